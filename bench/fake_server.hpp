@@ -0,0 +1,408 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_BENCH_FAKE_SERVER_HPP
+#define BOOST_MYSQL_BENCH_FAKE_SERVER_HPP
+
+// A minimal MySQL server, listening on loopback, that answers with canned responses.
+// Used to measure the client's own overhead, without a real database.
+// Supports the handshake (no TLS, any credentials are accepted), COM_QUERY,
+// COM_STMT_PREPARE, COM_STMT_EXECUTE, COM_STMT_CLOSE, COM_PING, COM_RESET_CONNECTION and COM_QUIT.
+// Queries starting with SET get an OK packet. Any other query or statement execution
+// gets the same canned resultset. Messages are composed using the library's serialization functions.
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/flags.hpp>
+
+#include <boost/mysql/impl/internal/protocol/basic_types.hpp>
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
+#include <boost/mysql/impl/internal/protocol/protocol_field_type.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/core/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace bench {
+
+struct fake_server_config
+{
+    // Number of rows in the canned resultset. Rows have a BIGINT and a VARCHAR column
+    std::size_t num_rows{1};
+
+    // Delay injected before writing each response
+    std::chrono::microseconds latency{0};
+};
+
+namespace fake_detail {
+
+// Command identifiers, as sent by the client
+constexpr std::uint8_t com_quit = 0x01;
+constexpr std::uint8_t com_query = 0x03;
+constexpr std::uint8_t com_ping = 0x0e;
+constexpr std::uint8_t com_stmt_prepare = 0x16;
+constexpr std::uint8_t com_stmt_execute = 0x17;
+constexpr std::uint8_t com_stmt_close = 0x19;
+constexpr std::uint8_t com_reset_connection = 0x1f;
+
+constexpr std::uint32_t server_capabilities = detail::mandatory_capabilities.get() |
+                                              detail::CLIENT_MULTI_RESULTS |
+                                              detail::CLIENT_PS_MULTI_RESULTS |
+                                              detail::CLIENT_CONNECT_WITH_DB;
+constexpr std::uint16_t status_autocommit = 2;  // SERVER_STATUS_AUTOCOMMIT
+constexpr std::uint16_t utf8mb4_collation = 45;
+constexpr std::uint16_t binary_collation = 63;
+constexpr const char* row_string_value = "A string value returned by the fake server";
+constexpr std::int64_t row_int_value = 42;
+
+// Appends a single-frame message containing the serialization of args
+template <class... Args>
+void append_message(std::vector<std::uint8_t>& to, std::uint8_t& seqnum, const Args&... args)
+{
+    std::size_t size = detail::get_size(args...);
+    std::size_t offset = to.size();
+    to.resize(offset + detail::frame_header_size + size);
+    detail::serialize_frame_header(
+        detail::frame_header{static_cast<std::uint32_t>(size), seqnum++},
+        span<std::uint8_t, detail::frame_header_size>(to.data() + offset, detail::frame_header_size)
+    );
+    detail::serialization_context ctx(to.data() + offset + detail::frame_header_size);
+    detail::serialize(ctx, args...);
+}
+
+inline void append_ok(std::vector<std::uint8_t>& to, std::uint8_t& seqnum, std::uint8_t header = 0x00)
+{
+    append_message(
+        to,
+        seqnum,
+        header,
+        detail::int_lenenc{0},  // affected rows
+        detail::int_lenenc{0},  // last insert ID
+        status_autocommit,
+        std::uint16_t(0)  // warnings
+    );
+}
+
+inline void append_coldef(
+    std::vector<std::uint8_t>& to,
+    std::uint8_t& seqnum,
+    string_view name,
+    detail::protocol_field_type type,
+    std::uint16_t collation_id,
+    std::uint16_t flags
+)
+{
+    append_message(
+        to,
+        seqnum,
+        detail::string_lenenc{"def"},
+        detail::string_lenenc{"fake_db"},
+        detail::string_lenenc{"fake_table"},
+        detail::string_lenenc{"fake_table"},
+        detail::string_lenenc{name},
+        detail::string_lenenc{name},
+        detail::int_lenenc{0x0c},  // length of the fixed fields
+        collation_id,
+        std::uint32_t(255),  // column length
+        type,
+        flags,
+        std::uint8_t(0),  // decimals
+        std::uint16_t(0)  // filler
+    );
+}
+
+inline void append_coldefs(std::vector<std::uint8_t>& to, std::uint8_t& seqnum)
+{
+    append_coldef(
+        to,
+        seqnum,
+        "id",
+        detail::protocol_field_type::longlong,
+        binary_collation,
+        static_cast<std::uint16_t>(detail::column_flags::not_null | detail::column_flags::pri_key)
+    );
+    append_coldef(to, seqnum, "name", detail::protocol_field_type::var_string, utf8mb4_collation, 0);
+}
+
+// A text or binary resultset with the configured number of rows
+inline std::vector<std::uint8_t> make_resultset(std::size_t num_rows, bool binary)
+{
+    std::vector<std::uint8_t> res;
+    std::uint8_t seqnum = 1;
+    append_message(res, seqnum, detail::int_lenenc{2});
+    append_coldefs(res, seqnum);
+    std::string int_str = std::to_string(row_int_value);
+    for (std::size_t i = 0; i < num_rows; ++i)
+    {
+        if (binary)
+        {
+            // Header, NULL bitmap (no NULLs) and values
+            append_message(
+                res,
+                seqnum,
+                std::uint8_t(0),
+                std::uint8_t(0),
+                row_int_value,
+                detail::string_lenenc{row_string_value}
+            );
+        }
+        else
+        {
+            append_message(
+                res,
+                seqnum,
+                detail::string_lenenc{int_str},
+                detail::string_lenenc{row_string_value}
+            );
+        }
+    }
+    append_ok(res, seqnum, 0xfe);
+    return res;
+}
+
+// Responses that don't depend on the request, computed once
+struct canned_responses
+{
+    std::vector<std::uint8_t> server_hello;
+    std::vector<std::uint8_t> login_ok;
+    std::vector<std::uint8_t> ok;
+    std::vector<std::uint8_t> text_resultset;
+    std::vector<std::uint8_t> binary_resultset;
+
+    canned_responses(std::size_t num_rows)
+        : text_resultset(make_resultset(num_rows, false)), binary_resultset(make_resultset(num_rows, true))
+    {
+        // Server hello, using mysql_native_password
+        std::uint8_t seqnum = 0;
+        std::array<char, 8> scramble1{{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'}};
+        std::array<char, 10> reserved{};
+        std::array<char, 13> scramble2{{'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 0}};
+        append_message(
+            server_hello,
+            seqnum,
+            std::uint8_t(10),  // protocol version
+            detail::string_null{"8.0.36-fake"},
+            std::uint32_t(1),  // connection ID
+            detail::string_fixed<8>{scramble1},
+            std::uint8_t(0),  // filler
+            std::uint16_t(server_capabilities & 0xffff),
+            std::uint8_t(utf8mb4_collation),
+            status_autocommit,
+            std::uint16_t(server_capabilities >> 16),
+            std::uint8_t(21),  // auth plugin data length
+            detail::string_fixed<10>{reserved},
+            detail::string_fixed<13>{scramble2},
+            detail::string_null{"mysql_native_password"}
+        );
+
+        // Response to the login request. Any credentials are accepted
+        seqnum = 2;
+        append_ok(login_ok, seqnum);
+
+        // Response to commands
+        seqnum = 1;
+        append_ok(ok, seqnum);
+    }
+};
+
+// Response to COM_STMT_PREPARE. Parameter count depends on the statement text
+inline void append_prepare_response(std::vector<std::uint8_t>& to, string_view stmt)
+{
+    auto num_params = static_cast<std::uint16_t>(std::count(stmt.begin(), stmt.end(), '?'));
+    std::uint8_t seqnum = 1;
+    append_message(
+        to,
+        seqnum,
+        std::uint8_t(0),
+        std::uint32_t(1),  // statement ID
+        std::uint16_t(2),  // number of columns
+        num_params,
+        std::uint8_t(0),  // reserved
+        std::uint16_t(0)  // warnings
+    );
+    for (std::uint16_t i = 0; i < num_params; ++i)
+        append_coldef(to, seqnum, "?", detail::protocol_field_type::var_string, binary_collation, 0);
+    append_coldefs(to, seqnum);
+}
+
+class session : public std::enable_shared_from_this<session>
+{
+    asio::ip::tcp::socket sock_;
+    asio::steady_timer timer_;
+    const fake_server_config& cfg_;
+    const canned_responses& responses_;
+    std::array<std::uint8_t, detail::frame_header_size> header_{};
+    std::vector<std::uint8_t> request_;
+    std::vector<std::uint8_t> dynamic_response_;
+    span<const std::uint8_t> response_;
+    asio::coroutine coro_;
+
+    struct handler
+    {
+        std::shared_ptr<session> self;
+        void operator()(error_code ec, std::size_t = 0) { self->resume(ec); }
+    };
+
+    handler make_handler() { return handler{shared_from_this()}; }
+
+    // Sets response_ according to the request. Returns false if the connection should be closed
+    bool process_request()
+    {
+        if (request_.empty())
+            return false;
+        string_view payload(reinterpret_cast<const char*>(request_.data() + 1), request_.size() - 1);
+        switch (request_[0])
+        {
+        case com_query:
+            if (payload.size() >= 3u && std::equal(payload.begin(), payload.begin() + 3, "SET"))
+                response_ = responses_.ok;
+            else
+                response_ = responses_.text_resultset;
+            return true;
+        case com_stmt_prepare:
+            dynamic_response_.clear();
+            append_prepare_response(dynamic_response_, payload);
+            response_ = dynamic_response_;
+            return true;
+        case com_stmt_execute: response_ = responses_.binary_resultset; return true;
+        case com_stmt_close: response_ = {}; return true;  // No response
+        case com_ping:
+        case com_reset_connection: response_ = responses_.ok; return true;
+        case com_quit:
+        default: return false;
+        }
+    }
+
+public:
+    session(asio::ip::tcp::socket sock, const fake_server_config& cfg, const canned_responses& responses)
+        : sock_(std::move(sock)), timer_(sock_.get_executor()), cfg_(cfg), responses_(responses)
+    {
+    }
+
+    void resume(error_code ec = {})
+    {
+        // Any error (including the client closing the connection) terminates the session
+        if (ec)
+            return;
+
+        BOOST_ASIO_CORO_REENTER(coro_)
+        {
+            // Handshake. We don't check the login request's contents
+            BOOST_ASIO_CORO_YIELD
+            asio::async_write(sock_, asio::buffer(responses_.server_hello), make_handler());
+            BOOST_ASIO_CORO_YIELD
+            asio::async_read(sock_, asio::buffer(header_), make_handler());
+            request_.resize(detail::deserialize_frame_header(header_).size);
+            BOOST_ASIO_CORO_YIELD
+            asio::async_read(sock_, asio::buffer(request_), make_handler());
+            BOOST_ASIO_CORO_YIELD
+            asio::async_write(sock_, asio::buffer(responses_.login_ok), make_handler());
+
+            // Command phase. Requests are assumed to fit in a single frame
+            while (true)
+            {
+                BOOST_ASIO_CORO_YIELD
+                asio::async_read(sock_, asio::buffer(header_), make_handler());
+                request_.resize(detail::deserialize_frame_header(header_).size);
+                BOOST_ASIO_CORO_YIELD
+                asio::async_read(sock_, asio::buffer(request_), make_handler());
+
+                if (!process_request())
+                {
+                    sock_.close();
+                    return;
+                }
+
+                if (response_.empty())
+                    continue;
+
+                if (cfg_.latency.count() > 0)
+                {
+                    timer_.expires_after(cfg_.latency);
+                    BOOST_ASIO_CORO_YIELD timer_.async_wait(make_handler());
+                }
+
+                BOOST_ASIO_CORO_YIELD
+                asio::async_write(sock_, asio::buffer(response_.data(), response_.size()), make_handler());
+            }
+        }
+    }
+};
+
+}  // namespace fake_detail
+
+// Runs the server in a dedicated thread, so its cost isn't attributed to the client
+class fake_server
+{
+    fake_server_config cfg_;
+    fake_detail::canned_responses responses_;
+    asio::io_context ctx_;
+    asio::ip::tcp::acceptor acceptor_;
+    std::thread thread_;
+
+    void accept()
+    {
+        acceptor_.async_accept([this](error_code ec, asio::ip::tcp::socket sock) {
+            if (ec)
+                return;
+            sock.set_option(asio::ip::tcp::no_delay(true));
+            std::make_shared<fake_detail::session>(std::move(sock), cfg_, responses_)->resume();
+            accept();
+        });
+    }
+
+public:
+    // Listens on an ephemeral loopback port
+    fake_server(const fake_server_config& cfg)
+        : cfg_(cfg),
+          responses_(cfg.num_rows),
+          acceptor_(ctx_, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0))
+    {
+        accept();
+        thread_ = std::thread([this] { ctx_.run(); });
+    }
+
+    fake_server(const fake_server&) = delete;
+    fake_server& operator=(const fake_server&) = delete;
+
+    ~fake_server()
+    {
+        ctx_.stop();
+        thread_.join();
+    }
+
+    unsigned short port() const { return acceptor_.local_endpoint().port(); }
+};
+
+}  // namespace bench
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,365 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Drives any_connection and connection_pool against an in-process fake server
+// (see fake_server.hpp) at maximum rate, reporting throughput and latency percentiles.
+// Since the server answers with canned responses, this measures the client's own overhead.
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/connect_params.hpp>
+#include <boost/mysql/connection_pool.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/ssl_mode.hpp>
+#include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "fake_server.hpp"
+
+using boost::mysql::error_code;
+using std::chrono::steady_clock;
+namespace mysql = boost::mysql;
+namespace asio = boost::asio;
+
+namespace {
+
+static constexpr std::size_t num_parallel = 100;
+static constexpr std::size_t total = num_parallel * 1000;
+static constexpr const char* query = "SELECT id, name FROM fake_table WHERE id = 42";
+static constexpr const char* stmt_sql = "SELECT id, name FROM fake_table WHERE id = ?";
+
+class coordinator
+{
+    bool finished_{};
+    std::size_t remaining_queries_{total};
+    std::size_t outstanding_tasks_{num_parallel};
+    steady_clock::time_point tp_start_;
+    steady_clock::time_point tp_finish_;
+    std::vector<steady_clock::duration> latencies_;
+    mysql::connection_pool* pool_{};
+
+    double percentile_us(double p) const
+    {
+        std::size_t idx = static_cast<std::size_t>(p * static_cast<double>(latencies_.size() - 1));
+        return std::chrono::duration<double, std::micro>(latencies_[idx]).count();
+    }
+
+public:
+    coordinator(mysql::connection_pool* pool = nullptr) : pool_(pool) { latencies_.reserve(total); }
+    void record_start() { tp_start_ = steady_clock::now(); }
+    void record_latency(steady_clock::time_point op_start)
+    {
+        latencies_.push_back(steady_clock::now() - op_start);
+    }
+    void on_finish()
+    {
+        if (--outstanding_tasks_ == 0)
+        {
+            tp_finish_ = steady_clock::now();
+            if (pool_)
+                pool_->cancel();
+        }
+    }
+    bool on_loop_finish()
+    {
+        if (--remaining_queries_ == 0)
+            finished_ = true;
+        return !finished_;
+    }
+
+    bool check_ec(error_code ec, const mysql::diagnostics& diag)
+    {
+        if (ec)
+        {
+            finished_ = true;
+            std::cerr << ec << ", " << diag.server_message() << std::endl;
+        }
+        return !finished_;
+    }
+
+    // Prints qps and latency percentiles as CSV
+    void print_report()
+    {
+        if (latencies_.empty())
+            return;
+        std::sort(latencies_.begin(), latencies_.end());
+        double elapsed_s = std::chrono::duration<double>(tp_finish_ - tp_start_).count();
+        std::cout << "qps,p50_us,p90_us,p99_us,max_us\n"
+                  << static_cast<double>(latencies_.size()) / elapsed_s << ',' << percentile_us(0.5) << ','
+                  << percentile_us(0.9) << ',' << percentile_us(0.99) << ',' << percentile_us(1.0)
+                  << std::endl;
+    }
+};
+
+class task_nopool
+{
+    mysql::any_connection conn_;
+    mysql::results r_;
+    mysql::diagnostics diag_;
+    coordinator* coord_{};
+    const mysql::connect_params* params_;
+    bool use_stmt_;
+    mysql::statement stmt_;
+    steady_clock::time_point op_start_;
+    asio::coroutine coro_;
+
+public:
+    task_nopool(
+        asio::any_io_executor ex,
+        coordinator& coord,
+        const mysql::connect_params& params,
+        bool use_stmt
+    )
+        : conn_(ex), coord_(&coord), params_(&params), use_stmt_(use_stmt)
+    {
+    }
+
+    void resume(error_code ec = {})
+    {
+        // Error checking
+        if (!coord_->check_ec(ec, diag_))
+        {
+            coord_->on_finish();
+            return;
+        }
+
+        BOOST_ASIO_CORO_REENTER(coro_)
+        {
+            BOOST_ASIO_CORO_YIELD
+            conn_.async_connect(params_, diag_, [this](error_code ec) { resume(ec); });
+
+            if (use_stmt_)
+            {
+                BOOST_ASIO_CORO_YIELD
+                conn_.async_prepare_statement(stmt_sql, diag_, [this](error_code ec, mysql::statement s) {
+                    stmt_ = s;
+                    resume(ec);
+                });
+            }
+
+            while (true)
+            {
+                op_start_ = steady_clock::now();
+                if (use_stmt_)
+                {
+                    BOOST_ASIO_CORO_YIELD
+                    conn_.async_execute(stmt_.bind(42), r_, diag_, [this](error_code ec) { resume(ec); });
+                }
+                else
+                {
+                    BOOST_ASIO_CORO_YIELD
+                    conn_.async_execute(query, r_, diag_, [this](error_code ec) { resume(ec); });
+                }
+                coord_->record_latency(op_start_);
+
+                if (!coord_->on_loop_finish())
+                {
+                    coord_->on_finish();
+                    return;
+                }
+            }
+        }
+    }
+};
+
+class task_pool
+{
+    mysql::connection_pool* pool_;
+    mysql::results r_;
+    mysql::diagnostics diag_;
+    coordinator* coord_{};
+    bool use_stmt_;
+    mysql::pooled_connection conn_;
+    mysql::statement stmt_;
+    steady_clock::time_point op_start_;
+    asio::coroutine coro_;
+
+    void on_finish()
+    {
+        conn_ = mysql::pooled_connection();
+        coord_->on_finish();
+    }
+
+public:
+    task_pool(mysql::connection_pool& pool, coordinator& coord, bool use_stmt)
+        : pool_(&pool), coord_(&coord), use_stmt_(use_stmt)
+    {
+    }
+
+    void resume(error_code ec = {})
+    {
+        // Error checking
+        if (!coord_->check_ec(ec, diag_))
+        {
+            on_finish();
+            return;
+        }
+
+        BOOST_ASIO_CORO_REENTER(coro_)
+        {
+            while (true)
+            {
+                // Latency includes getting the connection from the pool
+                op_start_ = steady_clock::now();
+
+                BOOST_ASIO_CORO_YIELD
+                pool_->async_get_connection(diag_, [this](error_code ec, mysql::pooled_connection c) {
+                    conn_ = std::move(c);
+                    resume(ec);
+                });
+
+                if (use_stmt_)
+                {
+                    BOOST_ASIO_CORO_YIELD
+                    conn_->async_prepare_statement(
+                        stmt_sql,
+                        diag_,
+                        [this](error_code ec, mysql::statement s) {
+                            stmt_ = s;
+                            resume(ec);
+                        }
+                    );
+
+                    BOOST_ASIO_CORO_YIELD
+                    conn_->async_execute(stmt_.bind(42), r_, diag_, [this](error_code ec) { resume(ec); });
+                }
+                else
+                {
+                    BOOST_ASIO_CORO_YIELD
+                    conn_->async_execute(query, r_, diag_, [this](error_code ec) { resume(ec); });
+                }
+
+                conn_ = mysql::pooled_connection();
+                coord_->record_latency(op_start_);
+
+                if (!coord_->on_loop_finish())
+                {
+                    on_finish();
+                    return;
+                }
+            }
+        }
+    }
+};
+
+void run_nopool(unsigned short port, bool use_stmt)
+{
+    // Setup
+    asio::io_context ctx;
+    mysql::connect_params params;
+    params.server_address.emplace_host_and_port("127.0.0.1", port);
+    params.username = "fake_user";
+    params.password = "fake_password";
+    params.ssl = mysql::ssl_mode::disable;
+    std::vector<task_nopool> conns;
+    coordinator coord;
+
+    // Create connections
+    for (std::size_t i = 0; i < num_parallel; ++i)
+        conns.emplace_back(ctx.get_executor(), coord, params, use_stmt);
+
+    // Launch
+    coord.record_start();
+    for (auto& conn : conns)
+        conn.resume(error_code());
+
+    // Run
+    ctx.run();
+    coord.print_report();
+}
+
+void run_pool(unsigned short port, bool use_stmt)
+{
+    // Setup
+    asio::io_context ctx;
+    mysql::pool_params params;
+    params.server_address.emplace_host_and_port("127.0.0.1", port);
+    params.username = "fake_user";
+    params.password = "fake_password";
+    params.max_size = num_parallel;
+    params.ssl = mysql::ssl_mode::disable;
+
+    mysql::connection_pool pool(ctx, std::move(params));
+    pool.async_run(asio::detached);
+
+    std::vector<task_pool> conns;
+    coordinator coord(&pool);
+
+    // Create connections
+    for (std::size_t i = 0; i < num_parallel; ++i)
+        conns.emplace_back(pool, coord, use_stmt);
+
+    // Launch
+    coord.record_start();
+    for (auto& conn : conns)
+        conn.resume(error_code());
+
+    // Run
+    ctx.run();
+    coord.print_report();
+}
+
+static constexpr const char* options[] = {
+    "nopool-query",
+    "nopool-stmt",
+    "pool-query",
+    "pool-stmt",
+};
+
+void usage(const char* progname)
+{
+    std::cerr << "Usage: " << progname << " <benchmark-type> [num-rows] [server-latency-us]\n"
+              << "Available options:\n";
+    for (const char* opt : options)
+        std::cerr << "    " << opt << "\n";
+    exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4)
+    {
+        usage(argv[0]);
+    }
+
+    mysql::string_view opt = argv[1];
+    mysql::bench::fake_server_config cfg;
+    if (argc >= 3)
+        cfg.num_rows = std::stoul(argv[2]);
+    if (argc >= 4)
+        cfg.latency = std::chrono::microseconds(std::stoul(argv[3]));
+
+    mysql::bench::fake_server server(cfg);
+
+    if (opt == "nopool-query")
+        run_nopool(server.port(), false);
+    else if (opt == "nopool-stmt")
+        run_nopool(server.port(), true);
+    else if (opt == "pool-query")
+        run_pool(server.port(), false);
+    else if (opt == "pool-stmt")
+        run_pool(server.port(), true);
+    else
+        usage(argv[0]);
+}
@@ -0,0 +1,554 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Micro-benchmarks for the sans-io layers. These don't require a server:
+// they operate on canned wire bytes. Usage: <program> [name-filter].
+// Output is CSV: benchmark name, number of iterations, nanoseconds per iteration.
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/escape_string.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/flags.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
+#include <boost/mysql/detail/row_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/constants.hpp>
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
+#include <boost/mysql/impl/internal/sansio/message_reader.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+#include <boost/mysql/detail/typing/pos_map.hpp>
+#include <boost/mysql/detail/typing/row_traits.hpp>
+#endif
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace mysql = boost::mysql;
+namespace detail = boost::mysql::detail;
+using mysql::column_type;
+using mysql::field_view;
+using mysql::string_view;
+using detail::resultset_encoding;
+using std::chrono::steady_clock;
+
+namespace {
+
+//
+// Benchmark runner
+//
+
+// Each benchmark is re-run doubling its iteration count until it takes at least this long
+constexpr std::chrono::milliseconds min_bench_time{200};
+constexpr std::size_t max_iterations = std::size_t(1) << 30;
+
+// Results are accumulated here, so the compiler can't optimize benchmarked code away
+volatile std::size_t sink = 0;
+
+// If set, only benchmarks containing this string in their name are run
+const char* name_filter = nullptr;
+
+template <class Fn>
+void run_benchmark(const char* name, Fn&& fn)
+{
+    if (name_filter && std::strstr(name, name_filter) == nullptr)
+        return;
+
+    std::size_t iters = 1;
+    while (true)
+    {
+        auto start = steady_clock::now();
+        for (std::size_t i = 0; i < iters; ++i)
+            fn();
+        auto elapsed = steady_clock::now() - start;
+
+        if (elapsed >= min_bench_time || iters >= max_iterations)
+        {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+            std::cout << name << ',' << iters << ',' << static_cast<double>(ns) / iters << std::endl;
+            return;
+        }
+        iters *= 2;
+    }
+}
+
+// Benchmarks shouldn't fail. If they do, the numbers are meaningless
+void check_ok(mysql::error_code ec, const char* what)
+{
+    if (ec)
+    {
+        std::cerr << what << ": " << ec << std::endl;
+        std::exit(1);
+    }
+}
+
+//
+// Wire bytes helpers
+//
+void append_int(std::vector<std::uint8_t>& to, std::uint64_t value, std::size_t num_bytes)
+{
+    for (std::size_t i = 0; i < num_bytes; ++i)
+        to.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+}
+
+void append_double(std::vector<std::uint8_t>& to, double value)
+{
+    std::uint64_t repr{};
+    std::memcpy(&repr, &value, sizeof(repr));
+    append_int(to, repr, 8);
+}
+
+// Only 1-byte lengths are required by the values in this file
+void append_lenenc_string(std::vector<std::uint8_t>& to, string_view value)
+{
+    BOOST_ASSERT(value.size() < 251u);
+    to.push_back(static_cast<std::uint8_t>(value.size()));
+    to.insert(to.end(), value.begin(), value.end());
+}
+
+// Splits a message body into frames, as the server would do
+void append_message(
+    std::vector<std::uint8_t>& to,
+    const std::vector<std::uint8_t>& body,
+    std::uint8_t& seqnum,
+    std::size_t max_frame_size
+)
+{
+    std::size_t offset = 0;
+    while (true)
+    {
+        std::size_t size = (std::min)(body.size() - offset, max_frame_size);
+        append_int(to, size, 3);
+        to.push_back(seqnum++);
+        to.insert(to.end(), body.begin() + offset, body.begin() + offset + size);
+        offset += size;
+
+        // A frame with max_frame_size bytes is always followed by another frame
+        if (size < max_frame_size)
+            break;
+    }
+}
+
+//
+// Message framing
+//
+void bench_message_reader(
+    const char* name,
+    std::size_t message_size,
+    std::size_t num_messages,
+    std::size_t max_frame_size
+)
+{
+    // Setup
+    std::vector<std::uint8_t> body(message_size, 0x42), wire;
+    std::uint8_t seqnum = 0;
+    for (std::size_t i = 0; i < num_messages; ++i)
+        append_message(wire, body, seqnum, max_frame_size);
+    detail::message_reader reader(wire.size(), max_frame_size);
+
+    run_benchmark(name, [&] {
+        // Place all messages in the buffer, as if a single read returned them
+        std::uint8_t read_seqnum = 0;
+        reader.reset();
+        reader.prepare_read(read_seqnum);
+        reader.prepare_buffer();
+        std::memcpy(reader.buffer().data(), wire.data(), wire.size());
+        reader.resume(wire.size());
+
+        // Parse them
+        for (std::size_t i = 0; i < num_messages; ++i)
+        {
+            if (i != 0)
+                reader.prepare_read(read_seqnum);
+            BOOST_ASSERT(reader.done());
+            check_ok(reader.error(), name);
+            sink = sink + reader.message().size();
+        }
+    });
+}
+
+//
+// Row deserialization
+//
+struct column_spec
+{
+    column_type type;
+    std::uint16_t flags;
+    std::uint16_t collation_id;
+    std::uint8_t decimals;
+    string_view text_value;
+    std::vector<std::uint8_t> binary_value;  // value as sent in the binary protocol
+};
+
+constexpr std::uint16_t binary_collation = 63;
+constexpr std::uint16_t utf8mb4_collation = 45;
+
+std::vector<std::uint8_t> binary_int(std::uint64_t value, std::size_t num_bytes)
+{
+    std::vector<std::uint8_t> res;
+    append_int(res, value, num_bytes);
+    return res;
+}
+
+std::vector<std::uint8_t> binary_double(double value)
+{
+    std::vector<std::uint8_t> res;
+    append_double(res, value);
+    return res;
+}
+
+std::vector<std::uint8_t> binary_string(string_view value)
+{
+    std::vector<std::uint8_t> res;
+    append_lenenc_string(res, value);
+    return res;
+}
+
+column_spec bigint_column()
+{
+    return {column_type::bigint, 0, binary_collation, 0, "123456789", binary_int(123456789, 8)};
+}
+
+column_spec int_unsigned_column()
+{
+    return {
+        column_type::int_,
+        detail::column_flags::unsigned_,
+        binary_collation,
+        0,
+        "4000000",
+        binary_int(4000000, 4)
+    };
+}
+
+column_spec double_column()
+{
+    return {column_type::double_, 0, binary_collation, 31, "3.14159", binary_double(3.14159)};
+}
+
+column_spec varchar_column()
+{
+    string_view value = "A varchar value of moderate length";
+    return {column_type::varchar, 0, utf8mb4_collation, 0, value, binary_string(value)};
+}
+
+column_spec decimal_column()
+{
+    return {column_type::decimal, 0, binary_collation, 2, "12345.67", binary_string("12345.67")};
+}
+
+column_spec datetime_column()
+{
+    // length, year (2 bytes), month, day, hour, minute, second
+    return {
+        column_type::datetime,
+        0,
+        binary_collation,
+        0,
+        "2023-10-12 10:20:30",
+        {0x07, 0xe7, 0x07, 10, 12, 10, 20, 30}
+    };
+}
+
+column_spec date_column()
+{
+    return {column_type::date, 0, binary_collation, 0, "2023-10-12", {0x04, 0xe7, 0x07, 10, 12}};
+}
+
+class row_fixture
+{
+    std::vector<mysql::metadata> meta_;
+    std::vector<std::uint8_t> text_row_;
+    std::vector<std::uint8_t> binary_row_;
+
+public:
+    row_fixture(const std::vector<column_spec>& cols)
+    {
+        // Metadata
+        for (const auto& col : cols)
+        {
+            detail::coldef_view coldef{};
+            coldef.database = "db";
+            coldef.table = "table";
+            coldef.org_table = "table";
+            coldef.name = "column";
+            coldef.org_name = "column";
+            coldef.collation_id = col.collation_id;
+            coldef.column_length = 255;
+            coldef.type = col.type;
+            coldef.flags = col.flags;
+            coldef.decimals = col.decimals;
+            meta_.push_back(detail::access::construct<mysql::metadata>(coldef, true));
+        }
+
+        // Text row: a length-encoded string per field
+        for (const auto& col : cols)
+            append_lenenc_string(text_row_, col.text_value);
+
+        // Binary row: header, NULL bitmap (no NULLs) and values
+        binary_row_.push_back(0x00);
+        binary_row_.resize(binary_row_.size() + (cols.size() + 7 + 2) / 8, 0x00);
+        for (const auto& col : cols)
+            binary_row_.insert(binary_row_.end(), col.binary_value.begin(), col.binary_value.end());
+    }
+
+    mysql::metadata_collection_view meta() const noexcept
+    {
+        return mysql::metadata_collection_view(meta_.data(), meta_.size());
+    }
+
+    boost::span<const std::uint8_t> row(resultset_encoding enc) const noexcept
+    {
+        return enc == resultset_encoding::text ? text_row_ : binary_row_;
+    }
+};
+
+std::vector<column_spec> repeat_column(column_spec col, std::size_t num_columns)
+{
+    return std::vector<column_spec>(num_columns, col);
+}
+
+std::vector<column_spec> mixed_columns()
+{
+    return {
+        bigint_column(),
+        varchar_column(),
+        int_unsigned_column(),
+        double_column(),
+        decimal_column(),
+        datetime_column(),
+        date_column(),
+        varchar_column(),
+    };
+}
+
+void bench_deserialize_row(
+    const char* name,
+    resultset_encoding enc,
+    const std::vector<column_spec>& cols,
+    bool use_plan
+)
+{
+    // Setup
+    row_fixture fix(cols);
+    std::vector<field_view> fields(cols.size());
+    detail::row_decoding_plan plan;
+    plan.compile(enc, fix.meta());
+    check_ok(detail::deserialize_row(enc, fix.row(enc), fix.meta(), fields), name);
+
+    if (use_plan)
+    {
+        run_benchmark(name, [&] {
+            auto ec = detail::deserialize_row(plan, fix.row(enc), fix.meta(), fields);
+            sink = sink + static_cast<std::size_t>(ec.value());
+        });
+    }
+    else
+    {
+        run_benchmark(name, [&] {
+            auto ec = detail::deserialize_row(enc, fix.row(enc), fix.meta(), fields);
+            sink = sink + static_cast<std::size_t>(ec.value());
+        });
+    }
+}
+
+//
+// Statement execution request serialization
+//
+void bench_execute_stmt_serialize()
+{
+    const mysql::datetime dt(2023, 10, 12, 10, 20, 30);
+    const mysql::date d(2023, 10, 12);
+    const std::array<field_view, 8> params{{
+        field_view(42),
+        field_view(std::uint64_t(0xffffffff)),
+        field_view("A string parameter"),
+        field_view(nullptr),
+        field_view(3.14159),
+        field_view(dt),
+        field_view(d),
+        field_view("Another, somewhat longer string parameter"),
+    }};
+    detail::execute_stmt_command cmd{1, params};
+    std::vector<std::uint8_t> buff;
+
+    run_benchmark("execute_stmt_serialize", [&] {
+        buff.resize(cmd.get_size());
+        cmd.serialize(buff);
+        sink = sink + buff.size();
+    });
+}
+
+//
+// escape_string
+//
+void bench_escape_string(const char* name, string_view input)
+{
+    std::string output;
+    run_benchmark(name, [&] {
+        output.clear();
+        auto ec = mysql::escape_string(
+            input,
+            mysql::utf8mb4_charset,
+            true,
+            mysql::quoting_context::single_quote,
+            output
+        );
+        check_ok(ec, name);
+        sink = sink + output.size();
+    });
+}
+
+//
+// row_impl string copying, as done when reading rows into a results object
+//
+void bench_copy_strings_as_offsets()
+{
+    std::vector<field_view> batch;
+    for (std::size_t i = 0; i < 32; ++i)
+    {
+        batch.emplace_back(static_cast<std::int64_t>(i));
+        batch.emplace_back("A varchar value of moderate length");
+        batch.emplace_back(nullptr);
+        batch.emplace_back("Short");
+    }
+    detail::row_impl r;
+
+    run_benchmark("row_impl_copy_strings_as_offsets", [&] {
+        r.clear();
+        auto storage = r.add_fields(batch.size());
+        std::copy(batch.begin(), batch.end(), storage.begin());
+        r.copy_strings_as_offsets(0, batch.size());
+        r.offsets_to_string_views();
+        sink = sink + r.fields().size();
+    });
+}
+
+//
+// Static row parsing (C++14 only)
+//
+#ifdef BOOST_MYSQL_CXX14
+void bench_static_row_parse()
+{
+    using row_t = std::
+        tuple<std::int64_t, std::string, std::uint32_t, double, mysql::datetime, std::string>;
+    constexpr std::size_t num_columns = std::tuple_size<row_t>::value;
+
+    row_fixture fix({
+        bigint_column(),
+        varchar_column(),
+        int_unsigned_column(),
+        double_column(),
+        datetime_column(),
+        varchar_column(),
+    });
+    const auto enc = resultset_encoding::text;
+    std::vector<field_view> fields(num_columns);
+    check_ok(detail::deserialize_row(enc, fix.row(enc), fix.meta(), fields), "static_row_parse");
+
+    // Compute the position map, as static_results does
+    std::array<std::size_t, num_columns> pos_map{};
+    auto name_table = detail::get_row_name_table<row_t>();
+    detail::pos_map_reset(pos_map);
+    for (std::size_t i = 0; i < num_columns; ++i)
+        detail::pos_map_add_field(pos_map, name_table, i, fix.meta()[i].column_name());
+    mysql::diagnostics diag;
+    check_ok(detail::meta_check<row_t>(pos_map, fix.meta(), diag), "static_row_parse");
+
+    row_t row;
+    run_benchmark("static_row_parse", [&] {
+        auto ec = detail::parse(pos_map, fields, row);
+        sink = sink + static_cast<std::size_t>(ec.value());
+    });
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " [name-filter]\n";
+        return 1;
+    }
+    if (argc == 2)
+        name_filter = argv[1];
+
+    std::cout << "benchmark,iterations,ns_per_iteration\n";
+
+    // Framing. The multi-frame cases use a small max frame size to keep buffers small
+    bench_message_reader("message_reader_small", 64, 256, detail::MAX_PACKET_SIZE);
+    bench_message_reader("message_reader_large", 64 * 1024, 4, detail::MAX_PACKET_SIZE);
+    bench_message_reader("message_reader_multiframe", 4 * 1024, 16, 256);
+
+    // Row deserialization, per column type
+    const auto text = resultset_encoding::text;
+    const auto binary = resultset_encoding::binary;
+    struct
+    {
+        const char* name;
+        resultset_encoding enc;
+        std::vector<column_spec> cols;
+        bool use_plan;
+    } row_benchs[] = {
+        // clang-format off
+        {"deserialize_row_text_bigint",       text,   repeat_column(bigint_column(), 10),   false},
+        {"deserialize_row_text_double",       text,   repeat_column(double_column(), 10),   false},
+        {"deserialize_row_text_varchar",      text,   repeat_column(varchar_column(), 10),  false},
+        {"deserialize_row_text_decimal",      text,   repeat_column(decimal_column(), 10),  false},
+        {"deserialize_row_text_datetime",     text,   repeat_column(datetime_column(), 10), false},
+        {"deserialize_row_text_mixed",        text,   mixed_columns(),                      false},
+        {"deserialize_row_text_mixed_plan",   text,   mixed_columns(),                      true },
+        {"deserialize_row_binary_bigint",     binary, repeat_column(bigint_column(), 10),   false},
+        {"deserialize_row_binary_double",     binary, repeat_column(double_column(), 10),   false},
+        {"deserialize_row_binary_varchar",    binary, repeat_column(varchar_column(), 10),  false},
+        {"deserialize_row_binary_decimal",    binary, repeat_column(decimal_column(), 10),  false},
+        {"deserialize_row_binary_datetime",   binary, repeat_column(datetime_column(), 10), false},
+        {"deserialize_row_binary_mixed",      binary, mixed_columns(),                      false},
+        {"deserialize_row_binary_mixed_plan", binary, mixed_columns(),                      true },
+        // clang-format on
+    };
+    for (const auto& b : row_benchs)
+        bench_deserialize_row(b.name, b.enc, b.cols, b.use_plan);
+
+    // Serialization and escaping
+    bench_execute_stmt_serialize();
+    bench_escape_string("escape_string_clean", "A string without any character that requires escaping");
+    bench_escape_string("escape_string_quotes", "It's a 'quoted' string with \\ and \"double quotes\"");
+
+    // Containers and static interface
+    bench_copy_strings_as_offsets();
+#ifdef BOOST_MYSQL_CXX14
+    bench_static_row_parse();
+#endif
+}
@@ -55,8 +55,23 @@ function(boost_mysql_common_target_settings TARGET_NAME)
         target_compile_options(${TARGET_NAME} PUBLIC --coverage)
         target_link_options(${TARGET_NAME} PUBLIC --coverage)
     endif()
+
+    # io_uring. All translation units must agree on the backend, so this is PUBLIC
+    if(BOOST_MYSQL_IO_URING)
+        target_compile_definitions(${TARGET_NAME} PUBLIC BOOST_ASIO_HAS_IO_URING BOOST_ASIO_DISABLE_EPOLL)
+        target_link_libraries(${TARGET_NAME} PUBLIC ${URING_LIBRARY})
+    endif()
 endfunction()
 
+# io_uring stuff
+if(BOOST_MYSQL_IO_URING)
+    find_library(URING_LIBRARY uring)
+
+    if(NOT URING_LIBRARY)
+        message(FATAL_ERROR "Cannot locate liburing")
+    endif()
+endif()
+
 # Valgrind stuff
 if(BOOST_MYSQL_VALGRIND_TESTS)
     # Locate executable
@@ -13,7 +13,11 @@
 
 #include <boost/mysql/detail/access.hpp>
 
+#include <boost/assert.hpp>
+
+#include <algorithm>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -69,6 +73,29 @@ struct unix_path
     std::string path;
 };
 
+/**
+ * \brief (EXPERIMENTAL) Determines the order in which the hosts in an \ref any_address are tried.
+ * \details
+ * Only relevant for addresses containing more than one host, as created by
+ * \ref any_address::emplace_host_list.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+enum class host_selection_policy
+{
+    /// Hosts are always tried in the order they were specified. This is the default.
+    ordered,
+
+    /// Hosts are tried starting by a randomly selected one.
+    random,
+
+    /// Successive connection establishments start at successive hosts. The position is shared
+    /// by all connections in the program, so connections in a pool are spread across hosts.
+    round_robin,
+};
+
 /**
  * \brief (EXPERIMENTAL) A server address, identifying how to physically connect to a MySQL server.
  * \details
@@ -88,11 +115,18 @@ class any_address
         address_type type;
         std::string address;
         unsigned short port;
+        std::vector<host_and_port> fallback_hosts;
+        host_selection_policy policy;
     } impl_;
 
     any_address(address_type t, std::string&& addr, unsigned short port) noexcept
-        : impl_{t, std::move(addr), port}
+        : impl_{t, std::move(addr), port, {}, host_selection_policy::ordered}
+    {
+    }
+
+    static bool hosts_equal(const host_and_port& lhs, const host_and_port& rhs) noexcept
     {
+        return lhs.host == rhs.host && lhs.port == rhs.port;
     }
     friend struct detail::access;
 #endif
@@ -157,7 +191,7 @@ public:
      * No-throw guarantee.
      */
     any_address(host_and_port value) noexcept
-        : impl_{address_type::host_and_port, std::move(value.host), value.port}
+        : any_address(address_type::host_and_port, std::move(value.host), value.port)
     {
     }
 
@@ -172,7 +206,7 @@ public:
      * \par Exception safety
      * No-throw guarantee.
      */
-    any_address(unix_path value) noexcept : impl_{address_type::unix_path, std::move(value.path), 0} {}
+    any_address(unix_path value) noexcept : any_address(address_type::unix_path, std::move(value.path), 0) {}
 
     /**
      * \brief Retrieves the type of address that this object contains.
@@ -213,6 +247,39 @@ public:
         return impl_.port;
     }
 
+    /**
+     * \brief Retrieves the hosts to try if connecting to the primary host fails.
+     * \details
+     * The primary host is the one returned by \ref hostname and \ref port.
+     * Returns an empty collection if `*this` contains a single host.
+     *
+     * \par Preconditions
+     * `this->type() == address_type::host_and_port`
+     *
+     * \par Object lifetimes
+     * The returned reference points into `*this`, and is valid as long as `*this`
+     * is alive and hasn't been assigned to or moved from.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    const std::vector<host_and_port>& fallback_hosts() const noexcept
+    {
+        BOOST_ASSERT(type() == address_type::host_and_port);
+        return impl_.fallback_hosts;
+    }
+
+    /**
+     * \brief Retrieves the policy used to select which host to try first.
+     * \details
+     * Returns \ref host_selection_policy::ordered unless the address was
+     * created using \ref emplace_host_list.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    host_selection_policy selection_policy() const noexcept { return impl_.policy; }
+
     /**
      * \brief Retrieves the UNIX socket path that this object contains.
      * \par Preconditions
@@ -253,6 +320,41 @@ public:
         impl_.type = address_type::host_and_port;
         impl_.address = std::move(hostname);
         impl_.port = port;
+        impl_.fallback_hosts.clear();
+        impl_.policy = host_selection_policy::ordered;
+    }
+
+    /**
+     * \brief Replaces the current object with a list of hosts and ports.
+     * \details
+     * The first element in `hosts` becomes the primary host, and is returned by
+     * \ref hostname and \ref port. The rest of the elements are returned by \ref fallback_hosts.
+     * \n
+     * When connecting, hosts are tried one after another until a physical connection
+     * is established. `policy` determines which host is tried first.
+     * \n
+     * The constructed object has `this->type() == address_type::host_and_port`.
+     *
+     * \par Preconditions
+     * `!hosts.empty()`
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations may throw.
+     * \par Object lifetimes
+     * Invalidates views pointing into `*this`.
+     */
+    void emplace_host_list(
+        std::vector<host_and_port> hosts,
+        host_selection_policy policy = host_selection_policy::ordered
+    )
+    {
+        BOOST_ASSERT(!hosts.empty());
+        impl_.type = address_type::host_and_port;
+        impl_.address = std::move(hosts.front().host);
+        impl_.port = hosts.front().port;
+        hosts.erase(hosts.begin());
+        impl_.fallback_hosts = std::move(hosts);
+        impl_.policy = policy;
     }
 
     /**
@@ -275,18 +377,28 @@ public:
         impl_.type = address_type::unix_path;
         impl_.address = std::move(path);
         impl_.port = 0;
+        impl_.fallback_hosts.clear();
+        impl_.policy = host_selection_policy::ordered;
     }
 
     /**
      * \brief Tests for equality.
      * \details Two addresses are equal if they have the same type and individual components.
+     * For multi-host addresses, fallback hosts and selection policies are also compared.
      * \par Exception safety
      * No-throw guarantee.
      */
     bool operator==(const any_address& rhs) const noexcept
     {
         return impl_.type == rhs.impl_.type && impl_.address == rhs.impl_.address &&
-               impl_.port == rhs.impl_.port;
+               impl_.port == rhs.impl_.port && impl_.policy == rhs.impl_.policy &&
+               impl_.fallback_hosts.size() == rhs.impl_.fallback_hosts.size() &&
+               std::equal(
+                   impl_.fallback_hosts.begin(),
+                   impl_.fallback_hosts.end(),
+                   rhs.impl_.fallback_hosts.begin(),
+                   &hosts_equal
+               );
     }
 
     /**
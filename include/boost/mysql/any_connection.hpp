@@ -8,17 +8,24 @@
 #ifndef BOOST_MYSQL_ANY_CONNECTION_HPP
 #define BOOST_MYSQL_ANY_CONNECTION_HPP
 
+#include <boost/mysql/binlog.hpp>
 #include <boost/mysql/connect_params.hpp>
+#include <boost/mysql/connection_observer.hpp>
 #include <boost/mysql/defaults.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/execution_state.hpp>
 #include <boost/mysql/handshake_params.hpp>
+#include <boost/mysql/lazy_row_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
+#include <boost/mysql/resolver_cache.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
+#include <boost/mysql/tls_session_cache.hpp>
+#include <boost/mysql/wire_capture.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/algo_params.hpp>
@@ -36,10 +43,12 @@
 #include <boost/assert.hpp>
 #include <boost/variant2/variant.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -84,6 +93,131 @@ struct any_connection_params
      * returned by \ref any_connection::read_some_rows.
      */
     std::size_t initial_read_buffer_size{default_initial_read_buffer_size};
+
+    /**
+     * \brief Enables double-buffered row reads, setting the initial size of the secondary read buffer.
+     * \details
+     * By default, the rows returned by \ref any_connection::read_some_rows and
+     * \ref any_connection::async_read_some_rows point into the connection's read buffer,
+     * and are invalidated as soon as the next operation starts. This forces applications
+     * to process each batch of rows before requesting the next one.
+     * \n
+     * If this value is greater than zero, the connection allocates a second read buffer
+     * of this initial size and alternates between both buffers on each `read_some_rows` call.
+     * The \ref rows_view returned by a `read_some_rows` operation then remains valid while the
+     * next `read_some_rows` operation runs, and until a third one is started. This allows
+     * processing a batch while the next one is being read. The size of the buffers bounds
+     * the amount of data read ahead on each call. Other operations invalidate rows as usual.
+     * \n
+     * Set to zero (the default) to disable double buffering.
+     */
+    std::size_t read_ahead_buffer_size{0};
+
+    /**
+     * \brief An external cache for hostname resolution results.
+     * \details
+     * If set to non-null, \ref any_connection::connect and \ref any_connection::async_connect
+     * will look up hostnames in this cache before issuing DNS queries, and will store
+     * the results of any query they perform. Several connections may share a single cache.
+     * \n
+     * If set to `nullptr` (the default), a DNS query is performed every time
+     * a TCP connection is established.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    resolver_cache* dns_cache{};
+
+    /**
+     * \brief The maximum time to spend trying to establish a physical connection to each host.
+     * \details
+     * When connecting to an address with several hosts (as created by \ref any_address::emplace_host_list),
+     * a host that fails to accept the connection within this time is considered failed, and the next
+     * host is tried. Only applies to \ref any_connection::async_connect. Hostname resolution
+     * is not subject to this timeout.
+     * \n
+     * Set to zero (the default) to disable it.
+     */
+    std::chrono::steady_clock::duration connect_attempt_timeout{};
+
+    /**
+     * \brief An external cache for TLS sessions.
+     * \details
+     * If set to non-null, TLS handshakes will offer the session last established with
+     * the same server, if any, allowing the server to perform an abbreviated handshake.
+     * Established sessions are stored in the cache. Several connections may share a single cache.
+     * \n
+     * If set to `nullptr` (the default), every TLS handshake is a full handshake.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    tls_session_cache* tls_sessions{};
+
+    /**
+     * \brief A capture where to record all the bytes exchanged with the server.
+     * \details
+     * If set to non-null, every completed stream operation performed by the connection
+     * is recorded into the capture. See \ref wire_capture for more info.
+     * \n
+     * If set to `nullptr` (the default), nothing is recorded.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    wire_capture* capture{};
+
+    /**
+     * \brief A previously recorded capture to serve instead of performing network I/O.
+     * \details
+     * If set to non-null, the connection doesn't communicate with any server.
+     * Instead, it reads the bytes recorded in the replay. See \ref wire_replay for more info.
+     * `ssl_context`, `dns_cache`, `connect_attempt_timeout`, `tls_sessions` and `capture` are ignored.
+     * \n
+     * If set to `nullptr` (the default), the connection uses the network, as usual.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    wire_replay* replay{};
+
+    /**
+     * \brief An observer to notify about the work performed by the connection.
+     * \details
+     * If set to non-null, the connection notifies the observer when operations start and finish,
+     * around network operations, and when rows are read. See \ref connection_observer for more info.
+     * Several connections may share a single observer.
+     * \n
+     * If set to `nullptr` (the default), no notifications are emitted.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    connection_observer* observer{};
+
+    /**
+     * \brief A decoder to split the decoding of large row batches between several threads.
+     * \details
+     * If set to non-null, rows read into \ref results, \ref static_results,
+     * \ref execution_state and \ref static_execution_state objects are decoded in batches,
+     * using the decoder's executor. Async operations hand large batches to the decoder's executor
+     * and resume in the connection's executor when decoding finishes, so the thread performing I/O
+     * doesn't block. Sync operations block the calling thread until the batch is decoded.
+     * See \ref parallel_row_decoder for more info.
+     * Several connections may share a single decoder.
+     * \n
+     * If set to `nullptr` (the default), rows are decoded one by one, in the thread reading them.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    parallel_row_decoder* row_decoder{};
 };
 
 /**
@@ -115,16 +249,24 @@ class any_connection
 {
     detail::connection_impl impl_;
 
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+
     BOOST_MYSQL_DECL
     static std::unique_ptr<detail::any_stream> create_stream(
         asio::any_io_executor ex,
-        asio::ssl::context* ctx
+        const any_connection_params& params
     );
 
     template <class CompletionToken>
     using async_connect_owning_t = detail::async_connect_t<
         detail::any_address_view,
-        decltype(asio::consign(std::declval<CompletionToken>(), std::unique_ptr<char[]>()))>;
+        decltype(asio::consign(
+            std::declval<CompletionToken>(),
+            std::unique_ptr<char[]>(),
+            std::vector<host_and_port>()
+        ))>;
 
 public:
     /**
@@ -137,7 +279,13 @@ public:
      * an \ref any_connection_params object to this constructor.
      */
     any_connection(boost::asio::any_io_executor ex, any_connection_params params = {})
-        : impl_(params.initial_read_buffer_size, create_stream(std::move(ex), params.ssl_context))
+        : impl_(
+              params.initial_read_buffer_size,
+              create_stream(std::move(ex), params),
+              params.read_ahead_buffer_size,
+              params.observer,
+              params.row_decoder
+          )
     {
     }
 
@@ -241,6 +389,31 @@ public:
      */
     bool backslash_escapes() const noexcept { return impl_.backslash_escapes(); }
 
+    /**
+     * \brief Returns whether the session state may have changed since the connection was established.
+     * \details
+     * Returns `true` if the connection's session may have been modified since the last successful
+     * \ref connect or \ref reset_connection. Session modifications include changes to system
+     * or user variables, the current schema, open transactions, temporary tables and prepared statements.
+     * Connection pools use this information to skip unnecessary session resets.
+     * \n
+     * If the server supports session state tracking (`CLIENT_SESSION_TRACK`), this information
+     * is computed using the session state changes reported by the server in OK packets.
+     * Note that servers only report changes to user variables and temporary tables if
+     * the `session_track_state_change` system variable is `ON`.
+     * If the server doesn't support session tracking, any SQL execution is considered a modification.
+     * Preparing a statement is always considered a modification.
+     * \n
+     * This function also returns `true` if an execution was started but not all of its
+     * results were read, or if it was interrupted by a network error.
+     * \n
+     * This function does not involve server communication.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool session_state_changed() const noexcept { return impl_.session_state_changed(); }
+
     /// \copydoc connection::meta_mode
     metadata_mode meta_mode() const noexcept { return impl_.meta_mode(); }
 
@@ -312,7 +485,11 @@ public:
             stable_prms.address,
             stable_prms.hparams,
             diag,
-            asio::consign(std::forward<CompletionToken>(token), std::move(stable_prms.string_buffer))
+            asio::consign(
+                std::forward<CompletionToken>(token),
+                std::move(stable_prms.string_buffer),
+                std::move(stable_prms.fallback_hosts)
+            )
         );
     }
 
@@ -584,45 +761,175 @@ public:
         );
     }
 
-#ifdef BOOST_MYSQL_CXX14
-
     /**
-     * \brief Reads a batch of rows.
+     * \brief Reads a batch of rows, invoking a function object for each of them.
      * \details
-     * Reads a batch of rows of unspecified size into the storage given by `output`.
-     * At most `output.size()` rows will be read. If the operation represented by `st`
-     * has still rows to read, and `output.size() > 0`, at least one row will be read.
+     * Reads a batch of rows of unspecified size, like \ref read_some_rows does. Instead of
+     * returning the batch as a \ref rows_view, `visitor` is invoked with a \ref row_view for each row,
+     * as soon as the row is parsed. Only a single row is stored in the connection at a time, so
+     * consumers that aggregate rows, rather than storing them, don't incur in any per-batch storage.
      * \n
-     * Returns the number of read rows.
+     * Returns the number of rows read. If there are no more rows, or `st.should_read_rows() == false`,
+     * this function is a no-op and returns zero.
      * \n
-     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
-     * zero.
-     * \n
-     * The number of rows that will be read depends on the input buffer size. The bigger the buffer,
-     * the greater the batch size (up to a maximum). You can set the initial buffer size in the
-     * constructor. The buffer may be grown bigger by other read operations, if required.
+     * `visitor` is invoked as `visitor(row_view)`. The passed \ref row_view points into the connection's
+     * internal buffers, and is only valid until `visitor` returns. `visitor` must not throw and must not
+     * call any function on this connection.
+     */
+    template <class Visitor>
+    std::size_t visit_some_rows(execution_state& st, Visitor&& visitor, error_code& err, diagnostics& diag)
+    {
+        return impl_.run(impl_.make_params_visit_some_rows(st, visitor, diag), err);
+    }
+
+    /// \copydoc visit_some_rows(execution_state&,Visitor&&,error_code&,diagnostics&)
+    template <class Visitor>
+    std::size_t visit_some_rows(execution_state& st, Visitor&& visitor)
+    {
+        error_code err;
+        diagnostics diag;
+        std::size_t res = visit_some_rows(st, visitor, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc visit_some_rows(execution_state&,Visitor&&,error_code&,diagnostics&)
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, std::size_t)`.
+     *
+     * \par Object lifetimes
+     * `visitor` is taken by reference, and must be kept alive until the operation completes.
+     */
+    template <
+        class Visitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    auto async_visit_some_rows(
+        execution_state& st,
+        Visitor& visitor,
+        CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_visit_some_rows_t<CompletionToken&&>)
+    {
+        return async_visit_some_rows(
+            st,
+            visitor,
+            impl_.shared_diag(),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_visit_some_rows(execution_state&,Visitor&,CompletionToken&&)
+    template <
+        class Visitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    auto async_visit_some_rows(
+        execution_state& st,
+        Visitor& visitor,
+        diagnostics& diag,
+        CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_visit_some_rows_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_visit_some_rows(st, visitor, diag),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * \brief (EXPERIMENTAL) Reads a batch of rows, invoking a function object for each of them,
+     *        without decoding their fields.
+     * \details
+     * Like \ref visit_some_rows, but `visitor` is invoked as `visitor(lazy_row_view)`.
+     * Each row is split into fields, but fields are only decoded when accessed through the
+     * \ref lazy_row_view. This saves the cost of decoding columns that are never used,
+     * as can happen with `SELECT *` queries over wide tables.
      * \n
-     * Rows read by this function are owning objects, and don't hold any reference to
-     * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
+     * Returns the number of rows read. If there are no more rows, or `st.should_read_rows() == false`,
+     * this function is a no-op and returns zero.
      * \n
-     * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
-     * The type must match the resultset that is currently being processed by `st`. For instance,
-     * given `static_execution_state<T1, T2>`, when reading rows for the second resultset, `SpanStaticRow`
-     * must exactly be `T2`. If this is not the case, a runtime error will be issued.
-     * \n
-     * This function can report schema mismatches.
+     * The passed \ref lazy_row_view, and the \ref field_view objects obtained from it, point into the
+     * connection's internal buffers, and are only valid until `visitor` returns.
+     * `visitor` must not throw and must not call any function on this connection. Errors caused by
+     * invalid field values are reported by \ref lazy_row_view::at, and don't cause this function to fail.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
      */
-    template <class SpanStaticRow, class... StaticRow>
-    std::size_t read_some_rows(
-        static_execution_state<StaticRow...>& st,
-        span<SpanStaticRow> output,
+    template <class Visitor>
+    std::size_t visit_some_rows_lazy(
+        execution_state& st,
+        Visitor&& visitor,
         error_code& err,
         diagnostics& diag
     )
     {
-        return impl_.run(impl_.make_params_read_some_rows(st, output, diag), err);
+        return impl_.run(impl_.make_params_visit_some_rows_lazy(st, visitor, diag), err);
+    }
+
+    /// \copydoc visit_some_rows_lazy(execution_state&,Visitor&&,error_code&,diagnostics&)
+    template <class Visitor>
+    std::size_t visit_some_rows_lazy(execution_state& st, Visitor&& visitor)
+    {
+        error_code err;
+        diagnostics diag;
+        std::size_t res = visit_some_rows_lazy(st, visitor, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc visit_some_rows_lazy(execution_state&,Visitor&&,error_code&,diagnostics&)
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, std::size_t)`.
+     *
+     * \par Object lifetimes
+     * `visitor` is taken by reference, and must be kept alive until the operation completes.
+     */
+    template <
+        class Visitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    auto async_visit_some_rows_lazy(
+        execution_state& st,
+        Visitor& visitor,
+        CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_visit_some_rows_t<CompletionToken&&>)
+    {
+        return async_visit_some_rows_lazy(
+            st,
+            visitor,
+            impl_.shared_diag(),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_visit_some_rows_lazy(execution_state&,Visitor&,CompletionToken&&)
+    template <
+        class Visitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    auto async_visit_some_rows_lazy(
+        execution_state& st,
+        Visitor& visitor,
+        diagnostics& diag,
+        CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_visit_some_rows_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_visit_some_rows_lazy(st, visitor, diag),
+            std::forward<CompletionToken>(token)
+        );
     }
 
+#ifdef BOOST_MYSQL_CXX14
+
     /**
      * \brief Reads a batch of rows.
      * \details
@@ -641,6 +948,8 @@ public:
      * \n
      * Rows read by this function are owning objects, and don't hold any reference to
      * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
+     * The exception are `string_view` and `blob_view` fields, which point into the connection's
+     * internal buffers and are valid until the connection performs any other operation.
      * \n
      * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
      * The type must match the resultset that is currently being processed by `st`. For instance,
@@ -650,6 +959,18 @@ public:
      * This function can report schema mismatches.
      */
     template <class SpanStaticRow, class... StaticRow>
+    std::size_t read_some_rows(
+        static_execution_state<StaticRow...>& st,
+        span<SpanStaticRow> output,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        return impl_.run(impl_.make_params_read_some_rows(st, output, diag), err);
+    }
+
+    /// \copydoc read_some_rows(static_execution_state<StaticRow...>&,span<SpanStaticRow>,error_code&,diagnostics&)
+    template <class SpanStaticRow, class... StaticRow>
     std::size_t read_some_rows(static_execution_state<StaticRow...>& st, span<SpanStaticRow> output)
     {
         error_code err;
@@ -660,30 +981,7 @@ public:
     }
 
     /**
-     * \brief Reads a batch of rows.
-     * \details
-     * Reads a batch of rows of unspecified size into the storage given by `output`.
-     * At most `output.size()` rows will be read. If the operation represented by `st`
-     * has still rows to read, and `output.size() > 0`, at least one row will be read.
-     * \n
-     * Returns the number of read rows.
-     * \n
-     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
-     * zero.
-     * \n
-     * The number of rows that will be read depends on the input buffer size. The bigger the buffer,
-     * the greater the batch size (up to a maximum). You can set the initial buffer size in the
-     * constructor. The buffer may be grown bigger by other read operations, if required.
-     * \n
-     * Rows read by this function are owning objects, and don't hold any reference to
-     * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
-     * \n
-     * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
-     * The type must match the resultset that is currently being processed by `st`. For instance,
-     * given `static_execution_state<T1, T2>`, when reading rows for the second resultset, `SpanStaticRow`
-     * must exactly be `T2`. If this is not the case, a runtime error will be issued.
-     * \n
-     * This function can report schema mismatches.
+     * \copydoc read_some_rows(static_execution_state<StaticRow...>&,span<SpanStaticRow>,error_code&,diagnostics&)
      *
      * \par Handler signature
      * The handler signature for this operation is
@@ -706,53 +1004,112 @@ public:
         return async_read_some_rows(st, output, impl_.shared_diag(), std::forward<CompletionToken>(token));
     }
 
+    /// \copydoc async_read_some_rows(static_execution_state<StaticRow...>&,span<SpanStaticRow>,CompletionToken&&)
+    template <
+        class SpanStaticRow,
+        class... StaticRow,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    auto async_read_some_rows(
+        static_execution_state<StaticRow...>& st,
+        span<SpanStaticRow> output,
+        diagnostics& diag,
+        CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
+    )
+    {
+        return impl_.async_run(
+            impl_.make_params_read_some_rows(st, output, diag),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
     /**
-     * \brief Reads a batch of rows.
+     * \brief Reads a batch of rows, invoking a function object for each of them.
      * \details
-     * Reads a batch of rows of unspecified size into the storage given by `output`.
-     * At most `output.size()` rows will be read. If the operation represented by `st`
-     * has still rows to read, and `output.size() > 0`, at least one row will be read.
-     * \n
-     * Returns the number of read rows.
-     * \n
-     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
-     * zero.
-     * \n
-     * The number of rows that will be read depends on the input buffer size. The bigger the buffer,
-     * the greater the batch size (up to a maximum). You can set the initial buffer size in the
-     * constructor. The buffer may be grown bigger by other read operations, if required.
+     * Reads a batch of rows of unspecified size, like \ref read_some_rows does. Instead of
+     * storing the batch in a span, each row is parsed into a `SpanStaticRow` object living in
+     * this function's stack frame, and `visitor` is invoked with it, as `visitor(row)`,
+     * where `row` is a non-const lvalue that `visitor` may move from. The object is destroyed
+     * after `visitor` returns.
      * \n
-     * Rows read by this function are owning objects, and don't hold any reference to
-     * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
+     * Returns the number of rows read. If there are no more rows, or `st.should_read_rows() == false`,
+     * this function is a no-op and returns zero.
      * \n
-     * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
-     * The type must match the resultset that is currently being processed by `st`. For instance,
-     * given `static_execution_state<T1, T2>`, when reading rows for the second resultset, `SpanStaticRow`
-     * must exactly be `T2`. If this is not the case, a runtime error will be issued.
+     * `SpanStaticRow` must be explicitly specified, and must be default-constructible.
+     * It must exactly be one of the types in the `StaticRow` parameter pack, following the
+     * same rules as \ref read_some_rows. `visitor` must not throw and must not call any function
+     * on this connection.
      * \n
      * This function can report schema mismatches.
+     */
+    template <class SpanStaticRow, class Visitor, class... StaticRow>
+    std::size_t visit_some_rows(
+        static_execution_state<StaticRow...>& st,
+        Visitor&& visitor,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        return impl_.run(impl_.make_params_visit_some_rows<SpanStaticRow>(st, visitor, diag), err);
+    }
+
+    /// \copydoc visit_some_rows(static_execution_state<StaticRow...>&,Visitor&&,error_code&,diagnostics&)
+    template <class SpanStaticRow, class Visitor, class... StaticRow>
+    std::size_t visit_some_rows(static_execution_state<StaticRow...>& st, Visitor&& visitor)
+    {
+        error_code err;
+        diagnostics diag;
+        std::size_t res = visit_some_rows<SpanStaticRow>(st, visitor, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc visit_some_rows(static_execution_state<StaticRow...>&,Visitor&&,error_code&,diagnostics&)
      *
      * \par Handler signature
      * The handler signature for this operation is
      * `void(boost::mysql::error_code, std::size_t)`.
      *
      * \par Object lifetimes
-     * The storage that `output` references must be kept alive until the operation completes.
+     * `visitor` is taken by reference, and must be kept alive until the operation completes.
      */
     template <
         class SpanStaticRow,
+        class Visitor,
         class... StaticRow,
         BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
             CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
-    auto async_read_some_rows(
+    auto async_visit_some_rows(
         static_execution_state<StaticRow...>& st,
-        span<SpanStaticRow> output,
+        Visitor& visitor,
+        CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
+    )
+    {
+        return async_visit_some_rows<SpanStaticRow>(
+            st,
+            visitor,
+            impl_.shared_diag(),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_visit_some_rows(static_execution_state<StaticRow...>&,Visitor&,CompletionToken&&)
+    template <
+        class SpanStaticRow,
+        class Visitor,
+        class... StaticRow,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    auto async_visit_some_rows(
+        static_execution_state<StaticRow...>& st,
+        Visitor& visitor,
         diagnostics& diag,
         CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type)
     )
     {
         return impl_.async_run(
-            impl_.make_params_read_some_rows(st, output, diag),
+            impl_.make_params_visit_some_rows<SpanStaticRow>(st, visitor, diag),
             std::forward<CompletionToken>(token)
         );
     }
@@ -859,6 +1216,133 @@ public:
         );
     }
 
+    /**
+     * \brief (EXPERIMENTAL) Requests the server to send its binary log.
+     * \details
+     * Registers this connection as a replica, with the ID specified by `params.server_id`,
+     * and requests the server to stream binary log events from the position specified
+     * by `params`. Events are then read one by one using \ref read_binlog_event.
+     * \n
+     * Events are only read when \ref read_binlog_event is called. If the application stops
+     * reading, the server will eventually block on TCP flow control, so a slow consumer doesn't
+     * accumulate events in memory.
+     * \n
+     * Once this operation succeeds, the connection can only be used to read events or to be closed.
+     * Calling any other operation results in undefined behavior. `st` is reset when the
+     * operation starts.
+     * \n
+     * The server must have binary logging enabled and be configured with `binlog_format=ROW`
+     * to get rows events. The user must have the `REPLICATION SLAVE` privilege.
+     *
+     * \par Object lifetimes
+     * `params` and `st` must be kept alive until the operation completes.
+     * `st` must be kept alive while events are being read.
+     */
+    void start_binlog_dump(
+        const binlog_dump_params& params,
+        binlog_state& st,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        impl_.run(impl_.make_params_start_binlog_dump(params, st, diag), err);
+    }
+
+    /// \copydoc start_binlog_dump(const binlog_dump_params&,binlog_state&,error_code&,diagnostics&)
+    void start_binlog_dump(const binlog_dump_params& params, binlog_state& st)
+    {
+        error_code err;
+        diagnostics diag;
+        start_binlog_dump(params, st, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc start_binlog_dump(const binlog_dump_params&,binlog_state&,error_code&,diagnostics&)
+     * \details
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     */
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code)) CompletionToken>
+    auto async_start_binlog_dump(const binlog_dump_params& params, binlog_state& st, CompletionToken&& token)
+        BOOST_MYSQL_RETURN_TYPE(detail::async_start_binlog_dump_t<CompletionToken&&>)
+    {
+        return async_start_binlog_dump(params, st, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_start_binlog_dump(const binlog_dump_params&,binlog_state&,CompletionToken&&)
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code)) CompletionToken>
+    auto async_start_binlog_dump(
+        const binlog_dump_params& params,
+        binlog_state& st,
+        diagnostics& diag,
+        CompletionToken&& token
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_start_binlog_dump_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_start_binlog_dump(params, st, diag),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * \brief (EXPERIMENTAL) Reads the next binary log event.
+     * \details
+     * Waits until the server sends an event, and returns it. `st` must have been passed
+     * to a successful \ref start_binlog_dump operation. If the server has finished the stream
+     * (`!st.dumping()`), returns an empty event without performing any I/O.
+     * \n
+     * The returned event and any views obtained from it point into the connection's
+     * internal buffers and `st`. They are valid until the next operation on this connection
+     * or `st`, whatever happens first.
+     * \n
+     * If the server signals an error, `st.dumping()` becomes `false`.
+     *
+     * \par Object lifetimes
+     * `st` must be kept alive until the operation completes.
+     */
+    binlog_event read_binlog_event(binlog_state& st, error_code& err, diagnostics& diag)
+    {
+        return impl_.run(impl_.make_params_read_binlog_event(st, diag), err);
+    }
+
+    /// \copydoc read_binlog_event(binlog_state&,error_code&,diagnostics&)
+    binlog_event read_binlog_event(binlog_state& st)
+    {
+        error_code err;
+        diagnostics diag;
+        binlog_event res = read_binlog_event(st, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc read_binlog_event(binlog_state&,error_code&,diagnostics&)
+     * \details
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, boost::mysql::binlog_event)`.
+     */
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::binlog_event))
+                  CompletionToken>
+    auto async_read_binlog_event(binlog_state& st, CompletionToken&& token)
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_binlog_event_t<CompletionToken&&>)
+    {
+        return async_read_binlog_event(st, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_read_binlog_event(binlog_state&,CompletionToken&&)
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::binlog_event))
+                  CompletionToken>
+    auto async_read_binlog_event(binlog_state& st, diagnostics& diag, CompletionToken&& token)
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_binlog_event_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_read_binlog_event(st, diag),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
     /**
      * \brief Cleanly closes the connection to the server.
      * \details
@@ -0,0 +1,626 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_BINLOG_HPP
+#define BOOST_MYSQL_BINLOG_HPP
+
+#include <boost/mysql/blob.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/row_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The type of a binary log event.
+ * \details
+ * The values match the ones used by the server. Events of types not listed here
+ * may be received, too.
+ */
+enum class binlog_event_type : std::uint8_t
+{
+    /// Not a known event type.
+    unknown = 0,
+
+    /// A statement, including `BEGIN`, `COMMIT` and DDL statements (`QUERY_EVENT`).
+    query = 2,
+
+    /// The server stopped (`STOP_EVENT`).
+    stop = 3,
+
+    /// The server switched to another binary log file (`ROTATE_EVENT`).
+    rotate = 4,
+
+    /// Describes the format of the events that follow (`FORMAT_DESCRIPTION_EVENT`).
+    format_description = 15,
+
+    /// A transaction was committed (`XID_EVENT`).
+    xid = 16,
+
+    /// Describes the table modified by the rows events that follow (`TABLE_MAP_EVENT`).
+    table_map = 19,
+
+    /// Rows were inserted, version 1 (`WRITE_ROWS_EVENT_V1`). Used by MariaDB.
+    write_rows_v1 = 23,
+
+    /// Rows were updated, version 1 (`UPDATE_ROWS_EVENT_V1`). Used by MariaDB.
+    update_rows_v1 = 24,
+
+    /// Rows were deleted, version 1 (`DELETE_ROWS_EVENT_V1`). Used by MariaDB.
+    delete_rows_v1 = 25,
+
+    /// Sent by the server when there are no events to keep the connection alive (`HEARTBEAT_EVENT`).
+    heartbeat = 27,
+
+    /// Rows were inserted (`WRITE_ROWS_EVENT`).
+    write_rows = 30,
+
+    /// Rows were updated (`UPDATE_ROWS_EVENT`).
+    update_rows = 31,
+
+    /// Rows were deleted (`DELETE_ROWS_EVENT`).
+    delete_rows = 32,
+
+    /// A transaction with a GTID starts (`GTID_LOG_EVENT`). MySQL only.
+    gtid = 33,
+
+    /// A transaction without a GTID starts (`ANONYMOUS_GTID_LOG_EVENT`). MySQL only.
+    anonymous_gtid = 34,
+
+    /// The GTIDs contained in previous binary log files (`PREVIOUS_GTIDS_LOG_EVENT`). MySQL only.
+    previous_gtids = 35,
+
+    /// A transaction with a GTID starts (`GTID_EVENT`). MariaDB only.
+    mariadb_gtid = 162,
+
+    /// The GTIDs contained in previous binary log files (`GTID_LIST_EVENT`). MariaDB only.
+    mariadb_gtid_list = 163,
+};
+
+/**
+ * \brief (EXPERIMENTAL) Parameters for \ref any_connection::async_start_binlog_dump.
+ * \details
+ * This is an owning type.
+ */
+struct binlog_dump_params
+{
+    /**
+     * \brief The server ID that this client will use to register as a replica.
+     * \details
+     * It must be non-zero and different from the IDs used by the server and any other replica.
+     */
+    std::uint32_t server_id{};
+
+    /**
+     * \brief The binary log file to start reading from.
+     * \details
+     * If empty, reading starts from the first binary log file available in the server.
+     */
+    std::string file_name;
+
+    /**
+     * \brief The position within \ref file_name to start reading from.
+     * \details
+     * Positions must point to the start of an event. Reading should start
+     * at a transaction boundary, since rows events can only be decoded if
+     * the table map events preceding them have been read.
+     * The default value (4) is the first event in a file.
+     */
+    std::uint64_t position{4};
+
+    /**
+     * \brief (MySQL only) A set of GTIDs that the client has already received.
+     * \details
+     * If not empty, the server will send all the transactions not contained in this set,
+     * using `COM_BINLOG_DUMP_GTID`. The set must use the binary encoding expected by this command:
+     * the number of source UUIDs (8 bytes), followed by each UUID (16 bytes), its number of
+     * intervals (8 bytes) and each interval's start and exclusive end (8 bytes each), with
+     * integers stored in little-endian order. \ref file_name and \ref position are usually left
+     * to their default values when using this option.
+     * \n
+     * MariaDB doesn't support this option. With MariaDB, set the `@slave_connect_state`
+     * session variable before starting the dump, instead.
+     */
+    blob gtid_set;
+
+    /**
+     * \brief Whether to stop when all the events in the binary log have been read.
+     * \details
+     * If `false` (the default), the server waits for new events when it reaches the end
+     * of the binary log, and \ref any_connection::async_read_binlog_event never finishes the stream.
+     * If `true`, the stream finishes when the end of the binary log is reached.
+     */
+    bool non_blocking{false};
+};
+
+/**
+ * \brief (EXPERIMENTAL) The contents of a \ref binlog_event_type::rotate event.
+ * \details
+ * This is a non-owning type. Strings point into the connection's internal buffers.
+ */
+struct binlog_rotate_event
+{
+    /// The position of the first event in the next file.
+    std::uint64_t position;
+
+    /// The name of the binary log file that the following events belong to.
+    string_view next_file;
+};
+
+/**
+ * \brief (EXPERIMENTAL) The contents of a \ref binlog_event_type::gtid,
+ *        \ref binlog_event_type::anonymous_gtid or \ref binlog_event_type::mariadb_gtid event.
+ */
+struct binlog_gtid_event
+{
+    /// (MySQL only) The UUID of the server where the transaction originated. All zeros for MariaDB.
+    std::array<std::uint8_t, 16> source_id;
+
+    /// (MariaDB only) The replication domain ID. Zero for MySQL.
+    std::uint32_t domain_id;
+
+    /// The transaction number, within its source (MySQL) or replication domain (MariaDB).
+    std::uint64_t sequence_number;
+};
+
+/**
+ * \brief (EXPERIMENTAL) The contents of a \ref binlog_event_type::query event.
+ * \details
+ * This is a non-owning type. Strings point into the connection's internal buffers.
+ */
+struct binlog_query_event
+{
+    /// The default database when the statement was run. May be empty.
+    string_view schema;
+
+    /// The SQL text of the statement.
+    string_view query;
+};
+
+/**
+ * \brief (EXPERIMENTAL) Describes a table modified by rows events.
+ * \details
+ * Obtained from \ref binlog_event_type::table_map events and \ref binlog_rows_event::table.
+ * This is a view type. It is valid until the server switches to another binary log file
+ * (as announced by a \ref binlog_event_type::rotate event) or the \ref binlog_state
+ * it was obtained from is destroyed or used to start another dump.
+ */
+class binlog_table_map
+{
+    const detail::binlog_table_data* impl_;
+
+    binlog_table_map(const detail::binlog_table_data* impl) noexcept : impl_(impl) {}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+
+public:
+    /// The ID that rows events use to refer to this table.
+    std::uint64_t table_id() const noexcept { return impl_->table_id; }
+
+    /// The database where the table lives.
+    string_view schema() const noexcept { return impl_->schema; }
+
+    /// The table name.
+    string_view table() const noexcept { return impl_->table; }
+
+    /// The number of columns in the table.
+    std::size_t size() const noexcept { return impl_->column_types.size(); }
+
+    /**
+     * \brief Returns the type of a column.
+     * \details
+     * The binary log doesn't distinguish between character and binary strings.
+     * `CHAR` and `BINARY` columns are reported as \ref column_type::char_, `VARCHAR` and
+     * `VARBINARY` as \ref column_type::varchar, and `TEXT` and `BLOB` as \ref column_type::blob.
+     *
+     * \par Preconditions
+     * `column < this->size()`
+     */
+    BOOST_MYSQL_DECL
+    column_type type(std::size_t column) const noexcept;
+
+    /**
+     * \brief Returns whether a column may be NULL.
+     * \par Preconditions
+     * `column < this->size()`
+     */
+    bool is_nullable(std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(column < size());
+        return impl_->column_flags[column] & detail::binlog_column_nullable;
+    }
+
+    /**
+     * \brief Returns whether a numeric column is `UNSIGNED`.
+     * \details
+     * Signedness is only available if the server sends it (MySQL 8.0.1 and later,
+     * with the default `binlog_row_metadata` setting). Otherwise, this function returns `false`.
+     *
+     * \par Preconditions
+     * `column < this->size()`
+     */
+    bool is_unsigned(std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(column < size());
+        return impl_->column_flags[column] & detail::binlog_column_unsigned;
+    }
+};
+
+/**
+ * \brief (EXPERIMENTAL) The contents of a rows event.
+ * \details
+ * Rows events contain one or more rows modified by a single statement. Each row contains
+ * a before image (the row contents before the modification, for updates and deletions),
+ * an after image (the contents after the modification, for insertions and updates), or both.
+ * \n
+ * Images contain a field per table column. Depending on the server's `binlog_row_image`
+ * setting, some columns may not be present in the images. These are reported as NULL
+ * (use \ref is_present_before and \ref is_present_after to distinguish them).
+ * \n
+ * Fields are decoded as follows:
+ * \li Integers are decoded as `std::int64_t`, unless they are known to be unsigned
+ *     (see \ref binlog_table_map::is_unsigned). `YEAR`, `BIT`, `ENUM` and `SET` values
+ *     are decoded as `std::uint64_t`. `ENUM` and `SET` values contain the index of the
+ *     enumerator and the bitmask of members, respectively.
+ * \li `DECIMAL` values are decoded as strings.
+ * \li `TIMESTAMP` values are decoded as UTC \ref datetime objects.
+ * \li `TEXT`, `BLOB`, `JSON` and `GEOMETRY` values are decoded as blobs. `JSON`
+ *     values use the server's internal binary format.
+ *
+ * This is a view type. Fields point into the connection's internal buffers and
+ * are valid until the next operation on the connection.
+ */
+class binlog_rows_event
+{
+    const detail::binlog_state_impl* impl_;
+
+    binlog_rows_event(const detail::binlog_state_impl* impl) noexcept : impl_(impl) {}
+
+    std::size_t num_columns() const noexcept { return impl_->num_columns(); }
+    std::size_t row_offset(std::size_t row) const noexcept
+    {
+        return row * num_columns() * (impl_->has_before_image + impl_->has_after_image);
+    }
+    static bool test_bit(span<const std::uint8_t> bitmap, std::size_t pos) noexcept
+    {
+        return bitmap[pos / 8u] & (1u << (pos % 8u));
+    }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+
+public:
+    /// The table that was modified.
+    binlog_table_map table() const noexcept
+    {
+        return detail::access::construct<binlog_table_map>(impl_->table);
+    }
+
+    /// The number of rows in the event.
+    std::size_t size() const noexcept { return impl_->num_rows; }
+
+    /// Whether rows contain a before image (true for updates and deletions).
+    bool has_before_image() const noexcept { return impl_->has_before_image; }
+
+    /// Whether rows contain an after image (true for insertions and updates).
+    bool has_after_image() const noexcept { return impl_->has_after_image; }
+
+    /**
+     * \brief Returns the contents of a row before the modification.
+     * \par Preconditions
+     * `row < this->size() && this->has_before_image()`
+     */
+    row_view before(std::size_t row) const noexcept
+    {
+        BOOST_ASSERT(row < size() && has_before_image());
+        return detail::access::construct<row_view>(impl_->fields.data() + row_offset(row), num_columns());
+    }
+
+    /**
+     * \brief Returns the contents of a row after the modification.
+     * \par Preconditions
+     * `row < this->size() && this->has_after_image()`
+     */
+    row_view after(std::size_t row) const noexcept
+    {
+        BOOST_ASSERT(row < size() && has_after_image());
+        std::size_t offset = row_offset(row) + (impl_->has_before_image ? num_columns() : 0u);
+        return detail::access::construct<row_view>(impl_->fields.data() + offset, num_columns());
+    }
+
+    /**
+     * \brief Returns whether a column is present in the before images.
+     * \par Preconditions
+     * `column < this->table().size() && this->has_before_image()`
+     */
+    bool is_present_before(std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(column < num_columns() && has_before_image());
+        return test_bit(impl_->present_before, column);
+    }
+
+    /**
+     * \brief Returns whether a column is present in the after images.
+     * \par Preconditions
+     * `column < this->table().size() && this->has_after_image()`
+     */
+    bool is_present_after(std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(column < num_columns() && has_after_image());
+        return test_bit(impl_->present_after, column);
+    }
+};
+
+/**
+ * \brief (EXPERIMENTAL) An event read from the binary log.
+ * \details
+ * Returned by \ref any_connection::async_read_binlog_event. Contains the event header
+ * and its decoded contents. Use \ref type to determine which of the `as_xxx` functions
+ * may be called.
+ * \n
+ * An empty event is returned once the server has sent all the events
+ * (only if \ref binlog_dump_params::non_blocking was set).
+ * \n
+ * This is a view type. It points into the \ref binlog_state passed to
+ * \ref any_connection::async_read_binlog_event and into the connection's internal buffers.
+ * It's valid until the next operation on the connection.
+ */
+class binlog_event
+{
+    const detail::binlog_state_impl* impl_{};
+
+    binlog_event(const detail::binlog_state_impl* impl) noexcept : impl_(impl) {}
+
+    bool is_rows_event() const noexcept
+    {
+        switch (type())
+        {
+        case binlog_event_type::write_rows_v1:
+        case binlog_event_type::update_rows_v1:
+        case binlog_event_type::delete_rows_v1:
+        case binlog_event_type::write_rows:
+        case binlog_event_type::update_rows:
+        case binlog_event_type::delete_rows: return true;
+        default: return false;
+        }
+    }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+
+public:
+    /**
+     * \brief Constructs an empty event.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    binlog_event() = default;
+
+    /// Returns whether this object doesn't contain an event.
+    bool empty() const noexcept { return impl_ == nullptr || !impl_->has_event; }
+
+    /**
+     * \brief The event type.
+     * \par Preconditions
+     * `!this->empty()`
+     */
+    binlog_event_type type() const noexcept
+    {
+        BOOST_ASSERT(!empty());
+        return static_cast<binlog_event_type>(impl_->header.type);
+    }
+
+    /**
+     * \brief The time when the event was written, as seconds since the UNIX epoch.
+     * \par Preconditions
+     * `!this->empty()`
+     */
+    std::uint32_t timestamp() const noexcept
+    {
+        BOOST_ASSERT(!empty());
+        return impl_->header.timestamp;
+    }
+
+    /**
+     * \brief The ID of the server where the event originated.
+     * \par Preconditions
+     * `!this->empty()`
+     */
+    std::uint32_t server_id() const noexcept
+    {
+        BOOST_ASSERT(!empty());
+        return impl_->header.server_id;
+    }
+
+    /**
+     * \brief The position of the next event, within the current binary log file.
+     * \details
+     * Zero for artificial events, which are generated by the server
+     * and are not part of any binary log file.
+     *
+     * \par Preconditions
+     * `!this->empty()`
+     */
+    std::uint32_t log_position() const noexcept
+    {
+        BOOST_ASSERT(!empty());
+        return impl_->header.log_pos;
+    }
+
+    /**
+     * \brief The event flags, as sent by the server.
+     * \par Preconditions
+     * `!this->empty()`
+     */
+    std::uint16_t flags() const noexcept
+    {
+        BOOST_ASSERT(!empty());
+        return impl_->header.flags;
+    }
+
+    /**
+     * \brief The raw event contents, without the header and the checksum.
+     * \details
+     * Can be used to decode event types not supported by this class.
+     *
+     * \par Preconditions
+     * `!this->empty()`
+     */
+    span<const std::uint8_t> data() const noexcept
+    {
+        BOOST_ASSERT(!empty());
+        return impl_->data;
+    }
+
+    /**
+     * \brief Returns the contents of a rotate event.
+     * \par Preconditions
+     * `this->type() == binlog_event_type::rotate`
+     */
+    binlog_rotate_event as_rotate() const noexcept
+    {
+        BOOST_ASSERT(type() == binlog_event_type::rotate);
+        return {impl_->rotate_position, impl_->rotate_file};
+    }
+
+    /**
+     * \brief Returns the contents of a GTID event.
+     * \par Preconditions
+     * `this->type()` is \ref binlog_event_type::gtid, \ref binlog_event_type::anonymous_gtid
+     * or \ref binlog_event_type::mariadb_gtid.
+     */
+    binlog_gtid_event as_gtid() const noexcept
+    {
+        BOOST_ASSERT(
+            type() == binlog_event_type::gtid || type() == binlog_event_type::anonymous_gtid ||
+            type() == binlog_event_type::mariadb_gtid
+        );
+        return {impl_->gtid_source_id, impl_->gtid_domain_id, impl_->gtid_sequence_number};
+    }
+
+    /**
+     * \brief Returns the contents of a query event.
+     * \par Preconditions
+     * `this->type() == binlog_event_type::query`
+     */
+    binlog_query_event as_query() const noexcept
+    {
+        BOOST_ASSERT(type() == binlog_event_type::query);
+        return {impl_->query_schema, impl_->query};
+    }
+
+    /**
+     * \brief Returns the transaction ID contained in an XID event.
+     * \par Preconditions
+     * `this->type() == binlog_event_type::xid`
+     */
+    std::uint64_t as_xid() const noexcept
+    {
+        BOOST_ASSERT(type() == binlog_event_type::xid);
+        return impl_->xid;
+    }
+
+    /**
+     * \brief Returns the table described by a table map event.
+     * \par Preconditions
+     * `this->type() == binlog_event_type::table_map`
+     */
+    binlog_table_map as_table_map() const noexcept
+    {
+        BOOST_ASSERT(type() == binlog_event_type::table_map);
+        return detail::access::construct<binlog_table_map>(impl_->table);
+    }
+
+    /**
+     * \brief Returns the contents of a rows event.
+     * \par Preconditions
+     * `this->type()` is one of the `write_rows`, `update_rows` or `delete_rows` types.
+     */
+    binlog_rows_event as_rows() const noexcept
+    {
+        BOOST_ASSERT(is_rows_event());
+        return detail::access::construct<binlog_rows_event>(impl_);
+    }
+};
+
+/**
+ * \brief (EXPERIMENTAL) Holds the state of a binary log dump.
+ * \details
+ * Pass an object of this type to \ref any_connection::async_start_binlog_dump, and then to
+ * \ref any_connection::async_read_binlog_event to read events. The object tracks the
+ * position of the next event, which can be persisted to resume reading after a disconnection,
+ * and stores the table definitions required to decode rows events.
+ */
+class binlog_state
+{
+    detail::binlog_state_impl impl_;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+
+public:
+    /**
+     * \brief Default constructor.
+     * \details
+     * The constructed object is not associated to any dump.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    binlog_state() = default;
+
+    /**
+     * \brief Returns whether the server is sending events.
+     * \details
+     * Becomes `true` when a dump is successfully started. Becomes `false` when the server
+     * finishes the stream, either because it has sent all events (if
+     * \ref binlog_dump_params::non_blocking was set) or because of an error.
+     */
+    bool dumping() const noexcept { return impl_.dumping; }
+
+    /**
+     * \brief Returns the binary log file containing the next event to be read.
+     * \details
+     * May be empty if the server hasn't sent any event yet.
+     */
+    string_view file_name() const noexcept { return impl_.file_name; }
+
+    /**
+     * \brief Returns the position of the next event to be read, within \ref file_name.
+     * \details
+     * This position, together with \ref file_name, can be used in \ref binlog_dump_params
+     * to resume reading. It's updated after every event that is part of a binary log file.
+     */
+    std::uint64_t position() const noexcept { return impl_.position; }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/binlog.ipp>
+#endif
+
+#endif
@@ -80,6 +80,10 @@ enum class client_errc : int
 
     /// (EXPERIMENTAL) An invalid byte sequence was found while trying to decode a string.
     invalid_encoding,
+
+    /// (EXPERIMENTAL) Getting a connection from a connection_pool failed because too many
+    /// requests were waiting for a connection. See pool_params::max_pending_requests.
+    pool_queue_full,
 };
 
 BOOST_MYSQL_DECL
@@ -1193,6 +1193,8 @@ public:
      * \n
      * Rows read by this function are owning objects, and don't hold any reference to
      * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
+     * The exception are `string_view` and `blob_view` fields, which point into the connection's
+     * internal buffers and are valid until the connection performs any other operation.
      * \n
      * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
      * The type must match the resultset that is currently being processed by `st`. For instance,
@@ -1212,33 +1214,7 @@ public:
         return impl_.run(impl_.make_params_read_some_rows(st, output, diag), err);
     }
 
-    /**
-     * \brief Reads a batch of rows.
-     * \details
-     * Reads a batch of rows of unspecified size into the storage given by `output`.
-     * At most `output.size()` rows will be read. If the operation represented by `st`
-     * has still rows to read, and `output.size() > 0`, at least one row will be read.
-     * \n
-     * Returns the number of read rows.
-     * \n
-     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
-     * zero.
-     * \n
-     * The number of rows that will be read depends on the input buffer size. The bigger the buffer,
-     * the greater the batch size (up to a maximum). You can set the initial buffer size in `connection`'s
-     * constructor, using \ref buffer_params::initial_read_size. The buffer may be
-     * grown bigger by other read operations, if required.
-     * \n
-     * Rows read by this function are owning objects, and don't hold any reference to
-     * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
-     * \n
-     * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
-     * The type must match the resultset that is currently being processed by `st`. For instance,
-     * given `static_execution_state<T1, T2>`, when reading rows for the second resultset, `SpanStaticRow`
-     * must exactly be `T2`. If this is not the case, a runtime error will be issued.
-     * \n
-     * This function can report schema mismatches.
-     */
+    /// \copydoc read_some_rows(static_execution_state<StaticRow...>&,span<SpanStaticRow>,error_code&,diagnostics&)
     template <class SpanStaticRow, class... StaticRow>
     std::size_t read_some_rows(static_execution_state<StaticRow...>& st, span<SpanStaticRow> output)
     {
@@ -1250,31 +1226,7 @@ public:
     }
 
     /**
-     * \brief Reads a batch of rows.
-     * \details
-     * Reads a batch of rows of unspecified size into the storage given by `output`.
-     * At most `output.size()` rows will be read. If the operation represented by `st`
-     * has still rows to read, and `output.size() > 0`, at least one row will be read.
-     * \n
-     * Returns the number of read rows.
-     * \n
-     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
-     * zero.
-     * \n
-     * The number of rows that will be read depends on the input buffer size. The bigger the buffer,
-     * the greater the batch size (up to a maximum). You can set the initial buffer size in `connection`'s
-     * constructor, using \ref buffer_params::initial_read_size. The buffer may be
-     * grown bigger by other read operations, if required.
-     * \n
-     * Rows read by this function are owning objects, and don't hold any reference to
-     * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
-     * \n
-     * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
-     * The type must match the resultset that is currently being processed by `st`. For instance,
-     * given `static_execution_state<T1, T2>`, when reading rows for the second resultset, `SpanStaticRow`
-     * must exactly be `T2`. If this is not the case, a runtime error will be issued.
-     * \n
-     * This function can report schema mismatches.
+     * \copydoc read_some_rows(static_execution_state<StaticRow...>&,span<SpanStaticRow>,error_code&,diagnostics&)
      *
      * \par Handler signature
      * The handler signature for this operation is
@@ -1298,40 +1250,7 @@ public:
         return async_read_some_rows(st, output, impl_.shared_diag(), std::forward<CompletionToken>(token));
     }
 
-    /**
-     * \brief Reads a batch of rows.
-     * \details
-     * Reads a batch of rows of unspecified size into the storage given by `output`.
-     * At most `output.size()` rows will be read. If the operation represented by `st`
-     * has still rows to read, and `output.size() > 0`, at least one row will be read.
-     * \n
-     * Returns the number of read rows.
-     * \n
-     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
-     * zero.
-     * \n
-     * The number of rows that will be read depends on the input buffer size. The bigger the buffer,
-     * the greater the batch size (up to a maximum). You can set the initial buffer size in `connection`'s
-     * constructor, using \ref buffer_params::initial_read_size. The buffer may be
-     * grown bigger by other read operations, if required.
-     * \n
-     * Rows read by this function are owning objects, and don't hold any reference to
-     * the connection's internal buffers (contrary what happens with the dynamic interface's counterpart).
-     * \n
-     * `SpanStaticRow` must exactly be one of the types in the `StaticRow` parameter pack.
-     * The type must match the resultset that is currently being processed by `st`. For instance,
-     * given `static_execution_state<T1, T2>`, when reading rows for the second resultset, `SpanStaticRow`
-     * must exactly be `T2`. If this is not the case, a runtime error will be issued.
-     * \n
-     * This function can report schema mismatches.
-     *
-     * \par Handler signature
-     * The handler signature for this operation is
-     * `void(boost::mysql::error_code, std::size_t)`.
-     *
-     * \par Object lifetimes
-     * The storage that `output` references must be kept alive until the operation completes.
-     */
+    /// \copydoc async_read_some_rows(static_execution_state<StaticRow...>&,span<SpanStaticRow>,CompletionToken&&)
     template <
         class SpanStaticRow,
         class... StaticRow,
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_CONNECTION_OBSERVER_HPP
+#define BOOST_MYSQL_CONNECTION_OBSERVER_HPP
+
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <cstddef>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The type of a high-level operation run by a connection.
+ * \details
+ * Operations are reported by \ref connection_observer::on_operation_start and
+ * \ref connection_observer::on_operation_finish.
+ */
+enum class operation_type
+{
+    /// Establishing a physical connection and performing the handshake (e.g. `async_connect`).
+    connect,
+
+    /// Performing the handshake over an already established physical connection (`async_handshake`).
+    handshake,
+
+    /// Running a text query or a statement, reading all the results (e.g. `async_execute`).
+    execute,
+
+    /// Starting a multi-function operation (e.g. `async_start_execution`).
+    start_execution,
+
+    /// Reading the head of a resultset in a multi-function operation (e.g. `async_read_resultset_head`).
+    read_resultset_head,
+
+    /// Reading a batch of rows in a multi-function operation (e.g. `async_read_some_rows`).
+    read_some_rows,
+
+    /// Preparing a statement (e.g. `async_prepare_statement`).
+    prepare_statement,
+
+    /// Closing a statement (e.g. `async_close_statement`).
+    close_statement,
+
+    /// Pinging the server (e.g. `async_ping`).
+    ping,
+
+    /// Resetting the session (e.g. `async_reset_connection`).
+    reset_connection,
+
+    /// Notifying the server that the session is ending (e.g. `async_quit`).
+    quit,
+
+    /// Closing the session and the physical connection (e.g. `async_close`).
+    close,
+
+    /// Running several requests written back-to-back (e.g. by \ref multiplexed_connection).
+    run_pipeline,
+
+    /// Requesting the binary log (e.g. `async_start_binlog_dump`).
+    start_binlog_dump,
+
+    /// Reading an event from the binary log (e.g. `async_read_binlog_event`).
+    read_binlog_event,
+};
+
+/**
+ * \brief (EXPERIMENTAL) Receives notifications about the work performed by a connection.
+ * \details
+ * When a connection is configured with an observer (see \ref any_connection_params::observer),
+ * it invokes the observer's member functions when operations start and finish, around every
+ * network operation, and when other relevant events happen. Derive from this class and
+ * override the functions you're interested in. The default implementations do nothing.
+ * \n
+ * This allows attributing an operation's latency: the time spent between
+ * \ref on_io_start and \ref on_io_finish is spent waiting for the network and the server,
+ * while the rest of the time between \ref on_operation_start and \ref on_operation_finish is
+ * spent by the client, serializing requests and parsing responses.
+ * \n
+ * Functions are invoked synchronously, from within the connection's operations, so they
+ * should return quickly. They must not throw, and must not call any function on the connection
+ * being observed. Connections that are not configured with an observer don't incur in any overhead.
+ *
+ * \par Thread safety
+ * The observer is invoked from the threads running the connection's operations.
+ * If an observer is shared between connections running in different threads,
+ * it must be thread-safe.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class connection_observer
+{
+public:
+    /// Destructor.
+    virtual ~connection_observer() {}
+
+    /// Called when the connection starts running an operation.
+    virtual void on_operation_start(operation_type op) { boost::ignore_unused(op); }
+
+    /// Called when an operation finishes, with the error it produced, if any.
+    virtual void on_operation_finish(operation_type op, error_code ec) { boost::ignore_unused(op, ec); }
+
+    /// Called before starting a network operation.
+    virtual void on_io_start(wire_event type) { boost::ignore_unused(type); }
+
+    /**
+     * \brief Called after a network operation completes.
+     * \details
+     * `bytes_transferred` is only meaningful for \ref wire_event::read and \ref wire_event::write.
+     */
+    virtual void on_io_finish(wire_event type, error_code ec, std::size_t bytes_transferred)
+    {
+        boost::ignore_unused(type, ec, bytes_transferred);
+    }
+
+    /**
+     * \brief Called after a batch of rows has been parsed, with the number of rows in the batch.
+     * \details
+     * Invoked by any operation that reads rows, including `execute`.
+     * Batches are bounded by the size of the connection's read buffer.
+     */
+    virtual void on_rows_read(std::size_t num_rows) { boost::ignore_unused(num_rows); }
+
+    /**
+     * \brief Called when the connection's read buffer grows to accommodate a message.
+     * \details `new_size` is the buffer's size, in bytes, after growing.
+     */
+    virtual void on_read_buffer_growth(std::size_t new_size) { boost::ignore_unused(new_size); }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
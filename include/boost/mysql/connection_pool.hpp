@@ -12,6 +12,9 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
+#include <boost/mysql/request_priority.hpp>
+#include <boost/mysql/statement.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/config.hpp>
@@ -22,6 +25,7 @@
 #include <boost/asio/async_result.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 
 namespace boost {
@@ -163,6 +167,31 @@ public:
     /// \copydoc get
     const any_connection* operator->() const noexcept { return &get(); }
 
+    /**
+     * \brief Retrieves one of the statements prepared by the pool for this connection.
+     * \details
+     * `index` is the position of the statement in \ref pool_params::statements.
+     * The statement has already been prepared by the pool, so it can be executed right away.
+     * Don't close it: the pool manages its lifetime, re-preparing it when required.
+     *
+     * \par Preconditions
+     * The object should own a connection (`this->valid() == true`). \n
+     * `index < statements.size()`, where `statements` is the value of \ref pool_params::statements
+     * passed to the pool.
+     *
+     * \par Object lifetimes
+     * The returned statement handle is valid as long as `*this` or an object
+     * move-constructed or move-assigned from `*this` is alive.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    statement prepared_statement(std::size_t index) const noexcept
+    {
+        BOOST_ASSERT(valid());
+        return detail::get_statement(*impl_, index);
+    }
+
     /**
      * \brief Returns the owned connection to the pool and marks it as not requiring reset.
      * \details
@@ -274,10 +303,11 @@ class connection_pool
             Handler&& h,
             std::shared_ptr<detail::pool_impl> self,
             std::chrono::steady_clock::duration timeout,
+            request_priority priority,
             diagnostics* diag
         )
         {
-            async_get_connection_erased(std::move(self), timeout, diag, std::forward<Handler>(h));
+            async_get_connection_erased(std::move(self), timeout, priority, diag, std::forward<Handler>(h));
         }
     };
 
@@ -285,6 +315,7 @@ class connection_pool
     static void async_get_connection_erased(
         std::shared_ptr<detail::pool_impl> pool,
         std::chrono::steady_clock::duration timeout,
+        request_priority priority,
         diagnostics* diag,
         asio::any_completion_handler<void(error_code, pooled_connection)> handler
     );
@@ -292,6 +323,7 @@ class connection_pool
     template <class CompletionToken>
     auto async_get_connection_impl(
         std::chrono::steady_clock::duration timeout,
+        request_priority priority,
         diagnostics* diag,
         CompletionToken&& token
     )
@@ -300,6 +332,7 @@ class connection_pool
             token,
             impl_,
             timeout,
+            priority,
             diag
         ))
     {
@@ -309,6 +342,7 @@ class connection_pool
             token,
             impl_,
             timeout,
+            priority,
             diag
         );
     }
@@ -479,11 +513,12 @@ public:
         BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
             CompletionToken>
     auto async_get_connection(CompletionToken&& token) BOOST_MYSQL_RETURN_TYPE(
-        decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+        decltype(async_get_connection_impl({}, {}, nullptr, std::forward<CompletionToken>(token)))
     )
     {
         return async_get_connection_impl(
             get_default_timeout(),
+            request_priority::normal,
             nullptr,
             std::forward<CompletionToken>(token)
         );
@@ -539,10 +574,15 @@ public:
         BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
             CompletionToken>
     auto async_get_connection(diagnostics& diag, CompletionToken&& token) BOOST_MYSQL_RETURN_TYPE(
-        decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+        decltype(async_get_connection_impl({}, {}, nullptr, std::forward<CompletionToken>(token)))
     )
     {
-        return async_get_connection_impl(get_default_timeout(), &diag, std::forward<CompletionToken>(token));
+        return async_get_connection_impl(
+            get_default_timeout(),
+            request_priority::normal,
+            &diag,
+            std::forward<CompletionToken>(token)
+        );
     }
 
     /// \copydoc async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
@@ -551,10 +591,15 @@ public:
             CompletionToken>
     auto async_get_connection(std::chrono::steady_clock::duration timeout, CompletionToken&& token)
         BOOST_MYSQL_RETURN_TYPE(
-            decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+            decltype(async_get_connection_impl({}, {}, nullptr, std::forward<CompletionToken>(token)))
         )
     {
-        return async_get_connection_impl(timeout, nullptr, std::forward<CompletionToken>(token));
+        return async_get_connection_impl(
+            timeout,
+            request_priority::normal,
+            nullptr,
+            std::forward<CompletionToken>(token)
+        );
     }
 
     /**
@@ -613,10 +658,85 @@ public:
         CompletionToken&& token
     )
         BOOST_MYSQL_RETURN_TYPE(
-            decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+            decltype(async_get_connection_impl({}, {}, nullptr, std::forward<CompletionToken>(token)))
         )
     {
-        return async_get_connection_impl(timeout, &diag, std::forward<CompletionToken>(token));
+        return async_get_connection_impl(
+            timeout,
+            request_priority::normal,
+            &diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_get_connection(request_priority,std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken>
+    auto async_get_connection(
+        request_priority priority,
+        std::chrono::steady_clock::duration timeout,
+        CompletionToken&& token
+    )
+        BOOST_MYSQL_RETURN_TYPE(
+            decltype(async_get_connection_impl({}, {}, nullptr, std::forward<CompletionToken>(token)))
+        )
+    {
+        return async_get_connection_impl(timeout, priority, nullptr, std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * \brief Retrieves a connection from the pool, specifying the request's priority.
+     * \details
+     * Behaves like
+     * \ref async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&),
+     * but if the request needs to wait for a connection, it will be queued according to `priority`.
+     * Requests with a higher priority are served first. Requests with the same priority
+     * are served in deadline order. The other `async_get_connection` overloads use
+     * \ref request_priority::normal.
+     * \n
+     * If \ref pool_params::max_pending_requests is set and the queue is full, either this
+     * request or the queued request that would be served last is rejected with
+     * \ref client_errc::pool_queue_full.
+     *
+     * \par Preconditions
+     * `this->valid() == true` \n
+     * Timeout values must be positive: `timeout.count() >= 0`.
+     *
+     * \par Object lifetimes
+     * While the operation is outstanding, the pool's internal data will be kept alive.
+     * It is safe to destroy `*this` while the operation is outstanding.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, boost::mysql::pooled_connection)`
+     *
+     * \par Errors
+     * Same as \ref async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&),
+     * plus \ref client_errc::pool_queue_full.
+     *
+     * \par Executor
+     * This function will run entirely in the pool's executor (as given by `this->get_executor()`).
+     * No internal data will be accessed or modified as part of the initiating function.
+     * This simplifies thread-safety.
+     *
+     * \par Thead-safety
+     * Same as \ref async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&).
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken>
+    auto async_get_connection(
+        request_priority priority,
+        std::chrono::steady_clock::duration timeout,
+        diagnostics& diag,
+        CompletionToken&& token
+    )
+        BOOST_MYSQL_RETURN_TYPE(
+            decltype(async_get_connection_impl({}, {}, nullptr, std::forward<CompletionToken>(token)))
+        )
+    {
+        return async_get_connection_impl(timeout, priority, &diag, std::forward<CompletionToken>(token));
     }
 
     /**
@@ -648,6 +768,24 @@ public:
      */
     BOOST_MYSQL_DECL
     void cancel();
+
+    /**
+     * \brief Retrieves the pool's activity counters.
+     * \details
+     * The returned counters are a snapshot and may be outdated
+     * as soon as this function returns.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Thead-safety
+     * This function is safe to be called concurrently with any other pool operation.
+     */
+    BOOST_MYSQL_DECL
+    pool_stats stats() const noexcept;
 };
 
 }  // namespace mysql
@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DECIMAL_HPP
+#define BOOST_MYSQL_DECIMAL_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <stdexcept>
+
+namespace boost {
+namespace mysql {
+
+class decimal;
+
+namespace detail {
+
+BOOST_MYSQL_DECL
+bool parse_decimal(string_view from, decimal& to) noexcept;
+
+}  // namespace detail
+
+/**
+ * \brief Type representing MySQL `DECIMAL` and `NUMERIC` data types.
+ * \details
+ * Holds an exact fixed-point number with up to \ref max_precision digits, \ref max_scale
+ * of which may be placed after the decimal point. This is the same range as MySQL's `DECIMAL`.
+ * \n
+ * The server sends `DECIMAL` values as text, both in the text and the binary protocol.
+ * This type stores the value in canonical textual form, in an inline buffer. Constructing
+ * it from a server value validates and copies the characters, without allocating. The value
+ * may be retrieved as an integer scaled by `10^scale()` using \ref get_unscaled_value or
+ * \ref as_unscaled_value, without intermediate strings, when it fits in a `std::int64_t`.
+ * \n
+ * `decimal` can be used as a field in static rows (i.e. \ref static_results and
+ * \ref static_execution_state), for `DECIMAL` and `NUMERIC` columns, and as a statement parameter.
+ * The dynamic interface (\ref field_view) keeps representing these columns as strings.
+ */
+class decimal
+{
+public:
+    /// The maximum number of digits that a `decimal` may hold.
+    static constexpr std::size_t max_precision = 65;
+
+    /// The maximum number of digits that a `decimal` may hold after the decimal point.
+    static constexpr std::size_t max_scale = 30;
+
+    /**
+     * \brief Constructs a decimal holding zero, with zero scale.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    decimal() noexcept = default;
+
+    /**
+     * \brief Constructs a decimal from its unscaled value and scale.
+     * \details The resulting value is `unscaled_value * 10^(-scale)`. For instance,
+     * `decimal(-1050, 2)` represents `-10.50`.
+     *
+     * \par Exception safety
+     * Strong guarantee.
+     * \throws std::out_of_range If `scale > max_scale`.
+     */
+    BOOST_MYSQL_DECL
+    decimal(std::int64_t unscaled_value, unsigned scale);
+
+    /**
+     * \brief Constructs a decimal from its textual representation.
+     * \details
+     * `s` must be composed of an optional sign, followed by one or more digits, optionally
+     * followed by a decimal point and one or more digits (e.g. `"-10.50"`). This is the format
+     * used by MySQL. The number of digits after the point determines the scale.
+     * Leading zeros are ignored.
+     *
+     * \par Exception safety
+     * Strong guarantee.
+     * \throws std::invalid_argument If `s` is not a valid decimal or it exceeds
+     *         \ref max_precision or \ref max_scale.
+     */
+    explicit decimal(string_view s)
+    {
+        if (!detail::parse_decimal(s, *this))
+            BOOST_THROW_EXCEPTION(std::invalid_argument("decimal::decimal: invalid decimal string"));
+    }
+
+    /**
+     * \brief Returns `true` if the number is less than zero.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_negative() const noexcept { return buffer_[0] == '-'; }
+
+    /**
+     * \brief Returns the number of digits after the decimal point.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    unsigned scale() const noexcept { return scale_; }
+
+    /**
+     * \brief Returns the total number of significant digits.
+     * \details Leading zeros are not counted. For instance, `10.50` has a precision of 4,
+     * and `0.05` has a precision of 2.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    unsigned precision() const noexcept { return precision_; }
+
+    /**
+     * \brief Returns the canonical textual representation of the number (e.g. `"-10.50"`).
+     * \details The returned view points into `*this`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view to_string_view() const noexcept { return string_view(buffer_, size_); }
+
+    /**
+     * \brief Returns `true` if the unscaled value fits in a `std::int64_t`.
+     * \details This is always the case for decimals with a precision of 18 or less.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool fits_int64() const noexcept { return fits_int64_; }
+
+    /**
+     * \brief Returns the number as an integer scaled by `10^scale()` (unchecked access).
+     * \details For instance, `10.50` returns `1050`.
+     *
+     * \par Preconditions
+     * `this->fits_int64() == true` (if violated, results in undefined behavior).
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::int64_t get_unscaled_value() const noexcept
+    {
+        BOOST_ASSERT(fits_int64_);
+        return unscaled_value_;
+    }
+
+    /**
+     * \brief Returns the number as an integer scaled by `10^scale()` (checked access).
+     * \par Exception safety
+     * Strong guarantee.
+     * \throws std::out_of_range If `!this->fits_int64()`.
+     */
+    std::int64_t as_unscaled_value() const
+    {
+        if (!fits_int64())
+            BOOST_THROW_EXCEPTION(std::out_of_range("decimal::as_unscaled_value: value out of range"));
+        return get_unscaled_value();
+    }
+
+    /**
+     * \brief Tests for equality.
+     * \details Two decimals are equal if they represent the same number with the same scale.
+     * `10.5` and `10.50` are considered different.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool operator==(const decimal& rhs) const noexcept
+    {
+        return scale_ == rhs.scale_ && size_ == rhs.size_ && std::memcmp(buffer_, rhs.buffer_, size_) == 0;
+    }
+
+    /**
+     * \brief Tests for inequality.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool operator!=(const decimal& rhs) const noexcept { return !(*this == rhs); }
+
+private:
+    // sign + max_precision digits + decimal point
+    static constexpr std::size_t buffer_size = max_precision + 2;
+
+    // The unscaled value is computed on construction, if it fits, so integer access is O(1)
+    std::int64_t unscaled_value_{0};
+    char buffer_[buffer_size]{'0'};
+    std::uint8_t size_{1};
+    std::uint8_t scale_{0};
+    std::uint8_t precision_{0};
+    bool fits_int64_{true};
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend bool detail::parse_decimal(string_view from, decimal& to) noexcept;
+#endif
+};
+
+/**
+ * \relates decimal
+ * \brief Streams a decimal, using its canonical textual representation.
+ */
+BOOST_MYSQL_DECL
+std::ostream& operator<<(std::ostream& os, const decimal& v);
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/decimal.ipp>
+#endif
+
+#endif
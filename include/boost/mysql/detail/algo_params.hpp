@@ -8,18 +8,25 @@
 #ifndef BOOST_MYSQL_DETAIL_ALGO_PARAMS_HPP
 #define BOOST_MYSQL_DETAIL_ALGO_PARAMS_HPP
 
+#include <boost/mysql/binlog.hpp>
 #include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
 #include <boost/mysql/handshake_params.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/binlog_state_impl.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
+#include <boost/mysql/detail/row_visitor.hpp>
+
+#include <boost/core/span.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 namespace boost {
 namespace mysql {
@@ -84,6 +91,32 @@ struct read_some_rows_dynamic_algo_params
     using result_type = rows_view;
 };
 
+struct read_some_rows_visit_algo_params
+{
+    diagnostics* diag;
+    execution_processor* proc;
+    row_visitor visitor;
+
+    using result_type = std::size_t;
+};
+
+// A request run as part of a pipeline, together with its outcome
+struct pipeline_stage
+{
+    any_execution_request req;
+    execution_processor* proc;
+    diagnostics* diag;
+    error_code err;  // Set by the algorithm
+};
+
+struct run_pipeline_algo_params
+{
+    diagnostics* diag;
+    span<pipeline_stage> stages;
+
+    using result_type = void;
+};
+
 struct prepare_statement_algo_params
 {
     diagnostics* diag;
@@ -92,6 +125,17 @@ struct prepare_statement_algo_params
     using result_type = statement;
 };
 
+// Prepares all statements in stmts_sql, storing them in output,
+// which must point to an array of stmts_sql.size() statements
+struct prepare_statements_algo_params
+{
+    diagnostics* diag;
+    span<const std::string> stmts_sql;
+    statement* output;
+
+    using result_type = void;
+};
+
 struct close_statement_algo_params
 {
     diagnostics* diag;
@@ -128,6 +172,23 @@ struct close_connection_algo_params
     using result_type = void;
 };
 
+struct start_binlog_dump_algo_params
+{
+    diagnostics* diag;
+    const binlog_dump_params* params;
+    binlog_state_impl* binlog_st;
+
+    using result_type = void;
+};
+
+struct read_binlog_event_algo_params
+{
+    diagnostics* diag;
+    binlog_state_impl* binlog_st;
+
+    using result_type = binlog_event;
+};
+
 template <class AlgoParams>
 constexpr bool has_void_result() noexcept
 {
@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_BINLOG_STATE_IMPL_HPP
+#define BOOST_MYSQL_DETAIL_BINLOG_STATE_IMPL_HPP
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Column types, as they appear in table map events. This is a superset of
+// protocol_field_type, since the binlog uses some types that are never sent in resultsets
+enum class binlog_column_type : std::uint8_t
+{
+    decimal = 0x00,
+    tiny = 0x01,
+    short_ = 0x02,
+    long_ = 0x03,
+    float_ = 0x04,
+    double_ = 0x05,
+    null = 0x06,
+    timestamp = 0x07,
+    longlong = 0x08,
+    int24 = 0x09,
+    date = 0x0a,
+    time = 0x0b,
+    datetime = 0x0c,
+    year = 0x0d,
+    newdate = 0x0e,
+    varchar = 0x0f,
+    bit = 0x10,
+    timestamp2 = 0x11,
+    datetime2 = 0x12,
+    time2 = 0x13,
+    json = 0xf5,
+    newdecimal = 0xf6,
+    enum_ = 0xf7,
+    set = 0xf8,
+    tiny_blob = 0xf9,
+    medium_blob = 0xfa,
+    long_blob = 0xfb,
+    blob = 0xfc,
+    var_string = 0xfd,
+    string = 0xfe,
+    geometry = 0xff
+};
+
+// Values for binlog_table_data::column_flags
+constexpr std::uint8_t binlog_column_nullable = 1;
+constexpr std::uint8_t binlog_column_unsigned = 2;
+
+// An owning copy of a table map event, required to decode the rows events that follow it.
+// Column metadata is type-dependent. Two-byte metadata is stored as it appears in the
+// event: little-endian, except for STRING, ENUM, SET and NEWDECIMAL, where it's big-endian
+struct binlog_table_data
+{
+    std::uint64_t table_id{};
+    std::string schema;
+    std::string table;
+    std::vector<binlog_column_type> column_types;
+    std::vector<std::uint16_t> column_meta;
+    std::vector<std::uint8_t> column_flags;
+};
+
+// The header present in all events
+struct binlog_event_header
+{
+    std::uint32_t timestamp;
+    std::uint8_t type;
+    std::uint32_t server_id;
+    std::uint32_t event_size;
+    std::uint32_t log_pos;
+    std::uint16_t flags;
+};
+
+struct binlog_state_impl
+{
+    // The sequence number of the next packet sent by the server
+    std::uint8_t seqnum{0};
+
+    // Is the server sending us events?
+    bool dumping{false};
+
+    // Are events followed by a CRC32 checksum? Set by format description events
+    bool has_checksum{false};
+
+    // The position of the next event to be read
+    std::string file_name;
+    std::uint64_t position{0};
+
+    // The table map events received so far, by table ID. Entries are re-used when
+    // a table is mapped again, and removed when the server switches to another file
+    std::unordered_map<std::uint64_t, binlog_table_data> tables;
+
+    // The last event read. Views point into the connection's read buffer
+    bool has_event{false};
+    binlog_event_header header{};
+    span<const std::uint8_t> data;  // without the header and the checksum
+
+    // Decoded contents of the last event. Which members are valid depends on the event type
+    std::uint64_t rotate_position{};
+    string_view rotate_file;
+    std::array<std::uint8_t, 16> gtid_source_id{};
+    std::uint32_t gtid_domain_id{};
+    std::uint64_t gtid_sequence_number{};
+    string_view query_schema;
+    string_view query;
+    std::uint64_t xid{};
+    const binlog_table_data* table{};  // table map and rows events
+
+    // Rows events. Each row contains a before image, an after image, or both,
+    // with a field per column (columns not present in the image are NULL)
+    std::size_t num_rows{};
+    bool has_before_image{};
+    bool has_after_image{};
+    span<const std::uint8_t> present_before;  // bitmaps with a bit per column
+    span<const std::uint8_t> present_after;
+    std::vector<field_view> fields;
+
+    // DECIMAL values are packed in the binlog. They are converted to text and stored here
+    std::string decimal_buffer;
+    std::vector<std::size_t> pending_decimals;  // indices into fields
+
+    std::size_t num_columns() const noexcept { return table ? table->column_types.size() : 0u; }
+
+    // Clears the stream state, before starting a dump
+    void reset()
+    {
+        seqnum = 0;
+        dumping = false;
+        has_checksum = false;
+        file_name.clear();
+        position = 0;
+        tables.clear();
+        has_event = false;
+        table = nullptr;
+        num_rows = 0;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
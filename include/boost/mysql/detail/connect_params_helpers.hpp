@@ -17,7 +17,10 @@
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/config.hpp>
 
+#include <boost/core/span.hpp>
+
 #include <memory>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -28,21 +31,40 @@ struct any_address_view
     address_type type;
     string_view address;
     unsigned short port;
+    span<const host_and_port> fallback_hosts;
+    host_selection_policy policy;
 
     any_address_view(
         address_type t = address_type::host_and_port,
         string_view addr = {},
-        unsigned short port = 0
+        unsigned short port = 0,
+        span<const host_and_port> fallback_hosts = {},
+        host_selection_policy policy = host_selection_policy::ordered
     ) noexcept
-        : type(t), address(addr), port(port)
+        : type(t), address(addr), port(port), fallback_hosts(fallback_hosts), policy(policy)
+    {
+    }
+
+    // Number of hosts that may be tried when connecting, including the primary one
+    std::size_t num_hosts() const noexcept { return fallback_hosts.size() + 1u; }
+
+    // Returns the i-th host to try. Index zero is the primary host
+    string_view host_at(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < num_hosts());
+        return i == 0u ? address : string_view(fallback_hosts[i - 1u].host);
+    }
+    unsigned short port_at(std::size_t i) const noexcept
     {
+        BOOST_ASSERT(i < num_hosts());
+        return i == 0u ? port : fallback_hosts[i - 1u].port;
     }
 };
 
 inline any_address_view make_view(const any_address& input) noexcept
 {
     const auto& impl = access::get_impl(input);
-    return any_address_view(impl.type, impl.address, impl.port);
+    return any_address_view(impl.type, impl.address, impl.port, impl.fallback_hosts, impl.policy);
 }
 
 inline ssl_mode adjust_ssl_mode(ssl_mode input, address_type addr_type) noexcept
@@ -67,6 +89,7 @@ struct stable_connect_params
     any_address_view address;
     handshake_params hparams;
     std::unique_ptr<char[]> string_buffer;
+    std::vector<host_and_port> fallback_hosts;  // address.fallback_hosts points here
 };
 
 BOOST_MYSQL_DECL
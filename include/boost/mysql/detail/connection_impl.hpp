@@ -8,12 +8,15 @@
 #ifndef BOOST_MYSQL_DETAIL_CONNECTION_IMPL_HPP
 #define BOOST_MYSQL_DETAIL_CONNECTION_IMPL_HPP
 
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/connection_observer.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/execution_state.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/handshake_params.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -25,6 +28,7 @@
 #include <boost/mysql/detail/config.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
+#include <boost/mysql/detail/row_visitor.hpp>
 #include <boost/mysql/detail/run_algo.hpp>
 #include <boost/mysql/detail/typing/get_type_index.hpp>
 #include <boost/mysql/detail/writable_field_traits.hpp>
@@ -209,7 +213,13 @@ class connection_impl
     };
 
 public:
-    BOOST_MYSQL_DECL connection_impl(std::size_t read_buff_size, std::unique_ptr<any_stream> stream);
+    BOOST_MYSQL_DECL connection_impl(
+        std::size_t read_buff_size,
+        std::unique_ptr<any_stream> stream,
+        std::size_t read_ahead_buff_size = 0,
+        connection_observer* observer = nullptr,
+        parallel_row_decoder* row_decoder = nullptr
+    );
     connection_impl(const connection_impl&) = delete;
     BOOST_MYSQL_DECL connection_impl(connection_impl&&) noexcept;
     connection_impl& operator=(const connection_impl&) = delete;
@@ -233,6 +243,7 @@ public:
     BOOST_MYSQL_DECL std::vector<field_view>& get_shared_fields() noexcept;
     BOOST_MYSQL_DECL bool ssl_active() const noexcept;
     BOOST_MYSQL_DECL bool backslash_escapes() const noexcept;
+    BOOST_MYSQL_DECL bool session_state_changed() const noexcept;
 
     // Generic algorithm
     template <class AlgoParams, class CompletionToken>
@@ -415,6 +426,45 @@ public:
         return {&diag, &access::get_impl(exec_st).get_interface(), output_ref(output, index)};
     }
 
+    // Visit some rows (dynamic)
+    template <class Visitor>
+    read_some_rows_visit_algo_params make_params_visit_some_rows(
+        execution_state& st,
+        Visitor& visitor,
+        diagnostics& diag
+    ) const noexcept
+    {
+        return {&diag, &access::get_impl(st).get_interface(), make_dynamic_row_visitor(visitor)};
+    }
+
+    // Visit some rows (dynamic, lazy)
+    template <class Visitor>
+    read_some_rows_visit_algo_params make_params_visit_some_rows_lazy(
+        execution_state& st,
+        Visitor& visitor,
+        diagnostics& diag
+    ) const noexcept
+    {
+        return {&diag, &access::get_impl(st).get_interface(), make_lazy_row_visitor(visitor)};
+    }
+
+    // Visit some rows (static)
+    template <class SpanRowType, class Visitor, class... RowType>
+    read_some_rows_visit_algo_params make_params_visit_some_rows(
+        static_execution_state<RowType...>& exec_st,
+        Visitor& visitor,
+        diagnostics& diag
+    ) const noexcept
+    {
+        constexpr std::size_t index = get_type_index<SpanRowType, RowType...>();
+        static_assert(index != index_not_found, "SpanRowType must be one of the types returned by the query");
+        return {
+            &diag,
+            &access::get_impl(exec_st).get_interface(),
+            make_static_row_visitor<SpanRowType, index>(visitor),
+        };
+    }
+
     // Read resultset head
     template <class ExecutionStateType>
     read_resultset_head_algo_params make_params_read_resultset_head(ExecutionStateType& st, diagnostics& diag)
@@ -444,6 +494,22 @@ public:
     // Close connection
     close_connection_algo_params make_params_close(diagnostics& diag) const noexcept { return {&diag}; }
 
+    // Binlog
+    start_binlog_dump_algo_params make_params_start_binlog_dump(
+        const binlog_dump_params& params,
+        binlog_state& st,
+        diagnostics& diag
+    ) const noexcept
+    {
+        return {&diag, &params, &access::get_impl(st)};
+    }
+
+    read_binlog_event_algo_params make_params_read_binlog_event(binlog_state& st, diagnostics& diag)
+        const noexcept
+    {
+        return {&diag, &access::get_impl(st)};
+    }
+
     // TODO: get rid of this
     BOOST_MYSQL_DECL
     diagnostics& shared_diag() noexcept;
@@ -489,6 +555,9 @@ using async_read_resultset_head_t = async_run_t<read_resultset_head_algo_params,
 template <class CompletionToken>
 using async_read_some_rows_dynamic_t = async_run_t<read_some_rows_dynamic_algo_params, CompletionToken>;
 
+template <class CompletionToken>
+using async_visit_some_rows_t = async_run_t<read_some_rows_visit_algo_params, CompletionToken>;
+
 template <class CompletionToken>
 using async_prepare_statement_t = async_run_t<prepare_statement_algo_params, CompletionToken>;
 
@@ -507,6 +576,12 @@ using async_quit_connection_t = async_run_t<quit_connection_algo_params, Complet
 template <class CompletionToken>
 using async_close_connection_t = async_run_t<close_connection_algo_params, CompletionToken>;
 
+template <class CompletionToken>
+using async_start_binlog_dump_t = async_run_t<start_binlog_dump_algo_params, CompletionToken>;
+
+template <class CompletionToken>
+using async_read_binlog_event_t = async_run_t<read_binlog_event_algo_params, CompletionToken>;
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -9,9 +9,12 @@
 #define BOOST_MYSQL_DETAIL_CONNECTION_POOL_FWD_HPP
 
 #include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/statement.hpp>
 
 #include <boost/mysql/detail/config.hpp>
 
+#include <cstddef>
+
 namespace boost {
 namespace mysql {
 
@@ -32,6 +35,7 @@ using pool_impl = basic_pool_impl<io_traits, pooled_connection>;
 
 BOOST_MYSQL_DECL void mark_as_collectable(connection_node& node, bool should_reset) noexcept;
 BOOST_MYSQL_DECL any_connection& get_connection(connection_node& node) noexcept;
+BOOST_MYSQL_DECL statement get_statement(const connection_node& node, std::size_t index) noexcept;
 
 }  // namespace detail
 }  // namespace mysql
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_CONTAINER_HPP
+#define BOOST_MYSQL_DETAIL_CONTAINER_HPP
+
+#include <boost/mysql/memory_resource_ref.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// An allocator that forwards to a memory_resource_ref. Moves and swaps transfer the resource,
+// so moving containers never reallocates. Copies use the global heap, as pmr containers do.
+template <class T>
+class resource_allocator
+{
+    memory_resource_ref res_;
+
+    template <class U>
+    friend class resource_allocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    resource_allocator() = default;
+    resource_allocator(memory_resource_ref res) noexcept : res_(res) {}
+
+    template <class U>
+    resource_allocator(const resource_allocator<U>& other) noexcept : res_(other.res_)
+    {
+    }
+
+    T* allocate(std::size_t n) { return static_cast<T*>(res_.allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T* p, std::size_t n) noexcept { res_.deallocate(p, n * sizeof(T), alignof(T)); }
+
+    resource_allocator select_on_container_copy_construction() const noexcept { return {}; }
+
+    memory_resource_ref resource() const noexcept { return res_; }
+
+    friend bool operator==(const resource_allocator& lhs, const resource_allocator& rhs) noexcept
+    {
+        return lhs.res_ == rhs.res_;
+    }
+
+    friend bool operator!=(const resource_allocator& lhs, const resource_allocator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+// The vector type used by owning result containers (results, rows, row, static_results).
+// Its layout is the same in all C++ standards
+template <class T>
+using container_vector = std::vector<T, resource_allocator<T>>;
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -30,6 +30,9 @@
 
 namespace boost {
 namespace mysql {
+
+class parallel_row_decoder;
+
 namespace detail {
 
 // A type-erased reference to be used as the output range for static_execution_state
@@ -127,6 +130,19 @@ public:
         return on_row_impl(msg, ref, storage);
     }
 
+    // Processes several row messages at once. The first one is stored at ref.offset()
+    BOOST_ATTRIBUTE_NODISCARD
+    error_code on_rows(
+        span<const span<const std::uint8_t>> msgs,
+        const output_ref& ref,
+        std::vector<field_view>& storage,
+        parallel_row_decoder& decoder
+    )
+    {
+        BOOST_ASSERT(is_reading_rows());
+        return on_rows_impl(msgs, ref, storage, decoder);
+    }
+
     BOOST_ATTRIBUTE_NODISCARD
     error_code on_row_ok_packet(const ok_view& pack)
     {
@@ -164,6 +180,25 @@ protected:
     virtual void on_row_batch_start_impl() = 0;
     virtual void on_row_batch_finish_impl() = 0;
 
+    // By default, rows are processed one by one, without using the decoder
+    virtual error_code on_rows_impl(
+        span<const span<const std::uint8_t>> msgs,
+        const output_ref& ref,
+        std::vector<field_view>& storage,
+        parallel_row_decoder&
+    )
+    {
+        output_ref row_ref = ref;
+        for (std::size_t i = 0; i < msgs.size(); ++i)
+        {
+            row_ref.set_offset(ref.offset() + i);
+            auto err = on_row_impl(msgs[i], row_ref, storage);
+            if (err)
+                return err;
+        }
+        return error_code();
+    }
+
     metadata create_meta(const coldef_view& coldef) const
     {
         return access::construct<metadata>(coldef, mode_ == metadata_mode::full);
@@ -17,6 +17,8 @@
 
 #include <boost/mysql/detail/config.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/lazy_row_impl.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
 
 #include <boost/assert.hpp>
 
@@ -40,6 +42,8 @@ class execution_state_impl final : public execution_processor
     std::vector<metadata> meta_;
     ok_data eof_data_;
     std::vector<char> info_;
+    row_decoding_plan decoding_plan_;
+    lazy_row_impl lazy_row_;
 
     void on_new_resultset() noexcept
     {
@@ -67,6 +71,14 @@ class execution_state_impl final : public execution_processor
     error_code on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>& fields)
         override final;
 
+    BOOST_MYSQL_DECL
+    error_code on_rows_impl(
+        span<const span<const std::uint8_t>> msgs,
+        const output_ref& ref,
+        std::vector<field_view>& fields,
+        parallel_row_decoder& decoder
+    ) override final;
+
     BOOST_MYSQL_DECL
     error_code on_row_ok_packet_impl(const ok_view& pack) override final;
 
@@ -109,6 +121,15 @@ public:
         return eof_data_.is_out_params;
     }
 
+    // Splits a row into fields without decoding them. Used instead of on_row by visit_some_rows_lazy
+    error_code on_lazy_row(span<const std::uint8_t> msg)
+    {
+        BOOST_ASSERT(is_reading_rows());
+        return lazy_row_.reset(decoding_plan_, meta_, msg);
+    }
+
+    lazy_row_impl& lazy_row() noexcept { return lazy_row_; }
+
     execution_state_impl& get_interface() noexcept { return *this; }
 };
 
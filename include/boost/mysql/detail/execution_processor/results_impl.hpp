@@ -11,13 +11,16 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/container.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
 #include <boost/mysql/detail/row_impl.hpp>
 
 #include <boost/assert.hpp>
@@ -46,10 +49,11 @@ class resultset_container
 {
     bool first_has_data_{false};
     per_resultset_data first_;
-    std::vector<per_resultset_data> rest_;
+    container_vector<per_resultset_data> rest_;
 
 public:
     resultset_container() = default;
+    explicit resultset_container(memory_resource_ref res) : rest_(res) {}
     std::size_t size() const noexcept { return !first_has_data_ ? 0 : rest_.size() + 1; }
     bool empty() const noexcept { return !first_has_data_; }
     void clear() noexcept
@@ -90,6 +94,12 @@ class results_impl final : public execution_processor
 public:
     results_impl() = default;
 
+    // Uses the given memory resource for all allocations, except metadata strings
+    explicit results_impl(memory_resource_ref res)
+        : meta_(res), per_result_(res), info_(res), rows_(res)
+    {
+    }
+
     BOOST_MYSQL_DECL
     row_view get_out_params() const noexcept;
 
@@ -154,6 +164,14 @@ private:
     error_code on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
         override final;
 
+    BOOST_MYSQL_DECL
+    error_code on_rows_impl(
+        span<const span<const std::uint8_t>> msgs,
+        const output_ref& ref,
+        std::vector<field_view>& fields,
+        parallel_row_decoder& decoder
+    ) override final;
+
     BOOST_MYSQL_DECL
     error_code on_row_ok_packet_impl(const ok_view& pack) override final;
 
@@ -164,10 +182,11 @@ private:
     void on_row_batch_finish_impl() override final;
 
     // Data
-    std::vector<metadata> meta_;
+    container_vector<metadata> meta_;
     resultset_container per_result_;
-    std::vector<char> info_;
+    container_vector<char> info_;
     row_impl rows_;
+    row_decoding_plan decoding_plan_;
     std::size_t num_fields_at_batch_start_{no_batch};
 
     // Auxiliar
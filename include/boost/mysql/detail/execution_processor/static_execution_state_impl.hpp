@@ -20,7 +20,9 @@
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
 #include <boost/mysql/detail/typing/get_type_index.hpp>
+#include <boost/mysql/detail/typing/meta_check_cache.hpp>
 #include <boost/mysql/detail/typing/row_traits.hpp>
 
 #include <boost/assert.hpp>
@@ -151,6 +153,8 @@ private:
     ok_packet_data ok_data_;
     std::vector<char> info_;
     std::vector<metadata> meta_;
+    row_decoding_plan decoding_plan_;
+    std::vector<meta_check_cache> meta_cache_;  // one per resultset, kept across executions
 
     // Virtual impls
     BOOST_MYSQL_DECL
@@ -172,6 +176,14 @@ private:
         std::vector<field_view>& fields
     ) override final;
 
+    BOOST_MYSQL_DECL
+    error_code on_rows_impl(
+        span<const span<const std::uint8_t>> msgs,
+        const output_ref& ref,
+        std::vector<field_view>& fields,
+        parallel_row_decoder& decoder
+    ) override final;
+
     BOOST_MYSQL_DECL
     error_code on_row_ok_packet_impl(const ok_view& pack) override final;
 
@@ -183,6 +195,7 @@ private:
     name_table_t current_name_table() const noexcept { return ext_.name_table(resultset_index_ - 1); }
     span<std::size_t> current_pos_map() noexcept { return ext_.pos_map(resultset_index_ - 1); }
     span<const std::size_t> current_pos_map() const noexcept { return ext_.pos_map(resultset_index_ - 1); }
+    meta_check_cache& current_meta_cache() noexcept { return meta_cache_[resultset_index_ - 1]; }
 
     error_code meta_check(diagnostics& diag) const
     {
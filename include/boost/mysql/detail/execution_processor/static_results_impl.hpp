@@ -14,11 +14,15 @@
 
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/container.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
+#include <boost/mysql/detail/typing/meta_check_cache.hpp>
 #include <boost/mysql/detail/typing/readable_field_traits.hpp>
 #include <boost/mysql/detail/typing/row_traits.hpp>
 
@@ -28,6 +32,7 @@
 
 #include <array>
 #include <cstddef>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -123,6 +128,11 @@ class static_results_erased_impl final : public execution_processor
 public:
     static_results_erased_impl(results_external_data ext) noexcept : ext_(ext) {}
 
+    static_results_erased_impl(results_external_data ext, memory_resource_ref res) noexcept
+        : ext_(ext), meta_(res), info_(res)
+    {
+    }
+
     results_external_data& ext_data() noexcept { return ext_; }
 
     metadata_collection_view get_meta(std::size_t index) const noexcept
@@ -169,6 +179,14 @@ private:
     error_code on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>& fields)
         override final;
 
+    BOOST_MYSQL_DECL
+    error_code on_rows_impl(
+        span<const span<const std::uint8_t>> msgs,
+        const output_ref& ref,
+        std::vector<field_view>& fields,
+        parallel_row_decoder& decoder
+    ) override final;
+
     BOOST_MYSQL_DECL
     error_code on_row_ok_packet_impl(const ok_view& pack) override final;
 
@@ -177,15 +195,18 @@ private:
 
     // Data
     results_external_data ext_;
-    std::vector<metadata> meta_;
-    std::vector<char> info_;
+    container_vector<metadata> meta_;
+    container_vector<char> info_;
+    row_decoding_plan decoding_plan_;
     std::size_t resultset_index_{0};
+    std::vector<meta_check_cache> meta_cache_;  // one per resultset, kept across executions
 
     // Helpers
     span<std::size_t> current_pos_map() noexcept { return ext_.pos_map(resultset_index_ - 1); }
     span<const std::size_t> current_pos_map() const noexcept { return ext_.pos_map(resultset_index_ - 1); }
     name_table_t current_name_table() const noexcept { return ext_.name_table(resultset_index_ - 1); }
     static_per_resultset_data& current_resultset() noexcept { return ext_.per_result(resultset_index_ - 1); }
+    meta_check_cache& current_meta_cache() noexcept { return meta_cache_[resultset_index_ - 1]; }
     metadata_collection_view current_resultset_meta() const noexcept
     {
         return get_meta(resultset_index_ - 1);
@@ -204,7 +225,7 @@ private:
 };
 
 template <class... StaticRow>
-using results_rows_t = std::tuple<std::vector<StaticRow>...>;
+using results_rows_t = std::tuple<container_vector<StaticRow>...>;
 
 template <class... StaticRow>
 struct results_fns
@@ -265,12 +286,21 @@ constexpr std::array<results_resultset_descriptor, sizeof...(StaticRow)>
 template <BOOST_MYSQL_STATIC_ROW... StaticRow>
 class static_results_impl
 {
+    static_assert(
+        mp11::mp_none_of<mp11::mp_list<StaticRow...>, is_borrowed_row>::value,
+        "static_results can't hold rows with string_view or blob_view fields, since these point into "
+        "the connection's internal buffer. Use std::string and std::vector<unsigned char>, instead"
+    );
+
     // Data that requires knowing template params
-    struct
+    struct data_t
     {
         results_rows_t<StaticRow...> rows;
         std::array<std::size_t, max_num_columns<StaticRow...>> pos_map{};
         std::array<static_per_resultset_data, sizeof...(StaticRow)> per_resultset{};
+
+        data_t() = default;
+        explicit data_t(memory_resource_ref res) : rows(container_vector<StaticRow>(res)...) {}
     } data_;
 
     // The type-erased impl, that will use pointers to the above storage
@@ -297,6 +327,19 @@ public:
     {
     }
 
+    explicit static_results_impl(memory_resource_ref res)
+        : data_(res),
+          impl_(
+              results_external_data(
+                  results_resultset_descriptor_table<StaticRow...>,
+                  &results_fns<StaticRow...>::reset,
+                  ptr_data()
+              ),
+              res
+          )
+    {
+    }
+
     static_results_impl(const static_results_impl& rhs) : data_(rhs.data_), impl_(rhs.impl_)
     {
         set_pointers();
@@ -37,9 +37,11 @@ constexpr std::uint16_t num = 32768;              // Field is num (for clients)
 
 namespace status_flags {
 
+constexpr std::uint32_t in_trans = 1;
 constexpr std::uint32_t more_results = 8;
 constexpr std::uint32_t no_backslash_escapes = 512;
 constexpr std::uint32_t out_params = 4096;
+constexpr std::uint32_t session_state_changed = 16384;
 
 }  // namespace status_flags
 
@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_LAZY_ROW_IMPL_HPP
+#define BOOST_MYSQL_DETAIL_LAZY_ROW_IMPL_HPP
+
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A row message that has been split into fields, but whose fields haven't been decoded.
+// Fields are decoded on first access, and cached afterwards. Storage is re-used between rows.
+class lazy_row_impl
+{
+    static constexpr std::size_t null_offset = (std::numeric_limits<std::size_t>::max)();
+
+    const row_decoding_plan* plan_{};
+    metadata_collection_view meta_;
+    span<const std::uint8_t> msg_;
+
+    // Offset of each field into msg_, or null_offset for NULL fields
+    std::vector<std::size_t> offsets_;
+
+    // Decoded fields, valid only if the corresponding decoded_ flag is set
+    std::vector<field_view> fields_;
+    std::vector<std::uint8_t> decoded_;
+
+    BOOST_MYSQL_DECL
+    error_code decode(std::size_t i);
+
+public:
+    lazy_row_impl() = default;
+
+    // Splits the message into fields, computing their offsets. Validates the message framing,
+    // but not field values. plan and meta must outlive the current row, and msg must be kept valid
+    BOOST_MYSQL_DECL
+    error_code reset(
+        const row_decoding_plan& plan,
+        metadata_collection_view meta,
+        span<const std::uint8_t> msg
+    );
+
+    std::size_t size() const noexcept { return offsets_.size(); }
+
+    bool is_null(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < size());
+        return offsets_[i] == null_offset;
+    }
+
+    field_view get(std::size_t i, error_code& err)
+    {
+        BOOST_ASSERT(i < size());
+        err = decoded_[i] ? error_code() : decode(i);
+        return err ? field_view() : fields_[i];
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/lazy_row_impl.ipp>
+#endif
+
+#endif
@@ -25,10 +25,16 @@ struct ok_view
     std::uint16_t status_flags;
     std::uint16_t warnings;
     string_view info;
+    string_view session_state;  // only present if CLIENT_SESSION_TRACK was negotiated
 
     bool more_results() const noexcept { return status_flags & status_flags::more_results; }
     bool backslash_escapes() const noexcept { return !(status_flags & status_flags::no_backslash_escapes); }
     bool is_out_params() const noexcept { return status_flags & status_flags::out_params; }
+    bool in_transaction() const noexcept { return status_flags & status_flags::in_trans; }
+    bool session_state_changed() const noexcept
+    {
+        return status_flags & status_flags::session_state_changed;
+    }
 };
 
 }  // namespace detail
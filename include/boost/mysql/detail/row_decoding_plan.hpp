@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_ROW_DECODING_PLAN_HPP
+#define BOOST_MYSQL_DETAIL_ROW_DECODING_PLAN_HPP
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+class deserialization_context;
+enum class deserialize_errc;
+
+// Decode a single, non-NULL field. Text decoders get the field's textual representation,
+// while binary decoders consume the field from the message
+using text_field_decoder = deserialize_errc (*)(string_view from, const metadata& meta, field_view& output);
+using binary_field_decoder = deserialize_errc (*)(
+    deserialization_context& ctx,
+    const metadata& meta,
+    field_view& output
+);
+
+// Contains the decoder to use for each field of a resultset.
+// Compiled once per resultset (when all metadata has been read), to avoid
+// inspecting column types and flags for every field of every row.
+// Storage is re-used between resultsets and executions.
+class row_decoding_plan
+{
+    resultset_encoding encoding_{resultset_encoding::text};
+    std::vector<text_field_decoder> text_decoders_;
+    std::vector<binary_field_decoder> binary_decoders_;
+
+public:
+    row_decoding_plan() = default;
+
+    resultset_encoding encoding() const noexcept { return encoding_; }
+
+    std::size_t size() const noexcept
+    {
+        return encoding_ == resultset_encoding::text ? text_decoders_.size() : binary_decoders_.size();
+    }
+
+    const text_field_decoder* text_decoders() const noexcept
+    {
+        BOOST_ASSERT(encoding_ == resultset_encoding::text);
+        return text_decoders_.data();
+    }
+
+    const binary_field_decoder* binary_decoders() const noexcept
+    {
+        BOOST_ASSERT(encoding_ == resultset_encoding::binary);
+        return binary_decoders_.data();
+    }
+
+    void clear() noexcept
+    {
+        text_decoders_.clear();
+        binary_decoders_.clear();
+    }
+
+    BOOST_MYSQL_DECL
+    void compile(resultset_encoding enc, metadata_collection_view meta);
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/row_decoding_plan.ipp>
+#endif
+
+#endif
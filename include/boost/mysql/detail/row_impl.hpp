@@ -9,8 +9,10 @@
 #define BOOST_MYSQL_DETAIL_ROW_IMPL_HPP
 
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/container.hpp>
 
 #include <boost/core/span.hpp>
 
@@ -23,7 +25,8 @@ namespace detail {
 
 // Adds num_fields default-constructed fields to the vector, return pointer to the first
 // allocated value. Used to allocate fields before deserialization
-inline span<field_view> add_fields(std::vector<field_view>& storage, std::size_t num_fields)
+template <class FieldVector>
+span<field_view> add_fields(FieldVector& storage, std::size_t num_fields)
 {
     std::size_t old_size = storage.size();
     storage.resize(old_size + num_fields);
@@ -49,6 +52,11 @@ public:
 
     ~row_impl() = default;
 
+    // Uses the given memory resource for all allocations
+    explicit row_impl(memory_resource_ref res) noexcept : fields_(res), string_buffer_(res) {}
+
+    memory_resource_ref memory_resource() const noexcept { return fields_.get_allocator().resource(); }
+
     // Copies the given span into *this
     BOOST_MYSQL_DECL
     row_impl(const field_view* fields, std::size_t size);
@@ -71,7 +79,7 @@ public:
     BOOST_MYSQL_DECL
     void offsets_to_string_views();
 
-    const std::vector<field_view>& fields() const noexcept { return fields_; }
+    const container_vector<field_view>& fields() const noexcept { return fields_; }
 
     void clear() noexcept
     {
@@ -80,8 +88,8 @@ public:
     }
 
 private:
-    std::vector<field_view> fields_;
-    std::vector<unsigned char> string_buffer_;
+    container_vector<field_view> fields_;
+    container_vector<unsigned char> string_buffer_;
 };
 
 }  // namespace detail
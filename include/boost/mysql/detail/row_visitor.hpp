@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_ROW_VISITOR_HPP
+#define BOOST_MYSQL_DETAIL_ROW_VISITOR_HPP
+
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/lazy_row_view.hpp>
+#include <boost/mysql/row_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A type-erased reference to a user-supplied function object, invoked once per row
+// by read_some_rows_visit_algo. It's in charge of parsing the row (by calling proc.on_row)
+// and handing it to the user. Doesn't own the function object.
+class row_visitor
+{
+    using fn_type = error_code (*)(
+        void*,
+        execution_processor&,
+        span<const std::uint8_t>,
+        std::vector<field_view>&
+    );
+
+    void* obj_{};
+    fn_type fn_{};
+
+public:
+    constexpr row_visitor() noexcept = default;
+    constexpr row_visitor(void* obj, fn_type fn) noexcept : obj_(obj), fn_(fn) {}
+
+    bool has_value() const noexcept { return fn_ != nullptr; }
+
+    error_code on_row(
+        execution_processor& proc,
+        span<const std::uint8_t> msg,
+        std::vector<field_view>& storage
+    ) const
+    {
+        BOOST_ASSERT(fn_);
+        return fn_(obj_, proc, msg, storage);
+    }
+};
+
+// Visitor may be const-qualified. The invoker functions restore the qualification
+template <class Visitor>
+void* erase_visitor(Visitor& visitor) noexcept
+{
+    return const_cast<void*>(static_cast<const void*>(&visitor));
+}
+
+// execution_state: the row is parsed into storage, which is cleared before every row
+template <class Visitor>
+error_code invoke_dynamic_row_visitor(
+    void* obj,
+    execution_processor& proc,
+    span<const std::uint8_t> msg,
+    std::vector<field_view>& storage
+)
+{
+    storage.clear();
+    auto err = proc.on_row(msg, output_ref(), storage);
+    if (!err)
+        (*static_cast<Visitor*>(obj))(access::construct<row_view>(storage.data(), storage.size()));
+    return err;
+}
+
+template <class Visitor>
+row_visitor make_dynamic_row_visitor(Visitor& visitor) noexcept
+{
+    return row_visitor(erase_visitor(visitor), &invoke_dynamic_row_visitor<Visitor>);
+}
+
+// execution_state, lazy mode: the row is split into fields, which are decoded
+// on demand by the visitor. Nothing is written to storage
+template <class Visitor>
+error_code invoke_lazy_row_visitor(
+    void* obj,
+    execution_processor& proc,
+    span<const std::uint8_t> msg,
+    std::vector<field_view>&
+)
+{
+    auto& st = static_cast<execution_state_impl&>(proc);
+    auto err = st.on_lazy_row(msg);
+    if (!err)
+        (*static_cast<Visitor*>(obj))(access::construct<lazy_row_view>(st.lazy_row()));
+    return err;
+}
+
+template <class Visitor>
+row_visitor make_lazy_row_visitor(Visitor& visitor) noexcept
+{
+    return row_visitor(erase_visitor(visitor), &invoke_lazy_row_visitor<Visitor>);
+}
+
+// static_execution_state: the row is parsed into an object in this function's stack frame.
+// TypeIndex is the index of RowType in the static_execution_state's type list
+template <class RowType, std::size_t TypeIndex, class Visitor>
+error_code invoke_static_row_visitor(
+    void* obj,
+    execution_processor& proc,
+    span<const std::uint8_t> msg,
+    std::vector<field_view>& storage
+)
+{
+    RowType row{};
+    auto err = proc.on_row(msg, output_ref(span<RowType>(&row, 1), TypeIndex), storage);
+    if (!err)
+        (*static_cast<Visitor*>(obj))(row);
+    return err;
+}
+
+template <class RowType, std::size_t TypeIndex, class Visitor>
+row_visitor make_static_row_visitor(Visitor& visitor) noexcept
+{
+    return row_visitor(erase_visitor(visitor), &invoke_static_row_visitor<RowType, TypeIndex, Visitor>);
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
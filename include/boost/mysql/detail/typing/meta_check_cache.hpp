@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_TYPING_META_CHECK_CACHE_HPP
+#define BOOST_MYSQL_DETAIL_TYPING_META_CHECK_CACHE_HPP
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/typing/pos_map.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Remembers the column names, types and flags of the last resultset that passed meta_check,
+// together with the pos_map computed for it. Executing the same query or statement again
+// usually yields identical metadata. When this happens, the pos_map is copied from the cache,
+// and both name mapping and meta_check are skipped.
+// Columns are compared as they arrive. On the first mismatch, the cache is discarded
+// from that column onwards and starts recording the new metadata, instead.
+class meta_check_cache
+{
+    struct column
+    {
+        std::size_t name_offset;
+        std::size_t name_size;
+        column_type type;
+        std::uint16_t flags;
+    };
+
+    std::vector<char> names_;
+    std::vector<column> columns_;
+    std::vector<std::size_t> pos_map_;
+    bool valid_{false};
+
+    // State for the resultset being read
+    std::size_t num_columns_{0};
+    bool matching_{false};
+
+    string_view name(std::size_t i) const noexcept
+    {
+        return string_view(names_.data() + columns_[i].name_offset, columns_[i].name_size);
+    }
+
+    bool matches(std::size_t i, const coldef_view& coldef) const noexcept
+    {
+        return i < columns_.size() && columns_[i].type == coldef.type && columns_[i].flags == coldef.flags &&
+               name(i) == coldef.name;
+    }
+
+    void truncate(std::size_t num_columns)
+    {
+        if (num_columns < columns_.size())
+        {
+            names_.resize(columns_[num_columns].name_offset);
+            columns_.resize(num_columns);
+        }
+    }
+
+    void record(const coldef_view& coldef)
+    {
+        columns_.push_back({names_.size(), coldef.name.size(), coldef.type, coldef.flags});
+        names_.insert(names_.end(), coldef.name.begin(), coldef.name.end());
+    }
+
+public:
+    meta_check_cache() = default;
+
+    // Call when a resultset with metadata starts
+    void on_resultset_start() noexcept
+    {
+        num_columns_ = 0;
+        matching_ = valid_;
+    }
+
+    // Call for every column, instead of pos_map_add_field
+    void on_column(span<std::size_t> pos_map, name_table_t name_table, const coldef_view& coldef)
+    {
+        std::size_t db_index = num_columns_++;
+        if (matching_ && matches(db_index, coldef))
+            return;
+
+        if (matching_)
+        {
+            // First mismatch. Previous columns were skipped, but they're identical to the cached ones
+            matching_ = false;
+            for (std::size_t i = 0; i < db_index; ++i)
+                pos_map_add_field(pos_map, name_table, i, name(i));
+        }
+
+        valid_ = false;
+        truncate(db_index);
+        record(coldef);
+        pos_map_add_field(pos_map, name_table, db_index, coldef.name);
+    }
+
+    // Call after the last column. Returns true if all columns matched the cached ones.
+    // In this case, pos_map is populated, and meta_check doesn't need to be run
+    bool on_resultset_finish(span<std::size_t> pos_map, name_table_t name_table)
+    {
+        if (matching_ && num_columns_ == columns_.size())
+        {
+            BOOST_ASSERT(pos_map.size() == pos_map_.size());
+            std::copy(pos_map_.begin(), pos_map_.end(), pos_map.begin());
+            return true;
+        }
+
+        if (matching_)
+        {
+            // Fewer columns than the cached resultset
+            matching_ = false;
+            valid_ = false;
+            for (std::size_t i = 0; i < num_columns_; ++i)
+                pos_map_add_field(pos_map, name_table, i, name(i));
+            truncate(num_columns_);
+        }
+        return false;
+    }
+
+    // Call after meta_check succeeds, to make the recorded metadata available to the next resultset
+    void commit(span<const std::size_t> pos_map)
+    {
+        BOOST_ASSERT(num_columns_ == columns_.size());
+        pos_map_.assign(pos_map.begin(), pos_map.end());
+        valid_ = true;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -8,8 +8,10 @@
 #ifndef BOOST_MYSQL_DETAIL_TYPING_READABLE_FIELD_TRAITS_HPP
 #define BOOST_MYSQL_DETAIL_TYPING_READABLE_FIELD_TRAITS_HPP
 
+#include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/date.hpp>
+#include <boost/mysql/decimal.hpp>
 #include <boost/mysql/datetime.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
@@ -29,6 +31,7 @@
 #include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -445,6 +448,68 @@ struct readable_field_traits<std::vector<unsigned char, Allocator>, void>
     }
 };
 
+// string_view and blob_view point into the connection's internal buffer. They're only
+// valid until the next operation on the connection, so they can't be used with static_results
+template <>
+struct readable_field_traits<string_view, void>
+{
+    static constexpr bool is_supported = true;
+    static constexpr const char* type_name = "string_view";
+    static bool meta_check(meta_check_context& ctx)
+    {
+        return readable_field_traits<std::string>::meta_check(ctx);
+    }
+    static error_code parse(field_view input, string_view& output)
+    {
+        if (input.kind() != field_kind::string)
+        {
+            return client_errc::static_row_parsing_error;
+        }
+        output = input.get_string();
+        return error_code();
+    }
+};
+
+template <>
+struct readable_field_traits<blob_view, void>
+{
+    static constexpr bool is_supported = true;
+    static constexpr const char* type_name = "blob_view";
+    static bool meta_check(meta_check_context& ctx)
+    {
+        return readable_field_traits<std::vector<unsigned char>>::meta_check(ctx);
+    }
+    static error_code parse(field_view input, blob_view& output)
+    {
+        if (input.kind() != field_kind::blob)
+        {
+            return client_errc::static_row_parsing_error;
+        }
+        output = input.get_blob();
+        return error_code();
+    }
+};
+
+template <>
+struct readable_field_traits<decimal, void>
+{
+    static constexpr bool is_supported = true;
+    static constexpr const char* type_name = "decimal";
+    static bool meta_check(meta_check_context& ctx)
+    {
+        return ctx.current_meta().type() == column_type::decimal;
+    }
+    static error_code parse(field_view input, decimal& output)
+    {
+        // DECIMALs are sent as strings, both in the text and binary protocols
+        if (input.kind() != field_kind::string || !parse_decimal(input.get_string(), output))
+        {
+            return client_errc::static_row_parsing_error;
+        }
+        return error_code();
+    }
+};
+
 template <>
 struct readable_field_traits<date, void>
 {
@@ -557,6 +622,28 @@ struct is_readable_field
     static constexpr bool value = readable_field_traits<T>::is_supported;
 };
 
+// Does the field point into the connection's buffer?
+template <class T, class = void>
+struct is_borrowed_field : std::false_type
+{
+};
+
+template <>
+struct is_borrowed_field<string_view, void> : std::true_type
+{
+};
+
+template <>
+struct is_borrowed_field<blob_view, void> : std::true_type
+{
+};
+
+template <class T>
+struct is_borrowed_field<T, typename std::enable_if<is_readable_optional<T>::value>::type>
+    : is_borrowed_field<typename T::value_type>
+{
+};
+
 template <typename ReadableField>
 void meta_check_field_impl(meta_check_context& ctx)
 {
@@ -253,6 +253,16 @@ error_code parse(span<const std::size_t> pos_map, span<const field_view> from, S
     return ctx.error();
 }
 
+// Does the row contain fields that point into the connection's buffer (e.g. string_view)?
+template <class TypeIdentity>
+using is_borrowed_field_identity = is_borrowed_field<typename TypeIdentity::type>;
+
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+struct is_borrowed_row
+    : mp11::mp_any_of<typename row_traits<StaticRow>::types, is_borrowed_field_identity>
+{
+};
+
 using meta_check_fn_t =
     error_code (*)(span<const std::size_t> field_map, metadata_collection_view meta, diagnostics& diag);
 
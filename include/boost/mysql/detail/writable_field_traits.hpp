@@ -8,6 +8,7 @@
 #ifndef BOOST_MYSQL_DETAIL_WRITABLE_FIELD_TRAITS_HPP
 #define BOOST_MYSQL_DETAIL_WRITABLE_FIELD_TRAITS_HPP
 
+#include <boost/mysql/decimal.hpp>
 #include <boost/mysql/field_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
@@ -31,6 +32,17 @@ struct writable_field_traits<bool, void, void>
     static field_view to_field(bool value) noexcept { return field_view(value ? 1 : 0); }
 };
 
+// Sent as a string, which the server converts to the parameter's type
+template <class T>
+struct writable_field_traits<
+    T,
+    typename std::enable_if<std::is_same<typename std::decay<T>::type, decimal>::value>::type,
+    void>
+{
+    static constexpr bool is_supported = true;
+    static field_view to_field(const decimal& value) noexcept { return field_view(value.to_string_view()); }
+};
+
 template <class T>
 struct writable_field_traits<
     T,
@@ -13,13 +13,28 @@
 #include <boost/mysql/any_connection.hpp>
 
 #include <boost/mysql/impl/internal/variant_stream.hpp>
+#include <boost/mysql/impl/internal/wire_capture_stream.hpp>
 
 std::unique_ptr<boost::mysql::detail::any_stream> boost::mysql::any_connection::create_stream(
     asio::any_io_executor ex,
-    asio::ssl::context* ctx
+    const any_connection_params& params
 )
 {
-    return std::unique_ptr<boost::mysql::detail::any_stream>(new detail::variant_stream(std::move(ex), ctx));
+    if (params.replay)
+    {
+        return std::unique_ptr<detail::any_stream>(new detail::replay_stream(std::move(ex), *params.replay));
+    }
+
+    std::unique_ptr<detail::any_stream> res(new detail::variant_stream(
+        std::move(ex),
+        params.ssl_context,
+        params.dns_cache,
+        params.connect_attempt_timeout,
+        params.tls_sessions
+    ));
+    if (params.capture)
+        res.reset(new detail::capturing_stream(std::move(res), *params.capture));
+    return res;
 }
 
 #endif
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_BINLOG_IPP
+#define BOOST_MYSQL_IMPL_BINLOG_IPP
+
+#pragma once
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/column_type.hpp>
+
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+
+#include <boost/assert.hpp>
+
+boost::mysql::column_type boost::mysql::binlog_table_map::type(std::size_t column) const noexcept
+{
+    using detail::binlog_column_type;
+
+    BOOST_ASSERT(column < size());
+    switch (impl_->column_types[column])
+    {
+    case binlog_column_type::tiny: return column_type::tinyint;
+    case binlog_column_type::short_: return column_type::smallint;
+    case binlog_column_type::int24: return column_type::mediumint;
+    case binlog_column_type::long_: return column_type::int_;
+    case binlog_column_type::longlong: return column_type::bigint;
+    case binlog_column_type::float_: return column_type::float_;
+    case binlog_column_type::double_: return column_type::double_;
+    case binlog_column_type::decimal:
+    case binlog_column_type::newdecimal: return column_type::decimal;
+    case binlog_column_type::bit: return column_type::bit;
+    case binlog_column_type::year: return column_type::year;
+    case binlog_column_type::time:
+    case binlog_column_type::time2: return column_type::time;
+    case binlog_column_type::date:
+    case binlog_column_type::newdate: return column_type::date;
+    case binlog_column_type::datetime:
+    case binlog_column_type::datetime2: return column_type::datetime;
+    case binlog_column_type::timestamp:
+    case binlog_column_type::timestamp2: return column_type::timestamp;
+    case binlog_column_type::varchar:
+    case binlog_column_type::var_string: return column_type::varchar;
+    case binlog_column_type::tiny_blob:
+    case binlog_column_type::medium_blob:
+    case binlog_column_type::long_blob:
+    case binlog_column_type::blob: return column_type::blob;
+    case binlog_column_type::json: return column_type::json;
+    case binlog_column_type::geometry: return column_type::geometry;
+    case binlog_column_type::enum_: return column_type::enum_;
+    case binlog_column_type::set: return column_type::set;
+    case binlog_column_type::string:
+    {
+        // ENUM and SET columns are reported as STRING, with the actual type in the metadata
+        auto real_type = static_cast<binlog_column_type>(impl_->column_meta[column] >> 8);
+        if (real_type == binlog_column_type::enum_)
+            return column_type::enum_;
+        else if (real_type == binlog_column_type::set)
+            return column_type::set;
+        else
+            return column_type::char_;
+    }
+    default: return column_type::unknown;
+    }
+}
+
+#endif
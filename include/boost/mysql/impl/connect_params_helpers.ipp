@@ -15,6 +15,7 @@
 #include <boost/mysql/detail/connect_params_helpers.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -54,8 +55,12 @@ boost::mysql::detail::stable_connect_params boost::mysql::detail::make_stable(co
     auto password = copy_string(input.password, it);
     auto database = copy_string(input.database, it);
 
+    // Fallback hosts are rare, so they're just copied. Moving the vector doesn't invalidate the view
+    std::vector<host_and_port> fallback_hosts(addr_impl.fallback_hosts);
+    span<const host_and_port> fallback_hosts_view(fallback_hosts);
+
     return {
-        any_address_view{addr_impl.type, address, addr_impl.port},
+        any_address_view{addr_impl.type, address, addr_impl.port, fallback_hosts_view, addr_impl.policy},
         handshake_params(
             username,
             password,
@@ -65,6 +70,7 @@ boost::mysql::detail::stable_connect_params boost::mysql::detail::make_stable(co
             input.multi_queries
         ),
         std::move(ptr),
+        std::move(fallback_hosts),
     };
 }
 
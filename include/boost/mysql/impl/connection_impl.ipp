@@ -26,9 +26,19 @@ std::vector<boost::mysql::field_view>& boost::mysql::detail::connection_impl::ge
 
 boost::mysql::detail::connection_impl::connection_impl(
     std::size_t read_buff_size,
-    std::unique_ptr<any_stream> stream
+    std::unique_ptr<any_stream> stream,
+    std::size_t read_ahead_buff_size,
+    connection_observer* observer,
+    parallel_row_decoder* row_decoder
 )
-    : stream_(std::move(stream)), st_(new connection_state(read_buff_size, stream_->supports_ssl()))
+    : stream_(std::move(stream)),
+      st_(new connection_state(
+          read_buff_size,
+          stream_->supports_ssl(),
+          read_ahead_buff_size,
+          observer,
+          row_decoder
+      ))
 {
 }
 
@@ -64,6 +74,11 @@ bool boost::mysql::detail::connection_impl::backslash_escapes() const noexcept
     return st_->data().backslash_escapes;
 }
 
+bool boost::mysql::detail::connection_impl::session_state_changed() const noexcept
+{
+    return st_->data().session_state_changed();
+}
+
 boost::mysql::diagnostics& boost::mysql::detail::connection_impl::shared_diag() noexcept
 {
     return st_->data().shared_diag;
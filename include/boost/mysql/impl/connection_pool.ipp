@@ -30,6 +30,14 @@ boost::mysql::any_connection& boost::mysql::detail::get_connection(boost::mysql:
     return node.connection();
 }
 
+boost::mysql::statement boost::mysql::detail::get_statement(
+    const boost::mysql::detail::connection_node& node,
+    std::size_t index
+) noexcept
+{
+    return node.get_statement(index);
+}
+
 boost::mysql::connection_pool::connection_pool(const pool_executor_params& ex_params, pool_params params)
     : impl_(std::make_shared<detail::pool_impl>(ex_params, std::move(params)))
 {
@@ -51,11 +59,12 @@ void boost::mysql::connection_pool::async_run_erased(
 void boost::mysql::connection_pool::async_get_connection_erased(
     std::shared_ptr<detail::pool_impl> pool,
     std::chrono::steady_clock::duration timeout,
+    request_priority priority,
     diagnostics* diag,
     asio::any_completion_handler<void(error_code, pooled_connection)> handler
 )
 {
-    pool->async_get_connection(timeout, diag, std::move(handler));
+    pool->async_get_connection(timeout, priority, diag, std::move(handler));
 }
 
 void boost::mysql::connection_pool::cancel()
@@ -64,4 +73,10 @@ void boost::mysql::connection_pool::cancel()
     impl_->cancel();
 }
 
+boost::mysql::pool_stats boost::mysql::connection_pool::stats() const noexcept
+{
+    BOOST_ASSERT(valid());
+    return impl_->stats();
+}
+
 #endif
@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_DECIMAL_IPP
+#define BOOST_MYSQL_IMPL_DECIMAL_IPP
+
+#pragma once
+
+#include <boost/mysql/decimal.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+inline bool is_decimal_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+// Accumulates the magnitude of the unscaled value of a decimal, digit by digit,
+// detecting whether it fits in an int64. The magnitude can represent the minimum int64
+class unscaled_accumulator
+{
+    std::uint64_t limit_;
+    std::uint64_t magnitude_{0};
+    bool fits_{true};
+
+public:
+    unscaled_accumulator(bool negative) noexcept
+        : limit_(negative ? (std::uint64_t(1) << 63) : (std::uint64_t(1) << 63) - 1u)
+    {
+    }
+
+    void add_digit(char c) noexcept
+    {
+        auto digit = static_cast<std::uint64_t>(c - '0');
+        if (!fits_ || magnitude_ > (limit_ - digit) / 10u)
+            fits_ = false;
+        else
+            magnitude_ = magnitude_ * 10u + digit;
+    }
+
+    bool fits() const noexcept { return fits_; }
+
+    std::int64_t value(bool negative) const noexcept
+    {
+        BOOST_ASSERT(fits_);
+        if (!negative || magnitude_ == 0u)
+            return static_cast<std::int64_t>(magnitude_);
+        return -static_cast<std::int64_t>(magnitude_ - 1u) - 1;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+bool boost::mysql::detail::parse_decimal(string_view from, decimal& to) noexcept
+{
+    const char* it = from.data();
+    const char* end = it + from.size();
+
+    // Sign
+    bool negative = false;
+    if (it != end && (*it == '-' || *it == '+'))
+    {
+        negative = *it == '-';
+        ++it;
+    }
+
+    // The unscaled value is computed while validating the digits, so accessors don't need to re-parse
+    unscaled_accumulator acc(negative);
+
+    // Integer part. Leading zeros are skipped
+    const char* int_first = it;
+    while (it != end && is_decimal_digit(*it))
+        acc.add_digit(*it++);
+    const char* int_last = it;
+    if (int_first == int_last)
+        return false;
+    while (int_first != int_last && *int_first == '0')
+        ++int_first;
+
+    // Fractional part
+    const char* frac_first = it;
+    if (it != end && *it == '.')
+    {
+        frac_first = ++it;
+        while (it != end && is_decimal_digit(*it))
+            acc.add_digit(*it++);
+        if (frac_first == it)
+            return false;
+    }
+    const char* frac_last = it;
+    if (it != end)
+        return false;
+
+    // Limits
+    std::size_t int_digits = static_cast<std::size_t>(int_last - int_first);
+    std::size_t scale = static_cast<std::size_t>(frac_last - frac_first);
+    if (scale > decimal::max_scale || int_digits + scale > decimal::max_precision)
+        return false;
+
+    // Negative zero is represented as zero
+    bool is_zero = int_digits == 0u && std::all_of(frac_first, frac_last, [](char c) { return c == '0'; });
+
+    // Compose the canonical representation
+    char* out = to.buffer_;
+    if (negative && !is_zero)
+        *out++ = '-';
+    if (int_digits == 0u)
+        *out++ = '0';
+    std::memcpy(out, int_first, int_digits);
+    out += int_digits;
+    if (scale)
+    {
+        *out++ = '.';
+        std::memcpy(out, frac_first, scale);
+        out += scale;
+    }
+    to.size_ = static_cast<std::uint8_t>(out - to.buffer_);
+    to.scale_ = static_cast<std::uint8_t>(scale);
+    to.precision_ = static_cast<std::uint8_t>(int_digits + scale);
+    to.fits_int64_ = acc.fits();
+    to.unscaled_value_ = acc.fits() ? acc.value(negative) : 0;
+    return true;
+}
+
+boost::mysql::decimal::decimal(std::int64_t unscaled_value, unsigned scale)
+{
+    if (scale > max_scale)
+        BOOST_THROW_EXCEPTION(std::out_of_range("decimal::decimal: scale out of range"));
+
+    // Digits of the absolute value, least significant first. Working with the unsigned
+    // value avoids overflowing with the minimum int64
+    char digits[max_scale + 20]{};
+    std::size_t num_digits = 0;
+    std::uint64_t abs_value = unscaled_value < 0 ? 0u - static_cast<std::uint64_t>(unscaled_value)
+                                                 : static_cast<std::uint64_t>(unscaled_value);
+    while (abs_value)
+    {
+        digits[num_digits++] = static_cast<char>('0' + abs_value % 10u);
+        abs_value /= 10u;
+    }
+
+    // Make sure we have at least a zero before the decimal point
+    std::size_t total_digits = (std::max)(num_digits, static_cast<std::size_t>(scale) + 1u);
+    for (std::size_t i = num_digits; i < total_digits; ++i)
+        digits[i] = '0';
+
+    char* out = buffer_;
+    if (unscaled_value < 0)
+        *out++ = '-';
+    for (std::size_t i = total_digits; i-- > 0u;)
+    {
+        *out++ = digits[i];
+        if (i == scale && scale != 0u)
+            *out++ = '.';
+    }
+    size_ = static_cast<std::uint8_t>(out - buffer_);
+    scale_ = static_cast<std::uint8_t>(scale);
+    precision_ = static_cast<std::uint8_t>(num_digits > scale ? num_digits : scale);
+    unscaled_value_ = unscaled_value;
+    fits_int64_ = true;
+}
+
+std::ostream& boost::mysql::operator<<(std::ostream& os, const decimal& value)
+{
+    return os << value.to_string_view();
+}
+
+#endif
@@ -64,6 +64,9 @@ const char* error_to_string(client_errc error) noexcept
                "that you're calling connection_pool::async_run.";
     case client_errc::invalid_encoding:
         return "An invalid byte sequence was found while trying to decode a string.";
+    case client_errc::pool_queue_full:
+        return "Getting a connection from a connection_pool failed because too many requests were waiting "
+               "for a connection. See pool_params::max_pending_requests.";
 
     default: return "<unknown MySQL client error>";
     }
@@ -47,9 +47,11 @@ void boost::mysql::detail::execution_state_impl::on_num_meta_impl(std::size_t nu
 }
 
 boost::mysql::error_code boost::mysql::detail::execution_state_impl::
-    on_meta_impl(const coldef_view& coldef, bool, diagnostics&)
+    on_meta_impl(const coldef_view& coldef, bool is_last, diagnostics&)
 {
     meta_.push_back(create_meta(coldef));
+    if (is_last)
+        decoding_plan_.compile(encoding(), meta_);
     return error_code();
 }
 
@@ -64,7 +66,21 @@ boost::mysql::error_code boost::mysql::detail::execution_state_impl::on_row_impl
     span<field_view> storage = add_fields(fields, meta_.size());
 
     // deserialize the row
-    return deserialize_row(encoding(), msg, meta_, storage);
+    return deserialize_row(decoding_plan_, msg, meta_, storage);
+}
+
+boost::mysql::error_code boost::mysql::detail::execution_state_impl::on_rows_impl(
+    span<const span<const std::uint8_t>> msgs,
+    const output_ref&,
+    std::vector<field_view>& fields,
+    parallel_row_decoder& decoder
+)
+{
+    // add storage for all the rows
+    span<field_view> storage = add_fields(fields, meta_.size() * msgs.size());
+
+    // deserialize them
+    return deserialize_rows(decoding_plan_, msgs, meta_, storage, decoder);
 }
 
 boost::mysql::error_code boost::mysql::detail::execution_state_impl::on_row_ok_packet_impl(const ok_view& pack
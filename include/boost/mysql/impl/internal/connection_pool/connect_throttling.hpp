@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_CONNECT_THROTTLING_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_CONNECT_THROTTLING_HPP
+
+#include <boost/assert.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Computes how long a connection should sleep after num_failures (>= 1) consecutive
+// failed connection attempts. The interval starts at retry_interval and is doubled
+// after each failure, up to max_retry_interval (no backoff if max_retry_interval <= retry_interval).
+// If jitter is enabled, a random interval in [interval/2, interval] is returned,
+// so connections that failed at the same time don't retry in lockstep.
+template <class Rng>
+std::chrono::steady_clock::duration compute_retry_interval(
+    std::chrono::steady_clock::duration retry_interval,
+    std::chrono::steady_clock::duration max_retry_interval,
+    bool jitter,
+    std::size_t num_failures,
+    Rng& rng
+)
+{
+    auto res = retry_interval;
+    for (std::size_t i = 1; i < num_failures && res < max_retry_interval; ++i)
+        res = res > max_retry_interval / 2 ? max_retry_interval : res * 2;
+
+    if (jitter)
+    {
+        using rep = std::chrono::steady_clock::duration::rep;
+        std::uniform_int_distribution<rep> dist(res.count() / 2, res.count());
+        res = std::chrono::steady_clock::duration(dist(rng));
+    }
+
+    return res;
+}
+
+// Limits the connection establishment attempts performed by a pool:
+// at most max_concurrent attempts may be in progress at the same time (zero means no limit),
+// and consecutive attempts must be started at least min_interval apart.
+class connect_limiter
+{
+    using time_point = std::chrono::steady_clock::time_point;
+
+    std::size_t max_concurrent_;
+    std::chrono::steady_clock::duration min_interval_;
+    std::size_t num_in_progress_{0};
+    time_point next_allowed_{(time_point::min)()};
+
+    bool concurrency_exhausted() const noexcept
+    {
+        return max_concurrent_ != 0u && num_in_progress_ >= max_concurrent_;
+    }
+
+public:
+    connect_limiter(std::size_t max_concurrent, std::chrono::steady_clock::duration min_interval) noexcept
+        : max_concurrent_(max_concurrent), min_interval_(min_interval)
+    {
+    }
+
+    // Attempts to start a connection attempt. If it succeeds, release() must be
+    // called once the attempt finishes
+    bool try_acquire(time_point now) noexcept
+    {
+        if (concurrency_exhausted() || now < next_allowed_)
+            return false;
+        ++num_in_progress_;
+        next_allowed_ = now + min_interval_;
+        return true;
+    }
+
+    void release() noexcept
+    {
+        BOOST_ASSERT(num_in_progress_ > 0u);
+        --num_in_progress_;
+    }
+
+    // If try_acquire failed, when should we try again?
+    // If the concurrency limit was hit, we need to wait until another attempt finishes
+    time_point retry_time() const noexcept
+    {
+        return concurrency_exhausted() ? (time_point::max)() : next_allowed_;
+    }
+
+    std::size_t num_in_progress() const noexcept { return num_in_progress_; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -12,10 +12,16 @@
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/statement.hpp>
 
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/connection_impl.hpp>
 #include <boost/mysql/detail/connection_pool_fwd.hpp>
 
+#include <boost/mysql/impl/internal/connection_pool/connect_throttling.hpp>
 #include <boost/mysql/impl/internal/connection_pool/internal_pool_params.hpp>
+#include <boost/mysql/impl/internal/connection_pool/replication_lag.hpp>
 #include <boost/mysql/impl/internal/connection_pool/sansio_connection_node.hpp>
 #include <boost/mysql/impl/internal/connection_pool/timer_list.hpp>
 
@@ -30,6 +36,15 @@
 #include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
 namespace boost {
 namespace mysql {
 namespace detail {
@@ -43,6 +58,12 @@ struct io_traits
 {
     using connection_type = any_connection;
     using timer_type = asio::steady_timer;
+
+    // The current time, as seen by timers
+    static std::chrono::steady_clock::time_point now(const timer_type&) noexcept
+    {
+        return std::chrono::steady_clock::now();
+    }
 };
 
 // State shared between connection tasks
@@ -54,8 +75,62 @@ struct conn_shared_state
     std::size_t num_pending_connections{0};
     error_code last_ec;
     diagnostics last_diag;
+
+    // Connection establishment throttling
+    connect_limiter limiter;
+    timer_list<typename IoTraits::timer_type> connect_waiters;  // connections waiting for the limiter
+    std::minstd_rand rng{std::random_device{}()};               // used for retry jitter
+
+    // Circuit breaker. After circuit_breaker_threshold consecutive connect failures
+    // (zero means disabled), requests fail fast until a connect succeeds
+    std::size_t circuit_breaker_threshold;
+    std::size_t num_consecutive_connect_failures{0};
+
+    // When pool_params::measure_replication_lag is set, the time at which the next lag
+    // sample is due. Idle connections wake up to take it, so it's refreshed even if
+    // no connection stays idle for a whole ping interval
+    std::chrono::steady_clock::time_point next_lag_sample{};
+
+    // Metrics. May be read from any thread, but only written within the pool's executor
+    std::atomic<std::size_t> num_connect_attempts{0};
+    std::atomic<std::size_t> num_connect_failures{0};
+    std::atomic<std::size_t> num_throttled_connects{0};
+    std::atomic<std::size_t> num_fast_failed_requests{0};
+    std::atomic<std::size_t> num_rejected_requests{0};
+    std::atomic<std::size_t> num_in_use{0};        // connections handed to the user
+    std::atomic<std::size_t> num_get_requests{0};  // outstanding async_get_connection operations
+    std::atomic<std::int64_t> replication_lag{replication_lag_unknown};  // last sample, in seconds
+
+    conn_shared_state(const internal_pool_params& params)
+        : limiter(params.max_concurrent_connects, params.min_connect_interval),
+          circuit_breaker_threshold(params.circuit_breaker_threshold)
+    {
+    }
+
+    bool circuit_open() const noexcept
+    {
+        return circuit_breaker_threshold != 0u &&
+               num_consecutive_connect_failures >= circuit_breaker_threshold;
+    }
 };
 
+// Prepares the statements configured in the pool, writing all requests at once.
+// Called unqualified, so tests can provide overloads for their mock connections
+template <class CompletionToken>
+auto async_prepare_statements(
+    any_connection& conn,
+    const std::vector<std::string>& stmts_sql,
+    statement* output,
+    diagnostics& diag,
+    CompletionToken&& token
+) -> async_run_t<prepare_statements_algo_params, CompletionToken&&>
+{
+    return access::get_impl(conn).async_run(
+        prepare_statements_algo_params{&diag, stmts_sql, output},
+        std::forward<CompletionToken>(token)
+    );
+}
+
 // Used when launching an op and a timer in parallel using make_parallel_group.
 // Translates the completion handler arguments into a single error code.
 // Timer must always be the 2nd argument.
@@ -89,6 +164,12 @@ class basic_connection_node : public intrusive::list_base_hook<>,
     connection_type conn_;
     timer_type timer_;
     diagnostics connect_diag_;
+    std::vector<statement> stmts_;  // the statements in params_->statements, once prepared
+    std::size_t num_consecutive_failures_{0};  // connect attempts failed since we were last idle
+    timer_block<timer_type> throttle_timer_;   // to wait for the connect limiter
+    results lag_results_;                      // to sample replication lag
+    std::int64_t sampled_lag_{replication_lag_unknown};
+    std::chrono::steady_clock::time_point ping_deadline_{};  // when we should ping, if still idle
 
     // Thread-safe
     std::atomic<collection_state> collection_state_{collection_state::none};
@@ -98,6 +179,8 @@ class basic_connection_node : public intrusive::list_base_hook<>,
     friend class sansio_connection_node<basic_connection_node<IoTraits>>;
     void entering_idle()
     {
+        num_consecutive_failures_ = 0u;
+        ping_deadline_ = IoTraits::now(timer_) + params_->ping_interval;
         shared_st_->idle_list.push_back(*this);
         shared_st_->pending_requests.notify_one();
     }
@@ -112,10 +195,84 @@ class basic_connection_node : public intrusive::list_base_hook<>,
         shared_st_->last_diag = connect_diag_;
     }
 
+    void on_connect_finished(error_code ec)
+    {
+        auto& st = *shared_st_;
+        st.limiter.release();
+
+        if (ec)
+        {
+            ++st.num_connect_failures;
+
+            // If the circuit breaker just tripped, make waiting requests fail
+            if (++st.num_consecutive_connect_failures == st.circuit_breaker_threshold)
+                st.pending_requests.notify_all();
+
+            // Let other connections connect. If the circuit breaker is open,
+            // the connection that failed will perform the next probe after sleeping
+            if (!st.circuit_open())
+                st.connect_waiters.notify_one();
+        }
+        else if (st.circuit_open())
+        {
+            // The probe succeeded. Let all the connections that were waiting reconnect
+            st.num_consecutive_connect_failures = 0u;
+            st.connect_waiters.notify_all();
+        }
+        else
+        {
+            // Let other connections connect
+            st.num_consecutive_connect_failures = 0u;
+            st.connect_waiters.notify_one();
+        }
+    }
+
+    // Idle connections measuring replication lag wait until they should ping or until
+    // the pool's lag sample is due, whatever happens first
+    bool waits_for_lag_sample() const
+    {
+        return params_->measure_replication_lag && params_->ping_interval.count() > 0 &&
+               this->status() == connection_status::idle;
+    }
+
+    std::chrono::steady_clock::duration idle_wait_timeout()
+    {
+        if (!waits_for_lag_sample())
+            return params_->ping_interval;
+        auto now = IoTraits::now(timer_);
+        auto deadline = (std::min)(ping_deadline_, shared_st_->next_lag_sample);
+
+        // A zero timeout means no timeout at all, so wait at least one tick
+        return (std::max)(deadline - now, std::chrono::steady_clock::duration(1));
+    }
+
+    // Another connection may have taken the lag sample we woke up for.
+    // If our own ping is not due yet, we should keep waiting
+    bool lag_sample_taken()
+    {
+        if (!waits_for_lag_sample())
+            return false;
+        auto now = IoTraits::now(timer_);
+        return now < ping_deadline_ && now < shared_st_->next_lag_sample;
+    }
+
+    std::chrono::steady_clock::duration next_retry_interval()
+    {
+        return compute_retry_interval(
+            params_->retry_interval,
+            params_->max_retry_interval,
+            params_->retry_jitter,
+            ++num_consecutive_failures_,
+            shared_st_->rng
+        );
+    }
+
     struct connection_task_op
     {
         this_type& node_;
         next_connection_action last_act_{next_connection_action::none};
+        bool waiting_connect_slot_{false};
+        bool throttled_{false};
 
         connection_task_op(this_type& node) noexcept : node_(node) {}
 
@@ -153,18 +310,117 @@ class basic_connection_node : public intrusive::list_base_hook<>,
             self(to_error_code(completion_order, io_ec, timer_ec));
         }
 
+        // Issues a connect, waiting until the connect limiter allows it.
+        // If the circuit breaker is open, only a single attempt (the probe) may be in progress
+        template <class Self>
+        void start_connect(Self& self)
+        {
+            auto& st = *node_.shared_st_;
+            auto now = IoTraits::now(node_.throttle_timer_.timer);
+            bool probe_in_progress = st.circuit_open() && st.limiter.num_in_progress() > 0u;
+            if (probe_in_progress || !st.limiter.try_acquire(now))
+            {
+                // Count each throttled attempt once, even if we need to wait several times
+                if (!throttled_)
+                    ++st.num_throttled_connects;
+                throttled_ = true;
+
+                // Wait until we're allowed to connect, or until another attempt finishes
+                waiting_connect_slot_ = true;
+                auto retry_time = probe_in_progress ? (std::chrono::steady_clock::time_point::max)()
+                                                    : st.limiter.retry_time();
+                node_.throttle_timer_.timer.expires_at(retry_time);
+                if (!node_.throttle_timer_.is_linked())
+                    st.connect_waiters.push_back(node_.throttle_timer_);
+                node_.throttle_timer_.timer.async_wait(std::move(self));
+                return;
+            }
+
+            throttled_ = false;
+            node_.throttle_timer_.unlink();
+            ++st.num_connect_attempts;
+            run_with_timeout(
+                self,
+                node_.params_->connect_timeout,
+                asio::bind_executor(
+                    node_.timer_.get_executor(),
+                    node_.conn_.async_connect(
+                        &node_.params_->connect_config,
+                        node_.connect_diag_,
+                        asio::deferred
+                    )
+                )
+            );
+        }
+
+        template <class Self>
+        void start_idle_wait(Self& self)
+        {
+            run_with_timeout(
+                self,
+                node_.idle_wait_timeout(),
+                node_.collection_channel_.async_receive(asio::deferred)
+            );
+        }
+
         template <class Self>
         void operator()(Self& self, error_code ec = {})
         {
+            // If we were waiting for the connect limiter, try again
+            if (waiting_connect_slot_)
+            {
+                waiting_connect_slot_ = false;
+                if (node_.status() != connection_status::terminated)
+                {
+                    start_connect(self);
+                    return;
+                }
+
+                // We were cancelled. No connect was issued. Let the sansio algorithm finish
+                node_.throttle_timer_.unlink();
+                last_act_ = next_connection_action::none;
+            }
+
             // A collection status may be generated by idle_wait actions
             auto col_st = last_act_ == next_connection_action::idle_wait
                               ? node_.collection_state_.exchange(collection_state::none)
                               : collection_state::none;
 
+            // If the session wasn't modified, there is no need to reset it
+            if (col_st == collection_state::needs_collect_with_reset && node_.params_->skip_unneeded_resets &&
+                !node_.conn_.session_state_changed())
+            {
+                col_st = collection_state::needs_collect;
+            }
+
+            // An idle connection woke up for a lag sample that someone else took
+            if (last_act_ == next_connection_action::idle_wait && col_st == collection_state::none &&
+                node_.lag_sample_taken())
+            {
+                start_idle_wait(self);
+                return;
+            }
+
             // Connect actions should set the shared diagnostics, so these
-            // get reported to the user
+            // get reported to the user. Preparing statements is part of connection establishment
             if (last_act_ == next_connection_action::connect)
+            {
+                node_.on_connect_finished(ec);
                 node_.propagate_connect_diag(ec);
+            }
+            else if (last_act_ == next_connection_action::prepare_statements)
+            {
+                node_.propagate_connect_diag(ec);
+            }
+            else if (last_act_ == next_connection_action::ping && !ec &&
+                     node_.params_->measure_replication_lag)
+            {
+                node_.shared_st_->replication_lag = node_.sampled_lag_;
+            }
+
+            // If the connection was returned by the user, it's no longer in use
+            if (col_st != collection_state::none)
+                --node_.shared_st_->num_in_use;
 
             // Invoke the sans-io algorithm
             last_act_ = node_.resume(ec, col_st);
@@ -177,14 +433,17 @@ class basic_connection_node : public intrusive::list_base_hook<>,
             // passed to run_with_timeout.
             switch (last_act_)
             {
-            case next_connection_action::connect:
+            case next_connection_action::connect: start_connect(self); break;
+            case next_connection_action::prepare_statements:
                 run_with_timeout(
                     self,
                     node_.params_->connect_timeout,
                     asio::bind_executor(
                         node_.timer_.get_executor(),
-                        node_.conn_.async_connect(
-                            &node_.params_->connect_config,
+                        async_prepare_statements(
+                            node_.conn_,
+                            node_.params_->statements,
+                            node_.stmts_.data(),
                             node_.connect_diag_,
                             asio::deferred
                         )
@@ -192,15 +451,40 @@ class basic_connection_node : public intrusive::list_base_hook<>,
                 );
                 break;
             case next_connection_action::sleep_connect_failed:
-                node_.timer_.expires_after(node_.params_->retry_interval);
+                node_.timer_.expires_after(node_.next_retry_interval());
                 node_.timer_.async_wait(std::move(self));
                 break;
             case next_connection_action::ping:
-                run_with_timeout(
-                    self,
-                    node_.params_->ping_timeout,
-                    asio::bind_executor(node_.timer_.get_executor(), node_.conn_.async_ping(asio::deferred))
-                );
+                if (node_.params_->measure_replication_lag)
+                {
+                    // Claim the lag sample, so other idle connections don't take it, too
+                    node_.shared_st_->next_lag_sample = IoTraits::now(node_.timer_) +
+                                                        node_.params_->ping_interval;
+                    run_with_timeout(
+                        self,
+                        node_.params_->ping_timeout,
+                        asio::bind_executor(
+                            node_.timer_.get_executor(),
+                            async_sample_replication_lag(
+                                node_.conn_,
+                                node_.lag_results_,
+                                node_.sampled_lag_,
+                                asio::deferred
+                            )
+                        )
+                    );
+                }
+                else
+                {
+                    run_with_timeout(
+                        self,
+                        node_.params_->ping_timeout,
+                        asio::bind_executor(
+                            node_.timer_.get_executor(),
+                            node_.conn_.async_ping(asio::deferred)
+                        )
+                    );
+                }
                 break;
             case next_connection_action::reset:
                 run_with_timeout(
@@ -212,13 +496,7 @@ class basic_connection_node : public intrusive::list_base_hook<>,
                     )
                 );
                 break;
-            case next_connection_action::idle_wait:
-                run_with_timeout(
-                    self,
-                    node_.params_->ping_interval,
-                    node_.collection_channel_.async_receive(asio::deferred)
-                );
-                break;
+            case next_connection_action::idle_wait: start_idle_wait(self); break;
             case next_connection_action::none: self.complete(error_code()); break;
             default: BOOST_ASSERT(false);
             }
@@ -232,10 +510,13 @@ public:
         boost::asio::any_io_executor conn_ex,
         conn_shared_state<IoTraits>& shared_st
     )
-        : params_(&params),
+        : sansio_connection_node<this_type>(connection_status::initial, !params.statements.empty()),
+          params_(&params),
           shared_st_(&shared_st),
           conn_(std::move(conn_ex), params.make_ctor_params()),
           timer_(ex),
+          stmts_(params.statements.size()),
+          throttle_timer_(ex),
           collection_channel_(ex, 1)
     {
     }
@@ -244,6 +525,7 @@ public:
     {
         sansio_connection_node<this_type>::cancel();
         timer_.cancel();
+        throttle_timer_.timer.cancel();
         collection_channel_.close();
     }
 
@@ -255,9 +537,23 @@ public:
         return asio::async_compose<CompletionToken, void(error_code)>(connection_task_op{*this}, token);
     }
 
+    // Hides sansio_connection_node::mark_as_in_use, to keep track of connections in use
+    void mark_as_in_use() noexcept
+    {
+        sansio_connection_node<this_type>::mark_as_in_use();
+        ++shared_st_->num_in_use;
+    }
+
     connection_type& connection() noexcept { return conn_; }
     const connection_type& connection() const noexcept { return conn_; }
 
+    // The statements configured in the pool. Only valid while the connection is in use
+    const statement& get_statement(std::size_t index) const noexcept
+    {
+        BOOST_ASSERT(index < stmts_.size());
+        return stmts_[index];
+    }
+
     // Thread-safe. May be safely be called without getting into the strand.
     void mark_as_collectable(bool should_reset) noexcept
     {
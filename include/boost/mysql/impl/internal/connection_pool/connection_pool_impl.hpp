@@ -13,6 +13,8 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
+#include <boost/mysql/request_priority.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/config.hpp>
@@ -45,6 +47,7 @@
 #include <cstddef>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -77,6 +80,9 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
     wait_group wait_gp_;
     asio::experimental::concurrent_channel<void(error_code)> cancel_chan_;
 
+    // Timers used by get_connection_op to wait, recycled to avoid allocating one per request
+    std::vector<std::unique_ptr<timer_block_type>> free_timers_;
+
     std::shared_ptr<this_type> shared_from_this_wrapper()
     {
         // Some compilers get confused without this explicit cast
@@ -89,6 +95,43 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
         wait_gp_.run_task(all_conns_.back().async_run(asio::deferred));
     }
 
+    std::unique_ptr<timer_block_type> acquire_timer()
+    {
+        if (free_timers_.empty())
+            return std::unique_ptr<timer_block_type>(new timer_block_type(ex_));
+        auto res = std::move(free_timers_.back());
+        free_timers_.pop_back();
+        res->rejected = false;
+        return res;
+    }
+
+    void release_timer(std::unique_ptr<timer_block_type> timer)
+    {
+        // Removes the timer from the pending request list, if it's there
+        timer->unlink();
+        free_timers_.push_back(std::move(timer));
+    }
+
+    // Adds a request to the pending request list, honoring max_pending_requests.
+    // If the list is full, the request that would be served last (req or another one)
+    // is rejected. Returns false if req was rejected.
+    bool enqueue_request(timer_block_type& req)
+    {
+        auto& reqs = shared_st_.pending_requests;
+        if (params_.max_pending_requests != 0u && reqs.size() >= params_.max_pending_requests)
+        {
+            ++shared_st_.num_rejected_requests;
+            if (!goes_before(req, reqs.back()))
+                return false;
+
+            // If the rejected request had been notified, the notification doesn't need to be
+            // passed to any other request: we only enqueue requests when there are no idle connections
+            reqs.reject_back();
+        }
+        reqs.insert(req);
+        return true;
+    }
+
     error_code get_diagnostics(diagnostics* diag) const
     {
         if (state_ == state_t::cancelled)
@@ -163,35 +206,53 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
     {
         std::shared_ptr<this_type> obj_;
         std::chrono::steady_clock::time_point timeout_;
+        request_priority priority_;
         diagnostics* diag_;
         std::unique_ptr<timer_block_type> timer_;
         error_code stored_ec_;
+        bool counted_{false};
 
         get_connection_op(
             std::shared_ptr<this_type> obj,
             std::chrono::steady_clock::time_point timeout,
+            request_priority priority,
             diagnostics* diag
         ) noexcept
-            : obj_(std::move(obj)), timeout_(timeout), diag_(diag)
+            : obj_(std::move(obj)), timeout_(timeout), priority_(priority), diag_(diag)
         {
         }
 
         template <class Self>
         void do_complete(Self& self, error_code ec, ConnectionWrapper conn)
         {
-            // Resetting the timer will remove it from the list thanks to the auto-unlink feature
-            timer_.reset();
             obj_.reset();
             self.complete(ec, std::move(conn));
         }
 
+        // Must be called before obj_ is moved
+        void finish_request()
+        {
+            if (counted_)
+                --obj_->shared_st_.num_get_requests;
+            if (timer_)
+                obj_->release_timer(std::move(timer_));
+        }
+
         template <class Self>
         void complete_success(Self& self, node_type& node)
         {
+            finish_request();
             node.mark_as_in_use();
             do_complete(self, error_code(), ConnectionWrapper(node, std::move(obj_)));
         }
 
+        template <class Self>
+        void complete_error(Self& self, error_code ec)
+        {
+            finish_request();
+            do_complete(self, ec, ConnectionWrapper());
+        }
+
         template <class Self>
         void operator()(Self& self, error_code ec = {})
         {
@@ -205,6 +266,12 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                 BOOST_ASIO_CORO_YIELD
                 asio::post(obj_->ex_, std::move(self));
 
+                // The request is outstanding from now on. Counting it here rather than
+                // in the initiating function means that deferred operations that never
+                // start don't leak a pending request. Every completion path decrements it.
+                ++obj_->shared_st_.num_get_requests;
+                counted_ = true;
+
                 // This loop guards us against possible race conditions
                 // between waiting on the pending request timer and getting the connection
                 while (true)
@@ -212,11 +279,10 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                     // If we're not running yet, or were cancelled, just return
                     if (obj_->state_ != state_t::running)
                     {
-                        do_complete(
+                        complete_error(
                             self,
                             obj_->state_ == state_t::initial ? client_errc::pool_not_running
-                                                             : client_errc::cancelled,
-                            ConnectionWrapper()
+                                                             : client_errc::cancelled
                         );
                         return;
                     }
@@ -229,6 +295,14 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                         return;
                     }
 
+                    // If the server is known to be unavailable, don't wait
+                    if (obj_->shared_st_.circuit_open())
+                    {
+                        ++obj_->shared_st_.num_fast_failed_requests;
+                        complete_error(self, obj_->get_diagnostics(diag_));
+                        return;
+                    }
+
                     // No luck. If there is room for more connections, create one.
                     // Don't create new connections if we have other connections pending
                     // (i.e. being connected, reset... ) - otherwise pool size increases for
@@ -239,11 +313,18 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                         obj_->create_connection();
                     }
 
-                    // Allocate a timer to perform waits.
+                    // Get a timer to perform waits and enter the pending request list,
+                    // ordered by priority and deadline.
                     if (!timer_)
                     {
-                        timer_.reset(new timer_block_type(obj_->ex_));
-                        obj_->shared_st_.pending_requests.push_back(*timer_);
+                        timer_ = obj_->acquire_timer();
+                        timer_->priority = static_cast<unsigned>(priority_);
+                        timer_->deadline = timeout_;
+                        if (!obj_->enqueue_request(*timer_))
+                        {
+                            complete_error(self, client_errc::pool_queue_full);
+                            return;
+                        }
                     }
 
                     // Wait to be notified, or until a timeout happens
@@ -256,10 +337,17 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                     // Dispatch so we run within the pool's executor.
                     BOOST_ASIO_CORO_YIELD asio::dispatch(obj_->ex_, std::move(self));
 
+                    // A request that should be served before us didn't fit in the list
+                    if (timer_->rejected)
+                    {
+                        complete_error(self, client_errc::pool_queue_full);
+                        return;
+                    }
+
                     if (!stored_ec_)
                     {
                         // We've got a timeout. Try to give as much info as possible
-                        do_complete(self, obj_->get_diagnostics(diag_), ConnectionWrapper());
+                        complete_error(self, obj_->get_diagnostics(diag_));
                         return;
                     }
                 }
@@ -272,6 +360,7 @@ public:
         : params_(make_internal_pool_params(std::move(params))),
           ex_(ex_params.pool_executor()),
           conn_ex_(ex_params.connection_executor()),
+          shared_st_(params_),
           wait_gp_(ex_),
           cancel_chan_(ex_, 1)
     {
@@ -302,12 +391,13 @@ public:
     BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void(error_code, ConnectionWrapper))
     async_get_connection(
         std::chrono::steady_clock::time_point timeout,
+        request_priority priority,
         diagnostics* diag,
         CompletionToken&& token
     )
     {
         return asio::async_compose<CompletionToken, void(error_code, ConnectionWrapper)>(
-            get_connection_op(shared_from_this_wrapper(), timeout, diag),
+            get_connection_op(shared_from_this_wrapper(), timeout, priority, diag),
             token,
             ex_
         );
@@ -317,6 +407,7 @@ public:
     BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void(error_code, ConnectionWrapper))
     async_get_connection(
         std::chrono::steady_clock::duration timeout,
+        request_priority priority,
         diagnostics* diag,
         CompletionToken&& token
     )
@@ -324,11 +415,31 @@ public:
         return async_get_connection(
             timeout.count() > 0 ? std::chrono::steady_clock::now() + timeout
                                 : (std::chrono::steady_clock::time_point::max)(),
+            priority,
             diag,
             std::forward<CompletionToken>(token)
         );
     }
 
+    // Thread-safe
+    pool_stats stats() const noexcept
+    {
+        pool_stats res;
+        res.connect_attempts = shared_st_.num_connect_attempts;
+        res.connect_failures = shared_st_.num_connect_failures;
+        res.throttled_connects = shared_st_.num_throttled_connects;
+        res.fast_failed_requests = shared_st_.num_fast_failed_requests;
+        res.rejected_requests = shared_st_.num_rejected_requests;
+        res.in_use_connections = shared_st_.num_in_use;
+        res.pending_requests = shared_st_.num_get_requests;
+        auto lag = shared_st_.replication_lag.load();
+        if (lag == replication_lag_stopped)
+            res.replication_lag = (std::chrono::seconds::max)();
+        else if (lag != replication_lag_unknown)
+            res.replication_lag = std::chrono::seconds(lag);
+        return res;
+    }
+
     // Exposed for testing
     std::list<node_type>& nodes() noexcept { return all_conns_; }
     shared_state_type& shared_state() noexcept { return shared_st_; }
@@ -12,7 +12,9 @@
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/handshake_params.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/resolver_cache.hpp>
 #include <boost/mysql/ssl_mode.hpp>
+#include <boost/mysql/tls_session_cache.hpp>
 
 #include <boost/asio/ssl/context.hpp>
 #include <boost/optional/optional.hpp>
@@ -20,8 +22,10 @@
 
 #include <chrono>
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -39,12 +43,29 @@ struct internal_pool_params
     std::chrono::steady_clock::duration ping_timeout;
     std::chrono::steady_clock::duration retry_interval;
     std::chrono::steady_clock::duration ping_interval;
+    std::chrono::steady_clock::duration connect_attempt_timeout;
+    std::unique_ptr<resolver_cache> dns_cache;  // null if caching is disabled
+    std::unique_ptr<tls_session_cache> tls_sessions;  // null if session reuse is disabled
+    bool skip_unneeded_resets;
+    connection_observer* observer;
+    std::vector<std::string> statements;
+    std::chrono::steady_clock::duration max_retry_interval;
+    bool retry_jitter;
+    std::size_t max_concurrent_connects;
+    std::chrono::steady_clock::duration min_connect_interval;
+    std::size_t circuit_breaker_threshold;
+    bool measure_replication_lag;
+    std::size_t max_pending_requests;
 
     any_connection_params make_ctor_params() noexcept
     {
         any_connection_params res;
         res.ssl_context = ssl_ctx.get_ptr();
         res.initial_read_buffer_size = initial_read_buffer_size;
+        res.dns_cache = dns_cache.get();
+        res.connect_attempt_timeout = connect_attempt_timeout;
+        res.tls_sessions = tls_sessions.get();
+        res.observer = observer;
         return res;
     }
 };
@@ -64,6 +85,14 @@ inline void check_validity(const pool_params& params)
         msg = "pool_params::ping_interval must not be negative";
     else if (params.ping_timeout.count() < 0)
         msg = "pool_params::ping_timeout must not be negative";
+    else if (params.dns_cache_ttl.count() < 0)
+        msg = "pool_params::dns_cache_ttl must not be negative";
+    else if (params.connect_attempt_timeout.count() < 0)
+        msg = "pool_params::connect_attempt_timeout must not be negative";
+    else if (params.max_retry_interval.count() < 0)
+        msg = "pool_params::max_retry_interval must not be negative";
+    else if (params.min_connect_interval.count() < 0)
+        msg = "pool_params::min_connect_interval must not be negative";
 
     if (msg != nullptr)
     {
@@ -94,6 +123,21 @@ inline internal_pool_params make_internal_pool_params(pool_params&& params)
         params.ping_timeout,
         params.retry_interval,
         params.ping_interval,
+        params.connect_attempt_timeout,
+        std::unique_ptr<resolver_cache>(
+            params.dns_cache_ttl.count() > 0 ? new resolver_cache(params.dns_cache_ttl) : nullptr
+        ),
+        std::unique_ptr<tls_session_cache>(params.reuse_tls_sessions ? new tls_session_cache : nullptr),
+        params.skip_unneeded_resets,
+        params.observer,
+        std::move(params.statements),
+        params.max_retry_interval,
+        params.retry_jitter,
+        params.max_concurrent_connects,
+        params.min_connect_interval,
+        params.circuit_breaker_threshold,
+        params.measure_replication_lag,
+        params.max_pending_requests,
     };
 }
 
@@ -0,0 +1,64 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_REPLICA_SELECTION_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_REPLICA_SELECTION_HPP
+
+#include <boost/mysql/pool_stats.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Whether a replica with the given stats may serve reads
+inline bool is_replica_eligible(const pool_stats& stats, std::chrono::steady_clock::duration max_lag) noexcept
+{
+    // No limit, or no measurement performed yet
+    if (max_lag.count() <= 0 || !stats.replication_lag)
+        return true;
+
+    // Lag is measured in seconds. Compare in seconds to prevent overflows
+    return *stats.replication_lag <= std::chrono::duration_cast<std::chrono::seconds>(max_lag);
+}
+
+// Selects the eligible replica with the least outstanding requests.
+// Ties are resolved in favor of the replica with the lowest index.
+// get_stats(i) should return the pool_stats for the i-th replica.
+// Returns num_replicas if no replica is eligible
+template <class GetStats>
+std::size_t select_replica(
+    std::size_t num_replicas,
+    std::chrono::steady_clock::duration max_lag,
+    GetStats&& get_stats
+)
+{
+    std::size_t res = num_replicas;
+    std::size_t min_load = (std::numeric_limits<std::size_t>::max)();
+    for (std::size_t i = 0; i < num_replicas; ++i)
+    {
+        pool_stats stats = get_stats(i);
+        if (!is_replica_eligible(stats, max_lag))
+            continue;
+        std::size_t load = stats.in_use_connections + stats.pending_requests;
+        if (load < min_load)
+        {
+            res = i;
+            min_load = load;
+        }
+    }
+    return res;
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_REPLICATION_LAG_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_REPLICATION_LAG_HPP
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/impl/internal/error/is_server_error.hpp>
+
+#include <boost/asio/compose.hpp>
+#include <boost/asio/coroutine.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Replication lag, in seconds, as stored by pools.
+// replication_lag_unknown means that no sample has been taken yet, or that the server
+// refused to report it (e.g. because of missing privileges).
+// replication_lag_stopped means that the server is not replicating
+constexpr std::int64_t replication_lag_unknown = -1;
+constexpr std::int64_t replication_lag_stopped = (std::numeric_limits<std::int64_t>::max)();
+
+// Extracts the replication lag from the results of a SHOW REPLICA STATUS query.
+// Servers with several replication channels report one row per channel: use the worst one.
+inline std::int64_t parse_replication_lag(const results& r)
+{
+    // MySQL 8.0.22+ and MariaDB 10.5.1+ use Seconds_Behind_Source. Older versions report
+    // Seconds_Behind_Master, even when they support the SHOW REPLICA STATUS syntax
+    auto meta = r.meta();
+    std::size_t idx = 0;
+    for (; idx < meta.size(); ++idx)
+    {
+        auto name = meta[idx].column_name();
+        if (name == "Seconds_Behind_Source" || name == "Seconds_Behind_Master")
+            break;
+    }
+
+    // If there is no replication configured, no rows are returned
+    if (idx == meta.size() || r.rows().empty())
+        return replication_lag_stopped;
+
+    std::int64_t res = 0;
+    for (auto row : r.rows())
+    {
+        // NULL means that replication threads are not running
+        field_view lag = row.at(idx);
+        if (lag.is_int64() && lag.get_int64() >= 0)
+            res = (std::max)(res, lag.get_int64());
+        else if (lag.is_uint64() && lag.get_uint64() < static_cast<std::uint64_t>(replication_lag_stopped))
+            res = (std::max)(res, static_cast<std::int64_t>(lag.get_uint64()));
+        else
+            return replication_lag_stopped;
+    }
+    return res;
+}
+
+struct sample_replication_lag_op : asio::coroutine
+{
+    any_connection& conn;
+    results& result;
+    std::int64_t& lag;
+
+    sample_replication_lag_op(any_connection& conn, results& result, std::int64_t& lag) noexcept
+        : conn(conn), result(result), lag(lag)
+    {
+    }
+
+    template <class Self>
+    void operator()(Self& self, error_code ec = {})
+    {
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            // The ping is the health check. Only its failure makes the connection unhealthy
+            BOOST_ASIO_CORO_YIELD conn.async_ping(std::move(self));
+            if (ec)
+            {
+                self.complete(ec);
+                return;
+            }
+
+            // MySQL 8.0.22+ and MariaDB 10.5.1+. Older servers only understand SHOW SLAVE STATUS
+            BOOST_ASIO_CORO_YIELD conn.async_execute("SHOW REPLICA STATUS", result, std::move(self));
+            if (is_server_error(ec))
+            {
+                BOOST_ASIO_CORO_YIELD conn.async_execute("SHOW SLAVE STATUS", result, std::move(self));
+            }
+
+            // Server errors leave the connection usable, and just mean that we don't know the lag
+            if (is_server_error(ec))
+            {
+                lag = replication_lag_unknown;
+                ec = error_code();
+            }
+            else if (!ec)
+            {
+                lag = parse_replication_lag(result);
+            }
+            self.complete(ec);
+        }
+    }
+};
+
+// Pings the server and queries its replication lag, storing it in lag.
+// Used by pools instead of pings when pool_params::measure_replication_lag is set.
+// Fails only if the connection is unhealthy: if the server refuses to report
+// the lag, lag is set to replication_lag_unknown and the operation succeeds.
+// Called unqualified, so tests can provide overloads for their mock connections
+template <class CompletionToken>
+auto async_sample_replication_lag(
+    any_connection& conn,
+    results& result,
+    std::int64_t& lag,
+    CompletionToken&& token
+)
+    -> decltype(asio::async_compose<CompletionToken, void(error_code)>(
+        std::declval<sample_replication_lag_op>(),
+        token,
+        conn
+    ))
+{
+    return asio::async_compose<CompletionToken, void(error_code)>(
+        sample_replication_lag_op{conn, result, lag},
+        token,
+        conn
+    );
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
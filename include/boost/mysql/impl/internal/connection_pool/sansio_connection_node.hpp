@@ -30,6 +30,9 @@ enum class connection_status
     // Connect failed and we're sleeping
     sleep_connect_failed_in_progress,
 
+    // Connection is preparing the statements configured in the pool
+    prepare_statements_in_progress,
+
     // Connection is trying to reset
     reset_in_progress,
 
@@ -67,6 +70,9 @@ enum class next_connection_action
 
     // Issue a ping
     ping,
+
+    // Prepare the statements configured in the pool
+    prepare_statements,
 };
 
 // A collection_state represents the possibility that a connection
@@ -89,6 +95,7 @@ template <class Derived>
 class sansio_connection_node
 {
     connection_status status_;
+    bool has_statements_;
 
     inline bool is_pending(connection_status status) noexcept
     {
@@ -105,6 +112,8 @@ class sansio_connection_node
             return next_connection_action::sleep_connect_failed;
         case connection_status::ping_in_progress: return next_connection_action::ping;
         case connection_status::reset_in_progress: return next_connection_action::reset;
+        case connection_status::prepare_statements_in_progress:
+            return next_connection_action::prepare_statements;
         case connection_status::idle:
         case connection_status::in_use: return next_connection_action::idle_wait;
         default: return next_connection_action::none;
@@ -133,9 +142,21 @@ class sansio_connection_node
         return status_to_action(new_status);
     }
 
+    // Connecting and resetting the session deallocate prepared statements.
+    // If the pool has statements, these need to be prepared before the connection becomes idle
+    next_connection_action set_session_ready()
+    {
+        return set_status(
+            has_statements_ ? connection_status::prepare_statements_in_progress : connection_status::idle
+        );
+    }
+
 public:
-    sansio_connection_node(connection_status initial_status = connection_status::initial) noexcept
-        : status_(initial_status)
+    sansio_connection_node(
+        connection_status initial_status = connection_status::initial,
+        bool has_statements = false
+    ) noexcept
+        : status_(initial_status), has_statements_(has_statements)
     {
     }
 
@@ -153,8 +174,7 @@ public:
         {
         case connection_status::initial: return set_status(connection_status::connect_in_progress);
         case connection_status::connect_in_progress:
-            return ec ? set_status(connection_status::sleep_connect_failed_in_progress)
-                      : set_status(connection_status::idle);
+            return ec ? set_status(connection_status::sleep_connect_failed_in_progress) : set_session_ready();
         case connection_status::sleep_connect_failed_in_progress:
             return set_status(connection_status::connect_in_progress);
         case connection_status::idle:
@@ -181,10 +201,17 @@ public:
                 return next_connection_action::idle_wait;
             }
         case connection_status::ping_in_progress:
-        case connection_status::reset_in_progress:
             // Reconnect if there was an error. Otherwise, we're idle
             return ec ? set_status(connection_status::connect_in_progress)
                       : set_status(connection_status::idle);
+        case connection_status::reset_in_progress:
+            // Reconnect if there was an error. Otherwise, re-prepare statements, if any
+            return ec ? set_status(connection_status::connect_in_progress) : set_session_ready();
+        case connection_status::prepare_statements_in_progress:
+            // Preparing statements is part of the connection establishment.
+            // Errors are treated like connect errors, so the retry interval applies
+            return ec ? set_status(connection_status::sleep_connect_failed_in_progress)
+                      : set_status(connection_status::idle);
         case connection_status::terminated:
         default: return next_connection_action::none;
         }
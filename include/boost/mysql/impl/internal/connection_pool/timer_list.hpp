@@ -12,7 +12,9 @@
 #include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 
+#include <chrono>
 #include <cstddef>
+#include <iterator>
 
 namespace boost {
 namespace mysql {
@@ -23,9 +25,23 @@ struct timer_block : intrusive::list_base_hook<intrusive::link_mode<intrusive::a
 {
     TimerType timer;
 
+    // Ordering key used by timer_list::insert. Lower priority values go first.
+    // Within a priority, earlier deadlines go first
+    unsigned priority{0};
+    std::chrono::steady_clock::time_point deadline{};
+
+    // Set when the block is removed by timer_list::reject_back
+    bool rejected{false};
+
     timer_block(asio::any_io_executor ex) : timer(std::move(ex)) {}
 };
 
+template <class TimerType>
+bool goes_before(const timer_block<TimerType>& lhs, const timer_block<TimerType>& rhs) noexcept
+{
+    return lhs.priority < rhs.priority || (lhs.priority == rhs.priority && lhs.deadline < rhs.deadline);
+}
+
 template <class TimerType>
 class timer_list
 {
@@ -34,6 +50,35 @@ class timer_list
 public:
     timer_list() = default;
     void push_back(timer_block<TimerType>& req) noexcept { requests_.push_back(req); }
+
+    // Inserts req after the last element that doesn't go after it, keeping the list ordered
+    // as long as only insert is used. Elements are usually inserted near the back,
+    // so we search backwards
+    void insert(timer_block<TimerType>& req) noexcept
+    {
+        auto it = requests_.end();
+        while (it != requests_.begin())
+        {
+            auto prev = std::prev(it);
+            if (!goes_before(req, *prev))
+                break;
+            it = prev;
+        }
+        requests_.insert(it, req);
+    }
+
+    // Removes the last element, marking it as rejected and waking its waiter.
+    // Precondition: !empty()
+    void reject_back()
+    {
+        auto& req = requests_.back();
+        requests_.pop_back();
+        req.rejected = true;
+        req.timer.cancel();
+    }
+
+    timer_block<TimerType>& back() noexcept { return requests_.back(); }
+    bool empty() const noexcept { return requests_.empty(); }
     void notify_one()
     {
         for (auto& req : requests_)
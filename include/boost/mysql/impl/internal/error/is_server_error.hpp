@@ -0,0 +1,31 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_ERROR_IS_SERVER_ERROR_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_ERROR_IS_SERVER_ERROR_HPP
+
+#include <boost/mysql/error_categories.hpp>
+#include <boost/mysql/error_code.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Server errors are sent as an error packet, which terminates the response.
+// After them, the connection remains usable
+inline bool is_server_error(error_code ec) noexcept
+{
+    const auto& cat = ec.category();
+    return cat == get_common_server_category() || cat == get_mysql_server_category() ||
+           cat == get_mariadb_server_category();
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,322 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_MULTIPLEXED_CONNECTION_IMPL_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_MULTIPLEXED_CONNECTION_IMPL_HPP
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/cancellation_type.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/list_hook.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// An execution request waiting to be run by a multiplexed connection.
+// Owned by the async_execute operation that created it
+struct multiplexed_request : intrusive::list_base_hook<intrusive::link_mode<intrusive::auto_unlink>>
+{
+    // Statement parameters are copied here, since the request outlives the initiating function
+    std::vector<field_view> params;
+    any_execution_request req;
+    execution_processor* proc;
+    diagnostics* diag;
+
+    // Set by the run task when the request completes
+    error_code err;
+    bool done{false};
+
+    // Set if the async_execute operation was cancelled after the request was sent.
+    // The response is still read into proc, but the operation reports client_errc::cancelled
+    bool abandoned{false};
+
+    // Used as a condition variable to notify completion
+    asio::steady_timer timer;
+
+    static any_execution_request own_params(any_execution_request req, std::vector<field_view>& storage)
+    {
+        if (req.is_query)
+            return req;
+        storage.assign(req.data.stmt.params.begin(), req.data.stmt.params.end());
+        return any_execution_request(req.data.stmt.stmt, storage);
+    }
+
+    multiplexed_request(
+        asio::any_io_executor ex,
+        any_execution_request request,
+        execution_processor& processor,
+        diagnostics& output_diag
+    )
+        : req(own_params(request, params)), proc(&processor), diag(&output_diag), timer(std::move(ex))
+    {
+    }
+
+    void complete(error_code ec)
+    {
+        err = ec;
+        done = true;
+        timer.cancel();
+    }
+};
+
+class multiplexed_connection_impl : public std::enable_shared_from_this<multiplexed_connection_impl>
+{
+    any_connection conn_;
+    std::size_t max_pipeline_size_;
+    bool cancelled_{false};
+
+    // Requests waiting to be sent. Auto-unlink makes requests remove themselves on destruction
+    intrusive::list<multiplexed_request, intrusive::constant_time_size<false>> pending_;
+
+    // Requests being run, in the same order as stages_
+    std::vector<multiplexed_request*> in_flight_;
+    std::vector<pipeline_stage> stages_;
+    diagnostics pipeline_diag_;
+
+    // Used as a condition variable to notify the run task about new requests and cancellations
+    asio::steady_timer run_timer_;
+
+    // Moves as many pending requests as allowed to the in-flight list
+    void start_batch()
+    {
+        while (!pending_.empty() && in_flight_.size() < max_pipeline_size_)
+        {
+            auto& req = pending_.front();
+            pending_.pop_front();
+            in_flight_.push_back(&req);
+            stages_.push_back(pipeline_stage{req.req, req.proc, req.diag, error_code()});
+        }
+    }
+
+    // Notifies the results of the in-flight requests
+    void finish_batch()
+    {
+        for (std::size_t i = 0; i < in_flight_.size(); ++i)
+            in_flight_[i]->complete(stages_[i].err);
+        in_flight_.clear();
+        stages_.clear();
+    }
+
+    // Fails all pending requests
+    void fail_pending(error_code ec)
+    {
+        while (!pending_.empty())
+        {
+            auto& req = pending_.front();
+            pending_.pop_front();
+            req.complete(ec);
+        }
+    }
+
+    struct run_op : asio::coroutine
+    {
+        std::shared_ptr<multiplexed_connection_impl> obj_;
+        error_code stored_ec_;
+
+        run_op(std::shared_ptr<multiplexed_connection_impl> obj) noexcept : obj_(std::move(obj)) {}
+
+        template <class Self>
+        void operator()(Self& self, error_code ec = {})
+        {
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Ensure we run within the connection's executor
+                BOOST_ASIO_CORO_YIELD
+                asio::dispatch(obj_->get_executor(), std::move(self));
+
+                while (!obj_->cancelled_)
+                {
+                    // Wait for requests to arrive
+                    if (obj_->pending_.empty())
+                    {
+                        obj_->run_timer_.expires_at((std::chrono::steady_clock::time_point::max)());
+                        BOOST_ASIO_CORO_YIELD obj_->run_timer_.async_wait(std::move(self));
+
+                        // If the token passed to async_run had a bound executor,
+                        // the handler will be invoked within that executor.
+                        // Dispatch so we run within the connection's executor.
+                        BOOST_ASIO_CORO_YIELD asio::dispatch(obj_->get_executor(), std::move(self));
+                        continue;
+                    }
+
+                    // Run as many requests as possible as a pipeline
+                    obj_->start_batch();
+                    BOOST_ASIO_CORO_YIELD access::get_impl(obj_->conn_).async_run(
+                        run_pipeline_algo_params{&obj_->pipeline_diag_, obj_->stages_},
+                        std::move(self)
+                    );
+                    stored_ec_ = ec;
+                    BOOST_ASIO_CORO_YIELD asio::dispatch(obj_->get_executor(), std::move(self));
+                    obj_->finish_batch();
+
+                    // Fatal errors leave the connection unusable
+                    if (stored_ec_)
+                        break;
+                }
+
+                // Requests that didn't make it to the server fail
+                obj_->fail_pending(stored_ec_ ? stored_ec_ : error_code(client_errc::cancelled));
+
+                // Done
+                obj_.reset();
+                self.complete(stored_ec_);
+            }
+        }
+    };
+
+    struct execute_op : asio::coroutine
+    {
+        std::shared_ptr<multiplexed_connection_impl> obj_;
+        std::unique_ptr<multiplexed_request> req_;
+
+        execute_op(std::shared_ptr<multiplexed_connection_impl> obj, std::unique_ptr<multiplexed_request> req)
+            noexcept
+            : obj_(std::move(obj)), req_(std::move(req))
+        {
+        }
+
+        template <class Self>
+        void do_complete(Self& self, error_code ec)
+        {
+            obj_.reset();
+            req_.reset();
+            self.complete(ec);
+        }
+
+        template <class Self>
+        static bool is_cancelled(Self& self) noexcept
+        {
+            return self.get_cancellation_state().cancelled() != asio::cancellation_type::none;
+        }
+
+        template <class Self>
+        void operator()(Self& self, error_code = {})
+        {
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Clear diagnostics
+                req_->diag->clear();
+
+                // Ensure we run within the connection's executor
+                BOOST_ASIO_CORO_YIELD
+                asio::post(obj_->get_executor(), std::move(self));
+
+                if (obj_->cancelled_ || is_cancelled(self))
+                {
+                    do_complete(self, client_errc::cancelled);
+                    return;
+                }
+
+                // Enqueue the request and notify the run task
+                obj_->pending_.push_back(*req_);
+                obj_->run_timer_.cancel();
+
+                // Wait for the request to be run. The wait is bound to our cancellation slot,
+                // so a cancellation signal makes the timer complete
+                while (!req_->done)
+                {
+                    req_->timer.expires_at((std::chrono::steady_clock::time_point::max)());
+                    BOOST_ASIO_CORO_YIELD req_->timer.async_wait(std::move(self));
+                    BOOST_ASIO_CORO_YIELD asio::dispatch(obj_->get_executor(), std::move(self));
+
+                    if (!req_->done && !req_->abandoned && is_cancelled(self))
+                    {
+                        if (req_->is_linked())
+                        {
+                            // Not sent yet. Removing it from the queue is enough
+                            req_->unlink();
+                            do_complete(self, client_errc::cancelled);
+                            return;
+                        }
+
+                        // Already sent. Its response will be read into proc,
+                        // which must outlive us, so we wait until the run task is done with it
+                        req_->abandoned = true;
+                    }
+                }
+
+                do_complete(self, req_->abandoned ? error_code(client_errc::cancelled) : req_->err);
+            }
+        }
+    };
+
+public:
+    multiplexed_connection_impl(any_connection&& conn, std::size_t max_pipeline_size)
+        : conn_(std::move(conn)),
+          max_pipeline_size_(max_pipeline_size ? max_pipeline_size : 1u),
+          run_timer_(conn_.get_executor())
+    {
+    }
+
+    using executor_type = asio::any_io_executor;
+    executor_type get_executor() { return conn_.get_executor(); }
+
+    any_connection& connection() noexcept { return conn_; }
+
+    template <class CompletionToken>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void(error_code))
+    async_run(CompletionToken&& token)
+    {
+        return asio::async_compose<CompletionToken, void(error_code)>(
+            run_op(shared_from_this()),
+            token,
+            get_executor()
+        );
+    }
+
+    void cancel()
+    {
+        cancelled_ = true;
+        fail_pending(client_errc::cancelled);
+        run_timer_.cancel();
+    }
+
+    template <class CompletionToken>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void(error_code))
+    async_execute(
+        any_execution_request req,
+        execution_processor& proc,
+        diagnostics& diag,
+        CompletionToken&& token
+    )
+    {
+        std::unique_ptr<multiplexed_request> mreq(new multiplexed_request(get_executor(), req, proc, diag));
+        return asio::async_compose<CompletionToken, void(error_code)>(
+            execute_op(shared_from_this(), std::move(mreq)),
+            token,
+            get_executor()
+        );
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
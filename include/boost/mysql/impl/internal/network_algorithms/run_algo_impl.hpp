@@ -8,7 +8,10 @@
 #ifndef BOOST_MYSQL_IMPL_INTERNAL_NETWORK_ALGORITHMS_RUN_ALGO_IMPL_HPP
 #define BOOST_MYSQL_IMPL_INTERNAL_NETWORK_ALGORITHMS_RUN_ALGO_IMPL_HPP
 
+#include <boost/mysql/connection_observer.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
+#include <boost/mysql/wire_capture.hpp>
 
 #include <boost/mysql/detail/any_stream.hpp>
 
@@ -22,6 +25,7 @@
 #include <boost/asio/post.hpp>
 
 #include <cstdint>
+#include <utility>
 
 namespace boost {
 namespace mysql {
@@ -32,15 +36,56 @@ inline asio::mutable_buffer to_buffer(span<std::uint8_t> buff) noexcept
     return asio::mutable_buffer(buff.data(), buff.size());
 }
 
+// The I/O operation reported to connection_observer for a next_action
+inline wire_event to_wire_event(next_action::type_t type) noexcept
+{
+    switch (type)
+    {
+    case next_action::type_t::read: return wire_event::read;
+    case next_action::type_t::write: return wire_event::write;
+    case next_action::type_t::ssl_handshake: return wire_event::tls_handshake;
+    case next_action::type_t::ssl_shutdown: return wire_event::tls_shutdown;
+    case next_action::type_t::connect: return wire_event::connect;
+    default: return wire_event::close;
+    }
+}
+
+// Runs the decoding requested by next_action::decode_rows() in the decoder's executor,
+// then resumes the operation in the connection's executor
+template <class Self>
+struct decode_rows_task
+{
+    connection_state_data* st;
+    any_stream* stream;
+    Self self;
+
+    void operator()()
+    {
+        st->run_pending_decode();
+        asio::post(stream->get_executor(), std::move(self));
+    }
+};
+
 struct run_algo_op : boost::asio::coroutine
 {
     any_stream& stream_;
     algo_runner runner_;
     bool has_done_io_{false};
     error_code stored_ec_;
+    wire_event current_io_{};
 
     run_algo_op(any_stream& stream, any_algo_ref algo) noexcept : stream_(stream), runner_(algo) {}
 
+    connection_observer* observer() noexcept { return runner_.conn_state().observer; }
+
+    template <class Self>
+    void post_decode_rows(Self& self)
+    {
+        auto& st = runner_.conn_state();
+        auto ex = st.row_decoder->get_executor();
+        asio::post(ex, decode_rows_task<Self>{&st, &stream_, std::move(self)});
+    }
+
     template <class Self>
     void operator()(Self& self, error_code io_ec = {}, std::size_t bytes_transferred = 0)
     {
@@ -48,6 +93,9 @@ struct run_algo_op : boost::asio::coroutine
 
         BOOST_ASIO_CORO_REENTER(*this)
         {
+            if (observer())
+                observer()->on_operation_start(runner_.conn_state().current_op);
+
             while (true)
             {
                 // Run the op
@@ -55,6 +103,8 @@ struct run_algo_op : boost::asio::coroutine
                 if (act.is_done())
                 {
                     stored_ec_ = act.error();
+                    if (observer())
+                        observer()->on_operation_finish(runner_.conn_state().current_op, stored_ec_);
                     if (!has_done_io_)
                     {
                         BOOST_ASIO_CORO_YIELD asio::post(stream_.get_executor(), std::move(self));
@@ -62,43 +112,61 @@ struct run_algo_op : boost::asio::coroutine
                     self.complete(stored_ec_);
                     BOOST_ASIO_CORO_YIELD break;
                 }
-                else if (act.type() == next_action::type_t::read)
-                {
-                    BOOST_ASIO_CORO_YIELD stream_.async_read_some(
-                        to_buffer(act.read_args().buffer),
-                        act.read_args().use_ssl,
-                        std::move(self)
-                    );
-                    has_done_io_ = true;
-                }
-                else if (act.type() == next_action::type_t::write)
-                {
-                    BOOST_ASIO_CORO_YIELD stream_.async_write_some(
-                        asio::buffer(act.write_args().buffer),
-                        act.write_args().use_ssl,
-                        std::move(self)
-                    );
-                    has_done_io_ = true;
-                }
-                else if (act.type() == next_action::type_t::ssl_handshake)
+                else if (act.type() == next_action::type_t::decode_rows)
                 {
-                    BOOST_ASIO_CORO_YIELD stream_.async_handshake(std::move(self));
-                    has_done_io_ = true;
-                }
-                else if (act.type() == next_action::type_t::ssl_shutdown)
-                {
-                    BOOST_ASIO_CORO_YIELD stream_.async_shutdown(std::move(self));
-                    has_done_io_ = true;
-                }
-                else if (act.type() == next_action::type_t::connect)
-                {
-                    BOOST_ASIO_CORO_YIELD stream_.async_connect(std::move(self));
+                    // Don't block the thread performing I/O while rows are decoded
+                    BOOST_ASIO_CORO_YIELD post_decode_rows(self);
                     has_done_io_ = true;
                 }
                 else
                 {
-                    BOOST_ASSERT(act.type() == next_action::type_t::close);
-                    stream_.close(io_ec);
+                    // Notify the observer, if any
+                    current_io_ = to_wire_event(act.type());
+                    if (observer())
+                        observer()->on_io_start(current_io_);
+
+                    // Perform the I/O
+                    if (act.type() == next_action::type_t::read)
+                    {
+                        BOOST_ASIO_CORO_YIELD stream_.async_read_some(
+                            to_buffer(act.read_args().buffer),
+                            act.read_args().use_ssl,
+                            std::move(self)
+                        );
+                        has_done_io_ = true;
+                    }
+                    else if (act.type() == next_action::type_t::write)
+                    {
+                        BOOST_ASIO_CORO_YIELD stream_.async_write_some(
+                            asio::buffer(act.write_args().buffer),
+                            act.write_args().use_ssl,
+                            std::move(self)
+                        );
+                        has_done_io_ = true;
+                    }
+                    else if (act.type() == next_action::type_t::ssl_handshake)
+                    {
+                        BOOST_ASIO_CORO_YIELD stream_.async_handshake(std::move(self));
+                        has_done_io_ = true;
+                    }
+                    else if (act.type() == next_action::type_t::ssl_shutdown)
+                    {
+                        BOOST_ASIO_CORO_YIELD stream_.async_shutdown(std::move(self));
+                        has_done_io_ = true;
+                    }
+                    else if (act.type() == next_action::type_t::connect)
+                    {
+                        BOOST_ASIO_CORO_YIELD stream_.async_connect(std::move(self));
+                        has_done_io_ = true;
+                    }
+                    else
+                    {
+                        BOOST_ASSERT(act.type() == next_action::type_t::close);
+                        stream_.close(io_ec);
+                    }
+
+                    if (observer())
+                        observer()->on_io_finish(current_io_, io_ec, bytes_transferred);
                 }
             }
         }
@@ -111,6 +179,9 @@ inline void run_algo_impl(any_stream& stream, any_algo_ref algo, error_code& ec)
     error_code io_ec;
     std::size_t bytes_transferred = 0;
     algo_runner runner(algo);
+    connection_observer* obs = runner.conn_state().observer;
+    if (obs)
+        obs->on_operation_start(runner.conn_state().current_op);
 
     while (true)
     {
@@ -122,9 +193,22 @@ inline void run_algo_impl(any_stream& stream, any_algo_ref algo, error_code& ec)
         if (act.is_done())
         {
             ec = act.error();
+            if (obs)
+                obs->on_operation_finish(runner.conn_state().current_op, ec);
             return;
         }
-        else if (act.type() == next_action::type_t::read)
+
+        // Sync operations decode in the calling thread
+        if (act.type() == next_action::type_t::decode_rows)
+        {
+            runner.conn_state().run_pending_decode();
+            continue;
+        }
+
+        if (obs)
+            obs->on_io_start(to_wire_event(act.type()));
+
+        if (act.type() == next_action::type_t::read)
         {
             bytes_transferred = stream.read_some(
                 to_buffer(act.read_args().buffer),
@@ -157,6 +241,9 @@ inline void run_algo_impl(any_stream& stream, any_algo_ref algo, error_code& ec)
             BOOST_ASSERT(act.type() == next_action::type_t::close);
             stream.close(io_ec);
         }
+
+        if (obs)
+            obs->on_io_finish(to_wire_event(act.type()), io_ec, bytes_transferred);
     }
 }
 
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_BINLOG_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_BINLOG_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+
+#include <boost/config.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Query run before requesting the binlog. Tells the server that we understand
+// event checksums, without requiring the initial rotate event to have one
+BOOST_MYSQL_DECL
+string_view binlog_setup_query(db_flavor flavor) noexcept;
+
+// COM_REGISTER_SLAVE
+struct register_replica_command
+{
+    std::uint32_t server_id;
+
+    BOOST_MYSQL_DECL std::size_t get_size() const noexcept;
+    BOOST_MYSQL_DECL void serialize(span<std::uint8_t> buffer) const noexcept;
+};
+
+// COM_BINLOG_DUMP. COM_BINLOG_DUMP_GTID is used instead if a GTID set is provided
+// or the position doesn't fit in the 4 bytes allowed by COM_BINLOG_DUMP
+struct binlog_dump_command
+{
+    std::uint32_t server_id;
+    string_view file_name;
+    std::uint64_t position;
+    span<const std::uint8_t> gtid_set;
+    bool non_blocking;
+
+    bool use_gtid() const noexcept { return !gtid_set.empty() || position > 0xffffffffu; }
+
+    BOOST_MYSQL_DECL std::size_t get_size() const noexcept;
+    BOOST_MYSQL_DECL void serialize(span<std::uint8_t> buffer) const noexcept;
+};
+
+// Decodes a value in a rows event, as described by its column's type and metadata.
+// DECIMAL values are returned as blobs containing their packed representation,
+// to be converted by decimal_to_text. Exposed for testing
+BOOST_MYSQL_DECL
+deserialize_errc deserialize_binlog_value(
+    deserialization_context& ctx,
+    binlog_column_type type,
+    std::uint16_t meta,
+    bool is_unsigned,
+    field_view& output
+) noexcept;
+
+// The maximum number of characters that decimal_to_text may write
+constexpr std::size_t max_decimal_text_size(std::uint8_t precision) noexcept { return precision + 3u; }
+
+// Converts a packed DECIMAL value to text. output must point to a buffer
+// of at least max_decimal_text_size(precision) characters. Exposed for testing
+BOOST_MYSQL_DECL
+deserialize_errc decimal_to_text(
+    span<const std::uint8_t> packed,
+    std::uint8_t precision,
+    std::uint8_t scale,
+    char* output,
+    std::size_t& output_size
+) noexcept;
+
+// Processes a message sent by the server in response to a binlog dump command.
+// On success, st contains the decoded event, if any
+BOOST_ATTRIBUTE_NODISCARD BOOST_MYSQL_DECL error_code process_binlog_message(
+    span<const std::uint8_t> message,
+    db_flavor flavor,
+    binlog_state_impl& st,
+    diagnostics& diag
+);
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/internal/protocol/binlog.ipp>
+#endif
+
+#endif
@@ -0,0 +1,1321 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_BINLOG_IPP
+#define BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_BINLOG_IPP
+
+#pragma once
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/datetime.hpp>
+
+#include <boost/mysql/impl/internal/make_string_view.hpp>
+#include <boost/mysql/impl/internal/protocol/basic_types.hpp>
+#include <boost/mysql/impl/internal/protocol/binlog.hpp>
+#include <boost/mysql/impl/internal/protocol/bit_deserialization.hpp>
+#include <boost/mysql/impl/internal/protocol/deserialize_binary_field.hpp>
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+
+#include <boost/assert.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Constants
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_event_header_byte = 0x00;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_error_header_byte = 0xff;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_eof_header_byte = 0xfe;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::size_t binlog_eof_max_size = 9;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t register_replica_command_id = 0x15;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_dump_command_id = 0x12;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_dump_gtid_command_id = 0x1e;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint16_t binlog_dump_non_block = 0x01;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint16_t binlog_through_gtid = 0x04;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::size_t binlog_header_size = 19;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::size_t binlog_checksum_size = 4;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_checksum_alg_crc32 = 1;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint16_t binlog_artificial_flag = 0x20;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::size_t binlog_table_id_size = 6;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t binlog_signedness_metadata = 1;
+
+// Packed DECIMALs store groups of 9 digits in 4 bytes. Leftover digits use fewer bytes
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::size_t decimal_digits_per_group = 9;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t decimal_group_size[] = {0, 1, 1, 2, 2, 3, 3, 4, 4, 4};
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint32_t decimal_powers_of_10[] =
+    {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t decimal_max_precision = 65;
+BOOST_MYSQL_STATIC_IF_COMPILED constexpr std::uint8_t decimal_max_scale = 30;
+
+// Helpers
+BOOST_MYSQL_STATIC_OR_INLINE
+bool binlog_test_bit(const std::uint8_t* bitmap, std::size_t pos) noexcept
+{
+    return bitmap[pos / 8u] & (1u << (pos % 8u));
+}
+
+// Unsigned integers of 1 to 8 bytes, in any byte order
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_uint(
+    deserialization_context& ctx,
+    std::size_t size,
+    bool big_endian,
+    std::uint64_t& output
+) noexcept
+{
+    BOOST_ASSERT(size <= 8u);
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    const std::uint8_t* data = ctx.first();
+    output = 0;
+    for (std::size_t i = 0; i < size; ++i)
+        output = (output << 8) | data[big_endian ? i : size - i - 1];
+    ctx.advance(size);
+    return deserialize_errc::ok;
+}
+
+// Strings and blobs, prefixed by their length, which takes length_size bytes
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_string(
+    deserialization_context& ctx,
+    std::size_t length_size,
+    bool is_blob,
+    field_view& output
+) noexcept
+{
+    std::uint64_t length = 0;
+    auto err = deserialize_binlog_uint(ctx, length_size, false, length);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (length > ctx.size())
+        return deserialize_errc::incomplete_message;
+    auto sz = static_cast<std::size_t>(length);
+    if (is_blob)
+        output = field_view(blob_view(ctx.first(), sz));
+    else
+        output = field_view(ctx.get_string(sz));
+    ctx.advance(sz);
+    return deserialize_errc::ok;
+}
+
+// Schema and table names in table map events: a length byte, the name and a NULL terminator
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_name(deserialization_context& ctx, string_view& output) noexcept
+{
+    std::uint8_t length = 0;
+    auto err = deserialize(ctx, length);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (!ctx.enough_size(length + 1u))
+        return deserialize_errc::incomplete_message;
+    output = ctx.get_string(length);
+    ctx.advance(length + 1u);
+    return deserialize_errc::ok;
+}
+
+// MEDIUMINT, which uses 3 bytes
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_int24(
+    deserialization_context& ctx,
+    bool is_unsigned,
+    field_view& output
+) noexcept
+{
+    std::uint64_t value = 0;
+    auto err = deserialize_binlog_uint(ctx, 3, false, value);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (is_unsigned)
+        output = field_view(value);
+    else
+        output = field_view(static_cast<std::int64_t>(value ^ 0x800000u) - 0x800000);  // sign extension
+    return deserialize_errc::ok;
+}
+
+// YEAR, as an offset from 1900. Zero represents the zero year
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_year(deserialization_context& ctx, field_view& output) noexcept
+{
+    std::uint8_t value = 0;
+    auto err = deserialize(ctx, value);
+    if (err != deserialize_errc::ok)
+        return err;
+    output = field_view(static_cast<std::uint64_t>(value ? value + 1900u : 0u));
+    return deserialize_errc::ok;
+}
+
+// DATE, packed as day (5 bits), month (4 bits) and year (15 bits)
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_date(deserialization_context& ctx, field_view& output) noexcept
+{
+    std::uint64_t value = 0;
+    auto err = deserialize_binlog_uint(ctx, 3, false, value);
+    if (err != deserialize_errc::ok)
+        return err;
+    auto day = value & 0x1fu;
+    auto month = (value >> 5) & 0x0fu;
+    auto year = value >> 9;
+    if (year > max_year || month > max_month)
+        return deserialize_errc::protocol_value_error;
+    output = field_view(date(
+        static_cast<std::uint16_t>(year),
+        static_cast<std::uint8_t>(month),
+        static_cast<std::uint8_t>(day)
+    ));
+    return deserialize_errc::ok;
+}
+
+// Fractional seconds in DATETIME2, TIMESTAMP2 and TIME2, stored big-endian in (decimals + 1) / 2 bytes
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_micros(
+    deserialization_context& ctx,
+    std::uint16_t decimals,
+    std::uint32_t& output
+) noexcept
+{
+    if (decimals > 6u)
+        return deserialize_errc::protocol_value_error;
+    std::size_t size = (decimals + 1u) / 2u;
+    std::uint64_t value = 0;
+    auto err = deserialize_binlog_uint(ctx, size, true, value);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    // 1 byte holds hundredths of a second, 2 bytes hold tenths of a millisecond, 3 bytes hold microseconds
+    constexpr std::uint32_t multipliers[] = {0, 10000, 100, 1};
+    value *= multipliers[size];
+    if (value > max_micro)
+        return deserialize_errc::protocol_value_error;
+    output = static_cast<std::uint32_t>(value);
+    return deserialize_errc::ok;
+}
+
+// DATETIME2. 5 big-endian bytes with an offset, followed by the fractional part. Packs
+// year * 13 + month (17 bits), day (5 bits), hour (5 bits), minute (6 bits) and second (6 bits)
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_datetime2(
+    deserialization_context& ctx,
+    std::uint16_t decimals,
+    field_view& output
+) noexcept
+{
+    constexpr std::uint64_t offset = 0x8000000000u;
+    std::uint64_t packed = 0;
+    std::uint32_t micros = 0;
+    auto err = deserialize_binlog_uint(ctx, 5, true, packed);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize_binlog_micros(ctx, decimals, micros);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    // Datetimes can't be negative
+    if (packed < offset)
+        return deserialize_errc::protocol_value_error;
+    packed -= offset;
+
+    auto ymd = packed >> 17;
+    auto year_month = ymd >> 5;
+    auto hms = packed & 0x1ffffu;
+    auto year = year_month / 13u;
+    auto month = year_month % 13u;
+    auto day = ymd & 0x1fu;
+    auto hour = hms >> 12;
+    auto minute = (hms >> 6) & 0x3fu;
+    auto second = hms & 0x3fu;
+    if (year > max_year || hour > max_hour || minute > max_min || second > max_sec)
+        return deserialize_errc::protocol_value_error;
+
+    output = field_view(datetime(
+        static_cast<std::uint16_t>(year),
+        static_cast<std::uint8_t>(month),
+        static_cast<std::uint8_t>(day),
+        static_cast<std::uint8_t>(hour),
+        static_cast<std::uint8_t>(minute),
+        static_cast<std::uint8_t>(second),
+        micros
+    ));
+    return deserialize_errc::ok;
+}
+
+// TIMESTAMP2. Seconds since the epoch, as 4 big-endian bytes, followed by the fractional part
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_timestamp2(
+    deserialization_context& ctx,
+    std::uint16_t decimals,
+    field_view& output
+) noexcept
+{
+    std::uint64_t secs = 0;
+    std::uint32_t micros = 0;
+    auto err = deserialize_binlog_uint(ctx, 4, true, secs);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize_binlog_micros(ctx, decimals, micros);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    if (secs == 0u && micros == 0u)
+    {
+        output = field_view(datetime());  // the zero timestamp
+    }
+    else
+    {
+        // The maximum value (year 2106) is always in range
+        auto since_epoch = std::chrono::seconds(secs) + std::chrono::microseconds(micros);
+        output = field_view(datetime(datetime::time_point(since_epoch)));
+    }
+    return deserialize_errc::ok;
+}
+
+// Shared by TIME and TIME2
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc make_binlog_time(
+    bool is_negative,
+    std::uint64_t hours,
+    std::uint64_t minutes,
+    std::uint64_t seconds,
+    std::uint64_t micros,
+    field_view& output
+) noexcept
+{
+    constexpr std::uint64_t max_time_hours = 838;
+    if (hours > max_time_hours || minutes > max_min || seconds > max_sec || micros > max_micro)
+        return deserialize_errc::protocol_value_error;
+    auto res = std::chrono::hours(hours) + std::chrono::minutes(minutes) + std::chrono::seconds(seconds) +
+               std::chrono::microseconds(micros);
+    output = field_view(time(is_negative ? -res : res));
+    return deserialize_errc::ok;
+}
+
+// TIME2. 3 big-endian bytes packing the sign (1 bit), hour (10 bits), minute (6 bits)
+// and second (6 bits), followed by the fractional part. Both parts are stored with
+// an offset, so values compare correctly as unsigned integers
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_time2(
+    deserialization_context& ctx,
+    std::uint16_t decimals,
+    field_view& output
+) noexcept
+{
+    if (decimals > 6u)
+        return deserialize_errc::protocol_value_error;
+    std::size_t frac_size = (decimals + 1u) / 2u;
+    std::uint64_t raw = 0;
+    auto err = deserialize_binlog_uint(ctx, 3u + frac_size, true, raw);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    // Compute the value as a signed integer, with the integer part in the upper bits
+    // and the microseconds in the lower 24
+    std::int64_t packed = 0;
+    if (frac_size == 3u)
+    {
+        packed = static_cast<std::int64_t>(raw) - 0x800000000000;
+    }
+    else
+    {
+        std::size_t frac_bits = 8u * frac_size;
+        auto int_part = static_cast<std::int64_t>(raw >> frac_bits) - 0x800000;
+        auto frac = static_cast<std::int64_t>(raw & ((std::uint64_t(1) << frac_bits) - 1u));
+        if (int_part < 0 && frac != 0)
+        {
+            // Negative values with a fractional part are stored as
+            // the next integer plus a negative fraction
+            ++int_part;
+            frac -= std::int64_t(1) << frac_bits;
+        }
+        packed = int_part * 0x1000000 + frac * (frac_size == 1u ? 10000 : 100);
+    }
+
+    bool is_negative = packed < 0;
+    auto abs_value = static_cast<std::uint64_t>(is_negative ? -packed : packed);
+    auto hms = abs_value >> 24;
+    return make_binlog_time(
+        is_negative,
+        (hms >> 12) & 0x3ffu,
+        (hms >> 6) & 0x3fu,
+        hms & 0x3fu,
+        abs_value & 0xffffffu,
+        output
+    );
+}
+
+// Pre-5.6 TIME. A signed integer of 3 bytes, representing HHMMSS in decimal
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_old_time(deserialization_context& ctx, field_view& output) noexcept
+{
+    std::uint64_t raw = 0;
+    auto err = deserialize_binlog_uint(ctx, 3, false, raw);
+    if (err != deserialize_errc::ok)
+        return err;
+    auto value = static_cast<std::int64_t>(raw ^ 0x800000u) - 0x800000;  // sign extension
+    bool is_negative = value < 0;
+    auto abs_value = static_cast<std::uint64_t>(is_negative ? -value : value);
+    return make_binlog_time(
+        is_negative,
+        abs_value / 10000u,
+        abs_value / 100u % 100u,
+        abs_value % 100u,
+        0u,
+        output
+    );
+}
+
+// Pre-5.6 DATETIME. An integer of 8 bytes, representing YYYYMMDDHHMMSS in decimal
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_old_datetime(deserialization_context& ctx, field_view& output) noexcept
+{
+    std::uint64_t value = 0;
+    auto err = deserialize_binlog_uint(ctx, 8, false, value);
+    if (err != deserialize_errc::ok)
+        return err;
+    auto ymd = value / 1000000u;
+    auto hms = value % 1000000u;
+    auto year = ymd / 10000u;
+    auto month = ymd / 100u % 100u;
+    auto day = ymd % 100u;
+    auto hour = hms / 10000u;
+    auto minute = hms / 100u % 100u;
+    auto second = hms % 100u;
+    if (year > max_year || month > max_month || day > max_day || hour > max_hour || minute > max_min ||
+        second > max_sec)
+        return deserialize_errc::protocol_value_error;
+    output = field_view(datetime(
+        static_cast<std::uint16_t>(year),
+        static_cast<std::uint8_t>(month),
+        static_cast<std::uint8_t>(day),
+        static_cast<std::uint8_t>(hour),
+        static_cast<std::uint8_t>(minute),
+        static_cast<std::uint8_t>(second)
+    ));
+    return deserialize_errc::ok;
+}
+
+// Pre-5.6 TIMESTAMP. Seconds since the epoch, as a 4 byte integer
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_old_timestamp(deserialization_context& ctx, field_view& output) noexcept
+{
+    std::uint32_t secs = 0;
+    auto err = deserialize(ctx, secs);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (secs == 0u)
+        output = field_view(datetime());
+    else
+        output = field_view(datetime(datetime::time_point(std::chrono::seconds(secs))));
+    return deserialize_errc::ok;
+}
+
+// CHAR, BINARY, ENUM and SET columns, which are all reported as STRING.
+// The metadata contains the real type and the maximum length
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_string_column(
+    deserialization_context& ctx,
+    std::uint16_t meta,
+    field_view& output
+) noexcept
+{
+    auto byte0 = static_cast<std::uint8_t>(meta >> 8);
+    auto byte1 = static_cast<std::uint8_t>(meta & 0xffu);
+    if (byte0 == static_cast<std::uint8_t>(binlog_column_type::enum_) ||
+        byte0 == static_cast<std::uint8_t>(binlog_column_type::set))
+    {
+        // ENUM and SET values are sent as their integer representation, in byte1 bytes
+        if (byte1 < 1u || byte1 > 8u)
+            return deserialize_errc::protocol_value_error;
+        std::uint64_t value = 0;
+        auto err = deserialize_binlog_uint(ctx, byte1, false, value);
+        if (err != deserialize_errc::ok)
+            return err;
+        output = field_view(value);
+        return deserialize_errc::ok;
+    }
+
+    // The maximum length in bytes has 10 bits. The upper 2 are stored XOR'ed in the real type
+    std::size_t max_length = (((byte0 & 0x30u) ^ 0x30u) << 4) | byte1;
+    return deserialize_binlog_string(ctx, max_length > 255u ? 2u : 1u, false, output);
+}
+
+// BIT. The metadata contains the number of full bytes and the number of extra bits
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_bit(
+    deserialization_context& ctx,
+    std::uint16_t meta,
+    field_view& output
+) noexcept
+{
+    std::size_t size = (meta >> 8) + ((meta & 0xffu) ? 1u : 0u);
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    auto err = deserialize_bit(ctx.get_string(size), output);
+    if (err != deserialize_errc::ok)
+        return err;
+    ctx.advance(size);
+    return deserialize_errc::ok;
+}
+
+// The number of bytes used by a packed DECIMAL
+BOOST_MYSQL_STATIC_OR_INLINE
+std::size_t packed_decimal_size(std::uint8_t precision, std::uint8_t scale) noexcept
+{
+    std::size_t int_digits = precision - scale;
+    std::size_t int_size = int_digits / decimal_digits_per_group * 4u +
+                           decimal_group_size[int_digits % decimal_digits_per_group];
+    std::size_t frac_size = scale / decimal_digits_per_group * 4u +
+                            decimal_group_size[scale % decimal_digits_per_group];
+    return int_size + frac_size;
+}
+
+// DECIMAL. The metadata contains the precision and scale. The value is
+// returned as a blob, since converting it to text requires extra space
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_decimal(
+    deserialization_context& ctx,
+    std::uint16_t meta,
+    field_view& output
+) noexcept
+{
+    auto precision = static_cast<std::uint8_t>(meta >> 8);
+    auto scale = static_cast<std::uint8_t>(meta & 0xffu);
+    if (precision == 0u || precision > decimal_max_precision || scale > decimal_max_scale ||
+        scale > precision)
+        return deserialize_errc::protocol_value_error;
+    std::size_t size = packed_decimal_size(precision, scale);
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    output = field_view(blob_view(ctx.first(), size));
+    ctx.advance(size);
+    return deserialize_errc::ok;
+}
+
+// Writes value in decimal, padding with zeros to width digits
+BOOST_MYSQL_STATIC_OR_INLINE
+char* write_decimal_digits(std::uint32_t value, std::size_t width, char* output) noexcept
+{
+    char buff[decimal_digits_per_group + 1];
+    std::size_t size = 0;
+    do
+    {
+        buff[size++] = static_cast<char>('0' + value % 10u);
+        value /= 10u;
+    } while (value);
+    while (size < width)
+        buff[size++] = '0';
+    while (size)
+        *output++ = buff[--size];
+    return output;
+}
+
+// Reads groups of digits from a packed DECIMAL
+class decimal_group_reader
+{
+    const std::uint8_t* it_;
+    std::uint8_t mask_;
+    bool first_{true};
+
+public:
+    decimal_group_reader(const std::uint8_t* first, std::uint8_t mask) noexcept : it_(first), mask_(mask) {}
+
+    bool read(std::size_t num_digits, std::uint32_t& output) noexcept
+    {
+        output = 0;
+        for (std::size_t i = 0; i < decimal_group_size[num_digits]; ++i)
+        {
+            std::uint8_t b = *it_++ ^ mask_;
+            if (first_)
+            {
+                b ^= 0x80u;  // the sign bit
+                first_ = false;
+            }
+            output = (output << 8) | b;
+        }
+        return output < decimal_powers_of_10[num_digits];
+    }
+};
+
+// Size of the metadata stored in table map events, by column type
+BOOST_MYSQL_STATIC_OR_INLINE
+std::size_t binlog_meta_size(binlog_column_type type) noexcept
+{
+    switch (type)
+    {
+    case binlog_column_type::float_:
+    case binlog_column_type::double_:
+    case binlog_column_type::tiny_blob:
+    case binlog_column_type::medium_blob:
+    case binlog_column_type::long_blob:
+    case binlog_column_type::blob:
+    case binlog_column_type::json:
+    case binlog_column_type::geometry:
+    case binlog_column_type::timestamp2:
+    case binlog_column_type::datetime2:
+    case binlog_column_type::time2: return 1u;
+    case binlog_column_type::varchar:
+    case binlog_column_type::var_string:
+    case binlog_column_type::bit:
+    case binlog_column_type::newdecimal:
+    case binlog_column_type::string:
+    case binlog_column_type::enum_:
+    case binlog_column_type::set: return 2u;
+    default: return 0u;
+    }
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE
+bool binlog_meta_is_big_endian(binlog_column_type type) noexcept
+{
+    return type == binlog_column_type::newdecimal || type == binlog_column_type::string ||
+           type == binlog_column_type::enum_ || type == binlog_column_type::set;
+}
+
+// The types described by the SIGNEDNESS optional metadata field
+BOOST_MYSQL_STATIC_OR_INLINE
+bool is_binlog_numeric_type(binlog_column_type type) noexcept
+{
+    switch (type)
+    {
+    case binlog_column_type::tiny:
+    case binlog_column_type::short_:
+    case binlog_column_type::int24:
+    case binlog_column_type::long_:
+    case binlog_column_type::longlong:
+    case binlog_column_type::newdecimal:
+    case binlog_column_type::float_:
+    case binlog_column_type::double_: return true;
+    default: return false;
+    }
+}
+
+// MySQL 5.6.1 and later append a checksum algorithm and a checksum to format
+// description events, even if checksums are disabled. server_version is NULL-padded
+BOOST_MYSQL_STATIC_OR_INLINE
+bool binlog_version_has_checksum(const std::array<char, 50>& server_version) noexcept
+{
+    unsigned parts[3]{};
+    std::size_t current = 0;
+    for (char c : server_version)
+    {
+        if (c >= '0' && c <= '9' && parts[current] < 1000u)
+            parts[current] = parts[current] * 10u + static_cast<unsigned>(c - '0');
+        else if (c == '.' && current < 2u)
+            ++current;
+        else
+            break;
+    }
+    return parts[0] > 5u || (parts[0] == 5u && (parts[1] > 6u || (parts[1] == 6u && parts[2] >= 1u)));
+}
+
+// Format description. Determines whether the events that follow it have checksums.
+// Removes the checksum algorithm and checksum from body, if present
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_format_description_event(
+    span<const std::uint8_t>& body,
+    binlog_state_impl& st
+) noexcept
+{
+    // binlog version, server version, creation timestamp, header length, post-header lengths
+    deserialization_context ctx(body);
+    std::uint16_t binlog_version = 0;
+    string_fixed<50> server_version{};
+    std::uint32_t created = 0;
+    std::uint8_t header_length = 0;
+    auto err = deserialize(ctx, binlog_version, server_version, created, header_length);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (binlog_version != 4u || header_length != binlog_header_size)
+        return deserialize_errc::server_unsupported;
+
+    st.has_checksum = false;
+    if (binlog_version_has_checksum(server_version.value))
+    {
+        constexpr std::size_t trailer_size = 1u + binlog_checksum_size;
+        if (!ctx.enough_size(trailer_size))
+            return deserialize_errc::incomplete_message;
+        st.has_checksum = body[body.size() - trailer_size] == binlog_checksum_alg_crc32;
+        body = body.first(body.size() - trailer_size);
+    }
+    return deserialize_errc::ok;
+}
+
+// Rotate: position and name of the next file
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_rotate_event(span<const std::uint8_t> body, binlog_state_impl& st)
+{
+    deserialization_context ctx(body);
+    string_eof next_file;
+    auto err = deserialize(ctx, st.rotate_position, next_file);
+    if (err != deserialize_errc::ok)
+        return err;
+    st.rotate_file = next_file.value;
+
+    // Table IDs are only meaningful within a file
+    st.file_name.assign(next_file.value.data(), next_file.value.size());
+    st.position = st.rotate_position;
+    st.tables.clear();
+    return deserialize_errc::ok;
+}
+
+// Query: thread ID, execution time, schema length, error code, status variables length,
+// status variables, NULL-terminated schema and query
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_query_event(span<const std::uint8_t> body, binlog_state_impl& st) noexcept
+{
+    deserialization_context ctx(body);
+    std::uint32_t thread_id = 0;
+    std::uint32_t exec_time = 0;
+    std::uint8_t schema_length = 0;
+    std::uint16_t error_code = 0;
+    std::uint16_t status_vars_length = 0;
+    auto err = deserialize(ctx, thread_id, exec_time, schema_length, error_code, status_vars_length);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (!ctx.enough_size(status_vars_length + schema_length + 1u))
+        return deserialize_errc::incomplete_message;
+    ctx.advance(status_vars_length);
+    st.query_schema = ctx.get_string(schema_length);
+    ctx.advance(schema_length + 1u);
+    st.query = ctx.get_string(ctx.size());
+    return deserialize_errc::ok;
+}
+
+// MySQL GTID: flags, source UUID and transaction number. Other fields are ignored
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_gtid_event(span<const std::uint8_t> body, binlog_state_impl& st) noexcept
+{
+    deserialization_context ctx(body);
+    std::uint8_t flags = 0;
+    auto err = deserialize(ctx, flags);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = ctx.copy(st.gtid_source_id.data(), st.gtid_source_id.size());
+    if (err != deserialize_errc::ok)
+        return err;
+    st.gtid_domain_id = 0;
+    return deserialize(ctx, st.gtid_sequence_number);
+}
+
+// MariaDB GTID: sequence number and domain ID. The server ID is in the event header
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_mariadb_gtid_event(span<const std::uint8_t> body, binlog_state_impl& st) noexcept
+{
+    deserialization_context ctx(body);
+    st.gtid_source_id = std::array<std::uint8_t, 16>{};
+    return deserialize(ctx, st.gtid_sequence_number, st.gtid_domain_id);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_xid_event(span<const std::uint8_t> body, binlog_state_impl& st) noexcept
+{
+    deserialization_context ctx(body);
+    return deserialize(ctx, st.xid);
+}
+
+// Table map: table ID, flags, schema and table names, column count, column types, metadata block,
+// NULL bitmap and optional metadata (MySQL 8.0.1+). The contents are copied into st.tables
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc process_table_map_event(span<const std::uint8_t> body, binlog_state_impl& st)
+{
+    deserialization_context ctx(body);
+    std::uint64_t table_id = 0;
+    std::uint16_t flags = 0;
+    string_view schema, table_name;
+    int_lenenc num_columns;
+    auto err = deserialize_binlog_uint(ctx, binlog_table_id_size, false, table_id);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize(ctx, flags);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize_binlog_name(ctx, schema);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize_binlog_name(ctx, table_name);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize(ctx, num_columns);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    // Types
+    if (num_columns.value > ctx.size())
+        return deserialize_errc::incomplete_message;
+    auto n = static_cast<std::size_t>(num_columns.value);
+    const std::uint8_t* types = ctx.first();
+    ctx.advance(n);
+
+    // Metadata block and NULL bitmap
+    string_lenenc meta_block;
+    err = deserialize(ctx, meta_block);
+    if (err != deserialize_errc::ok)
+        return err;
+    std::size_t bitmap_size = (n + 7u) / 8u;
+    if (!ctx.enough_size(bitmap_size))
+        return deserialize_errc::incomplete_message;
+    const std::uint8_t* null_bitmap = ctx.first();
+    ctx.advance(bitmap_size);
+
+    // Store the table, re-using memory if it was mapped before
+    auto& table = st.tables[table_id];
+    table.table_id = table_id;
+    table.schema.assign(schema.data(), schema.size());
+    table.table.assign(table_name.data(), table_name.size());
+    table.column_types.resize(n);
+    table.column_meta.resize(n);
+    table.column_flags.resize(n);
+    deserialization_context meta_ctx(to_span(meta_block.value));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto type = static_cast<binlog_column_type>(types[i]);
+        table.column_types[i] = type;
+        table.column_flags[i] = binlog_test_bit(null_bitmap, i) ? binlog_column_nullable : 0u;
+
+        std::uint64_t meta = 0;
+        auto meta_size = binlog_meta_size(type);
+        err = deserialize_binlog_uint(meta_ctx, meta_size, binlog_meta_is_big_endian(type), meta);
+        if (err != deserialize_errc::ok)
+            return err;
+        table.column_meta[i] = static_cast<std::uint16_t>(meta);
+    }
+    if (!meta_ctx.empty())
+        return deserialize_errc::protocol_value_error;
+
+    // Optional metadata, as type-length-value fields. We only use signedness,
+    // a bitmap with a bit per numeric column, most significant bit first
+    while (!ctx.empty())
+    {
+        std::uint8_t field_type = 0;
+        string_lenenc field_value;
+        err = deserialize(ctx, field_type, field_value);
+        if (err != deserialize_errc::ok)
+            return err;
+        if (field_type == binlog_signedness_metadata)
+        {
+            auto bitmap = to_span(field_value.value);
+            std::size_t numeric_index = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (!is_binlog_numeric_type(table.column_types[i]))
+                    continue;
+                std::size_t byte = numeric_index / 8u;
+                if (byte >= bitmap.size())
+                    return deserialize_errc::incomplete_message;
+                if (bitmap[byte] & (0x80u >> (numeric_index % 8u)))
+                    table.column_flags[i] |= binlog_column_unsigned;
+                ++numeric_index;
+            }
+        }
+    }
+
+    st.table = &table;
+    return deserialize_errc::ok;
+}
+
+// A row image: a NULL bitmap with a bit per present column, followed by the non-NULL values.
+// Appends a field per column to st.fields. Columns not present in the image are NULL
+BOOST_MYSQL_STATIC_OR_INLINE
+deserialize_errc deserialize_binlog_row_image(
+    deserialization_context& ctx,
+    const binlog_table_data& table,
+    const std::uint8_t* present,
+    std::size_t num_present,
+    binlog_state_impl& st
+)
+{
+    std::size_t null_bitmap_size = (num_present + 7u) / 8u;
+    if (!ctx.enough_size(null_bitmap_size))
+        return deserialize_errc::incomplete_message;
+    const std::uint8_t* null_bitmap = ctx.first();
+    ctx.advance(null_bitmap_size);
+
+    std::size_t n = table.column_types.size();
+    std::size_t offset = st.fields.size();
+    st.fields.resize(offset + n);
+    std::size_t present_index = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (!binlog_test_bit(present, i) || binlog_test_bit(null_bitmap, present_index++))
+            continue;
+        auto type = table.column_types[i];
+        auto err = deserialize_binlog_value(
+            ctx,
+            type,
+            table.column_meta[i],
+            (table.column_flags[i] & binlog_column_unsigned) != 0u,
+            st.fields[offset + i]
+        );
+        if (err != deserialize_errc::ok)
+            return err;
+        if (type == binlog_column_type::newdecimal)
+            st.pending_decimals.push_back(offset + i);
+    }
+    return deserialize_errc::ok;
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE
+std::size_t binlog_count_bits(const std::uint8_t* bitmap, std::size_t num_bits) noexcept
+{
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < num_bits; ++i)
+        res += binlog_test_bit(bitmap, i);
+    return res;
+}
+
+// Rows events: table ID, flags, extra data (v2 only), column count, present column bitmaps
+// and rows. Each row has a before image, an after image or both
+BOOST_MYSQL_STATIC_OR_INLINE
+error_code process_rows_event(
+    span<const std::uint8_t> body,
+    bool is_v2,
+    bool has_before_image,
+    bool has_after_image,
+    binlog_state_impl& st
+)
+{
+    deserialization_context ctx(body);
+    std::uint64_t table_id = 0;
+    std::uint16_t flags = 0;
+    int_lenenc num_columns;
+    auto err = deserialize_binlog_uint(ctx, binlog_table_id_size, false, table_id);
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+    err = deserialize(ctx, flags);
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+    if (is_v2)
+    {
+        // The length includes itself
+        std::uint16_t extra_data_length = 0;
+        err = deserialize(ctx, extra_data_length);
+        if (err != deserialize_errc::ok)
+            return to_error_code(err);
+        if (extra_data_length < 2u)
+            return client_errc::protocol_value_error;
+        if (!ctx.enough_size(extra_data_length - 2u))
+            return client_errc::incomplete_message;
+        ctx.advance(extra_data_length - 2u);
+    }
+    err = deserialize(ctx, num_columns);
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+
+    // Rows can only be decoded if we got the table map event for their table
+    auto it = st.tables.find(table_id);
+    if (it == st.tables.end())
+        return client_errc::protocol_value_error;
+    const binlog_table_data& table = it->second;
+    std::size_t n = table.column_types.size();
+    if (num_columns.value != n)
+        return client_errc::protocol_value_error;
+
+    // Present column bitmaps
+    std::size_t bitmap_size = (n + 7u) / 8u;
+    st.present_before = {};
+    st.present_after = {};
+    std::size_t num_present_before = 0, num_present_after = 0;
+    if (has_before_image)
+    {
+        if (!ctx.enough_size(bitmap_size))
+            return client_errc::incomplete_message;
+        st.present_before = span<const std::uint8_t>(ctx.first(), bitmap_size);
+        num_present_before = binlog_count_bits(ctx.first(), n);
+        ctx.advance(bitmap_size);
+    }
+    if (has_after_image)
+    {
+        if (!ctx.enough_size(bitmap_size))
+            return client_errc::incomplete_message;
+        st.present_after = span<const std::uint8_t>(ctx.first(), bitmap_size);
+        num_present_after = binlog_count_bits(ctx.first(), n);
+        ctx.advance(bitmap_size);
+    }
+
+    // Rows without any present column don't use any space, and can't be told apart
+    if (num_present_before == 0u && num_present_after == 0u && !ctx.empty())
+        return client_errc::protocol_value_error;
+
+    // Rows
+    st.table = &table;
+    st.has_before_image = has_before_image;
+    st.has_after_image = has_after_image;
+    st.num_rows = 0;
+    st.fields.clear();
+    st.pending_decimals.clear();
+    while (!ctx.empty())
+    {
+        if (has_before_image)
+        {
+            err = deserialize_binlog_row_image(ctx, table, st.present_before.data(), num_present_before, st);
+            if (err != deserialize_errc::ok)
+                return to_error_code(err);
+        }
+        if (has_after_image)
+        {
+            err = deserialize_binlog_row_image(ctx, table, st.present_after.data(), num_present_after, st);
+            if (err != deserialize_errc::ok)
+                return to_error_code(err);
+        }
+        ++st.num_rows;
+    }
+
+    // Convert DECIMALs to text. All buffer space is allocated first, since
+    // fields point into it
+    if (!st.pending_decimals.empty())
+    {
+        std::size_t buffer_size = 0;
+        for (std::size_t idx : st.pending_decimals)
+            buffer_size += max_decimal_text_size(static_cast<std::uint8_t>(table.column_meta[idx % n] >> 8));
+        st.decimal_buffer.resize(buffer_size);
+        char* out = &st.decimal_buffer[0];
+        for (std::size_t idx : st.pending_decimals)
+        {
+            auto meta = table.column_meta[idx % n];
+            auto packed = st.fields[idx].get_blob();
+            std::size_t size = 0;
+            err = decimal_to_text(
+                span<const std::uint8_t>(packed.data(), packed.size()),
+                static_cast<std::uint8_t>(meta >> 8),
+                static_cast<std::uint8_t>(meta & 0xffu),
+                out,
+                size
+            );
+            if (err != deserialize_errc::ok)
+                return to_error_code(err);
+            st.fields[idx] = field_view(string_view(out, size));
+            out += size;
+        }
+    }
+
+    return error_code();
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::string_view boost::mysql::detail::binlog_setup_query(db_flavor flavor) noexcept
+{
+    // Setting the checksum variables makes the server send us checksums, as configured.
+    // Both names are set to support servers before and after the replication terminology change
+    return flavor == db_flavor::mariadb
+               ? make_string_view(
+                     "SET @master_binlog_checksum = 'NONE', @source_binlog_checksum = 'NONE', "
+                     "@mariadb_slave_capability = 4"
+                 )
+               : make_string_view("SET @master_binlog_checksum = 'NONE', @source_binlog_checksum = 'NONE'");
+}
+
+std::size_t boost::mysql::detail::register_replica_command::get_size() const noexcept
+{
+    // command ID, server ID, host, user and password (empty), port, rank and source ID
+    return 1u + 4u + 3u + 2u + 4u + 4u;
+}
+
+void boost::mysql::detail::register_replica_command::serialize(span<std::uint8_t> buff) const noexcept
+{
+    BOOST_ASSERT(buff.size() >= get_size());
+    serialization_context ctx(buff.data());
+    std::uint8_t empty_string_length = 0;
+    std::uint16_t port = 0;
+    std::uint32_t rank = 0;
+    std::uint32_t source_id = 0;
+    ::boost::mysql::detail::serialize(
+        ctx,
+        register_replica_command_id,
+        server_id,
+        empty_string_length,
+        empty_string_length,
+        empty_string_length,
+        port,
+        rank,
+        source_id
+    );
+}
+
+std::size_t boost::mysql::detail::binlog_dump_command::get_size() const noexcept
+{
+    if (use_gtid())
+    {
+        // command ID, flags, server ID, file name length, file name, position, GTID set length and GTID set
+        std::size_t res = 1u + 2u + 4u + 4u + file_name.size() + 8u;
+        if (!gtid_set.empty())
+            res += 4u + gtid_set.size();
+        return res;
+    }
+    else
+    {
+        // command ID, position, flags, server ID, file name
+        return 1u + 4u + 2u + 4u + file_name.size();
+    }
+}
+
+void boost::mysql::detail::binlog_dump_command::serialize(span<std::uint8_t> buff) const noexcept
+{
+    BOOST_ASSERT(buff.size() >= get_size());
+    serialization_context ctx(buff.data());
+    std::uint16_t flags = non_blocking ? binlog_dump_non_block : 0u;
+    if (use_gtid())
+    {
+        if (!gtid_set.empty())
+            flags |= binlog_through_gtid;
+        ::boost::mysql::detail::serialize(
+            ctx,
+            binlog_dump_gtid_command_id,
+            flags,
+            server_id,
+            static_cast<std::uint32_t>(file_name.size()),
+            string_eof{file_name},
+            position
+        );
+        if (!gtid_set.empty())
+        {
+            ::boost::mysql::detail::serialize(ctx, static_cast<std::uint32_t>(gtid_set.size()));
+            ctx.write(gtid_set.data(), gtid_set.size());
+        }
+    }
+    else
+    {
+        ::boost::mysql::detail::serialize(
+            ctx,
+            binlog_dump_command_id,
+            static_cast<std::uint32_t>(position),
+            flags,
+            server_id,
+            string_eof{file_name}
+        );
+    }
+}
+
+boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_binlog_value(
+    deserialization_context& ctx,
+    binlog_column_type type,
+    std::uint16_t meta,
+    bool is_unsigned,
+    field_view& output
+) noexcept
+{
+    switch (type)
+    {
+    case binlog_column_type::tiny:
+        return is_unsigned ? deserialize_binary_field_int_impl<std::uint64_t, std::uint8_t>(ctx, output)
+                           : deserialize_binary_field_int_impl<std::int64_t, std::int8_t>(ctx, output);
+    case binlog_column_type::short_:
+        return is_unsigned ? deserialize_binary_field_int_impl<std::uint64_t, std::uint16_t>(ctx, output)
+                           : deserialize_binary_field_int_impl<std::int64_t, std::int16_t>(ctx, output);
+    case binlog_column_type::int24: return deserialize_binlog_int24(ctx, is_unsigned, output);
+    case binlog_column_type::long_:
+        return is_unsigned ? deserialize_binary_field_int_impl<std::uint64_t, std::uint32_t>(ctx, output)
+                           : deserialize_binary_field_int_impl<std::int64_t, std::int32_t>(ctx, output);
+    case binlog_column_type::longlong:
+        return is_unsigned ? deserialize_binary_field_int_impl<std::uint64_t, std::uint64_t>(ctx, output)
+                           : deserialize_binary_field_int_impl<std::int64_t, std::int64_t>(ctx, output);
+    case binlog_column_type::float_: return deserialize_binary_field_float<float>(ctx, output);
+    case binlog_column_type::double_: return deserialize_binary_field_float<double>(ctx, output);
+    case binlog_column_type::newdecimal: return deserialize_binlog_decimal(ctx, meta, output);
+    case binlog_column_type::year: return deserialize_binlog_year(ctx, output);
+    case binlog_column_type::date:
+    case binlog_column_type::newdate: return deserialize_binlog_date(ctx, output);
+    case binlog_column_type::time: return deserialize_binlog_old_time(ctx, output);
+    case binlog_column_type::time2: return deserialize_binlog_time2(ctx, meta, output);
+    case binlog_column_type::datetime: return deserialize_binlog_old_datetime(ctx, output);
+    case binlog_column_type::datetime2: return deserialize_binlog_datetime2(ctx, meta, output);
+    case binlog_column_type::timestamp: return deserialize_binlog_old_timestamp(ctx, output);
+    case binlog_column_type::timestamp2: return deserialize_binlog_timestamp2(ctx, meta, output);
+    case binlog_column_type::varchar:
+    case binlog_column_type::var_string:
+        return deserialize_binlog_string(ctx, meta > 255u ? 2u : 1u, false, output);
+    case binlog_column_type::string:
+    case binlog_column_type::enum_:
+    case binlog_column_type::set: return deserialize_binlog_string_column(ctx, meta, output);
+    case binlog_column_type::bit: return deserialize_binlog_bit(ctx, meta, output);
+    case binlog_column_type::tiny_blob:
+    case binlog_column_type::medium_blob:
+    case binlog_column_type::long_blob:
+    case binlog_column_type::blob:
+    case binlog_column_type::json:
+    case binlog_column_type::geometry:
+        // The metadata contains the size of the length prefix. TEXT columns are also sent
+        // as blobs, since the table map doesn't include their character set
+        if (meta < 1u || meta > 4u)
+            return deserialize_errc::protocol_value_error;
+        return deserialize_binlog_string(ctx, meta, true, output);
+    default: return deserialize_errc::server_unsupported;
+    }
+}
+
+boost::mysql::detail::deserialize_errc boost::mysql::detail::decimal_to_text(
+    span<const std::uint8_t> packed,
+    std::uint8_t precision,
+    std::uint8_t scale,
+    char* output,
+    std::size_t& output_size
+) noexcept
+{
+    // Packed DECIMALs store the integer and fractional parts as groups of 9 digits,
+    // big-endian, with any leftover integer digits first and leftover fractional digits last.
+    // The most significant bit is inverted, so that values compare correctly as bytes.
+    // Negative values have all their bits inverted
+    BOOST_ASSERT(scale <= precision);
+    if (packed.size() != packed_decimal_size(precision, scale))
+        return deserialize_errc::protocol_value_error;
+    std::size_t int_digits = precision - scale;
+    bool is_negative = !(packed[0] & 0x80u);
+    decimal_group_reader reader(packed.data(), is_negative ? 0xffu : 0x00u);
+    char* out = output;
+    std::uint32_t group = 0;
+
+    // Integer part, skipping leading zeros
+    if (is_negative)
+        *out++ = '-';
+    char* int_part_first = out;
+    std::size_t leftover_int_digits = int_digits % decimal_digits_per_group;
+    if (leftover_int_digits)
+    {
+        if (!reader.read(leftover_int_digits, group))
+            return deserialize_errc::protocol_value_error;
+        if (group)
+            out = write_decimal_digits(group, 0, out);
+    }
+    for (std::size_t i = 0; i < int_digits / decimal_digits_per_group; ++i)
+    {
+        if (!reader.read(decimal_digits_per_group, group))
+            return deserialize_errc::protocol_value_error;
+        if (out != int_part_first)
+            out = write_decimal_digits(group, decimal_digits_per_group, out);
+        else if (group)
+            out = write_decimal_digits(group, 0, out);
+    }
+    if (out == int_part_first)
+        *out++ = '0';
+
+    // Fractional part, with all its digits
+    if (scale)
+    {
+        *out++ = '.';
+        for (std::size_t i = 0; i < scale / decimal_digits_per_group; ++i)
+        {
+            if (!reader.read(decimal_digits_per_group, group))
+                return deserialize_errc::protocol_value_error;
+            out = write_decimal_digits(group, decimal_digits_per_group, out);
+        }
+        std::size_t leftover_frac_digits = scale % decimal_digits_per_group;
+        if (leftover_frac_digits)
+        {
+            if (!reader.read(leftover_frac_digits, group))
+                return deserialize_errc::protocol_value_error;
+            out = write_decimal_digits(group, leftover_frac_digits, out);
+        }
+    }
+
+    output_size = static_cast<std::size_t>(out - output);
+    BOOST_ASSERT(output_size <= max_decimal_text_size(precision));
+    return deserialize_errc::ok;
+}
+
+boost::mysql::error_code boost::mysql::detail::process_binlog_message(
+    span<const std::uint8_t> message,
+    db_flavor flavor,
+    binlog_state_impl& st,
+    diagnostics& diag
+)
+{
+    st.has_event = false;
+    st.table = nullptr;
+
+    // Header byte
+    if (message.empty())
+        return client_errc::incomplete_message;
+    std::uint8_t header = message[0];
+    if (header == binlog_error_header_byte)
+    {
+        st.dumping = false;
+        return process_error_packet(message.subspan(1), flavor, diag);
+    }
+    else if (header == binlog_eof_header_byte && message.size() < binlog_eof_max_size)
+    {
+        // The server sent all the events it had, and the dump was non-blocking
+        st.dumping = false;
+        return error_code();
+    }
+    else if (header != binlog_event_header_byte)
+    {
+        return client_errc::protocol_value_error;
+    }
+
+    // Event header
+    deserialization_context ctx(message.subspan(1));
+    binlog_event_header& h = st.header;
+    auto err = deserialize(ctx, h.timestamp, h.type, h.server_id, h.event_size, h.log_pos, h.flags);
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+    if (h.event_size != message.size() - 1u)
+        return client_errc::protocol_value_error;
+
+    // Event body, without the checksum. Format description events always include the checksum
+    // algorithm and a checksum (if the server supports them), even if checksums are disabled
+    auto body = ctx.to_span();
+    auto type = static_cast<binlog_event_type>(h.type);
+    if (type == binlog_event_type::format_description)
+    {
+        err = process_format_description_event(body, st);
+        if (err != deserialize_errc::ok)
+            return to_error_code(err);
+    }
+    else if (st.has_checksum)
+    {
+        if (body.size() < binlog_checksum_size)
+            return client_errc::incomplete_message;
+        body = body.first(body.size() - binlog_checksum_size);
+    }
+
+    // Type-specific contents
+    error_code ec;
+    switch (type)
+    {
+    case binlog_event_type::rotate: ec = to_error_code(process_rotate_event(body, st)); break;
+    case binlog_event_type::query: ec = to_error_code(process_query_event(body, st)); break;
+    case binlog_event_type::xid: ec = to_error_code(process_xid_event(body, st)); break;
+    case binlog_event_type::gtid:
+    case binlog_event_type::anonymous_gtid: ec = to_error_code(process_gtid_event(body, st)); break;
+    case binlog_event_type::mariadb_gtid: ec = to_error_code(process_mariadb_gtid_event(body, st)); break;
+    case binlog_event_type::table_map: ec = to_error_code(process_table_map_event(body, st)); break;
+    case binlog_event_type::write_rows_v1: ec = process_rows_event(body, false, false, true, st); break;
+    case binlog_event_type::update_rows_v1: ec = process_rows_event(body, false, true, true, st); break;
+    case binlog_event_type::delete_rows_v1: ec = process_rows_event(body, false, true, false, st); break;
+    case binlog_event_type::write_rows: ec = process_rows_event(body, true, false, true, st); break;
+    case binlog_event_type::update_rows: ec = process_rows_event(body, true, true, true, st); break;
+    case binlog_event_type::delete_rows: ec = process_rows_event(body, true, true, false, st); break;
+    default: break;
+    }
+    if (ec)
+    {
+        st.table = nullptr;
+        return ec;
+    }
+
+    // Artificial events (like the initial rotate) are not part of the file
+    // and don't advance the position. Rotate events already updated it
+    if (type != binlog_event_type::rotate && h.log_pos != 0u && !(h.flags & binlog_artificial_flag))
+        st.position = h.log_pos;
+
+    st.data = body;
+    st.has_event = true;
+    return error_code();
+}
+
+#endif
@@ -71,12 +71,13 @@ public:
     constexpr bool operator!=(const capabilities& rhs) const noexcept { return value_ != rhs.value_; }
 };
 
+// clang-format off
 /*
  * CLIENT_LONG_PASSWORD: unset //  Use the improved version of Old Password Authentication
  * CLIENT_FOUND_ROWS: unset //  Send found rows instead of affected rows in EOF_Packet
  * CLIENT_LONG_FLAG: unset //  Get all column flags
- * CLIENT_CONNECT_WITH_DB: optional //  Database (schema) name can be specified on connect in
- * Handshake Response Packet CLIENT_NO_SCHEMA: unset //  Don't allow database.table.column
+ * CLIENT_CONNECT_WITH_DB: optional //  Database (schema) name can be specified on connect in Handshake Response Packet
+ * CLIENT_NO_SCHEMA: unset //  Don't allow database.table.column
  * CLIENT_COMPRESS: unset //  Compression protocol supported
  * CLIENT_ODBC: unset //  Special handling of ODBC behavior
  * CLIENT_LOCAL_FILES: unset //  Can use LOAD DATA LOCAL
@@ -87,29 +88,29 @@ public:
  * CLIENT_IGNORE_SIGPIPE: unset //  Client only flag
  * CLIENT_TRANSACTIONS: unset //  Client knows about transactions
  * CLIENT_RESERVED: unset //  DEPRECATED: Old flag for 4.1 protocol
- * CLIENT_RESERVED2: unset //  DEPRECATED: Old flag for 4.1 authentication
- * \ CLIENT_SECURE_CONNECTION CLIENT_MULTI_STATEMENTS: unset //  Enable/disable multi-stmt support
- * CLIENT_MULTI_RESULTS: unset //  Enable/disable multi-results
- * CLIENT_PS_MULTI_RESULTS: unset //  Multi-results and OUT parameters in PS-protocol
+ * CLIENT_RESERVED2: unset //  DEPRECATED: Old flag for 4.1 authentication \ CLIENT_SECURE_CONNECTION
+ * CLIENT_MULTI_STATEMENTS: unset //  Enable/disable multi-stmt support
+ * CLIENT_MULTI_RESULTS: optional //  Enable/disable multi-results
+ * CLIENT_PS_MULTI_RESULTS: optional //  Multi-results and OUT parameters in PS-protocol
  * CLIENT_PLUGIN_AUTH: mandatory //  Client supports plugin authentication
  * CLIENT_CONNECT_ATTRS: unset //  Client supports connection attributes
- * CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA: mandatory //  Enable authentication response packet to be
- * larger than 255 bytes CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS: unset //  Don't close the connection
- * for a user account with expired password CLIENT_SESSION_TRACK: unset //  Capable of handling
- * server state change information CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs
- * EOF_Packet and will use OK_Packet instead CLIENT_SSL_VERIFY_SERVER_CERT: unset //  Verify server
- * certificate CLIENT_OPTIONAL_RESULTSET_METADATA: unset //  The client can handle optional metadata
- * information in the resultset CLIENT_REMEMBER_OPTIONS: unset //  Don't reset the options after an
- * unsuccessful connect
+ * CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA: mandatory //  Enable authentication response packet to be larger than 255 bytes
+ * CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS: unset //  Don't close the connection for a user account with expired password
+ * CLIENT_SESSION_TRACK: optional //  Capable of handling server state change information
+ * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet instead
+ * CLIENT_SSL_VERIFY_SERVER_CERT: unset //  Verify server certificate
+ * CLIENT_OPTIONAL_RESULTSET_METADATA: unset //  The client can handle optional metadata information in the resultset
+ * CLIENT_REMEMBER_OPTIONS: unset //  Don't reset the options after an unsuccessful connect
  *
  * We pay attention to:
- * CLIENT_CONNECT_WITH_DB: optional //  Database (schema) name can be specified on connect in
- * Handshake Response Packet CLIENT_PROTOCOL_41: mandatory //  New 4.1 protocol CLIENT_PLUGIN_AUTH:
- * mandatory //  Client supports plugin authentication CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA:
- * mandatory //  Enable authentication response packet to be larger than 255 bytes
- * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet
- * instead
+ * CLIENT_CONNECT_WITH_DB: optional //  Database (schema) name can be specified on connect in Handshake Response Packet
+ * CLIENT_PROTOCOL_41: mandatory //  New 4.1 protocol
+ * CLIENT_PLUGIN_AUTH: mandatory //  Client supports plugin authentication
+ * CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA: mandatory //  Enable authentication response packet to be larger than 255 bytes
+ * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet instead
+ * CLIENT_SESSION_TRACK: optional //  Used to detect whether the session needs to be reset
  */
+// clang-format on
 
 // clang-format off
 constexpr capabilities mandatory_capabilities{
@@ -121,7 +122,8 @@ constexpr capabilities mandatory_capabilities{
 };
 // clang-format on
 
-constexpr capabilities optional_capabilities{CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS};
+constexpr capabilities optional_capabilities{
+    CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS | CLIENT_SESSION_TRACK};
 
 }  // namespace detail
 }  // namespace mysql
@@ -12,13 +12,52 @@
 #include <boost/mysql/metadata.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
 
 #include <boost/mysql/impl/internal/protocol/serialization.hpp>
 
+#include <boost/endian/detail/endian_load.hpp>
+
+#include <cmath>
+
 namespace boost {
 namespace mysql {
 namespace detail {
 
+// Building blocks, also used to decode binlog rows
+// ints
+template <class TargetType, class DeserializableType>
+deserialize_errc deserialize_binary_field_int_impl(deserialization_context& ctx, field_view& output) noexcept
+{
+    DeserializableType deser;
+    auto err = deserialize(ctx, deser);
+    if (err != deserialize_errc::ok)
+        return err;
+    output = field_view(static_cast<TargetType>(deser));
+    return deserialize_errc::ok;
+}
+
+// Floats
+template <class T>
+deserialize_errc deserialize_binary_field_float(deserialization_context& ctx, field_view& output) noexcept
+{
+    // Size check
+    if (!ctx.enough_size(sizeof(T)))
+        return deserialize_errc::incomplete_message;
+
+    // Endianness conversion. Boost.Endian support for floats start at 1.71
+    T v = boost::endian::endian_load<T, sizeof(T), boost::endian::order::little>(ctx.first());
+
+    // Nans and infs not allowed in SQL
+    if (std::isnan(v) || std::isinf(v))
+        return deserialize_errc::protocol_value_error;
+
+    // Done
+    ctx.advance(sizeof(T));
+    output = field_view(v);
+    return deserialize_errc::ok;
+}
+
 BOOST_MYSQL_DECL
 deserialize_errc deserialize_binary_field(
     deserialization_context& ctx,
@@ -26,6 +65,10 @@ deserialize_errc deserialize_binary_field(
     field_view& output
 );
 
+// Returns the function to use to decode fields described by meta
+BOOST_MYSQL_DECL
+binary_field_decoder get_binary_field_decoder(const metadata& meta) noexcept;
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -22,7 +22,6 @@
 #include <boost/mysql/impl/internal/protocol/deserialize_binary_field.hpp>
 #include <boost/mysql/impl/internal/protocol/serialization.hpp>
 
-#include <cmath>
 #include <cstddef>
 
 namespace boost {
@@ -54,28 +53,6 @@ deserialize_errc deserialize_binary_field_string(
     return deserialize_errc::ok;
 }
 
-// ints
-template <class TargetType, class DeserializableType>
-BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
-deserialize_binary_field_int_impl(deserialization_context& ctx, field_view& output) noexcept
-{
-    DeserializableType deser;
-    auto err = deserialize(ctx, deser);
-    if (err != deserialize_errc::ok)
-        return err;
-    output = field_view(static_cast<TargetType>(deser));
-    return deserialize_errc::ok;
-}
-
-template <class DeserializableTypeUnsigned, class DeserializableTypeSigned>
-BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
-deserialize_binary_field_int(const metadata& meta, deserialization_context& ctx, field_view& output) noexcept
-{
-    return meta.is_unsigned()
-               ? deserialize_binary_field_int_impl<std::uint64_t, DeserializableTypeUnsigned>(ctx, output)
-               : deserialize_binary_field_int_impl<std::int64_t, DeserializableTypeSigned>(ctx, output);
-}
-
 // Bits. These come as a binary value between 1 and 8 bytes,
 // packed in a string
 BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
@@ -88,28 +65,6 @@ deserialize_binary_field_bit(deserialization_context& ctx, field_view& output) n
     return boost::mysql::detail::deserialize_bit(buffer.value, output);
 }
 
-// Floats
-template <class T>
-BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
-deserialize_binary_field_float(deserialization_context& ctx, field_view& output) noexcept
-{
-    // Size check
-    if (!ctx.enough_size(sizeof(T)))
-        return deserialize_errc::incomplete_message;
-
-    // Endianness conversion. Boost.Endian support for floats start at 1.71
-    T v = boost::endian::endian_load<T, sizeof(T), boost::endian::order::little>(ctx.first());
-
-    // Nans and infs not allowed in SQL
-    if (std::isnan(v) || std::isinf(v))
-        return deserialize_errc::protocol_value_error;
-
-    // Done
-    ctx.advance(sizeof(T));
-    output = field_view(v);
-    return deserialize_errc::ok;
-}
-
 // Time types
 BOOST_MYSQL_STATIC_OR_INLINE
 deserialize_errc deserialize_binary_ymd(deserialization_context& ctx, boost::mysql::date& output)
@@ -270,35 +225,88 @@ deserialize_errc deserialize_binary_field_time(deserialization_context& ctx, fie
     return deserialize_errc::ok;
 }
 
+// Decoders. These share a signature, so they can be stored in a row_decoding_plan.
+// Metadata-dependant decisions that can be taken in advance (like signedness) are
+// resolved when the decoder is selected
+template <class TargetType, class DeserializableType>
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_int(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_int_impl<TargetType, DeserializableType>(ctx, output);
+}
+
+template <class T>
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_float(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_float<T>(ctx, output);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_bit(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_bit(ctx, output);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_datetime(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_datetime(ctx, output);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_date(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_date(ctx, output);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_time(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_time(ctx, output);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_string(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_string(ctx, output, false);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_binary_blob(deserialization_context& ctx, const metadata&, field_view& output) noexcept
+{
+    return deserialize_binary_field_string(ctx, output, true);
+}
+
+template <class DeserializableTypeUnsigned, class DeserializableTypeSigned>
+BOOST_MYSQL_STATIC_OR_INLINE binary_field_decoder get_binary_int_decoder(const metadata& meta) noexcept
+{
+    return meta.is_unsigned() ? &decode_binary_int<std::uint64_t, DeserializableTypeUnsigned>
+                              : &decode_binary_int<std::int64_t, DeserializableTypeSigned>;
+}
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
 
-boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_binary_field(
-    deserialization_context& ctx,
-    const metadata& meta,
-    field_view& output
-)
+boost::mysql::detail::binary_field_decoder boost::mysql::detail::get_binary_field_decoder(const metadata& meta
+) noexcept
 {
     switch (meta.type())
     {
-    case column_type::tinyint:
-        return deserialize_binary_field_int<std::uint8_t, std::int8_t>(meta, ctx, output);
+    case column_type::tinyint: return get_binary_int_decoder<std::uint8_t, std::int8_t>(meta);
     case column_type::smallint:
-    case column_type::year:
-        return deserialize_binary_field_int<std::uint16_t, std::int16_t>(meta, ctx, output);
+    case column_type::year: return get_binary_int_decoder<std::uint16_t, std::int16_t>(meta);
     case column_type::mediumint:
-    case column_type::int_:
-        return deserialize_binary_field_int<std::uint32_t, std::int32_t>(meta, ctx, output);
-    case column_type::bigint:
-        return deserialize_binary_field_int<std::uint64_t, std::int64_t>(meta, ctx, output);
-    case column_type::bit: return deserialize_binary_field_bit(ctx, output);
-    case column_type::float_: return deserialize_binary_field_float<float>(ctx, output);
-    case column_type::double_: return deserialize_binary_field_float<double>(ctx, output);
+    case column_type::int_: return get_binary_int_decoder<std::uint32_t, std::int32_t>(meta);
+    case column_type::bigint: return get_binary_int_decoder<std::uint64_t, std::int64_t>(meta);
+    case column_type::bit: return &decode_binary_bit;
+    case column_type::float_: return &decode_binary_float<float>;
+    case column_type::double_: return &decode_binary_float<double>;
     case column_type::timestamp:
-    case column_type::datetime: return deserialize_binary_field_datetime(ctx, output);
-    case column_type::date: return deserialize_binary_field_date(ctx, output);
-    case column_type::time: return deserialize_binary_field_time(ctx, output);
+    case column_type::datetime: return &decode_binary_datetime;
+    case column_type::date: return &decode_binary_date;
+    case column_type::time: return &decode_binary_time;
     // True string types
     case column_type::char_:
     case column_type::varchar:
@@ -306,14 +314,23 @@ boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_binary_
     case column_type::enum_:
     case column_type::set:
     case column_type::decimal:
-    case column_type::json: return deserialize_binary_field_string(ctx, output, false);
+    case column_type::json: return &decode_binary_string;
     // Blobs and anything else
     case column_type::binary:
     case column_type::varbinary:
     case column_type::blob:
     case column_type::geometry:
-    default: return deserialize_binary_field_string(ctx, output, true);
+    default: return &decode_binary_blob;
     }
 }
 
-#endif
\ No newline at end of file
+boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_binary_field(
+    deserialization_context& ctx,
+    const metadata& meta,
+    field_view& output
+)
+{
+    return get_binary_field_decoder(meta)(ctx, meta, output);
+}
+
+#endif
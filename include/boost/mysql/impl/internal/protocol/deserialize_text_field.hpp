@@ -12,6 +12,7 @@
 #include <boost/mysql/metadata.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
 
 #include <boost/mysql/impl/internal/protocol/serialization.hpp>
 
@@ -22,6 +23,10 @@ namespace detail {
 BOOST_MYSQL_DECL
 deserialize_errc deserialize_text_field(string_view from, const metadata& meta, field_view& output);
 
+// Returns the function to use to decode fields described by meta
+BOOST_MYSQL_DECL
+text_field_decoder get_text_field_decoder(const metadata& meta) noexcept;
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -78,13 +78,6 @@ deserialize_text_value_int_impl(string_view from, field_view& to) noexcept
     return deserialize_errc::ok;
 }
 
-BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
-deserialize_text_value_int(string_view from, field_view& to, const metadata& meta) noexcept
-{
-    return meta.is_unsigned() ? deserialize_text_value_int_impl<std::uint64_t>(from, to)
-                              : deserialize_text_value_int_impl<std::int64_t>(from, to);
-}
-
 // Floating points
 template <class T>
 BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
@@ -291,15 +284,65 @@ deserialize_text_value_time(string_view from, field_view& to, const metadata& me
     return deserialize_errc::ok;
 }
 
+// Decoders. These share a signature, so they can be stored in a row_decoding_plan.
+// Metadata-dependant decisions that can be taken in advance (like signedness) are
+// resolved when the decoder is selected
+template <class T>
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_int(string_view from, const metadata&, field_view& to) noexcept
+{
+    return deserialize_text_value_int_impl<T>(from, to);
+}
+
+template <class T>
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_float(string_view from, const metadata&, field_view& to) noexcept
+{
+    return deserialize_text_value_float<T>(from, to);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_bit(string_view from, const metadata&, field_view& to) noexcept
+{
+    return deserialize_bit(from, to);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_datetime(string_view from, const metadata& meta, field_view& to) noexcept
+{
+    return deserialize_text_value_datetime(from, to, meta);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_date(string_view from, const metadata&, field_view& to) noexcept
+{
+    return deserialize_text_value_date(from, to);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_time(string_view from, const metadata& meta, field_view& to) noexcept
+{
+    return deserialize_text_value_time(from, to, meta);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_string(string_view from, const metadata&, field_view& to) noexcept
+{
+    return deserialize_text_value_string(from, to);
+}
+
+BOOST_MYSQL_STATIC_OR_INLINE deserialize_errc
+decode_text_blob(string_view from, const metadata&, field_view& to) noexcept
+{
+    return deserialize_text_value_blob(from, to);
+}
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
 
-boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_text_field(
-    string_view from,
-    const metadata& meta,
-    field_view& output
-)
+boost::mysql::detail::text_field_decoder boost::mysql::detail::get_text_field_decoder(const metadata& meta
+) noexcept
 {
     switch (meta.type())
     {
@@ -308,14 +351,15 @@ boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_text_fi
     case column_type::mediumint:
     case column_type::int_:
     case column_type::bigint:
-    case column_type::year: return deserialize_text_value_int(from, output, meta);
-    case column_type::bit: return deserialize_bit(from, output);
-    case column_type::float_: return deserialize_text_value_float<float>(from, output);
-    case column_type::double_: return deserialize_text_value_float<double>(from, output);
+    case column_type::year:
+        return meta.is_unsigned() ? &decode_text_int<std::uint64_t> : &decode_text_int<std::int64_t>;
+    case column_type::bit: return &decode_text_bit;
+    case column_type::float_: return &decode_text_float<float>;
+    case column_type::double_: return &decode_text_float<double>;
     case column_type::timestamp:
-    case column_type::datetime: return deserialize_text_value_datetime(from, output, meta);
-    case column_type::date: return deserialize_text_value_date(from, output);
-    case column_type::time: return deserialize_text_value_time(from, output, meta);
+    case column_type::datetime: return &decode_text_datetime;
+    case column_type::date: return &decode_text_date;
+    case column_type::time: return &decode_text_time;
     // True string types
     case column_type::char_:
     case column_type::varchar:
@@ -323,14 +367,23 @@ boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_text_fi
     case column_type::enum_:
     case column_type::set:
     case column_type::decimal:
-    case column_type::json: return deserialize_text_value_string(from, output);
+    case column_type::json: return &decode_text_string;
     // Blobs and anything else
     case column_type::binary:
     case column_type::varbinary:
     case column_type::blob:
     case column_type::geometry:
-    default: return deserialize_text_value_blob(from, output);
+    default: return &decode_text_blob;
     }
 }
 
+boost::mysql::detail::deserialize_errc boost::mysql::detail::deserialize_text_field(
+    string_view from,
+    const metadata& meta,
+    field_view& output
+)
+{
+    return get_text_field_decoder(meta)(from, meta, output);
+}
+
 #endif
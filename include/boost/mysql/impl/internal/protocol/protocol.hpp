@@ -19,6 +19,7 @@
 #include <boost/mysql/detail/config.hpp>
 #include <boost/mysql/detail/ok_view.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
 
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/protocol/constants.hpp>
@@ -34,6 +35,9 @@
 
 namespace boost {
 namespace mysql {
+
+class parallel_row_decoder;
+
 namespace detail {
 
 // Frame header
@@ -100,14 +104,14 @@ struct reset_connection_command
 };
 
 // Deserializes a response that may be an OK or an error packet.
-// Applicable for ping and reset connection.
-// If the response is an OK packet, sets backslash_escapes according to the
-// OK packet's server status flags
+// Applicable for ping, reset connection and close statement.
+// If the response is an OK packet, stores it in output, so the caller can
+// update the connection state according to the OK packet's server status flags
 BOOST_ATTRIBUTE_NODISCARD BOOST_MYSQL_DECL error_code deserialize_ok_response(
     span<const std::uint8_t> message,
     db_flavor flavor,
     diagnostics& diag,
-    bool& backslash_escapes
+    ok_view& output
 );
 
 // Query
@@ -233,6 +237,25 @@ error_code deserialize_row(
     span<field_view> output  // Should point to meta.size() field_view objects
 );
 
+// Same as the above, but uses a plan previously compiled for meta
+BOOST_MYSQL_DECL
+error_code deserialize_row(
+    const row_decoding_plan& plan,
+    span<const std::uint8_t> message,
+    metadata_collection_view meta,
+    span<field_view> output  // Should point to meta.size() field_view objects
+);
+
+// Deserializes several row messages, splitting the work between the threads used by decoder
+BOOST_MYSQL_DECL
+error_code deserialize_rows(
+    const row_decoding_plan& plan,
+    span<const span<const std::uint8_t>> messages,
+    metadata_collection_view meta,
+    span<field_view> output,  // Should point to meta.size() * messages.size() field_view objects
+    parallel_row_decoder& decoder
+);
+
 // Server hello
 struct server_hello
 {
@@ -15,6 +15,7 @@
 #include <boost/mysql/error_categories.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
@@ -124,8 +125,8 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_packet(
         int_lenenc last_insert_id;
         std::uint16_t status_flags;  // server_status_flags
         std::uint16_t warnings;
-        // CLIENT_SESSION_TRACK: not implemented
         string_lenenc info;
+        string_lenenc session_state;  // CLIENT_SESSION_TRACK and SERVER_SESSION_STATE_CHANGED
     } pack{};
 
     deserialization_context ctx(msg);
@@ -140,12 +141,22 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_packet(
             return to_error_code(err);
     }
 
+    // Session state changes are only sent if CLIENT_SESSION_TRACK was negotiated.
+    // The server may set the flag even if the capability is off, so check for size, too
+    if ((pack.status_flags & status_flags::session_state_changed) && ctx.enough_size(1))
+    {
+        err = deserialize(ctx, pack.session_state);
+        if (err != deserialize_errc::ok)
+            return to_error_code(err);
+    }
+
     output = {
         pack.affected_rows.value,
         pack.last_insert_id.value,
         pack.status_flags,
         pack.warnings,
         pack.info.value,
+        pack.session_state.value,
     };
 
     return ctx.check_extra_bytes();
@@ -327,7 +338,7 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_response(
     span<const std::uint8_t> message,
     db_flavor flavor,
     diagnostics& diag,
-    bool& backslash_escapes
+    ok_view& output
 )
 {
     // Header
@@ -340,12 +351,7 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_response(
     if (header == ok_packet_header)
     {
         // Verify that the ok_packet is correct
-        ok_view ok{};
-        err = deserialize_ok_packet(ctx.to_span(), ok);
-        if (err)
-            return err;
-        backslash_escapes = ok.backslash_escapes();
-        return error_code();
+        return deserialize_ok_packet(ctx.to_span(), output);
     }
     else if (header == error_packet_header)
     {
@@ -654,10 +660,14 @@ bool is_next_field_null(const deserialization_context& ctx) noexcept
     return *ctx.first() == 0xfb;
 }
 
-BOOST_MYSQL_STATIC_OR_INLINE
+// GetDecoder is a function object returning the decoder for the i-th field.
+// Rows are decoded either using a precompiled row_decoding_plan, or computing
+// the decoders on the fly
+template <class GetDecoder>
 error_code deserialize_text_row(
     deserialization_context& ctx,
     metadata_collection_view meta,
+    GetDecoder get_decoder,
     field_view* output
 )
 {
@@ -674,7 +684,7 @@ error_code deserialize_text_row(
             auto err = deserialize(ctx, value_str);
             if (err != deserialize_errc::ok)
                 return to_error_code(err);
-            err = deserialize_text_field(value_str.value, meta[i], output[i]);
+            err = get_decoder(i)(value_str.value, meta[i], output[i]);
             if (err != deserialize_errc::ok)
                 return to_error_code(err);
         }
@@ -684,10 +694,11 @@ error_code deserialize_text_row(
     return error_code();
 }
 
-BOOST_MYSQL_STATIC_OR_INLINE
+template <class GetDecoder>
 error_code deserialize_binary_row(
     deserialization_context& ctx,
     metadata_collection_view meta,
+    GetDecoder get_decoder,
     field_view* output
 )
 {
@@ -716,7 +727,7 @@ error_code deserialize_binary_row(
         }
         else
         {
-            auto err = deserialize_binary_field(ctx, meta[i], output[i]);
+            auto err = get_decoder(i)(ctx, meta[i], output[i]);
             if (err != deserialize_errc::ok)
                 return to_error_code(err);
         }
@@ -742,8 +753,63 @@ boost::mysql::error_code boost::mysql::detail::deserialize_row(
 {
     BOOST_ASSERT(meta.size() == output.size());
     deserialization_context ctx(buff);
-    return encoding == detail::resultset_encoding::text ? deserialize_text_row(ctx, meta, output.data())
-                                                        : deserialize_binary_row(ctx, meta, output.data());
+    if (encoding == detail::resultset_encoding::text)
+    {
+        auto get_decoder = [meta](std::size_t i) { return get_text_field_decoder(meta[i]); };
+        return deserialize_text_row(ctx, meta, get_decoder, output.data());
+    }
+    else
+    {
+        auto get_decoder = [meta](std::size_t i) { return get_binary_field_decoder(meta[i]); };
+        return deserialize_binary_row(ctx, meta, get_decoder, output.data());
+    }
+}
+
+boost::mysql::error_code boost::mysql::detail::deserialize_row(
+    const row_decoding_plan& plan,
+    span<const std::uint8_t> buff,
+    metadata_collection_view meta,
+    span<field_view> output
+)
+{
+    BOOST_ASSERT(meta.size() == output.size());
+    BOOST_ASSERT(plan.size() == meta.size());
+    deserialization_context ctx(buff);
+    if (plan.encoding() == detail::resultset_encoding::text)
+    {
+        const text_field_decoder* decoders = plan.text_decoders();
+        auto get_decoder = [decoders](std::size_t i) { return decoders[i]; };
+        return deserialize_text_row(ctx, meta, get_decoder, output.data());
+    }
+    else
+    {
+        const binary_field_decoder* decoders = plan.binary_decoders();
+        auto get_decoder = [decoders](std::size_t i) { return decoders[i]; };
+        return deserialize_binary_row(ctx, meta, get_decoder, output.data());
+    }
+}
+
+boost::mysql::error_code boost::mysql::detail::deserialize_rows(
+    const row_decoding_plan& plan,
+    span<const span<const std::uint8_t>> messages,
+    metadata_collection_view meta,
+    span<field_view> output,
+    parallel_row_decoder& decoder
+)
+{
+    std::size_t num_columns = meta.size();
+    BOOST_ASSERT(output.size() == num_columns * messages.size());
+
+    // Messages are independent, and each row has its own storage, so chunks can be decoded concurrently
+    return decoder.run(messages.size(), [&](std::size_t first, std::size_t last) -> error_code {
+        for (std::size_t i = first; i < last; ++i)
+        {
+            auto err = deserialize_row(plan, messages[i], meta, output.subspan(i * num_columns, num_columns));
+            if (err)
+                return err;
+        }
+        return error_code();
+    });
 }
 
 // Server hello
@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_RESULT_CACHE_LOAD_OP_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_RESULT_CACHE_LOAD_OP_HPP
+
+#include <boost/mysql/connection_pool.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/result_cache.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/asio/compose.hpp>
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Traits to use by default for result_cache. Templating on traits provides
+// a way to mock the pool in tests. Production code only uses result_cache_io_traits
+struct result_cache_io_traits
+{
+    using pool_type = connection_pool;
+    using connection_type = pooled_connection;
+};
+
+// Runs the query for a key on behalf of all the async_execute operations waiting for it
+template <class IoTraits>
+struct basic_result_cache_load_op : asio::coroutine
+{
+    using pool_type = typename IoTraits::pool_type;
+    using connection_type = typename IoTraits::connection_type;
+
+    struct data_t
+    {
+        result_cache* cache;
+        pool_type* pool;  // only valid while the operation is being initiated
+        std::string key;
+        std::string sql;
+        std::vector<field> params;
+        std::vector<std::string> tags;
+        std::uint64_t generation;
+        connection_type conn;
+        statement stmt;
+        results result;
+        diagnostics diag;
+    };
+
+    std::unique_ptr<data_t> data_;
+
+    basic_result_cache_load_op(std::unique_ptr<data_t> data) noexcept : data_(std::move(data)) {}
+
+    // Implements result_cache::async_execute
+    static void start(
+        result_cache& cache,
+        pool_type& pool,
+        string_view sql,
+        span<const field_view> params,
+        span<const string_view> tags,
+        diagnostics* diag,
+        result_cache::handler_type handler
+    )
+    {
+        diag->clear();
+        auto ex = pool.get_executor();
+        auto key = result_cache::make_key(sql, params);
+
+        // Cache hits and operations waiting for another one to run the query are done here
+        std::uint64_t generation = 0;
+        if (!cache.begin_flight(key, handler, ex, diag, generation))
+            return;
+
+        std::unique_ptr<data_t> data{new data_t{
+            &cache,
+            &pool,
+            std::move(key),
+            std::string(sql),
+            std::vector<field>(params.begin(), params.end()),
+            std::vector<std::string>(tags.begin(), tags.end()),
+            generation,
+            connection_type(),
+            statement(),
+            results(),
+            diagnostics(),
+        }};
+        asio::detached_t token;
+        asio::async_compose<asio::detached_t, void()>(basic_result_cache_load_op(std::move(data)), token, ex);
+    }
+
+    template <class Self>
+    void complete(Self& self, error_code ec)
+    {
+        // Return the connection to the pool before notifying anyone
+        data_->conn = connection_type();
+        result_cache::results_ptr res;
+        if (!ec)
+            res = std::make_shared<const results>(std::move(data_->result));
+        data_->cache->finish_flight(
+            data_->key,
+            data_->generation,
+            std::move(data_->tags),
+            ec,
+            data_->diag,
+            std::move(res)
+        );
+        data_.reset();
+        self.complete();
+    }
+
+    template <class Self>
+    void operator()(Self& self, error_code ec, connection_type conn)
+    {
+        data_->conn = std::move(conn);
+        (*this)(self, ec);
+    }
+
+    template <class Self>
+    void operator()(Self& self, error_code ec, statement stmt)
+    {
+        data_->stmt = stmt;
+        (*this)(self, ec);
+    }
+
+    template <class Self>
+    void operator()(Self& self, error_code ec = {})
+    {
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            // Get a connection. This runs as part of the initiating function, so the pool is alive
+            BOOST_ASIO_CORO_YIELD data_->pool->async_get_connection(data_->diag, std::move(self));
+            data_->pool = nullptr;
+            if (ec)
+            {
+                complete(self, ec);
+                return;
+            }
+
+            if (data_->params.empty())
+            {
+                // Run a text query
+                BOOST_ASIO_CORO_YIELD data_->conn->async_execute(
+                    string_view(data_->sql),
+                    data_->result,
+                    data_->diag,
+                    std::move(self)
+                );
+            }
+            else
+            {
+                // Prepare and execute a statement. The statement is deallocated when
+                // the connection is reset by the pool
+                BOOST_ASIO_CORO_YIELD data_->conn->async_prepare_statement(
+                    data_->sql,
+                    data_->diag,
+                    std::move(self)
+                );
+                if (ec)
+                {
+                    complete(self, ec);
+                    return;
+                }
+
+                BOOST_ASIO_CORO_YIELD data_->conn->async_execute(
+                    data_->stmt.bind(data_->params.begin(), data_->params.end()),
+                    data_->result,
+                    data_->diag,
+                    std::move(self)
+                );
+            }
+
+            complete(self, ec);
+        }
+    }
+};
+
+using result_cache_load_op = basic_result_cache_load_op<result_cache_io_traits>;
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -41,11 +41,22 @@ class algo_runner : asio::coroutine
 {
     any_algo_ref algo_;
 
-    connection_state_data& conn_state() noexcept { return algo_.get().conn_state(); }
+    // Resizes the read buffer, if required, notifying the observer if it grew
+    void prepare_read_buffer()
+    {
+        auto& st = conn_state();
+        std::size_t old_size = st.reader.internal_buffer().size();
+        st.reader.prepare_buffer();
+        std::size_t new_size = st.reader.internal_buffer().size();
+        if (st.observer && new_size != old_size)
+            st.observer->on_read_buffer_growth(new_size);
+    }
 
 public:
     algo_runner(any_algo_ref algo) : algo_(algo) {}
 
+    connection_state_data& conn_state() noexcept { return algo_.get().conn_state(); }
+
     next_action resume(error_code ec, std::size_t bytes_transferred)
     {
         next_action act;
@@ -69,7 +80,7 @@ public:
                     // (may be zero times if cached)
                     while (!conn_state().reader.done() && !ec)
                     {
-                        conn_state().reader.prepare_buffer();
+                        prepare_read_buffer();
                         BOOST_ASIO_CORO_YIELD return next_action::read(
                             {conn_state().reader.buffer(), conn_state().ssl_active()}
                         );
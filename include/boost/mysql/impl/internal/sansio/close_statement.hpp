@@ -64,12 +64,7 @@ public:
             BOOST_ASIO_CORO_YIELD return read(ping_seqnum_);
 
             // Process the OK packet
-            return deserialize_ok_response(
-                st_->reader.message(),
-                st_->flavor,
-                *diag_,
-                st_->backslash_escapes
-            );
+            return process_ok_response(*diag_);
         }
 
         return next_action();
@@ -8,6 +8,7 @@
 #ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_CONNECTION_STATE_HPP
 #define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_CONNECTION_STATE_HPP
 
+#include <boost/mysql/connection_observer.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/handshake_params.hpp>
@@ -24,11 +25,16 @@
 #include <boost/mysql/impl/internal/sansio/handshake.hpp>
 #include <boost/mysql/impl/internal/sansio/ping.hpp>
 #include <boost/mysql/impl/internal/sansio/prepare_statement.hpp>
+#include <boost/mysql/impl/internal/sansio/prepare_statements.hpp>
 #include <boost/mysql/impl/internal/sansio/quit_connection.hpp>
+#include <boost/mysql/impl/internal/sansio/read_binlog_event.hpp>
 #include <boost/mysql/impl/internal/sansio/read_resultset_head.hpp>
 #include <boost/mysql/impl/internal/sansio/read_some_rows.hpp>
 #include <boost/mysql/impl/internal/sansio/read_some_rows_dynamic.hpp>
+#include <boost/mysql/impl/internal/sansio/read_some_rows_visit.hpp>
 #include <boost/mysql/impl/internal/sansio/reset_connection.hpp>
+#include <boost/mysql/impl/internal/sansio/run_pipeline.hpp>
+#include <boost/mysql/impl/internal/sansio/start_binlog_dump.hpp>
 #include <boost/mysql/impl/internal/sansio/start_execution.hpp>
 
 #include <boost/asio/coroutine.hpp>
@@ -50,13 +56,42 @@ template <> struct get_algo<start_execution_algo_params> { using type = start_ex
 template <> struct get_algo<read_resultset_head_algo_params> { using type = read_resultset_head_algo; };
 template <> struct get_algo<read_some_rows_algo_params> { using type = read_some_rows_algo; };
 template <> struct get_algo<read_some_rows_dynamic_algo_params> { using type = read_some_rows_dynamic_algo; };
+template <> struct get_algo<read_some_rows_visit_algo_params> { using type = read_some_rows_visit_algo; };
 template <> struct get_algo<prepare_statement_algo_params> { using type = prepare_statement_algo; };
+template <> struct get_algo<prepare_statements_algo_params> { using type = prepare_statements_algo; };
 template <> struct get_algo<close_statement_algo_params> { using type = close_statement_algo; };
 template <> struct get_algo<ping_algo_params> { using type = ping_algo; };
 template <> struct get_algo<reset_connection_algo_params> { using type = reset_connection_algo; };
 template <> struct get_algo<quit_connection_algo_params> { using type = quit_connection_algo; };
 template <> struct get_algo<close_connection_algo_params> { using type = close_connection_algo; };
+template <> struct get_algo<run_pipeline_algo_params> { using type = run_pipeline_algo; };
+template <> struct get_algo<start_binlog_dump_algo_params> { using type = start_binlog_dump_algo; };
+template <> struct get_algo<read_binlog_event_algo_params> { using type = read_binlog_event_algo; };
 template <class AlgoParams> using get_algo_t = typename get_algo<AlgoParams>::type;
+
+// The operation type reported to connection_observer
+using optype = operation_type;
+inline optype get_operation_type(const connect_algo_params&) { return optype::connect; }
+inline optype get_operation_type(const handshake_algo_params&) { return optype::handshake; }
+inline optype get_operation_type(const execute_algo_params&) { return optype::execute; }
+inline optype get_operation_type(const start_execution_algo_params&) { return optype::start_execution; }
+inline optype get_operation_type(const read_resultset_head_algo_params&)
+{
+    return optype::read_resultset_head;
+}
+inline optype get_operation_type(const read_some_rows_algo_params&) { return optype::read_some_rows; }
+inline optype get_operation_type(const read_some_rows_dynamic_algo_params&) { return optype::read_some_rows; }
+inline optype get_operation_type(const read_some_rows_visit_algo_params&) { return optype::read_some_rows; }
+inline optype get_operation_type(const prepare_statement_algo_params&) { return optype::prepare_statement; }
+inline optype get_operation_type(const prepare_statements_algo_params&) { return optype::prepare_statement; }
+inline optype get_operation_type(const close_statement_algo_params&) { return optype::close_statement; }
+inline optype get_operation_type(const ping_algo_params&) { return optype::ping; }
+inline optype get_operation_type(const reset_connection_algo_params&) { return optype::reset_connection; }
+inline optype get_operation_type(const quit_connection_algo_params&) { return optype::quit; }
+inline optype get_operation_type(const close_connection_algo_params&) { return optype::close; }
+inline optype get_operation_type(const run_pipeline_algo_params&) { return optype::run_pipeline; }
+inline optype get_operation_type(const start_binlog_dump_algo_params&) { return optype::start_binlog_dump; }
+inline optype get_operation_type(const read_binlog_event_algo_params&) { return optype::read_binlog_event; }
 // clang-format on
 
 class connection_state
@@ -69,12 +104,17 @@ class connection_state
         read_resultset_head_algo,
         read_some_rows_algo,
         read_some_rows_dynamic_algo,
+        read_some_rows_visit_algo,
         prepare_statement_algo,
+        prepare_statements_algo,
         close_statement_algo,
         ping_algo,
         reset_connection_algo,
         quit_connection_algo,
-        close_connection_algo>;
+        close_connection_algo,
+        run_pipeline_algo,
+        start_binlog_dump_algo,
+        read_binlog_event_algo>;
 
     connection_state_data st_data_;
     any_algo algo_;
@@ -83,8 +123,14 @@ public:
     // We initialize the algo state with a dummy value. This will be overwritten
     // by setup() before the first algorithm starts running. Doing this avoids
     // the need for a special null algo
-    connection_state(std::size_t read_buffer_size, bool transport_supports_ssl)
-        : st_data_(read_buffer_size, transport_supports_ssl),
+    connection_state(
+        std::size_t read_buffer_size,
+        bool transport_supports_ssl,
+        std::size_t read_ahead_buffer_size = 0,
+        connection_observer* observer = nullptr,
+        parallel_row_decoder* row_decoder = nullptr
+    )
+        : st_data_(read_buffer_size, transport_supports_ssl, read_ahead_buffer_size, observer, row_decoder),
           algo_(ping_algo(st_data_, {&st_data_.shared_diag}))
     {
     }
@@ -95,6 +141,7 @@ public:
     template <class AlgoParams>
     any_algo_ref setup(AlgoParams params)
     {
+        st_data_.current_op = get_operation_type(params);
         return algo_.emplace<get_algo_t<AlgoParams>>(st_data_, params);
     }
 
@@ -8,20 +8,30 @@
 #ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_CONNECTION_STATE_DATA_HPP
 #define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_CONNECTION_STATE_DATA_HPP
 
+#include <boost/mysql/connection_observer.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
 
+#include <boost/mysql/detail/ok_view.hpp>
+
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
 #include <boost/mysql/impl/internal/sansio/message_reader.hpp>
 #include <boost/mysql/impl/internal/sansio/message_writer.hpp>
 
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace boost {
 namespace mysql {
+
+class parallel_row_decoder;
+
 namespace detail {
 
 enum class ssl_state
@@ -49,6 +59,10 @@ struct connection_state_data
     // Temporary field storage, re-used by several ops
     std::vector<field_view> shared_fields;
 
+    // If read-ahead is enabled, the fields returned by the previous read_some_rows op.
+    // Swapped with shared_fields on every read_some_rows op
+    std::vector<field_view> back_shared_fields;
+
     // Do we want to retain metadata strings or not? Used to save allocations
     metadata_mode meta_mode{metadata_mode::minimal};
 
@@ -59,16 +73,100 @@ struct connection_state_data
     // be disabled using a variable. OK packets include a flag with this info.
     bool backslash_escapes{true};
 
+    // Has the session been modified since the connection was established or reset?
+    // If CLIENT_SESSION_TRACK was negotiated, this is computed using the session
+    // state information in OK packets. Otherwise, any execution is considered a modification
+    bool session_modified{false};
+
+    // Has an execution started without its final OK or error packet being read?
+    // Connections in this state can't be re-used without a reset
+    bool execution_pending{false};
+
     // Reader and writer
     message_reader reader;
     message_writer writer;
 
+    // If not null, notified about the work performed by the connection. Not affected by reset()
+    connection_observer* observer{nullptr};
+
+    // If not null, batches of rows are decoded using this object. Not affected by reset()
+    parallel_row_decoder* row_decoder{nullptr};
+
+    // Row messages framed by read_some_rows before decoding them with row_decoder
+    std::vector<span<const std::uint8_t>> row_messages;
+
+    // Decodes row_messages. Set by read_some_rows before yielding next_action::decode_rows()
+    void (*pending_decode_fn)(void*){nullptr};
+    void* pending_decode_ctx{nullptr};
+
+    // The operation being run, as reported to the observer
+    operation_type current_op{operation_type::ping};
+
     bool ssl_active() const noexcept { return ssl == ssl_state::active; }
     bool supports_ssl() const noexcept { return ssl != ssl_state::unsupported; }
+    bool session_state_changed() const noexcept { return session_modified || execution_pending; }
+
+    connection_state_data(
+        std::size_t read_buffer_size,
+        bool transport_supports_ssl = false,
+        std::size_t read_ahead_buffer_size = 0,
+        connection_observer* obs = nullptr,
+        parallel_row_decoder* decoder = nullptr
+    )
+        : ssl(transport_supports_ssl ? ssl_state::inactive : ssl_state::unsupported),
+          reader(read_buffer_size),
+          observer(obs),
+          row_decoder(decoder)
+    {
+        if (read_ahead_buffer_size > 0u)
+            reader.enable_double_buffering(read_ahead_buffer_size);
+    }
+
+    // If read-ahead is enabled, makes the rows returned by the last read_some_rows op
+    // remain valid during the next one, by switching to the secondary read buffer and field storage.
+    // No-op otherwise
+    void flip_row_buffers()
+    {
+        if (reader.double_buffered())
+        {
+            reader.flip_buffers();
+            shared_fields.swap(back_shared_fields);
+        }
+    }
+
+    // Runs the decoding requested by next_action::decode_rows()
+    void run_pending_decode()
+    {
+        BOOST_ASSERT(pending_decode_fn != nullptr);
+        pending_decode_fn(pending_decode_ctx);
+    }
+
+    // Updates the state with the information contained in any OK packet
+    // (ping, reset connection, close statement, executions...)
+    void on_ok_packet(const ok_view& ok) noexcept
+    {
+        backslash_escapes = ok.backslash_escapes();
+        if (ok.session_state_changed() || ok.in_transaction())
+            session_modified = true;
+    }
+
+    // Updates the state with the information contained in an OK packet
+    // received as part of an execution. Without session tracking, we can't
+    // know what the statement did, so we assume the session was modified
+    void on_execution_ok_packet(const ok_view& ok) noexcept
+    {
+        on_ok_packet(ok);
+        if (!current_capabilities.has(CLIENT_SESSION_TRACK))
+            session_modified = true;
+        if (!ok.more_results())
+            execution_pending = false;
+    }
 
-    connection_state_data(std::size_t read_buffer_size, bool transport_supports_ssl = false)
-        : ssl(transport_supports_ssl ? ssl_state::inactive : ssl_state::unsupported), reader(read_buffer_size)
+    // Called after a successful COM_RESET_CONNECTION
+    void on_session_reset() noexcept
     {
+        session_modified = false;
+        execution_pending = false;
     }
 
     void reset()
@@ -82,6 +180,8 @@ struct connection_state_data
         if (supports_ssl())
             ssl = ssl_state::inactive;
         backslash_escapes = true;
+        session_modified = false;
+        execution_pending = false;
     }
 };
 
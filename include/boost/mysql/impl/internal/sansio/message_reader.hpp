@@ -20,6 +20,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <utility>
 
 namespace boost {
 namespace mysql {
@@ -44,9 +46,51 @@ public:
     void reset() noexcept
     {
         buffer_.reset();
+        back_buffer_.reset();
         state_ = parse_state();
     }
 
+    // Enables double buffering, allocating a secondary buffer with the given initial size.
+    // See flip_buffers()
+    void enable_double_buffering(std::size_t back_buffer_size)
+    {
+        back_buffer_ = read_buffer(back_buffer_size);
+        double_buffered_ = true;
+    }
+
+    bool double_buffered() const noexcept { return double_buffered_; }
+
+    // If double buffering is enabled, makes subsequent reads use the secondary buffer.
+    // Messages parsed before this call remain valid until flip_buffers() is called again,
+    // even if more reads are performed in between. Bytes not belonging to fully parsed messages
+    // are carried over to the new buffer, so parsing can continue seamlessly.
+    // This is a no-op if double buffering is not enabled
+    void flip_buffers()
+    {
+        if (!double_buffered_)
+            return;
+
+        // If we're in the middle of a message, the part we've already got must be carried over.
+        // Otherwise, the current message has already been parsed and belongs to the old buffer
+        std::size_t carried_message_size = done() ? 0u : buffer_.current_message_size();
+        std::size_t carried_size = carried_message_size + buffer_.pending_size();
+
+        back_buffer_.reset();
+        back_buffer_.grow_to_fit(carried_size);
+        if (carried_size > 0u)
+        {
+            std::memcpy(
+                back_buffer_.free_first(),
+                buffer_.pending_first() - carried_message_size,
+                carried_size
+            );
+            back_buffer_.move_to_pending(carried_size);
+            back_buffer_.move_to_current_message(carried_message_size);
+        }
+
+        std::swap(buffer_, back_buffer_);
+    }
+
     // Prepares a read operation. sequence_number should be kept alive until
     // the next read is prepared or no more calls to resume() are expected.
     // If keep_state=true, and the op is not complete, parsing state is preserved
@@ -161,9 +205,12 @@ public:
 
     // Exposed for testing
     const read_buffer& internal_buffer() const noexcept { return buffer_; }
+    const read_buffer& internal_back_buffer() const noexcept { return back_buffer_; }
 
 private:
     read_buffer buffer_;
+    read_buffer back_buffer_{0};
+    bool double_buffered_{false};
     std::size_t max_frame_size_;
 
     struct parse_state
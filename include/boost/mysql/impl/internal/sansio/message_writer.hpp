@@ -58,9 +58,8 @@ class message_writer
         in_progress,
         done,
 
-        // Send a short pipeline (all messages fitting in a single frame).
-        // Woraround to pipeline pings with close statement requests
-        // until we implement proper pipelining in https://github.com/boostorg/mysql/issues/75
+        // Send a pipeline (several messages, each fitting in a single frame)
+        // using a single write
         short_pipeline,
     };
 
@@ -138,18 +137,32 @@ public:
         std::uint8_t& seqnum2
     )
     {
-        // Prepare the buffer
-        std::size_t total_size = msg1.get_size() + msg2.get_size() + 2 * frame_header_size;
-        buffer_.resize(total_size);
+        start_pipeline();
+        add_pipelined_message(msg1, seqnum1);
+        add_pipelined_message(msg2, seqnum2);
+        finish_pipeline();
+    }
+
+    // Pipelines an arbitrary number of messages: call start_pipeline(),
+    // then add_pipelined_message() for each message, then finish_pipeline()
+    void start_pipeline() noexcept { buffer_.clear(); }
 
-        // Serialize the messages
-        auto it = buffer_.data();
-        it = serialize_with_header(msg1, seqnum1, it);
-        it = serialize_with_header(msg2, seqnum2, it);
+    // Can a message of this size be added to a pipeline?
+    bool fits_in_frame(std::size_t msg_size) const noexcept { return msg_size < max_frame_size_; }
+
+    template <class Serializable>
+    void add_pipelined_message(const Serializable& msg, std::uint8_t& seqnum)
+    {
+        std::size_t offset = buffer_.size();
+        buffer_.resize(offset + msg.get_size() + frame_header_size);
+        serialize_with_header(msg, seqnum, buffer_.data() + offset);
+    }
 
-        // Set up writer
+    void finish_pipeline() noexcept
+    {
+        BOOST_ASSERT(!buffer_.empty());
         state_ = state_t();
-        state_.chunk.reset(0, total_size);
+        state_.chunk.reset(0, buffer_.size());
         state_.coro = coro_state::short_pipeline;
     }
 
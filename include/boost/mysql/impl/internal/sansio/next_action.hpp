@@ -31,6 +31,7 @@ public:
         ssl_shutdown,
         connect,
         close,
+        decode_rows,
     };
 
     struct read_args_t
@@ -76,6 +77,10 @@ public:
     static next_action ssl_shutdown() noexcept { return next_action(type_t::ssl_shutdown, data_t()); }
     static next_action close() noexcept { return next_action(type_t::close, data_t()); }
 
+    // Not I/O: connection_state_data::run_pending_decode() should be called,
+    // preferably outside the thread performing I/O
+    static next_action decode_rows() noexcept { return next_action(type_t::decode_rows, data_t()); }
+
 private:
     type_t type_{type_t::none};
     union data_t
@@ -41,6 +41,7 @@ class prepare_statement_algo : public sansio_algorithm, asio::coroutine
         if (err)
             return err;
         res_ = access::construct<statement>(response.id, response.num_params);
+        st_->session_modified = true;  // prepared statements are part of the session state
         remaining_meta_ = response.num_columns + response.num_params;
         return error_code();
     }
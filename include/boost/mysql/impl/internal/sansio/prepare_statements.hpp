@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_PREPARE_STATEMENTS_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_PREPARE_STATEMENTS_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/statement.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/algo_params.hpp>
+
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+#include <boost/mysql/impl/internal/sansio/next_action.hpp>
+#include <boost/mysql/impl/internal/sansio/sansio_algorithm.hpp>
+
+#include <boost/asio/coroutine.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Prepares several statements, writing all the prepare requests back-to-back
+// before reading any response. Used by connection pools to prepare
+// the statements configured in pool_params. The first error aborts the operation.
+class prepare_statements_algo : public sansio_algorithm, asio::coroutine
+{
+    diagnostics* diag_;
+    span<const std::string> stmts_sql_;
+    statement* output_;
+    std::size_t batch_first_{0};
+    std::size_t batch_last_{0};
+    std::size_t current_{0};
+    std::uint8_t sequence_number_{0};
+    unsigned remaining_meta_{0};
+
+    // Serializes as many requests as possible, starting at batch_first_, so they
+    // can be written at once. Sets batch_last_ past the last serialized request.
+    // Requests that don't fit in a frame are written on their own
+    void compose_batch()
+    {
+        batch_last_ = batch_first_;
+        prepare_stmt_command first_cmd{stmts_sql_[batch_first_]};
+        if (!st_->writer.fits_in_frame(first_cmd.get_size()))
+        {
+            sequence_number_ = 0;
+            st_->writer.prepare_write(first_cmd, sequence_number_);
+            ++batch_last_;
+            return;
+        }
+
+        st_->writer.start_pipeline();
+        for (; batch_last_ < stmts_sql_.size(); ++batch_last_)
+        {
+            prepare_stmt_command cmd{stmts_sql_[batch_last_]};
+            if (!st_->writer.fits_in_frame(cmd.get_size()))
+                break;
+            std::uint8_t seqnum = 0;
+            st_->writer.add_pipelined_message(cmd, seqnum);
+        }
+        st_->writer.finish_pipeline();
+    }
+
+    error_code process_response()
+    {
+        prepare_stmt_response response{};
+        auto err = deserialize_prepare_stmt_response(st_->reader.message(), st_->flavor, response, *diag_);
+        if (err)
+            return err;
+        output_[current_] = access::construct<statement>(response.id, response.num_params);
+        remaining_meta_ = response.num_columns + response.num_params;
+        return error_code();
+    }
+
+public:
+    prepare_statements_algo(connection_state_data& st, prepare_statements_algo_params params) noexcept
+        : sansio_algorithm(st), diag_(params.diag), stmts_sql_(params.stmts_sql), output_(params.output)
+    {
+    }
+
+    next_action resume(error_code ec)
+    {
+        if (ec)
+            return ec;
+
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            // Clear diagnostics
+            diag_->clear();
+
+            while (batch_first_ < stmts_sql_.size())
+            {
+                // Write the requests
+                compose_batch();
+                BOOST_ASIO_CORO_YIELD return next_action::write(next_action::write_args_t{{}, false});
+
+                // Read the responses, in order
+                for (current_ = batch_first_; current_ != batch_last_; ++current_)
+                {
+                    // Each response starts at sequence number 1
+                    sequence_number_ = 1;
+                    BOOST_ASIO_CORO_YIELD return read(sequence_number_);
+                    ec = process_response();
+                    if (ec)
+                        return ec;
+
+                    // Parameter and column metadata is ignored
+                    for (; remaining_meta_ > 0u; --remaining_meta_)
+                        BOOST_ASIO_CORO_YIELD return read(sequence_number_);
+                }
+
+                batch_first_ = batch_last_;
+            }
+        }
+
+        return next_action();
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_BINLOG_EVENT_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_BINLOG_EVENT_HPP
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/binlog.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+#include <boost/mysql/impl/internal/sansio/sansio_algorithm.hpp>
+
+#include <boost/asio/coroutine.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+class read_binlog_event_algo : public sansio_algorithm, asio::coroutine
+{
+    diagnostics* diag_;
+    binlog_state_impl* binlog_st_;
+
+public:
+    read_binlog_event_algo(connection_state_data& st, read_binlog_event_algo_params params) noexcept
+        : sansio_algorithm(st), diag_(params.diag), binlog_st_(params.binlog_st)
+    {
+    }
+
+    next_action resume(error_code ec)
+    {
+        if (ec)
+            return ec;
+
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            // Clear diagnostics and the previous event
+            diag_->clear();
+            binlog_st_->has_event = false;
+            binlog_st_->table = nullptr;
+
+            // If the dump is over, there is nothing to read
+            if (!binlog_st_->dumping)
+                return next_action();
+
+            // Read the message. Views into the read buffer remain valid until the next read
+            BOOST_ASIO_CORO_YIELD return read(binlog_st_->seqnum);
+
+            // Process it
+            ec = process_binlog_message(st_->reader.message(), st_->flavor, *binlog_st_, *diag_);
+            if (!binlog_st_->dumping)
+                st_->execution_pending = false;
+            return ec;
+        }
+
+        return next_action();
+    }
+
+    binlog_event result() const noexcept { return access::construct<binlog_event>(binlog_st_); }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -34,9 +34,12 @@ inline error_code process_execution_response(
     error_code err;
     switch (response.type)
     {
-    case execute_response::type_t::error: err = response.data.err; break;
+    case execute_response::type_t::error:
+        st.execution_pending = false;
+        err = response.data.err;
+        break;
     case execute_response::type_t::ok_packet:
-        st.backslash_escapes = response.data.ok_pack.backslash_escapes();
+        st.on_execution_ok_packet(response.data.ok_pack);
         err = proc.on_head_ok_packet(response.data.ok_pack, diag);
         break;
     case execute_response::type_t::num_fields: proc.on_num_meta(response.data.num_fields); break;
@@ -86,6 +89,9 @@ public:
             if (!params_.proc->is_reading_head())
                 return next_action();
 
+            // Until the final OK packet is received, the connection can't be re-used
+            st_->execution_pending = true;
+
             // Read the response
             BOOST_ASIO_CORO_YIELD return read(params_.proc->sequence_number());
 
@@ -11,9 +11,11 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/row_visitor.hpp>
 
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/sansio_algorithm.hpp>
@@ -29,12 +31,21 @@ namespace detail {
 class read_some_rows_algo : public sansio_algorithm, asio::coroutine
 {
     read_some_rows_algo_params params_;
+    row_visitor visitor_;
     std::size_t rows_read_{0};
 
+    // State for batches decoded by the connection's row decoder
+    row_message last_msg_{error_code()};
+    bool has_last_msg_{false};
+    error_code decode_err_;
+
+    // If visitor has a value, rows are handed to it one by one instead of being
+    // written to output, and the batch is only bounded by the messages in the read buffer
     BOOST_ATTRIBUTE_NODISCARD static std::pair<error_code, std::size_t> process_some_rows(
         connection_state_data& st,
         execution_processor& proc,
         output_ref output,
+        const row_visitor& visitor,
         diagnostics& diag
     )
     {
@@ -56,18 +67,26 @@ class read_some_rows_algo : public sansio_algorithm, asio::coroutine
             auto res = deserialize_row_message(buff, st.flavor, diag);
             if (res.type == row_message::type_t::error)
             {
+                st.execution_pending = false;
                 err = res.data.err;
             }
             else if (res.type == row_message::type_t::row)
             {
-                output.set_offset(read_rows);
-                err = proc.on_row(res.data.row, output, st.shared_fields);
+                if (visitor.has_value())
+                {
+                    err = visitor.on_row(proc, res.data.row, st.shared_fields);
+                }
+                else
+                {
+                    output.set_offset(read_rows);
+                    err = proc.on_row(res.data.row, output, st.shared_fields);
+                }
                 if (!err)
                     ++read_rows;
             }
             else
             {
-                st.backslash_escapes = res.data.ok_pack.backslash_escapes();
+                st.on_execution_ok_packet(res.data.ok_pack);
                 err = proc.on_row_ok_packet(res.data.ok_pack);
             }
 
@@ -75,7 +94,7 @@ class read_some_rows_algo : public sansio_algorithm, asio::coroutine
                 return {err, read_rows};
 
             // TODO: can we make this better?
-            if (!proc.is_reading_rows() || read_rows >= output.max_size())
+            if (!proc.is_reading_rows() || (!visitor.has_value() && read_rows >= output.max_size()))
                 break;
 
             // Attempt to parse the next message
@@ -84,11 +103,95 @@ class read_some_rows_algo : public sansio_algorithm, asio::coroutine
                 break;
         }
         proc.on_row_batch_finish();
+        if (st.observer)
+            st.observer->on_rows_read(read_rows);
+        return {error_code(), read_rows};
+    }
+
+    // Used instead of process_some_rows when the connection has a row decoder and there is no visitor.
+    // Frames all the row messages first, so they can be decoded as a single batch.
+    // The message that ended the batch, if any, is processed by finish_parallel_batch
+    BOOST_ATTRIBUTE_NODISCARD error_code frame_rows()
+    {
+        // Collect row messages until they run out, an error or EOF is received,
+        // or the output range is full
+        auto& st = *st_;
+        st.row_messages.clear();
+        has_last_msg_ = false;
+        processor().on_row_batch_start();
+        while (true)
+        {
+            // Check for errors (like seqnum mismatches)
+            if (st.reader.error())
+                return st.reader.error();
+
+            // Get the row message and deserialize it
+            auto res = deserialize_row_message(st.reader.message(), st.flavor, *params_.diag);
+            if (res.type != row_message::type_t::row)
+            {
+                last_msg_ = res;
+                has_last_msg_ = true;
+                break;
+            }
+            st.row_messages.push_back(res.data.row);
+            if (st.row_messages.size() >= params_.output.max_size())
+                break;
+
+            // Attempt to parse the next message
+            st.reader.prepare_read(processor().sequence_number());
+            if (!st.reader.done())
+                break;
+        }
+        return error_code();
+    }
+
+    // Decodes the framed rows. May run in a thread other than the one performing I/O
+    void decode_rows()
+    {
+        auto& st = *st_;
+        params_.output.set_offset(0);
+        decode_err_ = processor().on_rows(st.row_messages, params_.output, st.shared_fields, *st.row_decoder);
+    }
+
+    static void decode_rows_fn(void* self) { static_cast<read_some_rows_algo*>(self)->decode_rows(); }
+
+    BOOST_ATTRIBUTE_NODISCARD std::pair<error_code, std::size_t> finish_parallel_batch()
+    {
+        auto& st = *st_;
+        std::size_t read_rows = st.row_messages.size();
+
+        // Process the message that ended the batch, if any
+        if (has_last_msg_)
+        {
+            if (last_msg_.type == row_message::type_t::error)
+            {
+                st.execution_pending = false;
+                return {last_msg_.data.err, read_rows};
+            }
+            st.on_execution_ok_packet(last_msg_.data.ok_pack);
+            auto err = processor().on_row_ok_packet(last_msg_.data.ok_pack);
+            if (err)
+                return {err, read_rows};
+        }
+
+        processor().on_row_batch_finish();
+        if (st.observer)
+            st.observer->on_rows_read(read_rows);
         return {error_code(), read_rows};
     }
 
     execution_processor& processor() noexcept { return *params_.proc; }
 
+protected:
+    read_some_rows_algo(
+        connection_state_data& st,
+        read_some_rows_algo_params params,
+        row_visitor visitor
+    ) noexcept
+        : sansio_algorithm(st), params_(params), visitor_(visitor)
+    {
+    }
+
 public:
     read_some_rows_algo(connection_state_data& st, read_some_rows_algo_params params) noexcept
         : sansio_algorithm(st), params_(params)
@@ -107,6 +210,10 @@ public:
             // Clear diagnostics
             params_.diag->clear();
 
+            // If read-ahead is enabled, leave the rows returned by the previous
+            // call untouched, so they can be processed while this op runs
+            st_->flip_row_buffers();
+
             // Clear any previous use of shared fields.
             // Required for the dynamic version to work.
             st_->shared_fields.clear();
@@ -120,7 +227,42 @@ public:
             BOOST_ASIO_CORO_YIELD return read(processor().sequence_number(), true);
 
             // Process messages
-            std::tie(ec, rows_read_) = process_some_rows(*st_, processor(), params_.output, *params_.diag);
+            if (st_->row_decoder && !visitor_.has_value())
+            {
+                ec = frame_rows();
+                if (ec)
+                    return ec;
+
+                // Batches that will be split in chunks are decoded outside the thread performing I/O,
+                // if the engine supports it. Small ones are decoded inline
+                if (!st_->row_messages.empty())
+                {
+                    if (st_->row_decoder->splits(st_->row_messages.size()))
+                    {
+                        st_->pending_decode_fn = &decode_rows_fn;
+                        st_->pending_decode_ctx = this;
+                        BOOST_ASIO_CORO_YIELD return next_action::decode_rows();
+                    }
+                    else
+                    {
+                        decode_rows();
+                    }
+                    if (decode_err_)
+                        return decode_err_;
+                }
+
+                std::tie(ec, rows_read_) = finish_parallel_batch();
+            }
+            else
+            {
+                std::tie(ec, rows_read_) = process_some_rows(
+                    *st_,
+                    processor(),
+                    params_.output,
+                    visitor_,
+                    *params_.diag
+                );
+            }
             return ec;
         }
 
@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_SOME_ROWS_VISIT_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_SOME_ROWS_VISIT_HPP
+
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+#include <boost/mysql/impl/internal/sansio/read_some_rows.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Reads a batch of rows, handing each one to a visitor as soon as it's parsed.
+// Only a single row is held in shared_fields at any given time
+class read_some_rows_visit_algo : public read_some_rows_algo
+{
+public:
+    read_some_rows_visit_algo(connection_state_data& st, read_some_rows_visit_algo_params params) noexcept
+        : read_some_rows_algo(
+              st,
+              read_some_rows_algo_params{params.diag, params.proc, output_ref()},
+              params.visitor
+          )
+    {
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
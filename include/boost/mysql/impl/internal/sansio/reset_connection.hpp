@@ -50,12 +50,12 @@ public:
             BOOST_ASIO_CORO_YIELD return read(seqnum_);
 
             // Verify it's what we expected
-            return deserialize_ok_response(
-                st_->reader.message(),
-                st_->flavor,
-                *diag_,
-                st_->backslash_escapes
-            );
+            ec = process_ok_response(*diag_);
+            if (ec)
+                return ec;
+
+            // The session is now pristine
+            st_->on_session_reset();
         }
 
         return next_action();
@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_RUN_PIPELINE_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_RUN_PIPELINE_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+
+#include <boost/mysql/impl/internal/error/is_server_error.hpp>
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+#include <boost/mysql/impl/internal/sansio/next_action.hpp>
+#include <boost/mysql/impl/internal/sansio/read_resultset_head.hpp>
+#include <boost/mysql/impl/internal/sansio/read_some_rows.hpp>
+#include <boost/mysql/impl/internal/sansio/sansio_algorithm.hpp>
+#include <boost/mysql/impl/internal/sansio/start_execution.hpp>
+
+#include <boost/asio/coroutine.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Runs several execution requests, writing them back-to-back before reading any response.
+// The MySQL protocol processes requests in order, so responses are read sequentially,
+// each one into its stage's processor. Every request is written as a single frame,
+// so the requests can be written using a single write. Requests that don't fit in
+// a frame are written on their own.
+// Stages are independent: a server error in a stage is reported in the stage,
+// and the following stages are run normally. Any other error aborts the pipeline:
+// the failing and the remaining stages are marked with the error, which is returned.
+class run_pipeline_algo : public sansio_algorithm, asio::coroutine
+{
+    diagnostics* diag_;
+    span<pipeline_stage> stages_;
+    std::size_t batch_first_{0};
+    std::size_t batch_last_{0};
+    std::size_t current_{0};
+    read_resultset_head_algo read_head_st_;
+    read_some_rows_algo read_some_rows_st_;
+
+    pipeline_stage& current() noexcept { return stages_[current_]; }
+
+    static execute_stmt_command make_stmt_command(const any_execution_request& req) noexcept
+    {
+        return execute_stmt_command{req.data.stmt.stmt.id(), req.data.stmt.params};
+    }
+
+    static std::size_t request_size(const any_execution_request& req) noexcept
+    {
+        return req.is_query ? query_command{req.data.query}.get_size() : make_stmt_command(req).get_size();
+    }
+
+    template <class Serializable>
+    void serialize_command(const Serializable& cmd, std::uint8_t& seqnum, bool pipelined)
+    {
+        if (pipelined)
+            st_->writer.add_pipelined_message(cmd, seqnum);
+        else
+            st_->writer.prepare_write(cmd, seqnum);
+    }
+
+    void serialize_request(pipeline_stage& stage, bool pipelined)
+    {
+        const auto& req = stage.req;
+        auto& seqnum = stage.proc->sequence_number();
+        if (req.is_query)
+            serialize_command(query_command{req.data.query}, seqnum, pipelined);
+        else
+            serialize_command(make_stmt_command(req), seqnum, pipelined);
+    }
+
+    // Serializes as many requests as possible, starting at batch_first_, so they
+    // can be written at once. Sets batch_last_ past the last serialized request.
+    // Returns false if there is nothing to write
+    bool compose_batch()
+    {
+        std::size_t num_requests = 0;
+        st_->writer.start_pipeline();
+        for (batch_last_ = batch_first_; batch_last_ < stages_.size(); ++batch_last_)
+        {
+            auto& stage = stages_[batch_last_];
+
+            // Requests rejected by client-side checks are not sent
+            if (stage.err)
+                continue;
+
+            if (!st_->writer.fits_in_frame(request_size(stage.req)))
+            {
+                // Too big to be pipelined. Write it on its own if it's the first one
+                if (num_requests == 0u)
+                {
+                    serialize_request(stage, false);
+                    ++batch_last_;
+                    return true;
+                }
+                break;
+            }
+
+            serialize_request(stage, true);
+            ++num_requests;
+        }
+
+        if (num_requests == 0u)
+            return false;
+        st_->writer.finish_pipeline();
+        return true;
+    }
+
+    // Marks all stages from first onwards as failed with a fatal error
+    error_code fail_stages(std::size_t first, error_code ec)
+    {
+        for (std::size_t i = first; i < stages_.size(); ++i)
+        {
+            if (!stages_[i].err)
+                stages_[i].err = ec;
+        }
+        return ec;
+    }
+
+public:
+    run_pipeline_algo(connection_state_data& st, run_pipeline_algo_params params) noexcept
+        : sansio_algorithm(st),
+          diag_(params.diag),
+          stages_(params.stages),
+          read_head_st_(st, read_resultset_head_algo_params{params.diag, nullptr}),
+          read_some_rows_st_(st, read_some_rows_algo_params{params.diag, nullptr, output_ref()})
+    {
+    }
+
+    next_action resume(error_code ec)
+    {
+        next_action act;
+
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            // Clear diagnostics
+            diag_->clear();
+
+            // Check for client errors and reset processors
+            for (auto& stage : stages_)
+            {
+                stage.diag->clear();
+                stage.err = check_client_errors(stage.req);
+                if (!stage.err)
+                    stage.proc->reset(get_encoding(stage.req), st_->meta_mode);
+            }
+
+            while (batch_first_ < stages_.size())
+            {
+                // Write the requests
+                if (compose_batch())
+                {
+                    BOOST_ASIO_CORO_YIELD return next_action::write(next_action::write_args_t{{}, false});
+                    if (ec)
+                        return fail_stages(batch_first_, ec);
+                }
+
+                // Read the responses
+                for (current_ = batch_first_; current_ != batch_last_; ++current_)
+                {
+                    if (current().err)
+                        continue;
+
+                    while (!current().proc->is_complete())
+                    {
+                        if (current().proc->is_reading_head())
+                        {
+                            read_head_st_ = read_resultset_head_algo(*st_, {current().diag, current().proc});
+                            while (!(act = read_head_st_.resume(ec)).is_done())
+                                BOOST_ASIO_CORO_YIELD return act;
+                        }
+                        else
+                        {
+                            read_some_rows_st_ = read_some_rows_algo(
+                                *st_,
+                                {current().diag, current().proc, output_ref()}
+                            );
+                            while (!(act = read_some_rows_st_.resume(ec)).is_done())
+                                BOOST_ASIO_CORO_YIELD return act;
+                        }
+
+                        if (act.error())
+                        {
+                            current().err = act.error();
+                            if (!is_server_error(act.error()))
+                            {
+                                *diag_ = *current().diag;
+                                return fail_stages(current_ + 1, act.error());
+                            }
+                            break;
+                        }
+                    }
+                }
+
+                batch_first_ = batch_last_;
+            }
+        }
+
+        return next_action();
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -8,8 +8,12 @@
 #ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_SANSIO_ALGORITHM_HPP
 #define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_SANSIO_ALGORITHM_HPP
 
+#include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 
+#include <boost/mysql/detail/ok_view.hpp>
+
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/next_action.hpp>
 
@@ -39,6 +43,18 @@ protected:
         return next_action::write(next_action::write_args_t{{}, false});
     }
 
+    // Processes the message just read as an OK or error response,
+    // updating the connection state if it's an OK packet
+    error_code process_ok_response(diagnostics& diag)
+    {
+        ok_view ok{};
+        auto ec = deserialize_ok_response(st_->reader.message(), st_->flavor, diag, ok);
+        if (ec)
+            return ec;
+        st_->on_ok_packet(ok);
+        return error_code();
+    }
+
     sansio_algorithm(connection_state_data& st) noexcept : st_(&st) {}
 
 public:
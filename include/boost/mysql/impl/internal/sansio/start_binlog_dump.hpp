@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_START_BINLOG_DUMP_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_START_BINLOG_DUMP_HPP
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/binlog.hpp>
+#include <boost/mysql/impl/internal/protocol/protocol.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+#include <boost/mysql/impl/internal/sansio/sansio_algorithm.hpp>
+
+#include <boost/asio/coroutine.hpp>
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+class start_binlog_dump_algo : public sansio_algorithm, asio::coroutine
+{
+    diagnostics* diag_;
+    const binlog_dump_params* params_;
+    binlog_state_impl* binlog_st_;
+    std::uint8_t seqnum_{0};
+
+    binlog_dump_command dump_command() const noexcept
+    {
+        return {
+            params_->server_id,
+            params_->file_name,
+            params_->position,
+            span<const std::uint8_t>(params_->gtid_set.data(), params_->gtid_set.size()),
+            params_->non_blocking,
+        };
+    }
+
+public:
+    start_binlog_dump_algo(connection_state_data& st, start_binlog_dump_algo_params params) noexcept
+        : sansio_algorithm(st), diag_(params.diag), params_(params.params), binlog_st_(params.binlog_st)
+    {
+    }
+
+    next_action resume(error_code ec)
+    {
+        if (ec)
+            return ec;
+
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            // Clear diagnostics and any previous dump state
+            diag_->clear();
+            binlog_st_->reset();
+
+            // Tell the server that we understand checksums
+            BOOST_ASIO_CORO_YIELD return write(query_command{binlog_setup_query(st_->flavor)}, seqnum_);
+            BOOST_ASIO_CORO_YIELD return read(seqnum_);
+            ec = process_ok_response(*diag_);
+            if (ec)
+                return ec;
+
+            // Register as a replica
+            seqnum_ = 0;
+            BOOST_ASIO_CORO_YIELD return write(register_replica_command{params_->server_id}, seqnum_);
+            BOOST_ASIO_CORO_YIELD return read(seqnum_);
+            ec = process_ok_response(*diag_);
+            if (ec)
+                return ec;
+
+            // Request the binlog. The server doesn't respond until the first event is available
+            seqnum_ = 0;
+            BOOST_ASIO_CORO_YIELD return write(dump_command(), seqnum_);
+
+            // The connection is now streaming events, and can't be used for anything else
+            binlog_st_->seqnum = seqnum_;
+            binlog_st_->dumping = true;
+            binlog_st_->file_name = params_->file_name;
+            binlog_st_->position = params_->position;
+            st_->session_modified = true;
+            st_->execution_pending = true;
+        }
+
+        return next_action();
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -8,8 +8,12 @@
 #ifndef BOOST_MYSQL_IMPL_INTERNAL_VARIANT_STREAM_HPP
 #define BOOST_MYSQL_IMPL_INTERNAL_VARIANT_STREAM_HPP
 
+#include <boost/mysql/any_address.hpp>
+#include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/resolver_cache.hpp>
 #include <boost/mysql/string_view.hpp>
+#include <boost/mysql/tls_session_cache.hpp>
 
 #include <boost/mysql/detail/any_stream.hpp>
 #include <boost/mysql/detail/config.hpp>
@@ -18,18 +22,28 @@
 #include <boost/mysql/impl/internal/ssl_context_with_default.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/cancellation_type.hpp>
 #include <boost/asio/compose.hpp>
 #include <boost/asio/connect.hpp>
 #include <boost/asio/coroutine.hpp>
+#include <boost/asio/deferred.hpp>
 #include <boost/asio/error.hpp>
+#include <boost/asio/experimental/parallel_group.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/local/stream_protocol.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/stream.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/variant2/variant.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
 #include <string>
 
 namespace boost {
@@ -55,8 +69,24 @@ class variant_stream final : public any_stream
     any_address_view address_;
 
 public:
-    variant_stream(asio::any_io_executor ex, asio::ssl::context* ctx)
-        : any_stream(true), ex_(std::move(ex)), ssl_ctx_(ctx)
+    variant_stream(
+        asio::any_io_executor ex,
+        asio::ssl::context* ctx,
+        resolver_cache* dns_cache = nullptr,
+        std::chrono::steady_clock::duration connect_attempt_timeout = {},
+        tls_session_cache* tls_sessions = nullptr
+    )
+        : any_stream(true),
+          ex_(std::move(ex)),
+          ssl_ctx_(ctx),
+          tls_sessions_(tls_sessions),
+          dns_cache_(dns_cache),
+          connect_attempt_timeout_(connect_attempt_timeout),
+          timer_(ex_),
+          rng_(static_cast<std::uint_fast32_t>(
+              std::chrono::steady_clock::now().time_since_epoch().count() ^
+              reinterpret_cast<std::uintptr_t>(this)
+          ))
     {
     }
 
@@ -73,23 +103,30 @@ public:
     {
         create_ssl_stream();
         ssl_->handshake(asio::ssl::stream_base::client, ec);
+        on_handshake_finished(ec);
     }
 
     void async_handshake(asio::any_completion_handler<void(error_code)> handler) override final
     {
         create_ssl_stream();
-        ssl_->async_handshake(asio::ssl::stream_base::client, std::move(handler));
+        asio::async_compose<asio::any_completion_handler<void(error_code)>, void(error_code)>(
+            handshake_op(*this),
+            handler,
+            ex_
+        );
     }
 
     void shutdown(error_code& ec) override final
     {
         BOOST_ASSERT(ssl_.has_value());
+        save_tls_session();
         ssl_->shutdown(ec);
     }
 
     void async_shutdown(asio::any_completion_handler<void(error_code)> handler) override final
     {
         BOOST_ASSERT(ssl_.has_value());
+        save_tls_session();
         ssl_->async_shutdown(std::move(handler));
     }
 
@@ -206,18 +243,40 @@ public:
 
         if (address_.type == address_type::host_and_port)
         {
-            // Resolve endpoints
+            // Try hosts one after another, until one accepts the connection
             auto& tcp_sock = variant2::unsafe_get<1>(sock_);
-            auto endpoints = tcp_sock.resolv.resolve(
-                cast_asio_sv_param(address_.address),
-                std::to_string(address_.port),
-                ec
-            );
-            if (ec)
-                return;
+            std::size_t num_hosts = address_.num_hosts();
+            std::size_t host_index = first_host_index();
+            for (std::size_t i = 0; i < num_hosts; ++i)
+            {
+                // Resolve endpoints, unless we have them cached
+                asio::ip::tcp::resolver::results_type endpoints;
+                ec.clear();
+                if (!find_cached_endpoints(host_index, endpoints))
+                {
+                    endpoints = tcp_sock.resolv.resolve(
+                        cast_asio_sv_param(address_.host_at(host_index)),
+                        std::to_string(address_.port_at(host_index)),
+                        ec
+                    );
+                    if (!ec)
+                        cache_endpoints(host_index, endpoints);
+                }
+
+                // Connect stream
+                if (!ec)
+                {
+                    asio::connect(tcp_sock.sock, std::move(endpoints), ec);
+                    if (!ec)
+                    {
+                        connected_host_index_ = host_index;
+                        return;
+                    }
+                    invalidate_cached_endpoints(host_index);
+                }
 
-            // Connect stream
-            asio::connect(tcp_sock.sock, std::move(endpoints), ec);
+                host_index = next_host_index(host_index);
+            }
         }
 #ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
         else
@@ -242,6 +301,7 @@ public:
 
     void close(error_code& ec) override final
     {
+        save_tls_session();
         if (auto* tcp_sock = variant2::get_if<socket_and_resolver>(&sock_))
         {
             tcp_sock->sock.close(ec);
@@ -280,8 +340,83 @@ private:
     ssl_context_with_default ssl_ctx_;
     boost::optional<asio::ssl::stream<asio::ip::tcp::socket&>> ssl_;
 
+    // TLS session resumption
+    tls_session_cache* tls_sessions_;
+    std::string tls_session_host_;  // address_ may not be valid after connect finishes, so we copy it
+    unsigned short tls_session_port_{0};
+
+    // Multi-host and resolution caching
+    resolver_cache* dns_cache_;
+    std::chrono::steady_clock::duration connect_attempt_timeout_;
+    asio::steady_timer timer_;
+    std::minstd_rand rng_;
+    std::size_t connected_host_index_{0};
+
+    // The round-robin counter is shared by all connections, so connections created
+    // together (e.g. by a connection pool) start at different hosts
+    static std::size_t next_round_robin_index() noexcept
+    {
+        static std::atomic<std::size_t> index{0};
+        return index.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the index of the first host to try, according to the address' selection policy
+    std::size_t first_host_index()
+    {
+        std::size_t num_hosts = address_.num_hosts();
+        if (num_hosts == 1u)
+            return 0u;
+        switch (address_.policy)
+        {
+        case host_selection_policy::random: return static_cast<std::size_t>(rng_() % num_hosts);
+        case host_selection_policy::round_robin: return next_round_robin_index() % num_hosts;
+        case host_selection_policy::ordered:
+        default: return 0u;
+        }
+    }
+
+    std::size_t next_host_index(std::size_t host_index) const noexcept
+    {
+        return (host_index + 1u) % address_.num_hosts();
+    }
+
+    bool find_cached_endpoints(std::size_t host_index, asio::ip::tcp::resolver::results_type& output) const
+    {
+        return dns_cache_ && dns_cache_->find(
+                                 address_.host_at(host_index),
+                                 address_.port_at(host_index),
+                                 std::chrono::steady_clock::now(),
+                                 output
+                             );
+    }
+
+    void cache_endpoints(std::size_t host_index, const asio::ip::tcp::resolver::results_type& endpoints)
+    {
+        if (dns_cache_)
+        {
+            dns_cache_->insert(
+                address_.host_at(host_index),
+                address_.port_at(host_index),
+                endpoints,
+                std::chrono::steady_clock::now()
+            );
+        }
+    }
+
+    // If we couldn't connect to any of the cached endpoints, the DNS records may have changed
+    // (e.g. because of a failover). Force a new resolution next time.
+    void invalidate_cached_endpoints(std::size_t host_index)
+    {
+        if (dns_cache_)
+            dns_cache_->invalidate(address_.host_at(host_index), address_.port_at(host_index));
+    }
+
     error_code setup_stream()
     {
+        // If we're reconnecting, capture the session established by the previous connection
+        save_tls_session();
+        ssl_.reset();
+
         if (address_.type == address_type::host_and_port)
         {
             // Clean up any previous state
@@ -308,24 +443,101 @@ private:
         // it can't be re-used for any subsequent connections
         BOOST_ASSERT(variant2::holds_alternative<socket_and_resolver>(sock_));
         ssl_.emplace(variant2::unsafe_get<1>(sock_).sock, ssl_ctx_.get());
+
+        // Offer a previously established session, if any, so the server may resume it
+        if (tls_sessions_)
+        {
+            string_view host = address_.host_at(connected_host_index_);
+            tls_session_host_.assign(host.data(), host.size());
+            tls_session_port_ = address_.port_at(connected_host_index_);
+            SSL_SESSION* session = tls_sessions_->get(tls_session_host_, tls_session_port_);
+            if (session)
+            {
+                SSL_set_session(ssl_->native_handle(), session);
+                SSL_SESSION_free(session);
+            }
+        }
     }
 
-    struct connect_op : boost::asio::coroutine
+    void on_handshake_finished(error_code ec)
+    {
+        if (!tls_sessions_)
+            return;
+        if (ec)
+        {
+            // The stored session may be the cause of the failure (e.g. the server's certificate changed)
+            tls_sessions_->invalidate(tls_session_host_, tls_session_port_);
+        }
+        else
+        {
+            save_tls_session();
+        }
+    }
+
+    // Stores the session established by the current TLS stream, if any, in the session cache.
+    // With TLS 1.3, session tickets are sent by the server after the handshake, so this is also
+    // called before the stream is torn down, to capture any ticket received in between.
+    void save_tls_session()
+    {
+        if (!tls_sessions_ || !ssl_.has_value())
+            return;
+        SSL* ssl = ssl_->native_handle();
+        if (!SSL_is_init_finished(ssl))
+            return;
+        SSL_SESSION* session = SSL_get1_session(ssl);
+        if (session == nullptr)
+            return;
+#if OPENSSL_VERSION_NUMBER >= 0x10101000L
+        bool resumable = SSL_SESSION_is_resumable(session) != 0;
+#else
+        bool resumable = true;
+#endif
+        if (resumable)
+        {
+            tls_sessions_->store(tls_session_host_, tls_session_port_, session);
+        }
+        SSL_SESSION_free(session);
+    }
+
+    struct handshake_op : boost::asio::coroutine
     {
         variant_stream& this_obj_;
-        error_code stored_ec_;
 
-        connect_op(variant_stream& this_obj) noexcept : this_obj_(this_obj) {}
+        handshake_op(variant_stream& this_obj) noexcept : this_obj_(this_obj) {}
 
         template <class Self>
-        void operator()(Self& self, error_code ec = {}, asio::ip::tcp::resolver::results_type endpoints = {})
+        void operator()(Self& self, error_code ec = {})
         {
-            if (ec)
+            BOOST_ASIO_CORO_REENTER(*this)
             {
+                BOOST_ASIO_CORO_YIELD
+                this_obj_.ssl_->async_handshake(asio::ssl::stream_base::client, std::move(self));
+                this_obj_.on_handshake_finished(ec);
                 self.complete(ec);
-                return;
             }
+        }
+    };
 
+    struct connect_op : boost::asio::coroutine
+    {
+        variant_stream& this_obj_;
+        error_code stored_ec_;
+        std::size_t host_index_{0};
+        std::size_t num_tries_{0};
+        asio::ip::tcp::resolver::results_type endpoints_;
+
+        connect_op(variant_stream& this_obj) noexcept : this_obj_(this_obj) {}
+
+        asio::ip::tcp::socket& tcp_sock() noexcept { return variant2::unsafe_get<1>(this_obj_.sock_).sock; }
+
+        static bool is_cancellation(error_code ec) noexcept
+        {
+            return ec == client_errc::cancelled || ec == asio::error::operation_aborted;
+        }
+
+        template <class Self>
+        void operator()(Self& self, error_code ec = {})
+        {
             BOOST_ASIO_CORO_REENTER(*this)
             {
                 // Setup stream
@@ -339,25 +551,66 @@ private:
 
                 if (this_obj_.address_.type == address_type::host_and_port)
                 {
-                    // Resolve endpoints
-                    BOOST_ASIO_CORO_YIELD
-                    variant2::unsafe_get<1>(this_obj_.sock_)
-                        .resolv.async_resolve(
-                            cast_asio_sv_param(this_obj_.address_.address),
-                            std::to_string(this_obj_.address_.port),
-                            std::move(self)
-                        );
-
-                    // Connect stream
-                    BOOST_ASIO_CORO_YIELD
-                    asio::async_connect(
-                        variant2::unsafe_get<1>(this_obj_.sock_).sock,
-                        std::move(endpoints),
-                        std::move(self)
-                    );
+                    // Try hosts one after another, until one accepts the connection
+                    host_index_ = this_obj_.first_host_index();
+                    for (num_tries_ = 0; num_tries_ < this_obj_.address_.num_hosts(); ++num_tries_)
+                    {
+                        // Resolve endpoints, unless we have them cached
+                        ec.clear();
+                        if (!this_obj_.find_cached_endpoints(host_index_, endpoints_))
+                        {
+                            BOOST_ASIO_CORO_YIELD
+                            variant2::unsafe_get<1>(this_obj_.sock_)
+                                .resolv.async_resolve(
+                                    cast_asio_sv_param(this_obj_.address_.host_at(host_index_)),
+                                    std::to_string(this_obj_.address_.port_at(host_index_)),
+                                    std::move(self)
+                                );
+                            if (!ec)
+                                this_obj_.cache_endpoints(host_index_, endpoints_);
+                        }
+
+                        if (!ec)
+                        {
+                            // Connect stream, applying the per-attempt timeout, if any
+                            if (this_obj_.connect_attempt_timeout_.count() > 0)
+                            {
+                                this_obj_.timer_.expires_after(this_obj_.connect_attempt_timeout_);
+                                BOOST_ASIO_CORO_YIELD
+                                asio::experimental::make_parallel_group(
+                                    asio::async_connect(tcp_sock(), endpoints_, asio::deferred),
+                                    this_obj_.timer_.async_wait(asio::deferred)
+                                )
+                                    .async_wait(asio::experimental::wait_for_one(), std::move(self));
+                            }
+                            else
+                            {
+                                BOOST_ASIO_CORO_YIELD
+                                asio::async_connect(tcp_sock(), endpoints_, std::move(self));
+                            }
+
+                            if (!ec)
+                            {
+                                this_obj_.connected_host_index_ = host_index_;
+                                self.complete(error_code());
+                                return;
+                            }
+                            this_obj_.invalidate_cached_endpoints(host_index_);
+                        }
+
+                        // If the operation was cancelled (e.g. by a timeout), don't try the remaining hosts
+                        if (is_cancellation(ec) ||
+                            self.get_cancellation_state().cancelled() != asio::cancellation_type::none)
+                        {
+                            self.complete(ec);
+                            return;
+                        }
+
+                        stored_ec_ = ec;
+                        host_index_ = this_obj_.next_host_index(host_index_);
+                    }
 
-                    // The final handler requires a void(error_code, tcp::endpoint signature),
-                    // which this function can't implement. See operator() overload below.
+                    self.complete(stored_ec_);
                 }
 #ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
                 else
@@ -369,16 +622,43 @@ private:
                     variant2::unsafe_get<2>(this_obj_.sock_)
                         .async_connect(cast_asio_sv_param(this_obj_.address_.address), std::move(self));
 
-                    self.complete(error_code());
+                    self.complete(ec);
                 }
 #endif
             }
         }
 
+        // Resolve completion
+        template <class Self>
+        void operator()(Self& self, error_code ec, asio::ip::tcp::resolver::results_type endpoints)
+        {
+            endpoints_ = std::move(endpoints);
+            (*this)(self, ec);
+        }
+
+        // Connect completion, without timeout
         template <class Self>
         void operator()(Self& self, error_code ec, asio::ip::tcp::endpoint)
         {
-            self.complete(ec);
+            (*this)(self, ec);
+        }
+
+        // Connect completion, with timeout
+        template <class Self>
+        void operator()(
+            Self& self,
+            std::array<std::size_t, 2> completion_order,
+            error_code connect_ec,
+            asio::ip::tcp::endpoint,
+            error_code timer_ec
+        )
+        {
+            if (completion_order[0] == 0u)  // connect finished first
+                (*this)(self, connect_ec);
+            else if (!timer_ec)  // the timer fired
+                (*this)(self, client_errc::timeout);
+            else  // the operation was cancelled
+                (*this)(self, client_errc::cancelled);
         }
     };
 };
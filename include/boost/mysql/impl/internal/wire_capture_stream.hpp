@@ -0,0 +1,371 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_WIRE_CAPTURE_STREAM_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_WIRE_CAPTURE_STREAM_HPP
+
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <boost/mysql/detail/any_stream.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Decorates a stream, recording every completed operation into a wire_capture
+class capturing_stream final : public any_stream
+{
+    std::unique_ptr<any_stream> next_;
+    wire_capture& capture_;
+
+    void record(error_code ec, wire_event type)
+    {
+        if (!ec)
+            capture_.record(type);
+    }
+
+    // Runs an operation on next_, recording it on success
+    struct control_op
+    {
+        capturing_stream& this_obj_;
+        wire_event type_;
+
+        template <class Self>
+        void operator()(Self& self)
+        {
+            auto& next = *this_obj_.next_;
+            switch (type_)
+            {
+            case wire_event::connect: next.async_connect(std::move(self)); break;
+            case wire_event::tls_handshake: next.async_handshake(std::move(self)); break;
+            default:
+                BOOST_ASSERT(type_ == wire_event::tls_shutdown);
+                next.async_shutdown(std::move(self));
+                break;
+            }
+        }
+
+        template <class Self>
+        void operator()(Self& self, error_code ec)
+        {
+            this_obj_.record(ec, type_);
+            self.complete(ec);
+        }
+    };
+
+    // Runs a read or write on next_, recording the transferred bytes.
+    // Failed operations may have transferred some bytes, too.
+    struct transfer_op
+    {
+        capturing_stream& this_obj_;
+        wire_event type_;
+        asio::mutable_buffer buff_;  // const-ness is restored for writes
+        bool use_ssl_;
+
+        template <class Self>
+        void operator()(Self& self)
+        {
+            if (type_ == wire_event::read)
+                this_obj_.next_->async_read_some(buff_, use_ssl_, std::move(self));
+            else
+                this_obj_.next_->async_write_some(buff_, use_ssl_, std::move(self));
+        }
+
+        template <class Self>
+        void operator()(Self& self, error_code ec, std::size_t bytes_transferred)
+        {
+            if (bytes_transferred)
+                this_obj_.capture_.record(type_, asio::buffer(buff_.data(), bytes_transferred));
+            self.complete(ec, bytes_transferred);
+        }
+    };
+
+    void launch(wire_event type, asio::any_completion_handler<void(error_code)> handler)
+    {
+        asio::async_compose<asio::any_completion_handler<void(error_code)>, void(error_code)>(
+            control_op{*this, type},
+            handler,
+            next_->get_executor()
+        );
+    }
+
+    void launch(
+        wire_event type,
+        asio::mutable_buffer buff,
+        bool use_ssl,
+        asio::any_completion_handler<void(error_code, std::size_t)> handler
+    )
+    {
+        asio::async_compose<
+            asio::any_completion_handler<void(error_code, std::size_t)>,
+            void(error_code, std::size_t)>(
+            transfer_op{*this, type, buff, use_ssl},
+            handler,
+            next_->get_executor()
+        );
+    }
+
+public:
+    capturing_stream(std::unique_ptr<any_stream> next, wire_capture& capture)
+        : any_stream(next->supports_ssl()), next_(std::move(next)), capture_(capture)
+    {
+    }
+
+    executor_type get_executor() override final { return next_->get_executor(); }
+
+    // SSL
+    void handshake(error_code& ec) override final
+    {
+        next_->handshake(ec);
+        record(ec, wire_event::tls_handshake);
+    }
+
+    void async_handshake(asio::any_completion_handler<void(error_code)> handler) override final
+    {
+        launch(wire_event::tls_handshake, std::move(handler));
+    }
+
+    void shutdown(error_code& ec) override final
+    {
+        next_->shutdown(ec);
+        record(ec, wire_event::tls_shutdown);
+    }
+
+    void async_shutdown(asio::any_completion_handler<void(error_code)> handler) override final
+    {
+        launch(wire_event::tls_shutdown, std::move(handler));
+    }
+
+    // Reading
+    std::size_t read_some(asio::mutable_buffer buff, bool use_ssl, error_code& ec) override final
+    {
+        std::size_t res = next_->read_some(buff, use_ssl, ec);
+        if (res)
+            capture_.record(wire_event::read, asio::buffer(buff.data(), res));
+        return res;
+    }
+
+    void async_read_some(
+        asio::mutable_buffer buff,
+        bool use_ssl,
+        asio::any_completion_handler<void(error_code, std::size_t)> handler
+    ) override final
+    {
+        launch(wire_event::read, buff, use_ssl, std::move(handler));
+    }
+
+    // Writing
+    std::size_t write_some(asio::const_buffer buff, bool use_ssl, error_code& ec) override final
+    {
+        std::size_t res = next_->write_some(buff, use_ssl, ec);
+        if (res)
+            capture_.record(wire_event::write, asio::buffer(buff.data(), res));
+        return res;
+    }
+
+    void async_write_some(
+        asio::const_buffer buff,
+        bool use_ssl,
+        asio::any_completion_handler<void(error_code, std::size_t)> handler
+    ) override final
+    {
+        asio::mutable_buffer mbuff(const_cast<void*>(buff.data()), buff.size());
+        launch(wire_event::write, mbuff, use_ssl, std::move(handler));
+    }
+
+    // Connect and close
+    void set_endpoint(const void* value) override final { next_->set_endpoint(value); }
+
+    void connect(error_code& ec) override final
+    {
+        next_->connect(ec);
+        record(ec, wire_event::connect);
+    }
+
+    void async_connect(asio::any_completion_handler<void(error_code)> handler) override final
+    {
+        launch(wire_event::connect, std::move(handler));
+    }
+
+    void close(error_code& ec) override final
+    {
+        next_->close(ec);
+        record(ec, wire_event::close);
+    }
+};
+
+// A stream that performs no I/O, serving reads from a wire_replay
+class replay_stream final : public any_stream
+{
+    asio::any_io_executor ex_;
+    wire_replay& replay_;
+
+    // Completes immediately, but never from within the initiating function
+    struct immediate_op : asio::coroutine
+    {
+        asio::any_io_executor ex_;
+        error_code ec_;
+
+        immediate_op(asio::any_io_executor ex, error_code ec) noexcept : ex_(std::move(ex)), ec_(ec) {}
+
+        template <class Self>
+        void operator()(Self& self)
+        {
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                BOOST_ASIO_CORO_YIELD asio::post(ex_, std::move(self));
+                self.complete(ec_);
+            }
+        }
+    };
+
+    struct immediate_transfer_op : asio::coroutine
+    {
+        asio::any_io_executor ex_;
+        error_code ec_;
+        std::size_t bytes_transferred_;
+
+        immediate_transfer_op(asio::any_io_executor ex, error_code ec, std::size_t bytes_transferred) noexcept
+            : ex_(std::move(ex)), ec_(ec), bytes_transferred_(bytes_transferred)
+        {
+        }
+
+        template <class Self>
+        void operator()(Self& self)
+        {
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                BOOST_ASIO_CORO_YIELD asio::post(ex_, std::move(self));
+                self.complete(ec_, bytes_transferred_);
+            }
+        }
+    };
+
+    void complete_immediately(asio::any_completion_handler<void(error_code)> handler)
+    {
+        asio::async_compose<asio::any_completion_handler<void(error_code)>, void(error_code)>(
+            immediate_op(ex_, error_code()),
+            handler,
+            ex_
+        );
+    }
+
+    void complete_immediately(
+        error_code ec,
+        std::size_t bytes_transferred,
+        asio::any_completion_handler<void(error_code, std::size_t)> handler
+    )
+    {
+        asio::async_compose<
+            asio::any_completion_handler<void(error_code, std::size_t)>,
+            void(error_code, std::size_t)>(immediate_transfer_op(ex_, ec, bytes_transferred), handler, ex_);
+    }
+
+    std::size_t do_read(asio::mutable_buffer buff, error_code& ec) noexcept
+    {
+        ec.clear();
+        if (buff.size() == 0u)
+            return 0u;
+        std::size_t res = replay_.read(buff);
+        if (res == 0u)
+            ec = asio::error::eof;
+        return res;
+    }
+
+    std::size_t do_write(asio::const_buffer buff, error_code& ec) noexcept
+    {
+        ec.clear();
+        replay_.write(buff);
+        return buff.size();
+    }
+
+public:
+    replay_stream(asio::any_io_executor ex, wire_replay& replay)
+        : any_stream(true), ex_(std::move(ex)), replay_(replay)
+    {
+    }
+
+    executor_type get_executor() override final { return ex_; }
+
+    // SSL. The replayed bytes are plaintext, so there is nothing to do
+    void handshake(error_code& ec) override final { ec.clear(); }
+
+    void async_handshake(asio::any_completion_handler<void(error_code)> handler) override final
+    {
+        complete_immediately(std::move(handler));
+    }
+
+    void shutdown(error_code& ec) override final { ec.clear(); }
+
+    void async_shutdown(asio::any_completion_handler<void(error_code)> handler) override final
+    {
+        complete_immediately(std::move(handler));
+    }
+
+    // Reading
+    std::size_t read_some(asio::mutable_buffer buff, bool, error_code& ec) override final
+    {
+        return do_read(buff, ec);
+    }
+
+    void async_read_some(
+        asio::mutable_buffer buff,
+        bool,
+        asio::any_completion_handler<void(error_code, std::size_t)> handler
+    ) override final
+    {
+        error_code ec;
+        std::size_t res = do_read(buff, ec);
+        complete_immediately(ec, res, std::move(handler));
+    }
+
+    // Writing
+    std::size_t write_some(asio::const_buffer buff, bool, error_code& ec) override final
+    {
+        return do_write(buff, ec);
+    }
+
+    void async_write_some(
+        asio::const_buffer buff,
+        bool,
+        asio::any_completion_handler<void(error_code, std::size_t)> handler
+    ) override final
+    {
+        error_code ec;
+        std::size_t res = do_write(buff, ec);
+        complete_immediately(ec, res, std::move(handler));
+    }
+
+    // Connect and close
+    void set_endpoint(const void*) override final {}
+    void connect(error_code& ec) override final { ec.clear(); }
+
+    void async_connect(asio::any_completion_handler<void(error_code)> handler) override final
+    {
+        complete_immediately(std::move(handler));
+    }
+
+    void close(error_code& ec) override final { ec.clear(); }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_LAZY_ROW_IMPL_IPP
+#define BOOST_MYSQL_IMPL_LAZY_ROW_IMPL_IPP
+
+#pragma once
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+
+#include <boost/mysql/detail/lazy_row_impl.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+
+#include <boost/mysql/impl/internal/protocol/basic_types.hpp>
+#include <boost/mysql/impl/internal/protocol/null_bitmap_traits.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Advances ctx past a non-NULL binary field, without decoding it.
+// Must be kept in sync with get_binary_field_decoder
+inline deserialize_errc skip_binary_field(deserialization_context& ctx, column_type type) noexcept
+{
+    std::size_t size = 0;
+    switch (type)
+    {
+    case column_type::tinyint: size = 1; break;
+    case column_type::smallint:
+    case column_type::year: size = 2; break;
+    case column_type::mediumint:
+    case column_type::int_:
+    case column_type::float_: size = 4; break;
+    case column_type::bigint:
+    case column_type::double_: size = 8; break;
+    case column_type::timestamp:
+    case column_type::datetime:
+    case column_type::date:
+    case column_type::time:
+    {
+        // int<1> length, followed by the actual value
+        std::uint8_t length = 0;
+        auto err = deserialize(ctx, length);
+        if (err != deserialize_errc::ok)
+            return err;
+        size = length;
+        break;
+    }
+    default:
+    {
+        // Strings, blobs, decimals and bits are sent as length-encoded strings
+        string_lenenc value;
+        return deserialize(ctx, value);
+    }
+    }
+
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    ctx.advance(size);
+    return deserialize_errc::ok;
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::error_code boost::mysql::detail::lazy_row_impl::reset(
+    const row_decoding_plan& plan,
+    metadata_collection_view meta,
+    span<const std::uint8_t> msg
+)
+{
+    BOOST_ASSERT(plan.size() == meta.size());
+
+    plan_ = &plan;
+    meta_ = meta;
+    msg_ = msg;
+    offsets_.clear();
+    fields_.resize(meta.size());
+    decoded_.assign(meta.size(), 0u);
+
+    deserialization_context ctx(msg);
+    auto offset = [&ctx, msg]() { return static_cast<std::size_t>(ctx.first() - msg.data()); };
+
+    if (plan.encoding() == resultset_encoding::text)
+    {
+        for (std::size_t i = 0; i < meta.size(); ++i)
+        {
+            if (ctx.enough_size(1) && *ctx.first() == 0xfb)
+            {
+                ctx.advance(1);
+                offsets_.push_back(std::size_t(null_offset));
+            }
+            else
+            {
+                offsets_.push_back(offset());
+                string_lenenc value;
+                auto err = deserialize(ctx, value);
+                if (err != deserialize_errc::ok)
+                    return to_error_code(err);
+            }
+        }
+    }
+    else
+    {
+        // Packet header, as in deserialize_binary_row
+        if (!ctx.enough_size(1))
+            return client_errc::incomplete_message;
+        ctx.advance(1);
+
+        // Null bitmap
+        null_bitmap_traits null_bitmap(binary_row_null_bitmap_offset, meta.size());
+        const std::uint8_t* null_bitmap_begin = ctx.first();
+        if (!ctx.enough_size(null_bitmap.byte_count()))
+            return client_errc::incomplete_message;
+        ctx.advance(null_bitmap.byte_count());
+
+        for (std::size_t i = 0; i < meta.size(); ++i)
+        {
+            if (null_bitmap.is_null(null_bitmap_begin, i))
+            {
+                offsets_.push_back(std::size_t(null_offset));
+            }
+            else
+            {
+                offsets_.push_back(offset());
+                auto err = skip_binary_field(ctx, meta[i].type());
+                if (err != deserialize_errc::ok)
+                    return to_error_code(err);
+            }
+        }
+    }
+
+    return ctx.check_extra_bytes();
+}
+
+boost::mysql::error_code boost::mysql::detail::lazy_row_impl::decode(std::size_t i)
+{
+    BOOST_ASSERT(i < size());
+    field_view& output = fields_[i];
+    std::size_t offset = offsets_[i];
+    deserialize_errc err = deserialize_errc::ok;
+
+    if (offset == null_offset)
+    {
+        output = field_view(nullptr);
+    }
+    else
+    {
+        deserialization_context ctx(msg_.data() + offset, msg_.size() - offset);
+        if (plan_->encoding() == resultset_encoding::text)
+        {
+            // The framing has already been validated by reset()
+            string_lenenc value;
+            err = deserialize(ctx, value);
+            BOOST_ASSERT(err == deserialize_errc::ok);
+            err = plan_->text_decoders()[i](value.value, meta_[i], output);
+        }
+        else
+        {
+            err = plan_->binary_decoders()[i](ctx, meta_[i], output);
+        }
+    }
+
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+    decoded_[i] = 1u;
+    return error_code();
+}
+
+#endif
@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_MULTIPLEXED_CONNECTION_IPP
+#define BOOST_MYSQL_IMPL_MULTIPLEXED_CONNECTION_IPP
+
+#pragma once
+
+#include <boost/mysql/multiplexed_connection.hpp>
+
+#include <boost/mysql/impl/internal/multiplexed_connection_impl.hpp>
+
+boost::mysql::multiplexed_connection::multiplexed_connection(
+    any_connection&& conn,
+    std::size_t max_pipeline_size
+)
+    : impl_(std::make_shared<detail::multiplexed_connection_impl>(std::move(conn), max_pipeline_size))
+{
+}
+
+boost::mysql::multiplexed_connection::executor_type boost::mysql::multiplexed_connection::get_executor(
+) noexcept
+{
+    BOOST_ASSERT(valid());
+    return impl_->get_executor();
+}
+
+boost::mysql::any_connection& boost::mysql::multiplexed_connection::connection() noexcept
+{
+    BOOST_ASSERT(valid());
+    return impl_->connection();
+}
+
+void boost::mysql::multiplexed_connection::async_run_erased(
+    std::shared_ptr<detail::multiplexed_connection_impl> self,
+    asio::any_completion_handler<void(error_code)> handler
+)
+{
+    self->async_run(std::move(handler));
+}
+
+void boost::mysql::multiplexed_connection::async_execute_erased(
+    std::shared_ptr<detail::multiplexed_connection_impl> self,
+    detail::any_execution_request req,
+    detail::execution_processor& proc,
+    diagnostics& diag,
+    asio::any_completion_handler<void(error_code)> handler
+)
+{
+    self->async_execute(req, proc, diag, std::move(handler));
+}
+
+void boost::mysql::multiplexed_connection::cancel()
+{
+    BOOST_ASSERT(valid());
+    impl_->cancel();
+}
+
+#endif
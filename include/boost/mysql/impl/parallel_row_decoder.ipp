@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_PARALLEL_ROW_DECODER_IPP
+#define BOOST_MYSQL_IMPL_PARALLEL_ROW_DECODER_IPP
+
+#pragma once
+
+#include <boost/mysql/parallel_row_decoder.hpp>
+
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Shared between the thread calling run() and the tasks it posts. Tasks may start
+// after run() has returned. By then, all chunks have been claimed, so they exit
+// without invoking the chunk function, which may no longer be valid
+class parallel_run_state
+{
+    using chunk_fn = error_code (*)(void*, std::size_t, std::size_t);
+
+    std::size_t num_items_;
+    std::size_t chunk_size_;
+    std::size_t num_chunks_;
+    chunk_fn fn_;
+    void* ctx_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::size_t next_chunk_{0};
+    std::size_t running_{0};
+    error_code err_;
+
+    bool done() const noexcept { return next_chunk_ == num_chunks_ && running_ == 0u; }
+
+    bool claim(std::size_t& chunk)
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        if (next_chunk_ == num_chunks_)
+            return false;
+        chunk = next_chunk_++;
+        ++running_;
+        return true;
+    }
+
+    void finish(error_code ec)
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        --running_;
+        if (ec && !err_)
+        {
+            // Skip the chunks that haven't started yet
+            err_ = ec;
+            next_chunk_ = num_chunks_;
+        }
+        if (done())
+            cv_.notify_all();
+    }
+
+public:
+    parallel_run_state(
+        std::size_t num_items,
+        std::size_t chunk_size,
+        std::size_t num_chunks,
+        chunk_fn fn,
+        void* ctx
+    ) noexcept
+        : num_items_(num_items), chunk_size_(chunk_size), num_chunks_(num_chunks), fn_(fn), ctx_(ctx)
+    {
+    }
+
+    // Decodes chunks until none are left
+    void work()
+    {
+        std::size_t chunk = 0;
+        while (claim(chunk))
+        {
+            std::size_t first = chunk * chunk_size_;
+            std::size_t last = (std::min)(first + chunk_size_, num_items_);
+            finish(fn_(ctx_, first, last));
+        }
+    }
+
+    // Waits until all claimed chunks are finished. Must be called after work()
+    error_code wait()
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [this] { return done(); });
+        return err_;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::parallel_row_decoder::parallel_row_decoder(
+    executor_type ex,
+    std::size_t max_tasks,
+    std::size_t min_rows_per_task
+) noexcept
+    : ex_(std::move(ex)),
+      max_tasks_(max_tasks ? max_tasks : (std::max)(std::thread::hardware_concurrency(), 1u)),
+      min_rows_per_task_((std::max)(min_rows_per_task, std::size_t(1)))
+{
+}
+
+boost::mysql::error_code boost::mysql::parallel_row_decoder::run_impl(
+    std::size_t num_items,
+    chunk_fn fn,
+    void* ctx
+)
+{
+    // Compute the chunks, such that all of them have at least min_rows_per_task items.
+    // Small ranges are processed inline
+    if (!splits(num_items))
+        return num_items ? fn(ctx, 0u, num_items) : error_code();
+    std::size_t num_chunks = (std::min)(max_tasks_, num_items / min_rows_per_task_);
+    std::size_t chunk_size = (num_items + num_chunks - 1u) / num_chunks;
+    num_chunks = (num_items + chunk_size - 1u) / chunk_size;
+
+    // Post a task per chunk, except for the one processed by this thread.
+    // Tasks don't own the chunk function, so we must wait for them, even if posting fails
+    auto st = std::make_shared<detail::parallel_run_state>(num_items, chunk_size, num_chunks, fn, ctx);
+    try
+    {
+        for (std::size_t i = 1; i < num_chunks; ++i)
+            asio::post(ex_, [st] { st->work(); });
+    }
+    catch (...)
+    {
+        st->work();
+        st->wait();
+        throw;
+    }
+
+    // Process chunks ourselves, until none are left, then wait for the ones being processed by tasks
+    st->work();
+    return st->wait();
+}
+
+#endif
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_RESOLVER_CACHE_IPP
+#define BOOST_MYSQL_IMPL_RESOLVER_CACHE_IPP
+
+#pragma once
+
+#include <boost/mysql/resolver_cache.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+std::size_t boost::mysql::resolver_cache::find_entry(string_view host, unsigned short port) const noexcept
+{
+    auto it = std::find_if(entries_.begin(), entries_.end(), [host, port](const entry& e) {
+        return e.port == port && e.host == host;
+    });
+    return static_cast<std::size_t>(it - entries_.begin());
+}
+
+bool boost::mysql::resolver_cache::find(
+    string_view host,
+    unsigned short port,
+    std::chrono::steady_clock::time_point now,
+    endpoints_type& output
+) const
+{
+    if (ttl_.count() <= 0)
+        return false;
+
+    std::lock_guard<std::mutex> guard(mtx_);
+    std::size_t idx = find_entry(host, port);
+    if (idx == entries_.size() || entries_[idx].expiry <= now)
+        return false;
+    output = entries_[idx].endpoints;
+    return true;
+}
+
+void boost::mysql::resolver_cache::insert(
+    string_view host,
+    unsigned short port,
+    endpoints_type endpoints,
+    std::chrono::steady_clock::time_point now
+)
+{
+    if (ttl_.count() <= 0)
+        return;
+
+    std::lock_guard<std::mutex> guard(mtx_);
+    std::size_t idx = find_entry(host, port);
+    if (idx == entries_.size())
+    {
+        entries_.push_back(entry{std::string(host), port, std::move(endpoints), now + ttl_});
+    }
+    else
+    {
+        entries_[idx].endpoints = std::move(endpoints);
+        entries_[idx].expiry = now + ttl_;
+    }
+}
+
+void boost::mysql::resolver_cache::invalidate(string_view host, unsigned short port)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    std::size_t idx = find_entry(host, port);
+    if (idx != entries_.size())
+        entries_.erase(entries_.begin() + idx);
+}
+
+void boost::mysql::resolver_cache::clear()
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    entries_.clear();
+}
+
+std::size_t boost::mysql::resolver_cache::size() const
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    return entries_.size();
+}
+
+#endif
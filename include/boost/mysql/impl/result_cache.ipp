@@ -0,0 +1,254 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_RESULT_CACHE_IPP
+#define BOOST_MYSQL_IMPL_RESULT_CACHE_IPP
+
+#pragma once
+
+#include <boost/mysql/result_cache.hpp>
+
+#include <boost/mysql/impl/internal/protocol/basic_types.hpp>
+#include <boost/mysql/impl/internal/protocol/binary_serialization.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+#include <boost/mysql/impl/internal/result_cache_load_op.hpp>
+
+#include <boost/asio/append.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::string boost::mysql::result_cache::make_key(string_view sql, span<const field_view> params)
+{
+    // The SQL text is length-prefixed, and each parameter is serialized as its kind
+    // followed by its binary protocol representation, so distinct inputs never yield the same key
+    std::size_t size = detail::get_size(detail::string_lenenc{sql});
+    for (auto param : params)
+        size += 1u + detail::get_size(param);
+
+    std::string res(size, '\0');
+    detail::serialization_context ctx(reinterpret_cast<std::uint8_t*>(&res[0]));
+    detail::serialize(ctx, detail::string_lenenc{sql});
+    for (auto param : params)
+    {
+        ctx.write(static_cast<std::uint8_t>(param.kind()));
+        detail::serialize(ctx, param);
+    }
+    return res;
+}
+
+boost::mysql::result_cache::results_ptr boost::mysql::result_cache::find_impl(
+    const std::string& key,
+    std::chrono::steady_clock::time_point now
+)
+{
+    auto it = entries_.find(key);
+    if (it == entries_.end())
+        return nullptr;
+    if (it->second->expiry <= now)
+    {
+        erase_impl(it->second);
+        return nullptr;
+    }
+
+    // Mark it as the most recently used
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->res;
+}
+
+void boost::mysql::result_cache::erase_impl(std::list<entry>::iterator it)
+{
+    entries_.erase(it->key);
+    lru_.erase(it);
+}
+
+void boost::mysql::result_cache::insert_impl(
+    const std::string& key,
+    results_ptr res,
+    std::vector<std::string> tags,
+    std::chrono::steady_clock::time_point now
+)
+{
+    BOOST_ASSERT(res != nullptr);
+
+    if (ttl_.count() <= 0 || max_entries_ == 0u)
+        return;
+
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        // Replace the existing entry
+        auto& e = *it->second;
+        e.res = std::move(res);
+        e.tags = std::move(tags);
+        e.expiry = now + ttl_;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return;
+    }
+
+    // Make room for the new entry
+    if (lru_.size() >= max_entries_)
+        erase_impl(std::prev(lru_.end()));
+
+    lru_.push_front(entry{key, std::move(res), std::move(tags), now + ttl_});
+    try
+    {
+        entries_.emplace(key, lru_.begin());
+    }
+    catch (...)
+    {
+        lru_.pop_front();
+        throw;
+    }
+}
+
+boost::mysql::result_cache::results_ptr boost::mysql::result_cache::find(
+    string_view key,
+    std::chrono::steady_clock::time_point now
+)
+{
+    std::string key_str(key);
+    std::lock_guard<std::mutex> guard(mtx_);
+    return find_impl(key_str, now);
+}
+
+void boost::mysql::result_cache::insert(
+    string_view key,
+    results_ptr res,
+    span<const string_view> tags,
+    std::chrono::steady_clock::time_point now
+)
+{
+    std::vector<std::string> tags_vec(tags.begin(), tags.end());
+    std::lock_guard<std::mutex> guard(mtx_);
+    insert_impl(std::string(key), std::move(res), std::move(tags_vec), now);
+}
+
+void boost::mysql::result_cache::invalidate(string_view key)
+{
+    std::string key_str(key);
+    std::lock_guard<std::mutex> guard(mtx_);
+    ++generation_;
+    auto it = entries_.find(key_str);
+    if (it != entries_.end())
+        erase_impl(it->second);
+}
+
+void boost::mysql::result_cache::invalidate_tag(string_view tag)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    ++generation_;
+    for (auto it = lru_.begin(); it != lru_.end();)
+    {
+        auto current = it++;
+        if (std::find(current->tags.begin(), current->tags.end(), tag) != current->tags.end())
+            erase_impl(current);
+    }
+}
+
+void boost::mysql::result_cache::clear()
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    ++generation_;
+    entries_.clear();
+    lru_.clear();
+}
+
+std::size_t boost::mysql::result_cache::size() const
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    return lru_.size();
+}
+
+bool boost::mysql::result_cache::begin_flight(
+    const std::string& key,
+    handler_type& handler,
+    const asio::any_io_executor& ex,
+    diagnostics* diag,
+    std::uint64_t& generation
+)
+{
+    results_ptr res;
+
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+
+        // Cache hit
+        res = find_impl(key, std::chrono::steady_clock::now());
+
+        if (!res)
+        {
+            // If there is already a query for this key in progress, wait for it
+            auto it = flights_.find(key);
+            if (it != flights_.end())
+            {
+                it->second.push_back(waiter{std::move(handler), ex, diag});
+                return false;
+            }
+
+            // Otherwise, we will be the ones running the query
+            flights_[key].push_back(waiter{std::move(handler), ex, diag});
+            generation = generation_;
+            return true;
+        }
+    }
+
+    asio::post(ex, asio::append(std::move(handler), error_code(), std::move(res)));
+    return false;
+}
+
+void boost::mysql::result_cache::async_execute_erased(
+    connection_pool& pool,
+    string_view sql,
+    span<const field_view> params,
+    span<const string_view> tags,
+    diagnostics* diag,
+    handler_type handler
+)
+{
+    detail::result_cache_load_op::start(*this, pool, sql, params, tags, diag, std::move(handler));
+}
+
+void boost::mysql::result_cache::finish_flight(
+    const std::string& key,
+    std::uint64_t generation,
+    std::vector<std::string> tags,
+    error_code ec,
+    const diagnostics& diag,
+    results_ptr res
+)
+{
+    std::vector<waiter> waiters;
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+
+        // Don't cache results that may have been invalidated while the query was running
+        if (!ec && generation == generation_)
+            insert_impl(key, res, std::move(tags), std::chrono::steady_clock::now());
+
+        auto it = flights_.find(key);
+        BOOST_ASSERT(it != flights_.end());
+        waiters = std::move(it->second);
+        flights_.erase(it);
+    }
+
+    for (auto& w : waiters)
+    {
+        if (ec)
+            *w.diag = diag;
+        asio::post(w.ex, asio::append(std::move(w.handler), ec, res));
+    }
+}
+
+#endif
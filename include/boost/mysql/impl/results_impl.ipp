@@ -68,9 +68,11 @@ boost::mysql::error_code boost::mysql::detail::results_impl::
 }
 
 boost::mysql::error_code boost::mysql::detail::results_impl::
-    on_meta_impl(const coldef_view& coldef, bool, diagnostics&)
+    on_meta_impl(const coldef_view& coldef, bool is_last, diagnostics&)
 {
     meta_.push_back(create_meta(coldef));
+    if (is_last)
+        decoding_plan_.compile(encoding(), current_resultset_meta());
     return error_code();
 }
 
@@ -85,13 +87,31 @@ boost::mysql::error_code boost::mysql::detail::results_impl::
     ++current_resultset().num_rows;
 
     // deserialize the row
-    auto err = deserialize_row(encoding(), msg, current_resultset_meta(), storage);
+    auto err = deserialize_row(decoding_plan_, msg, current_resultset_meta(), storage);
     if (err)
         return err;
 
     return error_code();
 }
 
+boost::mysql::error_code boost::mysql::detail::results_impl::on_rows_impl(
+    span<const span<const std::uint8_t>> msgs,
+    const output_ref&,
+    std::vector<field_view>&,
+    parallel_row_decoder& decoder
+)
+{
+    BOOST_ASSERT(has_active_batch());
+
+    // add storage for all the rows
+    std::size_t num_fields = current_resultset().num_columns;
+    span<field_view> storage = rows_.add_fields(num_fields * msgs.size());
+    current_resultset().num_rows += msgs.size();
+
+    // deserialize them
+    return deserialize_rows(decoding_plan_, msgs, current_resultset_meta(), storage, decoder);
+}
+
 boost::mysql::error_code boost::mysql::detail::results_impl::on_row_ok_packet_impl(const ok_view& pack)
 {
     on_ok_packet_impl(pack);
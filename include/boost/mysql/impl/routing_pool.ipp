@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_ROUTING_POOL_IPP
+#define BOOST_MYSQL_IMPL_ROUTING_POOL_IPP
+
+#pragma once
+
+#include <boost/mysql/routing_pool.hpp>
+
+#include <boost/mysql/impl/internal/connection_pool/replica_selection.hpp>
+
+#include <boost/asio/compose.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/asio/experimental/parallel_group.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Runs all the pools in parallel, completing when all of them finish
+struct routing_pool_run_op
+{
+    using pool_run_op = decltype(std::declval<connection_pool&>().async_run(asio::deferred));
+
+    std::vector<pool_run_op> ops;
+
+    template <class Self>
+    void operator()(Self& self)
+    {
+        asio::experimental::make_parallel_group(std::move(ops))
+            .async_wait(asio::experimental::wait_for_all(), std::move(self));
+    }
+
+    template <class Self>
+    void operator()(Self& self, std::vector<std::size_t>, std::vector<error_code>)
+    {
+        // connection_pool::async_run always succeeds
+        self.complete(error_code());
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::routing_pool::routing_pool(const pool_executor_params& ex_params, routing_pool_params params)
+    : max_replication_lag_(params.max_replication_lag)
+{
+    if (max_replication_lag_.count() < 0)
+    {
+        BOOST_THROW_EXCEPTION(
+            std::invalid_argument("routing_pool_params::max_replication_lag must not be negative")
+        );
+    }
+
+    pools_.reserve(params.replicas.size() + 1u);
+    pools_.emplace_back(ex_params, std::move(params.primary));
+    for (auto& replica_params : params.replicas)
+    {
+        if (max_replication_lag_.count() > 0)
+            replica_params.measure_replication_lag = true;
+        pools_.emplace_back(ex_params, std::move(replica_params));
+    }
+}
+
+void boost::mysql::routing_pool::async_run_erased(asio::any_completion_handler<void(error_code)> handler)
+{
+    detail::routing_pool_run_op op;
+    op.ops.reserve(pools_.size());
+    for (auto& pool : pools_)
+        op.ops.push_back(pool.async_run(asio::deferred));
+    asio::async_compose<asio::any_completion_handler<void(error_code)>, void(error_code)>(
+        std::move(op),
+        handler,
+        pools_.front().get_executor()
+    );
+}
+
+boost::mysql::connection_pool& boost::mysql::routing_pool::select_pool(access_mode mode) noexcept
+{
+    if (mode == access_mode::read_write)
+        return pools_.front();
+
+    auto idx = detail::select_replica(num_replicas(), max_replication_lag_, [this](std::size_t i) {
+        return pools_[i + 1u].stats();
+    });
+    return idx == num_replicas() ? pools_.front() : pools_[idx + 1u];
+}
+
+void boost::mysql::routing_pool::cancel()
+{
+    for (auto& pool : pools_)
+        pool.cancel();
+}
+
+#endif
@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_ROW_DECODING_PLAN_IPP
+#define BOOST_MYSQL_IMPL_ROW_DECODING_PLAN_IPP
+
+#pragma once
+
+#include <boost/mysql/detail/row_decoding_plan.hpp>
+
+#include <boost/mysql/impl/internal/protocol/deserialize_binary_field.hpp>
+#include <boost/mysql/impl/internal/protocol/deserialize_text_field.hpp>
+
+void boost::mysql::detail::row_decoding_plan::compile(resultset_encoding enc, metadata_collection_view meta)
+{
+    clear();
+    encoding_ = enc;
+    if (enc == resultset_encoding::text)
+    {
+        text_decoders_.reserve(meta.size());
+        for (const auto& m : meta)
+            text_decoders_.push_back(get_text_field_decoder(m));
+    }
+    else
+    {
+        binary_decoders_.reserve(meta.size());
+        for (const auto& m : meta)
+            binary_decoders_.push_back(get_binary_field_decoder(m));
+    }
+}
+
+#endif
@@ -81,7 +81,7 @@ std::size_t copy_blob_as_offset(unsigned char* buffer_first, std::size_t offset,
 }
 
 BOOST_MYSQL_STATIC_OR_INLINE
-void copy_strings(std::vector<field_view>& fields, std::vector<unsigned char>& string_buffer)
+void copy_strings(container_vector<field_view>& fields, container_vector<unsigned char>& string_buffer)
 {
     // Calculate the required size for the new strings
     std::size_t size = 0;
@@ -160,12 +160,17 @@ BOOST_MYSQL_INSTANTIATE_ALGO(start_execution_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(read_resultset_head_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(read_some_rows_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(read_some_rows_dynamic_algo_params)
+BOOST_MYSQL_INSTANTIATE_ALGO(read_some_rows_visit_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(prepare_statement_algo_params)
+BOOST_MYSQL_INSTANTIATE_ALGO(prepare_statements_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(close_statement_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(ping_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(reset_connection_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(quit_connection_algo_params)
 BOOST_MYSQL_INSTANTIATE_ALGO(close_connection_algo_params)
+BOOST_MYSQL_INSTANTIATE_ALGO(run_pipeline_algo_params)
+BOOST_MYSQL_INSTANTIATE_ALGO(start_binlog_dump_algo_params)
+BOOST_MYSQL_INSTANTIATE_ALGO(read_binlog_event_algo_params)
 
 }  // namespace detail
 }  // namespace mysql
@@ -40,6 +40,9 @@ void boost::mysql::detail::static_execution_state_erased_impl::on_num_meta_impl(
 {
     on_new_resultset();
     meta_.reserve(num_columns);
+    if (meta_cache_.size() < resultset_index_)
+        meta_cache_.resize(resultset_index_);
+    current_meta_cache().on_resultset_start();
 }
 
 boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_meta_impl(
@@ -49,15 +52,25 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
 )
 
 {
-    std::size_t meta_index = meta_.size();
-
     // Store the object
     meta_.push_back(create_meta(coldef));
 
-    // Record its position
-    pos_map_add_field(current_pos_map(), current_name_table(), meta_index, coldef.name);
+    // Record its position. This is skipped if the column matches the cached one
+    auto& cache = current_meta_cache();
+    cache.on_column(current_pos_map(), current_name_table(), coldef);
+
+    if (!is_last)
+        return error_code();
+    decoding_plan_.compile(encoding(), meta_);
+
+    // Same metadata as last time: the cached pos_map is valid and meta_check would succeed
+    if (cache.on_resultset_finish(current_pos_map(), current_name_table()))
+        return error_code();
 
-    return is_last ? meta_check(diag) : error_code();
+    auto err = meta_check(diag);
+    if (!err)
+        cache.commit(current_pos_map());
+    return err;
 }
 
 boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_row_impl(
@@ -76,7 +89,7 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     span<field_view> storage = add_fields(fields, meta_.size());
 
     // deserialize the row
-    auto err = deserialize_row(encoding(), msg, meta_, storage);
+    auto err = deserialize_row(decoding_plan_, msg, meta_, storage);
     if (err)
         return err;
 
@@ -88,6 +101,44 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     return error_code();
 }
 
+boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_rows_impl(
+    span<const span<const std::uint8_t>> msgs,
+    const output_ref& ref,
+    std::vector<field_view>& fields,
+    parallel_row_decoder& decoder
+)
+{
+    // check output
+    if (ref.type_index() != ext_.type_index(resultset_index_ - 1))
+        return client_errc::row_type_mismatch;
+
+    // Allocate temporary space for all the rows
+    std::size_t num_fields = meta_.size();
+    fields.clear();
+    span<field_view> storage = add_fields(fields, num_fields * msgs.size());
+
+    // deserialize them
+    auto err = deserialize_rows(decoding_plan_, msgs, meta_, storage, decoder);
+    if (err)
+        return err;
+
+    // parse them into the output ref, in order
+    output_ref row_ref = ref;
+    for (std::size_t i = 0; i < msgs.size(); ++i)
+    {
+        row_ref.set_offset(ref.offset() + i);
+        err = ext_.parse_fn(resultset_index_ - 1)(
+            current_pos_map(),
+            storage.subspan(i * num_fields, num_fields),
+            row_ref
+        );
+        if (err)
+            return err;
+    }
+
+    return error_code();
+}
+
 boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_row_ok_packet_impl(
     const ok_view& pack
 )
@@ -42,6 +42,9 @@ void boost::mysql::detail::static_results_erased_impl::on_num_meta_impl(std::siz
     auto& resultset_data = add_resultset();
     meta_.reserve(meta_.size() + num_columns);
     resultset_data.meta_size = num_columns;
+    if (meta_cache_.size() < resultset_index_)
+        meta_cache_.resize(resultset_index_);
+    current_meta_cache().on_resultset_start();
 }
 
 boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_meta_impl(
@@ -51,15 +54,25 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_me
 )
 
 {
-    std::size_t meta_index = meta_.size() - current_resultset().meta_offset;
-
     // Store the new object
     meta_.push_back(create_meta(coldef));
 
-    // Fill the pos map entry for this field, if any
-    pos_map_add_field(current_pos_map(), current_name_table(), meta_index, coldef.name);
+    // Fill the pos map entry for this field, if any. This is skipped if the column matches the cached one
+    auto& cache = current_meta_cache();
+    cache.on_column(current_pos_map(), current_name_table(), coldef);
+
+    if (!is_last)
+        return error_code();
+    decoding_plan_.compile(encoding(), current_resultset_meta());
 
-    return is_last ? meta_check(diag) : error_code();
+    // Same metadata as last time: the cached pos_map is valid and meta_check would succeed
+    if (cache.on_resultset_finish(current_pos_map(), current_name_table()))
+        return error_code();
+
+    auto err = meta_check(diag);
+    if (!err)
+        cache.commit(current_pos_map());
+    return err;
 }
 
 boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_row_impl(
@@ -76,7 +89,7 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_ro
     span<field_view> storage = add_fields(fields, meta.size());
 
     // deserialize the row
-    auto err = deserialize_row(encoding(), msg, meta, storage);
+    auto err = deserialize_row(decoding_plan_, msg, meta, storage);
     if (err)
         return err;
 
@@ -84,6 +97,40 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_ro
     return ext_.parse_fn(resultset_index_ - 1)(current_pos_map(), storage, ext_.rows());
 }
 
+boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_rows_impl(
+    span<const span<const std::uint8_t>> msgs,
+    const output_ref&,
+    std::vector<field_view>& fields,
+    parallel_row_decoder& decoder
+)
+{
+    auto meta = current_resultset_meta();
+
+    // Allocate temporary storage for all the rows
+    fields.clear();
+    span<field_view> storage = add_fields(fields, meta.size() * msgs.size());
+
+    // deserialize them
+    auto err = deserialize_rows(decoding_plan_, msgs, meta, storage, decoder);
+    if (err)
+        return err;
+
+    // parse them against the appropriate tuple element. This appends to the
+    // output vector, so it must happen in order
+    for (std::size_t i = 0; i < msgs.size(); ++i)
+    {
+        err = ext_.parse_fn(resultset_index_ - 1)(
+            current_pos_map(),
+            storage.subspan(i * meta.size(), meta.size()),
+            ext_.rows()
+        );
+        if (err)
+            return err;
+    }
+
+    return error_code();
+}
+
 boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_row_ok_packet_impl(
     const ok_view& pack
 )
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_TLS_SESSION_CACHE_IPP
+#define BOOST_MYSQL_IMPL_TLS_SESSION_CACHE_IPP
+
+#pragma once
+
+#include <boost/mysql/tls_session_cache.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+// SSL_SESSION_up_ref is required to share sessions safely
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+#define BOOST_MYSQL_HAS_TLS_SESSION_RESUMPTION
+#endif
+
+boost::mysql::tls_session_cache::~tls_session_cache()
+{
+    for (auto& e : entries_)
+        SSL_SESSION_free(e.session);
+}
+
+std::size_t boost::mysql::tls_session_cache::find_entry(string_view host, unsigned short port) const noexcept
+{
+    auto it = std::find_if(entries_.begin(), entries_.end(), [host, port](const entry& e) {
+        return e.port == port && e.host == host;
+    });
+    return static_cast<std::size_t>(it - entries_.begin());
+}
+
+SSL_SESSION* boost::mysql::tls_session_cache::get(string_view host, unsigned short port) const
+{
+#ifdef BOOST_MYSQL_HAS_TLS_SESSION_RESUMPTION
+    std::lock_guard<std::mutex> guard(mtx_);
+    std::size_t idx = find_entry(host, port);
+    if (idx == entries_.size())
+        return nullptr;
+    SSL_SESSION* res = entries_[idx].session;
+    SSL_SESSION_up_ref(res);
+    return res;
+#else
+    boost::ignore_unused(host, port);
+    return nullptr;
+#endif
+}
+
+void boost::mysql::tls_session_cache::store(string_view host, unsigned short port, SSL_SESSION* session)
+{
+    BOOST_ASSERT(session != nullptr);
+#ifdef BOOST_MYSQL_HAS_TLS_SESSION_RESUMPTION
+    std::lock_guard<std::mutex> guard(mtx_);
+    std::size_t idx = find_entry(host, port);
+    if (idx == entries_.size())
+    {
+        entries_.push_back(entry{std::string(host), port, nullptr});
+    }
+    else
+    {
+        SSL_SESSION_free(entries_[idx].session);
+        entries_[idx].session = nullptr;
+    }
+    SSL_SESSION_up_ref(session);
+    entries_[idx].session = session;
+#else
+    boost::ignore_unused(host, port, session);
+#endif
+}
+
+void boost::mysql::tls_session_cache::invalidate(string_view host, unsigned short port)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    std::size_t idx = find_entry(host, port);
+    if (idx != entries_.size())
+    {
+        SSL_SESSION_free(entries_[idx].session);
+        entries_.erase(entries_.begin() + idx);
+    }
+}
+
+void boost::mysql::tls_session_cache::clear()
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    for (auto& e : entries_)
+        SSL_SESSION_free(e.session);
+    entries_.clear();
+}
+
+std::size_t boost::mysql::tls_session_cache::size() const
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    return entries_.size();
+}
+
+#endif
@@ -0,0 +1,264 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_WIRE_CAPTURE_IPP
+#define BOOST_MYSQL_IMPL_WIRE_CAPTURE_IPP
+
+#pragma once
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+// File format, all integers little-endian:
+//   header: 8 byte magic, int<4> version
+//   events: int<1> wire_event, int<8> nanoseconds since open, int<4> payload size, payload
+namespace boost {
+namespace mysql {
+namespace detail {
+
+constexpr unsigned char wire_capture_magic[8] = {'B', 'M', 'Y', 'S', 'Q', 'L', 'W', 'C'};
+constexpr std::uint32_t wire_capture_version = 1u;
+constexpr std::size_t wire_capture_header_size = 12u;
+constexpr std::size_t wire_capture_event_header_size = 13u;
+
+inline void wire_capture_store_le(unsigned char* to, std::uint64_t value, std::size_t size) noexcept
+{
+    for (std::size_t i = 0; i < size; ++i)
+        to[i] = static_cast<unsigned char>(value >> (8u * i));
+}
+
+inline std::uint64_t wire_capture_load_le(const unsigned char* from, std::size_t size) noexcept
+{
+    std::uint64_t res = 0u;
+    for (std::size_t i = 0; i < size; ++i)
+        res |= static_cast<std::uint64_t>(from[i]) << (8u * i);
+    return res;
+}
+
+// Short writes don't always set errno, so callers clear it before each call that may fail
+inline error_code errno_to_error_code() noexcept
+{
+    int err = errno;
+    if (err == 0)
+        err = static_cast<int>(boost::system::errc::io_error);
+    return error_code(err, boost::system::generic_category());
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::wire_capture::~wire_capture()
+{
+    if (file_)
+        std::fclose(file_);
+}
+
+boost::mysql::error_code boost::mysql::wire_capture::open(const char* path)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    if (file_)
+    {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    error_.clear();
+
+    errno = 0;
+    std::FILE* f = std::fopen(path, "wb");
+    if (!f)
+        return detail::errno_to_error_code();
+
+    unsigned char header[detail::wire_capture_header_size];
+    std::memcpy(header, detail::wire_capture_magic, sizeof(detail::wire_capture_magic));
+    detail::wire_capture_store_le(header + 8, detail::wire_capture_version, 4);
+    errno = 0;
+    if (std::fwrite(header, 1, sizeof(header), f) != sizeof(header))
+    {
+        error_code ec = detail::errno_to_error_code();
+        std::fclose(f);
+        return ec;
+    }
+
+    file_ = f;
+    start_ = std::chrono::steady_clock::now();
+    return error_code();
+}
+
+void boost::mysql::wire_capture::close()
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    if (file_)
+    {
+        errno = 0;
+        if (std::fclose(file_) != 0 && !error_)
+            error_ = detail::errno_to_error_code();
+        file_ = nullptr;
+    }
+}
+
+bool boost::mysql::wire_capture::is_open() const
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    return file_ != nullptr;
+}
+
+boost::mysql::error_code boost::mysql::wire_capture::error() const
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    return error_;
+}
+
+void boost::mysql::wire_capture::record(wire_event type, asio::const_buffer payload)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> guard(mtx_);
+    if (!file_ || error_)
+        return;
+
+    // start_ is written by open(), so it must be read under the lock
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now - start_);
+    unsigned char header[detail::wire_capture_event_header_size];
+    header[0] = static_cast<unsigned char>(type);
+    detail::wire_capture_store_le(header + 1, static_cast<std::uint64_t>(ns.count()), 8);
+    detail::wire_capture_store_le(header + 9, static_cast<std::uint32_t>(payload.size()), 4);
+
+    // A partially written event makes the rest of the file unusable, so stop at the first error
+    errno = 0;
+    if (std::fwrite(header, 1, sizeof(header), file_) != sizeof(header) ||
+        (payload.size() && std::fwrite(payload.data(), 1, payload.size(), file_) != payload.size()))
+    {
+        error_ = detail::errno_to_error_code();
+    }
+}
+
+void boost::mysql::wire_replay::clear() noexcept
+{
+    read_data_.clear();
+    read_ends_.clear();
+    write_data_.clear();
+    num_events_ = 0u;
+    duration_ = std::chrono::nanoseconds();
+    rewind();
+}
+
+boost::mysql::error_code boost::mysql::wire_replay::load(const char* path)
+{
+    clear();
+
+    errno = 0;
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f)
+        return detail::errno_to_error_code();
+
+    std::vector<unsigned char> contents;
+    unsigned char chunk[4096];
+    std::size_t size_read = 0u;
+    while ((size_read = std::fread(chunk, 1, sizeof(chunk), f)) > 0u)
+        contents.insert(contents.end(), chunk, chunk + size_read);
+    bool failed = std::ferror(f) != 0;
+    std::fclose(f);
+    if (failed)
+        return detail::errno_to_error_code();
+
+    return load(asio::buffer(contents));
+}
+
+boost::mysql::error_code boost::mysql::wire_replay::load(asio::const_buffer contents)
+{
+    clear();
+
+    const auto* first = static_cast<const unsigned char*>(contents.data());
+    const auto* last = first + contents.size();
+
+    // Header
+    if (contents.size() < detail::wire_capture_header_size ||
+        std::memcmp(first, detail::wire_capture_magic, sizeof(detail::wire_capture_magic)) != 0 ||
+        detail::wire_capture_load_le(first + 8, 4) != detail::wire_capture_version)
+    {
+        return client_errc::protocol_value_error;
+    }
+    first += detail::wire_capture_header_size;
+
+    // Events
+    error_code ec;
+    while (first != last)
+    {
+        if (static_cast<std::size_t>(last - first) < detail::wire_capture_event_header_size)
+        {
+            ec = client_errc::incomplete_message;
+            break;
+        }
+        auto type = static_cast<wire_event>(first[0]);
+        auto ns = detail::wire_capture_load_le(first + 1, 8);
+        auto size = static_cast<std::size_t>(detail::wire_capture_load_le(first + 9, 4));
+        first += detail::wire_capture_event_header_size;
+        if (static_cast<std::size_t>(last - first) < size)
+        {
+            ec = client_errc::incomplete_message;
+            break;
+        }
+
+        switch (type)
+        {
+        case wire_event::read:
+            read_data_.insert(read_data_.end(), first, first + size);
+            if (size)
+                read_ends_.push_back(read_data_.size());
+            break;
+        case wire_event::write: write_data_.insert(write_data_.end(), first, first + size); break;
+        case wire_event::connect:
+        case wire_event::tls_handshake:
+        case wire_event::tls_shutdown:
+        case wire_event::close: break;
+        default: ec = client_errc::protocol_value_error; break;
+        }
+        if (ec)
+            break;
+
+        first += size;
+        ++num_events_;
+        duration_ = std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(ns));
+    }
+
+    if (ec)
+        clear();
+    return ec;
+}
+
+std::size_t boost::mysql::wire_replay::read(asio::mutable_buffer buff) noexcept
+{
+    if (finished())
+        return 0u;
+    std::size_t size = (std::min)(buff.size(), read_ends_[read_chunk_] - read_offset_);
+    if (size)
+        std::memcpy(buff.data(), read_data_.data() + read_offset_, size);
+    read_offset_ += size;
+    if (read_offset_ == read_ends_[read_chunk_])
+        ++read_chunk_;
+    return size;
+}
+
+void boost::mysql::wire_replay::write(asio::const_buffer buff) noexcept
+{
+    std::size_t remaining = write_data_.size() - write_offset_;
+    std::size_t size = (std::min)(buff.size(), remaining);
+    if (size != buff.size() ||
+        (size && std::memcmp(buff.data(), write_data_.data() + write_offset_, size) != 0))
+    {
+        writes_match_ = false;
+    }
+    write_offset_ += size;
+}
+
+#endif
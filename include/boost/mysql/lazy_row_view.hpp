@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_LAZY_ROW_VIEW_HPP
+#define BOOST_MYSQL_LAZY_ROW_VIEW_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/lazy_row_impl.hpp>
+#include <boost/mysql/detail/throw_on_error_loc.hpp>
+
+#include <boost/throw_exception.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) A read-only reference to a row whose fields are decoded on demand.
+ * \details
+ * Contrary to \ref row_view, which points to fields that have already been decoded, a
+ * `lazy_row_view` points to the row's raw protocol bytes. Fields are decoded the first time
+ * they are accessed, and cached afterwards. Fields that are never accessed are never decoded.
+ * This is useful when only a few columns of a wide resultset are used.
+ * \n
+ * Objects of this type are passed by the library to the function objects supplied to
+ * `any_connection::visit_some_rows_lazy`. They point into the connection's internal buffers,
+ * and are only valid until the function object returns. The same applies to
+ * the \ref field_view objects obtained from them.
+ * \n
+ * The framing of the row message is validated before the view is created, but field
+ * values are only validated when decoded. An invalid value (e.g. an out-of-range `DATETIME`
+ * sent by the server) is reported by \ref at.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class lazy_row_view
+{
+public:
+    /**
+     * \brief Constructs an empty (but valid) view.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    lazy_row_view() = default;
+
+    /**
+     * \brief Returns the number of fields in the row.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept { return impl_ ? impl_->size() : 0u; }
+
+    /**
+     * \brief Returns true if there are no fields in the row (i.e. `this->size() == 0`).
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept { return size() == 0u; }
+
+    /**
+     * \brief Returns whether the i-th field is `NULL`, without decoding it.
+     * \par Preconditions
+     * `i < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_null(std::size_t i) const noexcept { return impl_->is_null(i); }
+
+    /**
+     * \brief Decodes the i-th field, if it hasn't been decoded yet, and returns it.
+     * \details
+     * If the field contains an invalid value, sets `err` and returns an empty \ref field_view.
+     *
+     * \par Preconditions
+     * `i < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    field_view at(std::size_t i, error_code& err) const noexcept { return impl_->get(i, err); }
+
+    /**
+     * \brief Decodes the i-th field, if it hasn't been decoded yet, and returns it.
+     * \par Exception safety
+     * Strong guarantee.
+     * \throws std::out_of_range `i >= this->size()`
+     * \throws error_with_diagnostics If the field contains an invalid value.
+     */
+    field_view at(std::size_t i) const
+    {
+        if (i >= size())
+            BOOST_THROW_EXCEPTION(std::out_of_range("lazy_row_view::at"));
+        error_code err;
+        field_view res = at(i, err);
+        detail::throw_on_error_loc(err, diagnostics(), BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+private:
+    detail::lazy_row_impl* impl_{};
+
+    lazy_row_view(detail::lazy_row_impl& impl) noexcept : impl_(&impl) {}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
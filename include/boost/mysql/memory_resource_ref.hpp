@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_MEMORY_RESOURCE_REF_HPP
+#define BOOST_MYSQL_MEMORY_RESOURCE_REF_HPP
+
+#include <boost/mysql/detail/void_t.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+
+template <class T, class = void>
+struct is_memory_resource : std::false_type
+{
+};
+
+template <class T>
+struct is_memory_resource<
+    T,
+    void_t<
+        decltype(static_cast<void*>(std::declval<T&>().allocate(std::size_t(), std::size_t()))),
+        decltype(std::declval<T&>().deallocate(static_cast<void*>(nullptr), std::size_t(), std::size_t()))>>
+    : std::true_type
+{
+};
+
+}  // namespace detail
+
+/**
+ * \brief A non-owning, type-erased reference to a memory resource.
+ * \details
+ * Owning result containers (\ref results, \ref static_results, \ref rows and \ref row)
+ * may be constructed with a `memory_resource_ref`, so their memory is allocated
+ * from a user-supplied resource (like a per-request arena) rather than the global heap.
+ * \n
+ * Any type with `allocate(std::size_t bytes, std::size_t alignment)` and
+ * `deallocate(void* p, std::size_t bytes, std::size_t alignment)` member functions
+ * can be referenced, including `std::pmr::memory_resource`
+ * and `boost::container::pmr::memory_resource`.
+ * A default-constructed `memory_resource_ref` uses `::operator new` and `::operator delete`,
+ * and doesn't support alignments greater than `alignof(std::max_align_t)`.
+ * \n
+ * Objects hold two pointers. The layout of the containers doesn't depend on whether a resource
+ * is used or on the C++ standard in use, so translation units built with different `-std` flags
+ * can be mixed.
+ */
+class memory_resource_ref
+{
+    // The functions used to allocate from a resource type. One per type, so references
+    // only store two pointers
+    struct vtable
+    {
+        void* (*allocate)(void*, std::size_t, std::size_t);
+        void (*deallocate)(void*, void*, std::size_t, std::size_t);
+    };
+
+    template <class MemoryResource>
+    struct vtable_for
+    {
+        static void* allocate(void* res, std::size_t bytes, std::size_t alignment)
+        {
+            return static_cast<MemoryResource*>(res)->allocate(bytes, alignment);
+        }
+
+        static void deallocate(void* res, void* p, std::size_t bytes, std::size_t alignment)
+        {
+            static_cast<MemoryResource*>(res)->deallocate(p, bytes, alignment);
+        }
+
+        static constexpr vtable value{&allocate, &deallocate};
+    };
+
+    void* res_{};
+    const vtable* vtable_{};
+
+public:
+    /**
+     * \brief Constructs a reference to the global heap.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    constexpr memory_resource_ref() noexcept = default;
+
+    /**
+     * \brief Constructs a reference to `*res`.
+     * \details
+     * `*res` must outlive any object using `*this`. If `res` is `nullptr`,
+     * the constructed object references the global heap.
+     * \n
+     * This constructor participates in overload resolution only if `MemoryResource`
+     * has the `allocate` and `deallocate` member functions described in the class docs.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    template <
+        class MemoryResource,
+        class EnableIf =
+            typename std::enable_if<detail::is_memory_resource<MemoryResource>::value>::type>
+    memory_resource_ref(MemoryResource* res) noexcept
+        : res_(res), vtable_(res ? &vtable_for<MemoryResource>::value : nullptr)
+    {
+    }
+
+    /**
+     * \brief Allocates `bytes` bytes with the given alignment from the referenced resource.
+     * \par Exception safety
+     * Strong guarantee. Throws whatever the resource throws on allocation failure.
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment) const
+    {
+        if (vtable_)
+            return vtable_->allocate(res_, bytes, alignment);
+        BOOST_ASSERT(alignment <= alignof(std::max_align_t));
+        return ::operator new(bytes);
+    }
+
+    /**
+     * \brief Returns memory obtained by \ref allocate to the referenced resource.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment) const noexcept
+    {
+        if (vtable_)
+            vtable_->deallocate(res_, p, bytes, alignment);
+        else
+            ::operator delete(p);
+    }
+
+    /**
+     * \brief Returns a pointer to the referenced resource, or `nullptr` for the global heap.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void* get() const noexcept { return res_; }
+
+    /**
+     * \brief Returns whether two objects reference the same resource.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    friend bool operator==(const memory_resource_ref& lhs, const memory_resource_ref& rhs) noexcept
+    {
+        return lhs.res_ == rhs.res_;
+    }
+
+    /**
+     * \brief Returns whether two objects reference different resources.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    friend bool operator!=(const memory_resource_ref& lhs, const memory_resource_ref& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+#ifndef BOOST_MYSQL_DOXYGEN
+template <class MemoryResource>
+constexpr memory_resource_ref::vtable memory_resource_ref::vtable_for<MemoryResource>::value;
+#endif
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,318 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_MULTIPLEXED_CONNECTION_HPP
+#define BOOST_MYSQL_MULTIPLEXED_CONNECTION_HPP
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/connection_impl.hpp>
+#include <boost/mysql/detail/execution_concepts.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+class multiplexed_connection_impl;
+}
+
+/**
+ * \brief (EXPERIMENTAL) A connection that can be shared by many concurrent operations.
+ * \details
+ * Wraps an \ref any_connection, accepting execution requests from any number of
+ * concurrent async operations. Requests are queued and written to the server
+ * back-to-back (pipelined), without waiting for the previous responses to arrive.
+ * Responses are read in order and delivered to the operation that issued each request.
+ * This allows a small number of connections to serve many concurrent requests,
+ * reducing the number of sessions the server needs to hold.
+ * \n
+ * The connection must be established using \ref connection before calling \ref async_run,
+ * which is the task in charge of sending requests and reading responses.
+ * \ref async_execute operations wait until their request is run.
+ * \n
+ * Requests are independent: if a request fails with a server error
+ * (e.g. a syntax error), other requests are not affected. Any other error
+ * (e.g. a network error) makes the operations for the requests that had already
+ * been sent fail, and makes \ref async_run complete with the error.
+ * Requests waiting to be sent fail with the same error. The connection can then be
+ * re-established using \ref connection and \ref async_run can be called again.
+ * \n
+ * Since requests from different operations share the same session,
+ * operations that modify session state (like transactions, variables or temporary tables)
+ * must not be run using this class. Pipelining works best for short, independent
+ * requests, like point lookups.
+ * \n
+ * This is a move-only type.
+ *
+ * \par Thread-safety
+ * Distinct objects: safe. \n
+ * Shared objects: unsafe. \n
+ * All operations run within the connection's executor. Use a strand
+ * if the underlying execution context is run by several threads.
+ *
+ * \par Object lifetimes
+ * The connection and the queue of requests are kept alive using shared ownership semantics
+ * while operations are outstanding. It's safe to destroy `*this` while operations are outstanding.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class multiplexed_connection
+{
+    std::shared_ptr<detail::multiplexed_connection_impl> impl_;
+
+    struct initiate_run
+    {
+        template <class Handler>
+        void operator()(Handler&& h, std::shared_ptr<detail::multiplexed_connection_impl> self)
+        {
+            async_run_erased(std::move(self), std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_run_erased(
+        std::shared_ptr<detail::multiplexed_connection_impl> self,
+        asio::any_completion_handler<void(error_code)> handler
+    );
+
+    struct initiate_execute
+    {
+        template <class Handler, class ExecutionRequest>
+        void operator()(
+            Handler&& h,
+            std::shared_ptr<detail::multiplexed_connection_impl> self,
+            const ExecutionRequest& req,
+            detail::execution_processor* proc,
+            diagnostics* diag
+        )
+        {
+            std::vector<field_view> params;
+            auto getter = detail::make_request_getter(req, params);
+            async_execute_erased(std::move(self), getter.get(), *proc, *diag, std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_execute_erased(
+        std::shared_ptr<detail::multiplexed_connection_impl> self,
+        detail::any_execution_request req,
+        detail::execution_processor& proc,
+        diagnostics& diag,
+        asio::any_completion_handler<void(error_code)> handler
+    );
+
+public:
+    /**
+     * \brief Constructs a multiplexed connection from an existing connection.
+     * \details
+     * Takes ownership of `conn`. The resulting object uses `conn`'s executor.
+     * `conn` doesn't need to be connected yet.
+     * \n
+     * At most `max_pipeline_size` requests are written to the server before
+     * reading their responses. A value of zero is treated as one.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    explicit multiplexed_connection(any_connection&& conn, std::size_t max_pipeline_size = 64);
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    multiplexed_connection(const multiplexed_connection&) = delete;
+    multiplexed_connection& operator=(const multiplexed_connection&) = delete;
+#endif
+
+    /// Move constructor.
+    multiplexed_connection(multiplexed_connection&& other) = default;
+
+    /// Move assignment.
+    multiplexed_connection& operator=(multiplexed_connection&& other) = default;
+
+    /// Destructor.
+    ~multiplexed_connection() = default;
+
+    /**
+     * \brief Returns whether the object is in a moved-from state.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool valid() const noexcept { return impl_.get() != nullptr; }
+
+    /// The executor type associated to this object.
+    using executor_type = asio::any_io_executor;
+
+    /**
+     * \brief Retrieves the executor associated to this object.
+     * \details Returns the underlying connection's executor.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    executor_type get_executor() noexcept;
+
+    /**
+     * \brief Returns the underlying connection.
+     * \details
+     * Use it to establish the session before calling \ref async_run,
+     * or to re-establish it after `async_run` completes with an error.
+     * The returned connection must not be used while `async_run` is outstanding.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    any_connection& connection() noexcept;
+
+    /**
+     * \brief Runs the task in charge of sending requests and reading responses.
+     * \details
+     * Pending requests are written to the server in batches of up to `max_pipeline_size`
+     * requests. Once all the responses in a batch have been read, the next batch is sent.
+     * \n
+     * The operation runs until \ref cancel is called, in which case it completes successfully,
+     * or until an error other than a server error happens, in which case it completes
+     * with that error. In the latter case, the underlying connection can be re-established
+     * and this function called again.
+     *
+     * \par Preconditions
+     * `this->valid() == true` \n
+     * The underlying connection is established. No other `async_run` operation is outstanding.
+     *
+     * \par Object lifetimes
+     * While the operation is outstanding, the connection's internal data will be kept alive.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Executor
+     * No internal data will be accessed or modified as part of the initiating function.
+     */
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code)) CompletionToken>
+    auto async_run(CompletionToken&& token) BOOST_MYSQL_RETURN_TYPE(
+        decltype(asio::async_initiate<CompletionToken, void(error_code)>(initiate_run{}, token, impl_))
+    )
+    {
+        BOOST_ASSERT(valid());
+        return asio::async_initiate<CompletionToken, void(error_code)>(initiate_run{}, token, impl_);
+    }
+
+    /**
+     * \brief Executes a text query or prepared statement.
+     * \details
+     * Queues the request and waits for \ref async_run to send it and read its response,
+     * which is stored in `result`. The semantics of `req` and `result` are the same
+     * as in \ref any_connection::async_execute.
+     * \n
+     * Requests issued while `async_run` is not outstanding wait until it is called.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Object lifetimes
+     * `result` and `diag` must be kept alive until the operation completes.
+     * The query string and any string or blob parameter referenced by `req` must also be kept alive,
+     * since the request may be serialized after the initiating function returns.
+     * This is the case when using C++20 coroutines and passing these values
+     * directly in the `co_await` expression.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Errors
+     * \li Any error reported by \ref any_connection::async_execute.
+     * \li \ref client_errc::cancelled if \ref cancel was called before the request was sent,
+     *     or if the operation was cancelled.
+     *
+     * \par Per-operation cancellation
+     * This operation supports terminal cancellation, which results in \ref client_errc::cancelled.
+     * If the request hasn't been sent yet, it's removed from the queue and the operation
+     * completes immediately. Otherwise, the server's response is still read into `result`,
+     * so the operation completes once the response has been read. In both cases,
+     * `result` is left in an unspecified state.
+     */
+    template <
+        BOOST_MYSQL_EXECUTION_REQUEST ExecutionRequest,
+        BOOST_MYSQL_RESULTS_TYPE ResultsType,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code)) CompletionToken>
+    auto async_execute(
+        ExecutionRequest&& req,
+        ResultsType& result,
+        diagnostics& diag,
+        CompletionToken&& token
+    )
+        BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_execute{},
+            token,
+            impl_,
+            std::forward<ExecutionRequest>(req),
+            &detail::access::get_impl(result).get_interface(),
+            &diag
+        )))
+    {
+        BOOST_ASSERT(valid());
+        return asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_execute{},
+            token,
+            impl_,
+            std::forward<ExecutionRequest>(req),
+            &detail::access::get_impl(result).get_interface(),
+            &diag
+        );
+    }
+
+    /**
+     * \brief Stops the run task and cancels requests waiting to be sent.
+     * \details
+     * Requests that have not been sent yet complete with \ref client_errc::cancelled.
+     * Requests already sent complete normally, after which \ref async_run completes
+     * successfully. Successive calls to \ref async_execute complete with
+     * \ref client_errc::cancelled.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Exception safety
+     * Basic guarantee.
+     */
+    BOOST_MYSQL_DECL
+    void cancel();
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/multiplexed_connection.ipp>
+#endif
+
+#endif
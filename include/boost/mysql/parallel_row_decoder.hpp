@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_PARALLEL_ROW_DECODER_HPP
+#define BOOST_MYSQL_PARALLEL_ROW_DECODER_HPP
+
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) Decodes batches of rows in parallel, using an executor.
+ * \details
+ * By default, connections decode the rows they read in the thread running the read operation.
+ * When reading many rows with many columns, decoding may become the bottleneck.
+ * \n
+ * If a connection is configured with a decoder (see \ref any_connection_params::row_decoder),
+ * row reading operations first frame all the complete row messages available in the read buffer,
+ * and allocate storage for all of them. The batch is then split into chunks of consecutive rows,
+ * which are decoded by tasks posted to the decoder's executor (usually an `asio::thread_pool`)
+ * and by the thread running the operation. Messages are independent, so the resulting rows are
+ * the same as when decoding sequentially.
+ * \n
+ * Batches that can't be split in at least two chunks of \ref min_rows_per_task rows
+ * (see \ref splits) are decoded inline, without posting any task. Otherwise:
+ * \n
+ *   - Async operations don't decode in the thread performing I/O. The batch is handed to
+ *     the decoder's executor, and the operation resumes in the connection's executor once all
+ *     chunks have been decoded. The decoder thread that received the batch decodes chunks
+ *     while others are pending, and then blocks until the chunks being decoded by other
+ *     threads finish. Meanwhile, the thread that was running the operation is free to run
+ *     other handlers. Cancellation requests are processed once decoding finishes.
+ *   - Sync operations decode chunks in the calling thread while others are pending, and then
+ *     block it until all chunks have been decoded.
+ * \n
+ * Since the thread that waits for the chunks also decodes them, decoding always makes progress,
+ * even if the executor's threads are busy or the executor is the one running the operation.
+ * In the latter case, that thread is blocked while decoding, as if no decoder was used.
+ * \n
+ * Rows handed to visitors (as in \ref any_connection::async_visit_some_rows) are
+ * always decoded sequentially, since visitors are invoked in order.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: safe. Several connections may share a single decoder.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class parallel_row_decoder
+{
+public:
+    /// The executor type used to run decoding tasks.
+    using executor_type = asio::any_io_executor;
+
+    /**
+     * \brief Constructs a decoder that posts tasks to an executor.
+     * \details
+     * Batches are split in at most `max_tasks` chunks. If `max_tasks` is zero,
+     * `std::thread::hardware_concurrency()` is used. Chunks have at least
+     * `min_rows_per_task` rows, so small batches don't pay the synchronization costs.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    explicit parallel_row_decoder(
+        executor_type ex,
+        std::size_t max_tasks = 0,
+        std::size_t min_rows_per_task = 128
+    ) noexcept;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    parallel_row_decoder(const parallel_row_decoder&) = delete;
+    parallel_row_decoder(parallel_row_decoder&&) = delete;
+    parallel_row_decoder& operator=(const parallel_row_decoder&) = delete;
+    parallel_row_decoder& operator=(parallel_row_decoder&&) = delete;
+#endif
+
+    /// Returns the executor where decoding tasks are posted.
+    executor_type get_executor() const noexcept { return ex_; }
+
+    /// Returns the maximum number of chunks that a batch is split into.
+    std::size_t max_tasks() const noexcept { return max_tasks_; }
+
+    /// Returns the minimum number of rows in a chunk.
+    std::size_t min_rows_per_task() const noexcept { return min_rows_per_task_; }
+
+    /**
+     * \brief Returns whether \ref run splits a range of `num_items` items in several chunks.
+     * \details
+     * If `false`, \ref run processes the range in the calling thread, without posting any task.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool splits(std::size_t num_items) const noexcept
+    {
+        return (std::min)(max_tasks_, num_items / min_rows_per_task_) > 1u;
+    }
+
+    /**
+     * \brief Processes the range `[0, num_items)` in chunks, in parallel.
+     * \details
+     * Calls `fn(first, last)` for chunks of consecutive items covering the range,
+     * from the calling thread and from tasks posted to the executor, and waits for all
+     * of them to finish. `fn` must return an \ref error_code and must not throw.
+     * If any call returns an error, chunks that haven't started yet are skipped,
+     * and one of the errors is returned.
+     * \n
+     * Used by connections to decode rows. Can also be called directly.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations and posting tasks may throw. In this case,
+     * this function waits for any task already running before propagating the exception.
+     */
+    template <class Fn>
+    error_code run(std::size_t num_items, Fn&& fn)
+    {
+        using fn_type = typename std::remove_reference<Fn>::type;
+        return run_impl(
+            num_items,
+            [](void* ctx, std::size_t first, std::size_t last) -> error_code {
+                return (*static_cast<fn_type*>(ctx))(first, last);
+            },
+            const_cast<void*>(static_cast<const void*>(&fn))
+        );
+    }
+
+private:
+    using chunk_fn = error_code (*)(void*, std::size_t, std::size_t);
+
+    executor_type ex_;
+    std::size_t max_tasks_;
+    std::size_t min_rows_per_task_;
+
+    BOOST_MYSQL_DECL
+    error_code run_impl(std::size_t num_items, chunk_fn fn, void* ctx);
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/parallel_row_decoder.ipp>
+#endif
+
+#endif
@@ -9,6 +9,7 @@
 #define BOOST_MYSQL_POOL_PARAMS_HPP
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/connection_observer.hpp>
 #include <boost/mysql/defaults.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 
@@ -22,6 +23,7 @@
 #include <chrono>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -230,9 +232,106 @@ struct pool_params
      * attempts.
      * \n
      * This value must be greater than zero.
+     * \n
+     * See \ref max_retry_interval and \ref retry_jitter to make
+     * this interval increase with consecutive failures.
      */
     std::chrono::steady_clock::duration retry_interval{std::chrono::seconds(30)};
 
+    /**
+     * \brief Upper bound for the interval between connect attempts, when using exponential backoff.
+     * \details
+     * If this value is greater than \ref retry_interval, the interval between connect attempts
+     * is doubled after each consecutive failure performed by a connection,
+     * starting at `retry_interval` and up to this value.
+     * The interval is reset to `retry_interval` after a successful connection.
+     * \n
+     * This value must not be negative. The default (zero) disables backoff,
+     * so `retry_interval` is always used.
+     */
+    std::chrono::steady_clock::duration max_retry_interval{};
+
+    /**
+     * \brief Whether to randomize the interval between connect attempts.
+     * \details
+     * If `true`, connections sleep a random time between half the computed retry interval and the
+     * full interval after a failed connect attempt. This prevents connections (and applications)
+     * that lost connectivity at the same time from retrying in lockstep, which could overload
+     * a recovering server.
+     * \n
+     * Disabled by default.
+     */
+    bool retry_jitter{false};
+
+    /**
+     * \brief Maximum number of connect attempts in progress at the same time.
+     * \details
+     * Connections wanting to connect when this limit is hit wait until
+     * another attempt finishes. Waiting for this limit doesn't count
+     * towards \ref connect_timeout.
+     * \n
+     * The default (zero) means no limit.
+     */
+    std::size_t max_concurrent_connects{0};
+
+    /**
+     * \brief Minimum time between the start of two consecutive connect attempts.
+     * \details
+     * Limits the rate at which the pool creates sessions (including reconnections).
+     * Connections wanting to connect before this interval has elapsed since the last attempt
+     * wait until they're allowed to.
+     * \n
+     * This value must not be negative. The default (zero) means no limit.
+     */
+    std::chrono::steady_clock::duration min_connect_interval{};
+
+    /**
+     * \brief Number of consecutive failed connect attempts that make the pool fail fast.
+     * \details
+     * After this many consecutive connect attempts fail (across all connections), the pool
+     * considers the server unavailable. While in this state, \ref connection_pool::async_get_connection
+     * calls that can't be served by an idle connection fail immediately, reporting the error
+     * and diagnostics of the last failed attempt, instead of waiting until their timeout elapses.
+     * Requests already waiting fail, too.
+     * \n
+     * While the server is considered unavailable, the pool performs at most one connect
+     * attempt at a time, at the usual retry intervals. Once an attempt succeeds,
+     * the pool resumes normal operation.
+     * \n
+     * The default (zero) disables this behavior.
+     */
+    std::size_t circuit_breaker_threshold{0};
+
+    /**
+     * \brief Whether to measure the server's replication lag when health-checking connections.
+     * \details
+     * If `true`, idle connections follow their health-check pings with a `SHOW REPLICA STATUS`
+     * query (or `SHOW SLAVE STATUS`, for servers that don't support the former).
+     * The measured replication lag is made available by \ref connection_pool::stats.
+     * This is used by \ref routing_pool to exclude lagging replicas.
+     * \n
+     * The lag is sampled by a single connection every \ref ping_interval, even if the pool
+     * is busy and no connection stays idle for that long. A zero `ping_interval` disables sampling.
+     * \n
+     * Only a failed ping makes a connection unhealthy. If the server rejects the lag query
+     * (for instance, because the user lacks the `REPLICATION CLIENT` privilege),
+     * the lag is reported as unknown. Disabled by default.
+     */
+    bool measure_replication_lag{false};
+
+    /**
+     * \brief Maximum number of \ref connection_pool::async_get_connection requests waiting for a connection.
+     * \details
+     * When no connection is available, requests wait in a queue ordered by \ref request_priority
+     * and deadline. If the queue is full, the new request is rejected immediately with
+     * \ref client_errc::pool_queue_full. If the new request should be served before the
+     * last request in the queue, the latter is rejected instead. This way, low priority
+     * requests can't prevent higher priority ones from entering the queue.
+     * \n
+     * The default (zero) means no limit.
+     */
+    std::size_t max_pending_requests{0};
+
     /**
      * \brief The health-check interval.
      * \details
@@ -259,6 +358,90 @@ struct pool_params
      * This value must not be negative.
      */
     std::chrono::steady_clock::duration ping_timeout{std::chrono::seconds(10)};
+
+    /**
+     * \brief The time that hostname resolution results are cached for.
+     * \details
+     * If set to a value greater than zero, the pool will create a \ref resolver_cache
+     * and share it between all the connections it creates. This prevents each connection from issuing its
+     * own DNS query when (re)connecting. If connecting to all the endpoints resolved for a hostname fails,
+     * the cached entry is discarded.
+     * \n
+     * Set this value to zero (the default) to disable caching.
+     * \n
+     * This value must not be negative.
+     */
+    std::chrono::steady_clock::duration dns_cache_ttl{};
+
+    /**
+     * \brief The maximum time to spend trying to connect to each host.
+     * \details
+     * Only relevant when `server_address` contains several hosts.
+     * See \ref any_connection_params::connect_attempt_timeout for more info.
+     * \n
+     * Set this timeout to zero (the default) to disable it.
+     * \n
+     * This value must not be negative.
+     */
+    std::chrono::steady_clock::duration connect_attempt_timeout{};
+
+    /**
+     * \brief Whether to reuse TLS sessions when reconnecting.
+     * \details
+     * If `true`, the pool will create a \ref tls_session_cache and share it between
+     * all the connections it creates, so reconnections can use abbreviated TLS handshakes.
+     * This reduces CPU usage in both the client and the server when many connections
+     * are re-established at once (e.g. after a server restart).
+     * \n
+     * Only relevant for connections using TLS. Disabled by default.
+     */
+    bool reuse_tls_sessions{false};
+
+    /**
+     * \brief Whether to skip session resets when the session wasn't modified.
+     * \details
+     * By default, connections returned to the pool are reset (using
+     * \ref any_connection::async_reset_connection) before being handed to other users,
+     * which involves a round-trip to the server.
+     * If this option is `true`, the pool will skip the reset if \ref any_connection::session_state_changed
+     * reports that the session was not modified.
+     * \n
+     * This requires a server supporting session state tracking. Changes to user variables
+     * and temporary tables are only reported if the `session_track_state_change` system variable is `ON`.
+     * Don't enable this option if your server doesn't report these changes and your code relies on them.
+     * \n
+     * Disabled by default.
+     */
+    bool skip_unneeded_resets{false};
+
+    /**
+     * \brief An observer to notify about the work performed by the pool's connections.
+     * \details
+     * If set to non-null, it is shared by all the connections created by the pool,
+     * including the operations run internally by the pool (like connects, pings and resets).
+     * See \ref any_connection_params::observer for more info.
+     * \n
+     * The pointee object must be kept alive until the pool and all its connections are destroyed.
+     * Unset by default.
+     */
+    connection_observer* observer{};
+
+    /**
+     * \brief SQL statements that every connection created by the pool should prepare.
+     * \details
+     * Each connection prepares these statements after connecting, before being handed to users.
+     * All the prepare requests are written to the server at once, saving round-trips.
+     * Statements are prepared again when the session is reset or re-established,
+     * so they're always valid when getting a connection from the pool.
+     * Use \ref pooled_connection::prepared_statement to retrieve them, passing
+     * the statement's index in this vector as a handle.
+     * \n
+     * If any of the statements fails to prepare, the error is treated like a connection
+     * establishment error: the connection waits for \ref retry_interval and then reconnects.
+     * \n
+     * Empty by default.
+     */
+    std::vector<std::string> statements;
 };
 
 }  // namespace mysql
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_POOL_STATS_HPP
+#define BOOST_MYSQL_POOL_STATS_HPP
+
+#include <boost/optional/optional.hpp>
+
+#include <chrono>
+#include <cstddef>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) Counters describing a connection pool's activity.
+ * \details
+ * Returned by \ref connection_pool::stats. Counters are accumulated since the pool
+ * was created and are never reset. Other members describe the pool's current state.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+struct pool_stats
+{
+    /// The number of connection establishment attempts issued by the pool.
+    std::size_t connect_attempts{};
+
+    /// The number of connection establishment attempts that failed or timed out.
+    std::size_t connect_failures{};
+
+    /**
+     * \brief The number of connection establishment attempts that were delayed.
+     * \details
+     * Attempts are delayed to honor \ref pool_params::max_concurrent_connects
+     * and \ref pool_params::min_connect_interval.
+     */
+    std::size_t throttled_connects{};
+
+    /**
+     * \brief The number of connection requests that failed immediately.
+     * \details
+     * Requests fail immediately when the pool considers the server unavailable.
+     * See \ref pool_params::circuit_breaker_threshold.
+     */
+    std::size_t fast_failed_requests{};
+
+    /**
+     * \brief The number of `async_get_connection` requests rejected because the queue was full.
+     * \details
+     * See \ref pool_params::max_pending_requests.
+     */
+    std::size_t rejected_requests{};
+
+    /// The number of connections currently handed to the user.
+    std::size_t in_use_connections{};
+
+    /// The number of \ref connection_pool::async_get_connection operations currently outstanding.
+    std::size_t pending_requests{};
+
+    /**
+     * \brief The server's replication lag, as measured by the last health check.
+     * \details
+     * Only measured if \ref pool_params::measure_replication_lag is `true`. Empty if
+     * no measurement has been performed yet. If the server is not replicating
+     * (because it's not a replica or because replication is stopped),
+     * contains `std::chrono::seconds::max()`.
+     */
+    boost::optional<std::chrono::seconds> replication_lag;
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_REQUEST_PRIORITY_HPP
+#define BOOST_MYSQL_REQUEST_PRIORITY_HPP
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The priority of a \ref connection_pool::async_get_connection request.
+ * \details
+ * When no connection is available, requests wait in a queue. Requests with a higher
+ * priority are always served before requests with a lower one. Requests with the same
+ * priority are served in deadline order (requests with earlier timeouts first).
+ */
+enum class request_priority
+{
+    /// Served before any other request. Use it for latency-sensitive work, like interactive traffic.
+    high,
+
+    /// The default priority.
+    normal,
+
+    /// Served only when no other request is waiting. Use it for batch jobs.
+    low,
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_RESOLVER_CACHE_HPP
+#define BOOST_MYSQL_RESOLVER_CACHE_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/ip/tcp.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) A cache for hostname resolution results, shared between connections.
+ * \details
+ * When a connection configured with a resolver cache (see \ref any_connection_params::dns_cache)
+ * connects to a server using TCP, it looks up the server's hostname in the cache before
+ * issuing a DNS query. Successful resolutions are stored in the cache, and are considered
+ * valid for \ref ttl. If a physical connection can't be established to any of the
+ * endpoints associated to a hostname, its entry is invalidated, so the next connection
+ * attempt issues a fresh DNS query.
+ * \n
+ * \ref connection_pool creates an object of this type when \ref pool_params::dns_cache_ttl
+ * is set, and shares it between all the connections it creates.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: safe. All member functions are protected by an internal mutex.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class resolver_cache
+{
+public:
+    /// The type of the endpoints stored by the cache.
+    using endpoints_type = asio::ip::tcp::resolver::results_type;
+
+    /**
+     * \brief Constructs an empty cache with the given time-to-live.
+     * \details
+     * A non-positive `ttl` disables caching: lookups will never find any entry.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    explicit resolver_cache(std::chrono::steady_clock::duration ttl) noexcept : ttl_(ttl) {}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    resolver_cache(const resolver_cache&) = delete;
+    resolver_cache(resolver_cache&&) = delete;
+    resolver_cache& operator=(const resolver_cache&) = delete;
+    resolver_cache& operator=(resolver_cache&&) = delete;
+    ~resolver_cache() = default;
+#endif
+
+    /**
+     * \brief Retrieves the time that resolution results are considered valid.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::chrono::steady_clock::duration ttl() const noexcept { return ttl_; }
+
+    /**
+     * \brief Looks up the endpoints associated to a host and port.
+     * \details
+     * If a non-expired entry is found, it's copied into `output` and `true` is returned.
+     * Otherwise, `output` is left untouched and `false` is returned.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    bool find(
+        string_view host,
+        unsigned short port,
+        std::chrono::steady_clock::time_point now,
+        endpoints_type& output
+    ) const;
+
+    /**
+     * \brief Stores the endpoints associated to a host and port.
+     * \details
+     * The entry will be considered valid until `now + this->ttl()`. Any existing
+     * entry for the same host and port is replaced.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations and locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void insert(
+        string_view host,
+        unsigned short port,
+        endpoints_type endpoints,
+        std::chrono::steady_clock::time_point now
+    );
+
+    /**
+     * \brief Removes the entry associated to a host and port, if any.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void invalidate(string_view host, unsigned short port);
+
+    /**
+     * \brief Removes all entries.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void clear();
+
+    /**
+     * \brief Returns the number of entries in the cache, including expired ones.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    std::size_t size() const;
+
+private:
+    struct entry
+    {
+        std::string host;
+        unsigned short port;
+        endpoints_type endpoints;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    std::chrono::steady_clock::duration ttl_;
+    mutable std::mutex mtx_;
+
+    // The number of distinct hosts is expected to be small, so a linear search is fine
+    std::vector<entry> entries_;
+
+    // Returns the index of the entry matching host and port, or entries_.size() if not found
+    BOOST_MYSQL_DECL
+    std::size_t find_entry(string_view host, unsigned short port) const noexcept;
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/resolver_cache.ipp>
+#endif
+
+#endif
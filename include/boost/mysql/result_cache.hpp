@@ -0,0 +1,376 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_RESULT_CACHE_HPP
+#define BOOST_MYSQL_RESULT_CACHE_HPP
+
+#include <boost/mysql/connection_pool.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/core/span.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+template <class IoTraits>
+struct basic_result_cache_load_op;
+}
+
+/**
+ * \brief (EXPERIMENTAL) A client-side cache for query results, shared between connections.
+ * \details
+ * Stores the \ref results of queries, keyed by their SQL text and parameters (see \ref make_key).
+ * Results are stored as immutable objects shared between all the readers, so cache hits
+ * don't copy any rows.
+ * \n
+ * Entries are considered valid for \ref ttl. When the cache holds \ref max_entries entries,
+ * inserting a new one evicts the least recently used entry. Entries may be associated
+ * to a set of tags (e.g. the names of the tables they read), which can be used to invalidate
+ * them when the underlying data changes (see \ref invalidate_tag).
+ * \n
+ * \ref async_execute looks up the cache and runs the query using a connection from a
+ * \ref connection_pool on a miss. Concurrent misses for the same key are coalesced,
+ * so only one of them runs the query.
+ * \n
+ * The cache doesn't detect changes made to the data. Only use it for queries where
+ * reading data up to \ref ttl old is acceptable, and invalidate entries when you modify it.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: safe. All member functions are protected by an internal mutex.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class result_cache
+{
+public:
+    /// The type used to hold cached results.
+    using results_ptr = std::shared_ptr<const results>;
+
+private:
+    template <class IoTraits>
+    friend struct detail::basic_result_cache_load_op;
+
+    struct entry
+    {
+        std::string key;
+        results_ptr res;
+        std::vector<std::string> tags;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    using handler_type = asio::any_completion_handler<void(error_code, results_ptr)>;
+
+    // An async_execute operation waiting for a query to complete
+    struct waiter
+    {
+        handler_type handler;
+        asio::any_io_executor ex;
+        diagnostics* diag;
+    };
+
+    struct initiate_execute
+    {
+        template <class Handler>
+        void operator()(
+            Handler&& h,
+            result_cache* self,
+            connection_pool& pool,
+            string_view sql,
+            span<const field_view> params,
+            span<const string_view> tags,
+            diagnostics* diag
+        )
+        {
+            self->async_execute_erased(pool, sql, params, tags, diag, std::forward<Handler>(h));
+        }
+    };
+
+    std::chrono::steady_clock::duration ttl_;
+    std::size_t max_entries_;
+    mutable std::mutex mtx_;
+
+    // Most recently used entries go first
+    std::list<entry> lru_;
+    std::unordered_map<std::string, std::list<entry>::iterator> entries_;
+
+    // Queries in progress, by key
+    std::unordered_map<std::string, std::vector<waiter>> flights_;
+
+    // Incremented by invalidations, so results retrieved while they happen are not cached
+    std::uint64_t generation_{0};
+
+    // The *_impl functions require the mutex to be locked
+    BOOST_MYSQL_DECL
+    results_ptr find_impl(const std::string& key, std::chrono::steady_clock::time_point now);
+
+    BOOST_MYSQL_DECL
+    void erase_impl(std::list<entry>::iterator it);
+
+    BOOST_MYSQL_DECL
+    void insert_impl(
+        const std::string& key,
+        results_ptr res,
+        std::vector<std::string> tags,
+        std::chrono::steady_clock::time_point now
+    );
+
+    // Looks up the cache for an async_execute operation. On a hit, completes the handler.
+    // Otherwise, registers the operation as a waiter for the key. Returns whether the caller
+    // must run the query and call finish_flight
+    BOOST_MYSQL_DECL
+    bool begin_flight(
+        const std::string& key,
+        handler_type& handler,
+        const asio::any_io_executor& ex,
+        diagnostics* diag,
+        std::uint64_t& generation
+    );
+
+    BOOST_MYSQL_DECL
+    void async_execute_erased(
+        connection_pool& pool,
+        string_view sql,
+        span<const field_view> params,
+        span<const string_view> tags,
+        diagnostics* diag,
+        handler_type handler
+    );
+
+    // Called when the query for a key completes. Stores the results and notifies all the waiters
+    BOOST_MYSQL_DECL
+    void finish_flight(
+        const std::string& key,
+        std::uint64_t generation,
+        std::vector<std::string> tags,
+        error_code ec,
+        const diagnostics& diag,
+        results_ptr res
+    );
+
+public:
+    /**
+     * \brief Constructs an empty cache.
+     * \details
+     * A non-positive `ttl` or a zero `max_entries` disable caching: lookups will never find any entry,
+     * but concurrent \ref async_execute calls will still be coalesced.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    result_cache(std::chrono::steady_clock::duration ttl, std::size_t max_entries) noexcept
+        : ttl_(ttl), max_entries_(max_entries)
+    {
+    }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    result_cache(const result_cache&) = delete;
+    result_cache(result_cache&&) = delete;
+    result_cache& operator=(const result_cache&) = delete;
+    result_cache& operator=(result_cache&&) = delete;
+    ~result_cache() = default;
+#endif
+
+    /**
+     * \brief Retrieves the time that entries are considered valid.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::chrono::steady_clock::duration ttl() const noexcept { return ttl_; }
+
+    /**
+     * \brief Retrieves the maximum number of entries that the cache holds.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t max_entries() const noexcept { return max_entries_; }
+
+    /**
+     * \brief Computes the key associated to a query and its parameters.
+     * \details
+     * The key contains the SQL text and a serialized form of the parameters,
+     * including their types (e.g. the integer `1` and the string `"1"` yield different keys).
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    static std::string make_key(string_view sql, span<const field_view> params = {});
+
+    /**
+     * \brief Looks up the results associated to a key.
+     * \details
+     * If a non-expired entry is found, it's marked as the most recently used and returned.
+     * Otherwise, `nullptr` is returned.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations and locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    results_ptr find(string_view key, std::chrono::steady_clock::time_point now);
+
+    /**
+     * \brief Stores the results associated to a key.
+     * \details
+     * The entry will be considered valid until `now + this->ttl()`, and will be associated
+     * to the passed tags. Any existing entry for the same key is replaced. If the cache
+     * is full, the least recently used entry is evicted.
+     *
+     * \par Preconditions
+     * `res != nullptr`
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations and locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void insert(
+        string_view key,
+        results_ptr res,
+        span<const string_view> tags,
+        std::chrono::steady_clock::time_point now
+    );
+
+    /**
+     * \brief Removes the entry associated to a key, if any.
+     * \details
+     * Results for this key being retrieved by \ref async_execute when this function
+     * is called won't be cached.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations and locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void invalidate(string_view key);
+
+    /**
+     * \brief Removes all the entries associated to a tag.
+     * \details
+     * Results being retrieved by \ref async_execute when this function is called won't be cached.
+     * \n
+     * This function performs a linear scan over all entries.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void invalidate_tag(string_view tag);
+
+    /**
+     * \brief Removes all entries.
+     * \details
+     * Results being retrieved by \ref async_execute when this function is called won't be cached.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void clear();
+
+    /**
+     * \brief Returns the number of entries in the cache, including expired ones.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    std::size_t size() const;
+
+    /**
+     * \brief Retrieves the results of a query, running it on a miss.
+     * \details
+     * Looks up the key for `sql` and `params` (see \ref make_key). If there is a valid entry,
+     * the operation completes with it. Otherwise, a connection is obtained from `pool`
+     * (as per \ref connection_pool::async_get_connection, with the default timeout) and used to run
+     * the query. If `params` is empty, the query is run as a text query. Otherwise, it's
+     * prepared as a statement and executed with `params`. Successful results are stored in the cache,
+     * associated to `tags`.
+     * \n
+     * If there is already an operation retrieving the results for the same key, no query is run.
+     * Instead, the operation waits for the other one, and completes with its results
+     * (or error and diagnostics).
+     * \n
+     * `sql`, `params` and `tags` are copied, so they don't need to be kept alive after the
+     * initiating function returns.
+     *
+     * \par Object lifetimes
+     * `*this` must be kept alive until the operation completes. `pool` only needs to be
+     * alive while the operation is being initiated.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, boost::mysql::result_cache::results_ptr)`.
+     * On success, the pointer is never null.
+     *
+     * \par Errors
+     * Any error returned by \ref connection_pool::async_get_connection, \ref any_connection::async_execute
+     * or \ref any_connection::async_prepare_statement.
+     *
+     * \par Executor
+     * If the completion handler doesn't have an associated executor,
+     * it's invoked using the pool's executor.
+     */
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, results_ptr)) CompletionToken>
+    auto async_execute(
+        connection_pool& pool,
+        string_view sql,
+        span<const field_view> params,
+        span<const string_view> tags,
+        diagnostics& diag,
+        CompletionToken&& token
+    )
+        BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code, results_ptr)>(
+            initiate_execute{},
+            token,
+            this,
+            pool,
+            sql,
+            params,
+            tags,
+            &diag
+        )))
+    {
+        return asio::async_initiate<CompletionToken, void(error_code, results_ptr)>(
+            initiate_execute{},
+            token,
+            this,
+            pool,
+            sql,
+            params,
+            tags,
+            &diag
+        );
+    }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/result_cache.ipp>
+#endif
+
+#endif
@@ -8,6 +8,7 @@
 #ifndef BOOST_MYSQL_RESULTS_HPP
 #define BOOST_MYSQL_RESULTS_HPP
 
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/resultset.hpp>
 #include <boost/mysql/resultset_view.hpp>
@@ -77,6 +78,20 @@ public:
      */
     results() = default;
 
+    /**
+     * \brief Constructs an empty results object that allocates from a memory resource.
+     * \details
+     * Constructs an object with `this->has_value() == false`. Rows, per-resultset data
+     * and metadata objects will be allocated from `res`. Strings in metadata objects
+     * (like column names) use the default allocator.
+     * The resource referenced by `res` must outlive `*this`. Copies of `*this` allocate from
+     * the global heap. See \ref memory_resource_ref for the supported resource types.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    explicit results(memory_resource_ref res) noexcept : impl_(res) {}
+
     /**
      * \brief Copy constructor.
      * \par Exception safety
@@ -113,7 +128,7 @@ public:
      * \par Object lifetimes
      * View objects obtained from `other` using \ref rows and \ref meta remain valid.
      * Any other views and iterators referencing `other` are invalidated. Views and iterators
-     * referencing `*this` are invalidated.
+     * referencing `*this` are invalidated. `*this` takes over the memory resource used by `other`.
      */
     results& operator=(results&& other) = default;
 
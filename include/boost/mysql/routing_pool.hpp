@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_ROUTING_POOL_HPP
+#define BOOST_MYSQL_ROUTING_POOL_HPP
+
+#include <boost/mysql/connection_pool.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/pool_params.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/assert.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The kind of access required for a connection obtained from a \ref routing_pool.
+ */
+enum class access_mode
+{
+    /// The connection may be used to modify data. It's always obtained from the primary.
+    read_write,
+
+    /// The connection is only used to read data. It may be obtained from a replica.
+    read_only,
+};
+
+/**
+ * \brief (EXPERIMENTAL) Configuration parameters for \ref routing_pool.
+ * \details
+ * This is an owning type.
+ */
+struct routing_pool_params
+{
+    /// Configuration for the pool connecting to the primary server.
+    pool_params primary;
+
+    /// Configuration for the pools connecting to each of the replicas. May be empty.
+    std::vector<pool_params> replicas;
+
+    /**
+     * \brief Maximum replication lag for a replica to serve reads.
+     * \details
+     * If greater than zero, the replication lag of each replica is measured
+     * as part of its pool's health checks (see \ref pool_params::measure_replication_lag
+     * and \ref pool_params::ping_interval). Replicas lagging more than this value,
+     * or not replicating at all, are excluded from read routing until their lag decreases.
+     * Replicas that haven't been measured yet are considered eligible.
+     * \n
+     * Replication lag is measured with a granularity of one second.
+     * This value must not be negative. The default (zero) disables lag checks.
+     */
+    std::chrono::steady_clock::duration max_replication_lag{};
+};
+
+/**
+ * \brief (EXPERIMENTAL) A set of connection pools for a primary server and its replicas.
+ * \details
+ * Manages a \ref connection_pool for the primary server and one for each replica.
+ * Connections are requested specifying an \ref access_mode.
+ * \ref access_mode::read_write connections are always obtained from the primary.
+ * \ref access_mode::read_only connections are obtained from the replica with
+ * the least outstanding requests (i.e. connections in use plus pending \ref async_get_connection
+ * operations), excluding replicas whose replication lag exceeds
+ * \ref routing_pool_params::max_replication_lag.
+ * If no replica is available, read-only connections are obtained from the primary.
+ * \n
+ * Routing is performed when \ref async_get_connection is initiated. Once a pool has
+ * been selected, the operation behaves like \ref connection_pool::async_get_connection.
+ * \n
+ * This is a move-only type.
+ *
+ * \par Thread-safety
+ * Functions are thread-safe under the same conditions as their \ref connection_pool counterparts.
+ * The executor configuration passed to the constructor is used for all the pools.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class routing_pool
+{
+    std::vector<connection_pool> pools_;  // pools_[0] is the primary
+    std::chrono::steady_clock::duration max_replication_lag_;
+
+    struct initiate_run
+    {
+        template <class Handler>
+        void operator()(Handler&& h, routing_pool* self)
+        {
+            self->async_run_erased(std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    void async_run_erased(asio::any_completion_handler<void(error_code)> handler);
+
+    BOOST_MYSQL_DECL
+    connection_pool& select_pool(access_mode mode) noexcept;
+
+public:
+    /**
+     * \brief Constructs a routing pool.
+     * \details
+     * Creates a \ref connection_pool for the primary and each replica, using `ex_params`.
+     * If `params.max_replication_lag` is greater than zero, replica pools are configured to
+     * measure replication lag.
+     * \n
+     * Like connection pools, the routing pool is created in a "not-running" state.
+     * Call \ref async_run to transition to the "running" state.
+     *
+     * \par Exception safety
+     * Strong guarantee. Exceptions may be thrown by memory allocations.
+     * \throws std::invalid_argument If `params` contains values that violate the rules described in
+     *         \ref routing_pool_params or \ref pool_params.
+     */
+    BOOST_MYSQL_DECL
+    routing_pool(const pool_executor_params& ex_params, routing_pool_params params);
+
+    /// The executor type associated to this object.
+    using executor_type = asio::any_io_executor;
+
+    /// Retrieves the executor associated to the primary's pool.
+    executor_type get_executor() noexcept { return pools_.front().get_executor(); }
+
+    /// Retrieves the pool connecting to the primary.
+    connection_pool& primary() noexcept { return pools_.front(); }
+
+    /// Retrieves the number of replicas.
+    std::size_t num_replicas() const noexcept { return pools_.size() - 1u; }
+
+    /**
+     * \brief Retrieves the pool connecting to a replica.
+     * \details
+     * `index` follows the order of \ref routing_pool_params::replicas.
+     *
+     * \par Preconditions
+     * `index < this->num_replicas()`
+     */
+    connection_pool& replica(std::size_t index) noexcept
+    {
+        BOOST_ASSERT(index < num_replicas());
+        return pools_[index + 1u];
+    }
+
+    /**
+     * \brief Runs all the pools, until \ref cancel is called.
+     * \details
+     * Calls \ref connection_pool::async_run on every pool, and completes after all of them
+     * complete. The routing pool must be alive while the operation is being initiated,
+     * but it may be destroyed afterwards.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`
+     *
+     * \par Errors
+     * This function always complete successfully.
+     */
+    template <BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code)) CompletionToken>
+    auto async_run(CompletionToken&& token) BOOST_MYSQL_RETURN_TYPE(
+        decltype(asio::async_initiate<CompletionToken, void(error_code)>(initiate_run{}, token, this))
+    )
+    {
+        return asio::async_initiate<CompletionToken, void(error_code)>(initiate_run{}, token, this);
+    }
+
+    /// \copydoc async_get_connection(access_mode,std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken>
+    auto async_get_connection(access_mode mode, CompletionToken&& token) BOOST_MYSQL_RETURN_TYPE(
+        decltype(std::declval<connection_pool&>().async_get_connection(std::forward<CompletionToken>(token)))
+    )
+    {
+        return select_pool(mode).async_get_connection(std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_get_connection(access_mode,std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken>
+    auto async_get_connection(access_mode mode, diagnostics& diag, CompletionToken&& token)
+        BOOST_MYSQL_RETURN_TYPE(decltype(std::declval<connection_pool&>().async_get_connection(
+            diag,
+            std::forward<CompletionToken>(token)
+        )))
+    {
+        return select_pool(mode).async_get_connection(diag, std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_get_connection(access_mode,std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken>
+    auto async_get_connection(
+        access_mode mode,
+        std::chrono::steady_clock::duration timeout,
+        CompletionToken&& token
+    )
+        BOOST_MYSQL_RETURN_TYPE(decltype(std::declval<connection_pool&>().async_get_connection(
+            timeout,
+            std::forward<CompletionToken>(token)
+        )))
+    {
+        return select_pool(mode).async_get_connection(timeout, std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * \brief Retrieves a connection from the pool that corresponds to the given access mode.
+     * \details
+     * Selects a pool as described in the class description, then
+     * behaves like \ref connection_pool::async_get_connection.
+     * If `timeout` is not passed, a default of 30 seconds is used.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, boost::mysql::pooled_connection)`
+     *
+     * \par Errors
+     * Same as \ref connection_pool::async_get_connection.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken>
+    auto async_get_connection(
+        access_mode mode,
+        std::chrono::steady_clock::duration timeout,
+        diagnostics& diag,
+        CompletionToken&& token
+    )
+        BOOST_MYSQL_RETURN_TYPE(decltype(std::declval<connection_pool&>().async_get_connection(
+            timeout,
+            diag,
+            std::forward<CompletionToken>(token)
+        )))
+    {
+        return select_pool(mode).async_get_connection(timeout, diag, std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * \brief Cancels all the pools.
+     * \details
+     * Calls \ref connection_pool::cancel on every pool.
+     */
+    BOOST_MYSQL_DECL
+    void cancel();
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/routing_pool.ipp>
+#endif
+
+#endif
@@ -10,6 +10,7 @@
 
 #include <boost/mysql/field.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/row_view.hpp>
 
 #include <boost/mysql/detail/row_impl.hpp>
@@ -73,6 +74,18 @@ public:
      */
     row() = default;
 
+    /**
+     * \brief Constructs an empty row that allocates from a memory resource.
+     * \details
+     * All memory owned by the constructed object will be allocated from `res`.
+     * The resource referenced by `res` must outlive `*this`. Copies of `*this` allocate from
+     * the global heap. See \ref memory_resource_ref for the supported resource types.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    explicit row(memory_resource_ref res) noexcept : impl_(res) {}
+
     /**
      * \brief Copy constructor.
      * \par Exception safety
@@ -123,6 +136,7 @@ public:
      * Iterators and references (including \ref row_view's and \ref field_view's) to
      * elements in `*this` are invalidated. Iterators and references to elements in `other` remain
      * valid.
+     * `*this` takes over the memory resource used by `other`.
      *
      * \par Complexity
      * Constant.
@@ -9,6 +9,7 @@
 #define BOOST_MYSQL_ROWS_HPP
 
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/row.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows_view.hpp>
@@ -80,6 +81,18 @@ public:
      */
     rows() = default;
 
+    /**
+     * \brief Constructs an empty `rows` object that allocates from a memory resource.
+     * \details
+     * All memory owned by the constructed object will be allocated from `res`.
+     * The resource referenced by `res` must outlive `*this`. Copies of `*this` allocate from
+     * the global heap. See \ref memory_resource_ref for the supported resource types.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    explicit rows(memory_resource_ref res) noexcept : impl_(res) {}
+
     /**
      * \brief Copy constructor.
      * \par Exception safety
@@ -131,6 +144,7 @@ public:
      * Iterators and references (including \ref rows_view's \ref row_view's and \ref
      * field_view's) to elements in `*this` are invalidated. Iterators and references to elements in
      * `other` remain valid.
+     * `*this` takes over the memory resource used by `other`.
      *
      * \par Complexity
      * Constant.
@@ -20,6 +20,7 @@
 
 #include <boost/mysql/impl/any_connection.ipp>
 #include <boost/mysql/impl/any_stream_impl.ipp>
+#include <boost/mysql/impl/binlog.ipp>
 #include <boost/mysql/impl/character_set.ipp>
 #include <boost/mysql/impl/column_type.ipp>
 #include <boost/mysql/impl/connect_params_helpers.ipp>
@@ -27,6 +28,7 @@
 #include <boost/mysql/impl/connection_pool.ipp>
 #include <boost/mysql/impl/date.ipp>
 #include <boost/mysql/impl/datetime.ipp>
+#include <boost/mysql/impl/decimal.ipp>
 #include <boost/mysql/impl/error_categories.ipp>
 #include <boost/mysql/impl/escape_string.ipp>
 #include <boost/mysql/impl/execution_state_impl.ipp>
@@ -36,16 +38,26 @@
 #include <boost/mysql/impl/internal/auth/auth.ipp>
 #include <boost/mysql/impl/internal/error/server_error_to_string.ipp>
 #include <boost/mysql/impl/internal/protocol/binary_serialization.ipp>
+#include <boost/mysql/impl/internal/protocol/binlog.ipp>
 #include <boost/mysql/impl/internal/protocol/deserialize_binary_field.ipp>
 #include <boost/mysql/impl/internal/protocol/deserialize_text_field.ipp>
 #include <boost/mysql/impl/internal/protocol/protocol.ipp>
 #include <boost/mysql/impl/internal/protocol/protocol_field_type.ipp>
+#include <boost/mysql/impl/lazy_row_impl.ipp>
 #include <boost/mysql/impl/meta_check_context.ipp>
+#include <boost/mysql/impl/multiplexed_connection.ipp>
+#include <boost/mysql/impl/parallel_row_decoder.ipp>
+#include <boost/mysql/impl/resolver_cache.ipp>
+#include <boost/mysql/impl/result_cache.ipp>
 #include <boost/mysql/impl/results_impl.ipp>
 #include <boost/mysql/impl/resultset.ipp>
+#include <boost/mysql/impl/routing_pool.ipp>
+#include <boost/mysql/impl/row_decoding_plan.ipp>
 #include <boost/mysql/impl/row_impl.ipp>
 #include <boost/mysql/impl/run_algo.ipp>
 #include <boost/mysql/impl/static_execution_state_impl.ipp>
 #include <boost/mysql/impl/static_results_impl.ipp>
+#include <boost/mysql/impl/tls_session_cache.ipp>
+#include <boost/mysql/impl/wire_capture.ipp>
 
 #endif
@@ -12,6 +12,7 @@
 
 #ifdef BOOST_MYSQL_CXX14
 
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
@@ -50,6 +51,20 @@ public:
      */
     static_results() = default;
 
+    /**
+     * \brief Constructs an empty results object that allocates from a memory resource.
+     * \details
+     * Constructs an object with `this->has_value() == false`. Rows, per-resultset data
+     * and metadata objects will be allocated from `res`. Strings in metadata objects
+     * (like column names) use the default allocator.
+     * The resource referenced by `res` must outlive `*this`. Copies of `*this` allocate from
+     * the global heap. See \ref memory_resource_ref for the supported resource types.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    explicit static_results(memory_resource_ref res) noexcept : impl_(res) {}
+
     /**
      * \brief Copy constructor.
      * \par Exception safety
@@ -84,7 +99,7 @@ public:
      *
      * \par Object lifetimes
      * View objects obtained from `other` remain valid.
-     * Views and referencing `*this` are invalidated.
+     * Views and referencing `*this` are invalidated. `*this` takes over the memory resource used by `other`.
      */
     static_results& operator=(static_results&& other) = default;
 
@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TLS_SESSION_CACHE_HPP
+#define BOOST_MYSQL_TLS_SESSION_CACHE_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/ssl/context.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) Stores TLS sessions, so connections can use abbreviated handshakes when reconnecting.
+ * \details
+ * When a connection configured with a session cache (see \ref any_connection_params::tls_sessions)
+ * establishes a TLS session with a server, it stores the session in the cache, keyed by the
+ * server's host and port. Subsequent TLS handshakes against the same server (from the same or
+ * any other connection sharing the cache) will offer the stored session, allowing
+ * the server to resume it without a full key exchange. If the server doesn't accept the
+ * session, a full handshake is performed, as usual. Failed handshakes remove the session from the cache.
+ * \n
+ * \ref connection_pool creates an object of this type when \ref pool_params::reuse_tls_sessions
+ * is set, and shares it between all the connections it creates.
+ * \n
+ * Session resumption requires OpenSSL 1.1.0 or later. With previous versions,
+ * this class never stores any session.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: safe. All member functions are protected by an internal mutex.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class tls_session_cache
+{
+public:
+    /**
+     * \brief Constructs an empty cache.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    tls_session_cache() noexcept = default;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    tls_session_cache(const tls_session_cache&) = delete;
+    tls_session_cache(tls_session_cache&&) = delete;
+    tls_session_cache& operator=(const tls_session_cache&) = delete;
+    tls_session_cache& operator=(tls_session_cache&&) = delete;
+#endif
+
+    /// Destructor. Releases all stored sessions.
+    BOOST_MYSQL_DECL
+    ~tls_session_cache();
+
+    /**
+     * \brief Retrieves the session stored for a host and port.
+     * \details
+     * Returns `nullptr` if no session is stored. Otherwise, returns a new reference
+     * to the stored session, which must be released by the caller using `SSL_SESSION_free`.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    SSL_SESSION* get(string_view host, unsigned short port) const;
+
+    /**
+     * \brief Stores a session for a host and port.
+     * \details
+     * The cache acquires a new reference to `session`. The caller's
+     * reference is not consumed. Any session previously stored for the same host and
+     * port is released.
+     *
+     * \par Preconditions
+     * `session != nullptr`
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations and locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void store(string_view host, unsigned short port, SSL_SESSION* session);
+
+    /**
+     * \brief Removes the session stored for a host and port, if any.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void invalidate(string_view host, unsigned short port);
+
+    /**
+     * \brief Removes all stored sessions.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void clear();
+
+    /**
+     * \brief Returns the number of stored sessions.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    std::size_t size() const;
+
+private:
+    struct entry
+    {
+        std::string host;
+        unsigned short port;
+        SSL_SESSION* session;  // owning
+    };
+
+    mutable std::mutex mtx_;
+    std::vector<entry> entries_;
+
+    // Returns the index of the entry matching host and port, or entries_.size() if not found
+    BOOST_MYSQL_DECL
+    std::size_t find_entry(string_view host, unsigned short port) const noexcept;
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/tls_session_cache.ipp>
+#endif
+
+#endif
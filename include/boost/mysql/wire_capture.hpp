@@ -0,0 +1,321 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_WIRE_CAPTURE_HPP
+#define BOOST_MYSQL_WIRE_CAPTURE_HPP
+
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/buffer.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The type of an event stored in a wire capture.
+ * \details
+ * Each event corresponds to one completed operation on the connection's stream.
+ */
+enum class wire_event : std::uint8_t
+{
+    /// A physical connection was established.
+    connect = 1,
+
+    /// A TLS handshake was performed.
+    tls_handshake,
+
+    /// Bytes were read from the server. The event payload contains them.
+    read,
+
+    /// Bytes were written to the server. The event payload contains them.
+    write,
+
+    /// A TLS shutdown was performed.
+    tls_shutdown,
+
+    /// The physical connection was closed.
+    close,
+};
+
+/**
+ * \brief (EXPERIMENTAL) Records all the bytes exchanged by a connection to a file.
+ * \details
+ * When a connection is configured with a capture (see \ref any_connection_params::capture),
+ * every completed stream operation is appended to the capture file as an event,
+ * together with the time elapsed since the file was opened. Reads and writes store the
+ * bytes that were transferred, keeping the boundaries of the individual operations.
+ * Captures can be loaded by \ref wire_replay, to re-run a workload without a server.
+ * \n
+ * Bytes are recorded above the TLS layer. Captures contain any data sent or received by
+ * the connection in plaintext, including credentials and query results: handle them accordingly.
+ * \n
+ * I/O errors while writing the capture file never affect the connection. The first one is
+ * stored and can be queried with \ref error. Events recorded after an error are discarded,
+ * since the file can no longer be replayed. A capture should be used by a single connection:
+ * events from different connections sharing a capture are interleaved, which makes
+ * the capture unsuitable for replay.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: safe. All member functions are protected by an internal mutex.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class wire_capture
+{
+public:
+    /**
+     * \brief Constructs a capture without an associated file.
+     * \details Events recorded before calling \ref open are discarded.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    wire_capture() noexcept = default;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    wire_capture(const wire_capture&) = delete;
+    wire_capture(wire_capture&&) = delete;
+    wire_capture& operator=(const wire_capture&) = delete;
+    wire_capture& operator=(wire_capture&&) = delete;
+#endif
+
+    /// Destructor. Flushes and closes the capture file, if open.
+    BOOST_MYSQL_DECL
+    ~wire_capture();
+
+    /**
+     * \brief Creates a capture file, truncating it if it exists.
+     * \details
+     * Any previously open file is closed, and any stored error is cleared. Timestamps of
+     * subsequent events are relative to this call. Returns an error if the file can't be created.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    error_code open(const char* path);
+
+    /**
+     * \brief Flushes and closes the capture file, if open.
+     * \details If flushing fails, the error is stored and can be queried with \ref error.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void close();
+
+    /**
+     * \brief Returns whether a capture file is open.
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    bool is_open() const;
+
+    /**
+     * \brief Returns the first error encountered while writing the capture file.
+     * \details
+     * Returns an empty error code if all the recorded events were written successfully.
+     * Once an error occurs, subsequent events are discarded until \ref open is called again.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    error_code error() const;
+
+    /**
+     * \brief Appends an event to the capture file.
+     * \details
+     * This function is called by connections configured with this capture, and doesn't usually need
+     * to be called by user code. `payload` is only meaningful for \ref wire_event::read and
+     * \ref wire_event::write. Does nothing if no file is open or a previous write failed.
+     *
+     * \par Exception safety
+     * Strong guarantee. Locking the internal mutex may throw.
+     */
+    BOOST_MYSQL_DECL
+    void record(wire_event type, asio::const_buffer payload = {});
+
+private:
+    mutable std::mutex mtx_;
+    std::FILE* file_{};  // owning
+    std::chrono::steady_clock::time_point start_;
+    error_code error_;
+};
+
+/**
+ * \brief (EXPERIMENTAL) Serves the bytes recorded by a \ref wire_capture to a connection.
+ * \details
+ * When a connection is configured with a replay (see \ref any_connection_params::replay),
+ * it doesn't perform any network I/O. Connecting, TLS handshakes and closing succeed immediately.
+ * Reads are served from the recorded read events, respecting their original boundaries,
+ * so the connection's algorithms perform the same work as when the capture was taken.
+ * Writes succeed immediately and are compared against the recorded write events.
+ * Once all recorded reads have been consumed, reads fail with `asio::error::eof`.
+ * \n
+ * To reproduce a captured workload, run the same code that generated it against a connection
+ * configured with a replay. Timestamps are not honored: events are served as fast as the
+ * connection consumes them, so the replay measures the client's CPU cost alone.
+ * \n
+ * A replay should be used by a single connection.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: unsafe.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class wire_replay
+{
+public:
+    /**
+     * \brief Constructs an empty replay.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    wire_replay() noexcept = default;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    wire_replay(const wire_replay&) = delete;
+    wire_replay(wire_replay&&) = delete;
+    wire_replay& operator=(const wire_replay&) = delete;
+    wire_replay& operator=(wire_replay&&) = delete;
+#endif
+
+    /**
+     * \brief Loads a capture file created by \ref wire_capture.
+     * \details
+     * Replaces any previously loaded capture and rewinds the replay.
+     * Returns an error if the file can't be read or is not a valid capture.
+     * In this case, the replay is left empty.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    error_code load(const char* path);
+
+    /**
+     * \brief Loads a capture from an in-memory buffer, with the same format as a capture file.
+     * \details
+     * The buffer is copied. Replaces any previously loaded capture and rewinds the replay.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    error_code load(asio::const_buffer contents);
+
+    /**
+     * \brief Restarts the replay from the beginning of the capture.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void rewind() noexcept
+    {
+        read_offset_ = 0u;
+        read_chunk_ = 0u;
+        write_offset_ = 0u;
+        writes_match_ = true;
+    }
+
+    /**
+     * \brief Returns the number of events in the loaded capture.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t num_events() const noexcept { return num_events_; }
+
+    /**
+     * \brief Returns the time elapsed between opening the capture file and recording its last event.
+     * \details Useful to compare a replay's running time against the original workload.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::chrono::nanoseconds duration() const noexcept { return duration_; }
+
+    /**
+     * \brief Returns whether all the recorded reads have been served.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool finished() const noexcept { return read_chunk_ == read_ends_.size(); }
+
+    /**
+     * \brief Returns whether all the bytes written so far match the recorded writes.
+     * \details
+     * A mismatch means that the code being replayed diverged from the captured workload,
+     * and subsequent reads may not make sense to the connection.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool writes_match() const noexcept { return writes_match_; }
+
+    /**
+     * \brief Serves the next recorded bytes into `buff`.
+     * \details
+     * This function is called by connections configured with this replay, and doesn't usually need
+     * to be called by user code. Returns the number of bytes copied, never exceeding the remaining
+     * size of the current read event. Returns zero if all recorded reads have been served.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    std::size_t read(asio::mutable_buffer buff) noexcept;
+
+    /**
+     * \brief Compares the bytes in `buff` against the next recorded write bytes.
+     * \details
+     * This function is called by connections configured with this replay, and doesn't usually need
+     * to be called by user code. Updates \ref writes_match.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    void write(asio::const_buffer buff) noexcept;
+
+private:
+    std::vector<unsigned char> read_data_;  // contents of all read events, concatenated
+    std::vector<std::size_t> read_ends_;    // offset into read_data_ where each read event ends
+    std::vector<unsigned char> write_data_;
+    std::size_t num_events_{};
+    std::chrono::nanoseconds duration_{};
+
+    // Replay state
+    std::size_t read_offset_{};
+    std::size_t read_chunk_{};
+    std::size_t write_offset_{};
+    bool writes_match_{true};
+
+    BOOST_MYSQL_DECL
+    void clear() noexcept;
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/wire_capture.ipp>
+#endif
+
+#endif
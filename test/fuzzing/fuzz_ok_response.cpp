@@ -7,6 +7,8 @@
 
 #include <boost/mysql/diagnostics.hpp>
 
+#include <boost/mysql/detail/ok_view.hpp>
+
 #include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
 #include <boost/mysql/impl/internal/protocol/protocol.hpp>
 
@@ -15,8 +17,8 @@ using namespace boost::mysql::detail;
 static bool parse_ok_response(const uint8_t* data, size_t size) noexcept
 {
     boost::mysql::diagnostics diag;
-    bool backslash_slashes = true;
-    auto ec = deserialize_ok_response({data, size}, db_flavor::mariadb, diag, backslash_slashes);
+    ok_view ok{};
+    auto ec = deserialize_ok_response({data, size}, db_flavor::mariadb, diag, ok);
     return !ec.failed() && diag.server_message().empty();
 }
 
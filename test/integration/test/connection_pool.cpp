@@ -12,6 +12,7 @@
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/result_cache.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -552,6 +553,59 @@ BOOST_FIXTURE_TEST_CASE(zero_timeuts, fixture)
     });
 }
 
+// Spotcheck: result_cache coalesces concurrent misses and serves hits without querying
+BOOST_FIXTURE_TEST_CASE(result_cache_execute, fixture)
+{
+    run_stackful_coro([&](asio::yield_context yield) {
+        connection_pool pool(yield.get_executor(), create_pool_params());
+        pool_guard grd(&pool);
+        pool.async_run(check_err);
+
+        result_cache cache(std::chrono::minutes(1), 10);
+        const field_view params[] = {field_view(42)};
+        const string_view tags[] = {"my_table"};
+        result_cache::results_ptr r1, r2;
+        error_code ec2 = client_errc::server_unsupported;
+        diagnostics diag2;
+
+        // Issue two concurrent requests for the same query. Only one query is run
+        auto cb = [&](error_code err, result_cache::results_ptr r) {
+            ec2 = err;
+            r2 = std::move(r);
+        };
+        cache.async_execute(pool, "SELECT ?", params, tags, diag2, cb);
+        r1 = cache.async_execute(pool, "SELECT ?", params, tags, diag, yield[ec]);
+        check_success();
+        BOOST_TEST(ec2 == error_code());
+        BOOST_TEST_REQUIRE((r1 != nullptr));
+        BOOST_TEST((r1 == r2));
+        BOOST_TEST(r1->rows().at(0).at(0).as_int64() == 42);
+
+        // The results are now cached
+        auto r3 = cache.async_execute(pool, "SELECT ?", params, tags, diag, yield[ec]);
+        check_success();
+        BOOST_TEST((r3 == r1));
+
+        // Invalidating the tag causes the query to be run again
+        cache.invalidate_tag("my_table");
+        r3 = cache.async_execute(pool, "SELECT ?", params, tags, diag, yield[ec]);
+        check_success();
+        BOOST_TEST_REQUIRE((r3 != nullptr));
+        BOOST_TEST((r3 != r1));
+
+        // Text queries work, too
+        r3 = cache.async_execute(pool, "SELECT 'abc'", {}, {}, diag, yield[ec]);
+        check_success();
+        BOOST_TEST_REQUIRE((r3 != nullptr));
+        BOOST_TEST(r3->rows().at(0).at(0).as_string() == "abc");
+
+        // Errors are reported to all waiters
+        r3 = cache.async_execute(pool, "SELECT * FROM bad_table", {}, {}, diag, yield[ec]);
+        BOOST_TEST(ec == common_server_errc::er_no_such_table);
+        BOOST_TEST((r3 == nullptr));
+    });
+}
+
 // Spotcheck: constructing a connection_pool with invalid params throws
 BOOST_AUTO_TEST_CASE(invalid_params)
 {
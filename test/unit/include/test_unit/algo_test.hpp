@@ -93,6 +93,8 @@ class BOOST_ATTRIBUTE_NODISCARD algo_test
                     handle_read(step, algo.get().conn_state());
                 else if (step.type == detail::next_action::type_t::write)
                     handle_write(step, algo.get().conn_state());
+                else if (step.type == detail::next_action::type_t::decode_rows)
+                    algo.get().conn_state().run_pending_decode();
                 // Other actions don't need any handling
 
                 act = algo.resume(step.result);
@@ -169,6 +171,9 @@ public:
         return add_step(detail::next_action::type_t::close, {}, result);
     }
 
+    BOOST_ATTRIBUTE_NODISCARD
+    algo_test& expect_decode_rows() { return add_step(detail::next_action::type_t::decode_rows, {}, {}); }
+
     template <class AlgoFixture>
     void check(AlgoFixture& fix, error_code expected_ec = {}, const diagnostics& expected_diag = {})
     {
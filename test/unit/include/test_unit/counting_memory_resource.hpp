@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_COUNTING_MEMORY_RESOURCE_HPP
+#define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_COUNTING_MEMORY_RESOURCE_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace boost {
+namespace mysql {
+namespace test {
+
+// A memory resource that forwards to new/delete, recording
+// how many allocations are currently alive. Can be referenced by memory_resource_ref
+class counting_memory_resource
+{
+    std::size_t num_allocations_{};
+    std::size_t num_outstanding_{};
+
+public:
+    counting_memory_resource() = default;
+    counting_memory_resource(const counting_memory_resource&) = delete;
+    counting_memory_resource& operator=(const counting_memory_resource&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t)
+    {
+        void* res = ::operator new(bytes);
+        ++num_allocations_;
+        ++num_outstanding_;
+        return res;
+    }
+
+    void deallocate(void* p, std::size_t, std::size_t) noexcept
+    {
+        ::operator delete(p);
+        --num_outstanding_;
+    }
+
+    std::size_t num_allocations() const noexcept { return num_allocations_; }
+    std::size_t num_outstanding() const noexcept { return num_outstanding_; }
+};
+
+}  // namespace test
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_CREATE_BINLOG_EVENT_HPP
+#define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_CREATE_BINLOG_EVENT_HPP
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "test_unit/create_frame.hpp"
+
+namespace boost {
+namespace mysql {
+namespace test {
+
+inline void append_le(std::vector<std::uint8_t>& to, std::uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        to.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+}
+
+// The message sent by the server for a binlog event: a 0x00 byte, the event header and its body
+inline std::vector<std::uint8_t> create_binlog_event(
+    binlog_event_type type,
+    const std::vector<std::uint8_t>& body,
+    std::uint32_t log_pos = 0,
+    std::uint16_t flags = 0
+)
+{
+    std::vector<std::uint8_t> res{0x00};
+    append_le(res, 100, 4);  // timestamp
+    res.push_back(static_cast<std::uint8_t>(type));
+    append_le(res, 1, 4);  // server ID
+    append_le(res, 19 + body.size(), 4);
+    append_le(res, log_pos, 4);
+    append_le(res, flags, 2);
+    concat(res, body);
+    return res;
+}
+
+inline std::vector<std::uint8_t> create_binlog_event_frame(
+    std::uint8_t seqnum,
+    binlog_event_type type,
+    const std::vector<std::uint8_t>& body,
+    std::uint32_t log_pos = 0,
+    std::uint16_t flags = 0
+)
+{
+    return create_frame(seqnum, create_binlog_event(type, body, log_pos, flags));
+}
+
+// The body of a format description event, followed by the checksum algorithm and a zero checksum
+inline std::vector<std::uint8_t> create_format_description_body(
+    string_view server_version,
+    std::uint8_t checksum_alg
+)
+{
+    std::vector<std::uint8_t> res{0x04, 0x00};  // binlog version
+    std::vector<std::uint8_t> version(50, 0);
+    for (std::size_t i = 0; i < server_version.size(); ++i)
+        version[i] = static_cast<std::uint8_t>(server_version[i]);
+    concat(res, version);
+    append_le(res, 0, 4);                                      // creation timestamp
+    res.push_back(19);                                         // header length
+    concat(res, std::vector<std::uint8_t>{0x38, 0x0d, 0x08});  // post-header lengths (not used)
+    res.push_back(checksum_alg);                               // checksum algorithm
+    append_le(res, 0, 4);                                      // checksum
+    return res;
+}
+
+}  // namespace test
+}  // namespace mysql
+}  // namespace boost
+
+#endif
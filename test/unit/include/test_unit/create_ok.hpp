@@ -71,6 +71,21 @@ public:
         ok_.info = v;
         return *this;
     }
+    ok_builder& in_transaction(bool v) noexcept
+    {
+        flag(detail::status_flags::in_trans, v);
+        return *this;
+    }
+    ok_builder& session_state_changed(bool v) noexcept
+    {
+        flag(detail::status_flags::session_state_changed, v);
+        return *this;
+    }
+    ok_builder& session_state(string_view v) noexcept
+    {
+        ok_.session_state = v;
+        return session_state_changed(true);
+    }
     detail::ok_view build() const noexcept { return ok_; }
 };
 
@@ -24,6 +24,8 @@ inline std::ostream& operator<<(std::ostream& os, connection_status v)
     case connection_status::connect_in_progress: return os << "connection_status::connect_in_progress";
     case connection_status::sleep_connect_failed_in_progress:
         return os << "connection_status::sleep_connect_failed_in_progress";
+    case connection_status::prepare_statements_in_progress:
+        return os << "connection_status::prepare_statements_in_progress";
     case connection_status::reset_in_progress: return os << "connection_status::reset_in_progress";
     case connection_status::ping_in_progress: return os << "connection_status::ping_in_progress";
     case connection_status::idle: return os << "connection_status::idle";
@@ -55,6 +57,8 @@ inline std::ostream& operator<<(std::ostream& os, next_connection_action v)
     case next_connection_action::idle_wait: return os << "next_connection_action::idle_wait";
     case next_connection_action::reset: return os << "next_connection_action::reset";
     case next_connection_action::ping: return os << "next_connection_action::ping";
+    case next_connection_action::prepare_statements:
+        return os << "next_connection_action::prepare_statements";
     default: return os << "<unknown next_connection_action>";
     }
 }
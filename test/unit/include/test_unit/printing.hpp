@@ -9,6 +9,7 @@
 #define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_PRINTING_HPP
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/binlog.hpp>
 
 #include <boost/mysql/detail/results_iterator.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
@@ -35,6 +36,22 @@ inline std::ostream& operator<<(std::ostream& os, address_type value)
     }
 }
 
+inline std::ostream& operator<<(std::ostream& os, host_selection_policy value)
+{
+    switch (value)
+    {
+    case host_selection_policy::ordered: return os << "host_selection_policy::ordered";
+    case host_selection_policy::random: return os << "host_selection_policy::random";
+    case host_selection_policy::round_robin: return os << "host_selection_policy::round_robin";
+    default: return os << "<unknown host_selection_policy>";
+    }
+}
+
+inline std::ostream& operator<<(std::ostream& os, binlog_event_type value)
+{
+    return os << "binlog_event_type(" << static_cast<int>(value) << ")";
+}
+
 namespace detail {
 
 inline std::ostream& operator<<(std::ostream& os, capabilities caps)
@@ -76,6 +93,9 @@ inline std::ostream& operator<<(std::ostream& os, next_action::type_t t)
     case next_action::type_t::write: return os << "next_action::type_t::write";
     case next_action::type_t::ssl_handshake: return os << "next_action::type_t::ssl_handshake";
     case next_action::type_t::ssl_shutdown: return os << "next_action::type_t::ssh_shutdown";
+    case next_action::type_t::connect: return os << "next_action::type_t::connect";
+    case next_action::type_t::close: return os << "next_action::type_t::close";
+    case next_action::type_t::decode_rows: return os << "next_action::type_t::decode_rows";
     default: return os << "<unknown>";
     }
 }
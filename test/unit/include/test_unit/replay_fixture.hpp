@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_REPLAY_FIXTURE_HPP
+#define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_REPLAY_FIXTURE_HPP
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/connection_observer.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace test {
+
+// Creates the contents of a capture file with a single read event serving the given bytes,
+// in the format written by wire_capture
+inline std::vector<std::uint8_t> create_read_capture(const std::vector<std::uint8_t>& bytes)
+{
+    const auto append_le = [](std::vector<std::uint8_t>& to, std::uint64_t value, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i)
+            to.push_back(static_cast<std::uint8_t>(value >> (8u * i)));
+    };
+
+    // Header: magic and version
+    std::vector<std::uint8_t> res{'B', 'M', 'Y', 'S', 'Q', 'L', 'W', 'C'};
+    append_le(res, 1u, 4);
+
+    // Event: type, timestamp, payload size and payload
+    res.push_back(static_cast<std::uint8_t>(wire_event::read));
+    append_le(res, 0u, 8);
+    append_le(res, bytes.size(), 4);
+    res.insert(res.end(), bytes.begin(), bytes.end());
+    return res;
+}
+
+// A replay serving the given bytes in a single read event, loaded from memory
+struct replay_fixture
+{
+    wire_replay replay;
+    asio::io_context ctx;
+
+    replay_fixture(const std::vector<std::uint8_t>& bytes)
+    {
+        BOOST_TEST_REQUIRE(replay.load(asio::buffer(create_read_capture(bytes))) == error_code());
+    }
+    replay_fixture(const replay_fixture&) = delete;
+    replay_fixture& operator=(const replay_fixture&) = delete;
+
+    any_connection_params make_params(connection_observer* obs = nullptr)
+    {
+        any_connection_params res;
+        res.replay = &replay;
+        res.observer = obs;
+        return res;
+    }
+};
+
+}  // namespace test
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -46,11 +46,16 @@ static std::vector<std::uint8_t> serialize_ok_impl(const ok_view& pack, std::uin
         pack.status_flags,
         pack.warnings
     );
-    // When info is empty, it's actually omitted in the ok_packet
-    if (!pack.info.empty())
+    // When info is empty, it's actually omitted in the ok_packet,
+    // unless session state information follows
+    if (!pack.info.empty() || !pack.session_state.empty())
     {
         serialize_to_vector_inplace(res, string_lenenc{pack.info});
     }
+    if (!pack.session_state.empty())
+    {
+        serialize_to_vector_inplace(res, string_lenenc{pack.session_state});
+    }
     return res;
 }
 
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "test_unit/printing.hpp"
 
@@ -185,6 +186,126 @@ BOOST_AUTO_TEST_CASE(emplace_unix_path)
     BOOST_TEST(addr.unix_socket_path() == "/var/blah");
 }
 
+BOOST_AUTO_TEST_CASE(emplace_host_list)
+{
+    // Changing type
+    any_address addr{unix_path{"/var/sock"}};
+    addr.emplace_host_list(
+        {make_hport("host1", 2000), make_hport("host2", 2001), make_hport("host3", 2002)},
+        host_selection_policy::round_robin
+    );
+    BOOST_TEST(addr.type() == address_type::host_and_port);
+    BOOST_TEST(addr.hostname() == "host1");
+    BOOST_TEST(addr.port() == (unsigned short)2000);
+    BOOST_TEST_REQUIRE(addr.fallback_hosts().size() == 2u);
+    BOOST_TEST(addr.fallback_hosts()[0].host == "host2");
+    BOOST_TEST(addr.fallback_hosts()[0].port == (unsigned short)2001);
+    BOOST_TEST(addr.fallback_hosts()[1].host == "host3");
+    BOOST_TEST(addr.fallback_hosts()[1].port == (unsigned short)2002);
+    BOOST_TEST(addr.selection_policy() == host_selection_policy::round_robin);
+
+    // A single host with the default policy
+    addr.emplace_host_list({make_hport("host4", 2003)});
+    BOOST_TEST(addr.hostname() == "host4");
+    BOOST_TEST(addr.port() == (unsigned short)2003);
+    BOOST_TEST(addr.fallback_hosts().empty());
+    BOOST_TEST(addr.selection_policy() == host_selection_policy::ordered);
+}
+
+BOOST_AUTO_TEST_CASE(emplace_clears_host_list)
+{
+    // emplace_host_and_port
+    any_address addr;
+    addr.emplace_host_list(
+        {make_hport("host1", 2000), make_hport("host2", 2001)},
+        host_selection_policy::random
+    );
+    addr.emplace_host_and_port("abcd", 2000);
+    BOOST_TEST(addr.fallback_hosts().empty());
+    BOOST_TEST(addr.selection_policy() == host_selection_policy::ordered);
+
+    // emplace_unix_path
+    addr.emplace_host_list(
+        {make_hport("host1", 2000), make_hport("host2", 2001)},
+        host_selection_policy::random
+    );
+    addr.emplace_unix_path("/var/sock");
+    BOOST_TEST(addr.type() == address_type::unix_path);
+    BOOST_TEST(addr.selection_policy() == host_selection_policy::ordered);
+}
+
+BOOST_AUTO_TEST_CASE(copy_ctor_host_list)
+{
+    // Setup
+    auto addr = make_address_ptr(any_address());
+    addr->emplace_host_list(
+        {make_hport("host1", 2000), make_hport("host2", 2001)},
+        host_selection_policy::random
+    );
+
+    // Construct
+    any_address addr2(*addr);
+    addr.reset();  // lifetime check
+
+    // Check
+    BOOST_TEST(addr2.hostname() == "host1");
+    BOOST_TEST_REQUIRE(addr2.fallback_hosts().size() == 1u);
+    BOOST_TEST(addr2.fallback_hosts()[0].host == "host2");
+    BOOST_TEST(addr2.selection_policy() == host_selection_policy::random);
+}
+
+BOOST_AUTO_TEST_CASE(operator_eq_ne_host_list)
+{
+    auto make_list = [](std::vector<host_and_port> hosts, host_selection_policy policy) {
+        any_address res;
+        res.emplace_host_list(std::move(hosts), policy);
+        return res;
+    };
+    constexpr auto ordered = host_selection_policy::ordered;
+    constexpr auto random = host_selection_policy::random;
+
+    struct
+    {
+        const char* name;
+        any_address addr1;
+        any_address addr2;
+        bool equals;
+    } test_cases[] = {
+        {"eq",
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, random),
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, random),
+         true},
+        {"eq_single_host", make_list({make_hport("h1", 1)}, ordered), make_hport("h1", 1), true},
+        {"ne_policy",
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, random),
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, ordered),
+         false},
+        {"ne_fallback_host",
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, ordered),
+         make_list({make_hport("h1", 1), make_hport("h3", 2)}, ordered),
+         false},
+        {"ne_fallback_port",
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, ordered),
+         make_list({make_hport("h1", 1), make_hport("h2", 3)}, ordered),
+         false},
+        {"ne_size",
+         make_list({make_hport("h1", 1), make_hport("h2", 2)}, ordered),
+         make_list({make_hport("h1", 1)}, ordered),
+         false},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            BOOST_TEST((tc.addr1 == tc.addr2) == tc.equals);
+            BOOST_TEST((tc.addr2 == tc.addr1) == tc.equals);
+            BOOST_TEST((tc.addr1 != tc.addr2) == !tc.equals);
+            BOOST_TEST((tc.addr2 != tc.addr1) == !tc.equals);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(operator_eq_ne)
 {
     // For regression check: UNIX socket paths should compare equal
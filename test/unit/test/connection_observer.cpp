@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/connection_observer.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/replay_fixture.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+namespace asio = boost::asio;
+
+BOOST_AUTO_TEST_SUITE(test_connection_observer)
+
+// Records all received notifications
+struct recording_observer final : connection_observer
+{
+    std::vector<std::string> events;
+    std::size_t num_rows{};
+    std::size_t bytes_read{};
+    std::size_t bytes_written{};
+    std::size_t last_buffer_size{};
+
+    void on_operation_start(operation_type op) override
+    {
+        events.push_back("op_start " + std::to_string(static_cast<int>(op)));
+    }
+    void on_operation_finish(operation_type op, error_code ec) override
+    {
+        events.push_back("op_finish " + std::to_string(static_cast<int>(op)) + " " + (ec ? "error" : "ok"));
+    }
+    void on_io_start(wire_event type) override
+    {
+        events.push_back("io_start " + std::to_string(static_cast<int>(type)));
+    }
+    void on_io_finish(wire_event type, error_code ec, std::size_t bytes_transferred) override
+    {
+        events.push_back("io_finish " + std::to_string(static_cast<int>(type)) + " " + (ec ? "error" : "ok"));
+        if (type == wire_event::read)
+            bytes_read += bytes_transferred;
+        else if (type == wire_event::write)
+            bytes_written += bytes_transferred;
+    }
+    void on_rows_read(std::size_t n) override
+    {
+        events.push_back("rows " + std::to_string(n));
+        num_rows += n;
+    }
+    void on_read_buffer_growth(std::size_t new_size) override { last_buffer_size = new_size; }
+};
+
+static std::string op_start(operation_type op) { return "op_start " + std::to_string(static_cast<int>(op)); }
+static std::string op_finish(operation_type op, bool ok = true)
+{
+    return "op_finish " + std::to_string(static_cast<int>(op)) + (ok ? " ok" : " error");
+}
+static std::string io_start(wire_event t) { return "io_start " + std::to_string(static_cast<int>(t)); }
+static std::string io_finish(wire_event t, bool ok = true)
+{
+    return "io_finish " + std::to_string(static_cast<int>(t)) + (ok ? " ok" : " error");
+}
+
+BOOST_AUTO_TEST_CASE(ping)
+{
+    const auto response = create_ok_frame(1, ok_builder().build());
+    replay_fixture fix(response);
+    recording_observer obs;
+    auto& ctx = fix.ctx;
+    any_connection conn(ctx, fix.make_params(&obs));
+
+    // Sync
+    conn.ping();
+    const std::vector<std::string> expected{
+        op_start(operation_type::ping),
+        io_start(wire_event::write),
+        io_finish(wire_event::write),
+        io_start(wire_event::read),
+        io_finish(wire_event::read),
+        op_finish(operation_type::ping),
+    };
+    BOOST_TEST(obs.events == expected);
+    BOOST_TEST(obs.bytes_written == 5u);
+    BOOST_TEST(obs.bytes_read == response.size());
+
+    // Async
+    obs.events.clear();
+    fix.replay.rewind();
+    error_code ec = client_errc::wrong_num_params;
+    conn.async_ping([&](error_code err) { ec = err; });
+    ctx.run();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(obs.events == expected);
+
+    // Errors are reported
+    obs.events.clear();
+    ctx.restart();
+    conn.async_ping([&](error_code err) { ec = err; });
+    ctx.run();
+    BOOST_TEST(ec == error_code(asio::error::eof));
+    const std::vector<std::string> expected_err{
+        op_start(operation_type::ping),
+        io_start(wire_event::write),
+        io_finish(wire_event::write),
+        io_start(wire_event::read),
+        io_finish(wire_event::read, false),
+        op_finish(operation_type::ping, false),
+    };
+    BOOST_TEST(obs.events == expected_err);
+}
+
+BOOST_AUTO_TEST_CASE(execute_rows)
+{
+    const auto coldef = meta_builder().type(column_type::varchar).build_coldef();
+    const auto bytes = buffer_builder()
+                           .add(create_frame(1, {0x01}))  // 1 column
+                           .add(create_coldef_frame(2, coldef))
+                           .add(create_text_row_message(3, "abc"))
+                           .add(create_text_row_message(4, "defghi"))
+                           .add(create_eof_frame(5, ok_builder().build()))
+                           .build();
+    replay_fixture fix(bytes);
+    recording_observer obs;
+    auto& ctx = fix.ctx;
+    auto params = fix.make_params(&obs);
+    params.initial_read_buffer_size = 8u;  // forces the buffer to grow
+    any_connection conn(ctx, params);
+
+    results r;
+    conn.execute("SELECT 1", r);
+    BOOST_TEST(r.rows().size() == 2u);
+
+    BOOST_TEST_REQUIRE(obs.events.size() >= 2u);
+    BOOST_TEST(obs.events.front() == op_start(operation_type::execute));
+    BOOST_TEST(obs.events.back() == op_finish(operation_type::execute));
+    BOOST_TEST(obs.num_rows == 2u);
+    BOOST_TEST(obs.bytes_read == bytes.size());
+    BOOST_TEST(obs.last_buffer_size > 8u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
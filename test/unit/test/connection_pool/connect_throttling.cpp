@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/impl/internal/connection_pool/connect_throttling.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+
+using namespace boost::mysql::detail;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+BOOST_AUTO_TEST_SUITE(test_connect_throttling)
+
+BOOST_AUTO_TEST_SUITE(compute_retry_interval_)
+
+BOOST_AUTO_TEST_CASE(backoff)
+{
+    // Intervals are doubled after each failure, without exceeding the maximum
+    std::minstd_rand rng;
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(10), false, 1, rng) == seconds(2)));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(10), false, 2, rng) == seconds(4)));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(10), false, 3, rng) == seconds(8)));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(10), false, 4, rng) == seconds(10)));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(10), false, 5, rng) == seconds(10)));
+}
+
+BOOST_AUTO_TEST_CASE(backoff_big_num_failures)
+{
+    // Doesn't overflow
+    std::minstd_rand rng;
+    auto max = (steady_clock::duration::max)();
+    BOOST_TEST((compute_retry_interval(seconds(2), max, false, 200, rng) == max));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(10), false, 10000, rng) == seconds(10)));
+}
+
+BOOST_AUTO_TEST_CASE(no_backoff)
+{
+    // If max_retry_interval is not greater than retry_interval, the interval stays constant
+    std::minstd_rand rng;
+    BOOST_TEST((compute_retry_interval(seconds(2), steady_clock::duration(), false, 1, rng) == seconds(2)));
+    BOOST_TEST((compute_retry_interval(seconds(2), steady_clock::duration(), false, 5, rng) == seconds(2)));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(2), false, 5, rng) == seconds(2)));
+    BOOST_TEST((compute_retry_interval(seconds(2), seconds(1), false, 5, rng) == seconds(2)));
+}
+
+BOOST_AUTO_TEST_CASE(jitter)
+{
+    // Jittered intervals lie in [interval/2, interval]
+    std::minstd_rand rng;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        auto res = compute_retry_interval(seconds(2), seconds(10), true, 3, rng);
+        BOOST_TEST((res >= seconds(4) && res <= seconds(8)));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(connect_limiter_)
+
+BOOST_AUTO_TEST_CASE(no_limits)
+{
+    connect_limiter limiter(0, steady_clock::duration());
+    steady_clock::time_point t0;
+
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(limiter.num_in_progress() == 3u);
+}
+
+BOOST_AUTO_TEST_CASE(max_concurrent)
+{
+    connect_limiter limiter(2, steady_clock::duration());
+    steady_clock::time_point t0;
+
+    // Two attempts may be in progress at a time
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(!limiter.try_acquire(t0));
+    BOOST_TEST((limiter.retry_time() == (steady_clock::time_point::max)()));
+
+    // Finishing an attempt lets another one proceed
+    limiter.release();
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(limiter.num_in_progress() == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(min_interval)
+{
+    connect_limiter limiter(0, seconds(1));
+    steady_clock::time_point t0;
+
+    // Attempts must be spaced by at least min_interval
+    BOOST_TEST(limiter.try_acquire(t0));
+    BOOST_TEST(!limiter.try_acquire(t0));
+    BOOST_TEST(!limiter.try_acquire(t0 + std::chrono::milliseconds(999)));
+    BOOST_TEST((limiter.retry_time() == t0 + seconds(1)));
+
+    // Releasing doesn't affect the interval
+    limiter.release();
+    BOOST_TEST(!limiter.try_acquire(t0));
+
+    // Once the interval ellapses, another attempt may proceed
+    BOOST_TEST(limiter.try_acquire(t0 + seconds(1)));
+    BOOST_TEST((limiter.retry_time() == t0 + seconds(2)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
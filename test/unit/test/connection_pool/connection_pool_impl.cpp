@@ -12,7 +12,10 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/request_priority.hpp>
+#include <boost/mysql/results.hpp>
 #include <boost/mysql/ssl_mode.hpp>
+#include <boost/mysql/statement.hpp>
 
 #include <boost/mysql/impl/internal/connection_pool/connection_node.hpp>
 #include <boost/mysql/impl/internal/connection_pool/connection_pool_impl.hpp>
@@ -29,6 +32,7 @@
 #include <boost/asio/cancellation_type.hpp>
 #include <boost/asio/compose.hpp>
 #include <boost/asio/coroutine.hpp>
+#include <boost/asio/deferred.hpp>
 #include <boost/asio/detached.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/execution_context.hpp>
@@ -41,13 +45,17 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "test_common/create_diagnostics.hpp"
 #include "test_common/printing.hpp"
 #include "test_common/tracker_executor.hpp"
+#include "test_unit/create_statement.hpp"
 #include "test_unit/pool_printing.hpp"
 
 using namespace boost::mysql::detail;
@@ -60,6 +68,7 @@ using boost::mysql::diagnostics;
 using boost::mysql::error_code;
 using boost::mysql::pool_params;
 using boost::mysql::pooled_connection;
+using boost::mysql::request_priority;
 using std::chrono::steady_clock;
 
 /**
@@ -245,6 +254,8 @@ public:
 
     std::size_t cancel() { return svc_->cancel(timer_id_); }
 
+    steady_clock::time_point current_time() const noexcept { return svc_->current_time(); }
+
     template <class CompletionToken>
     auto async_wait(CompletionToken&& token)
         -> decltype(asio::async_initiate<CompletionToken, void(error_code)>(
@@ -262,6 +273,8 @@ enum fn_type
     connect,
     reset,
     ping,
+    prepare_statements,
+    sample_replication_lag,
 };
 
 // A mock for mysql::any_connection. This allows us to control
@@ -367,6 +380,9 @@ class mock_connection
 public:
     boost::mysql::any_connection_params ctor_params;
     boost::mysql::connect_params last_connect_params;
+    std::vector<std::string> last_statements;
+    bool session_changed{true};
+    std::int64_t next_replication_lag{0};
 
     mock_connection(asio::any_io_executor ex, boost::mysql::any_connection_params ctor_params)
         : to_test_chan_(ex), from_test_chan_(std::move(ex)), ctor_params(ctor_params)
@@ -389,6 +405,8 @@ public:
         return op_impl(fn_type::ping, nullptr, std::forward<CompletionToken>(token));
     }
 
+    bool session_state_changed() const noexcept { return session_changed; }
+
     template <class CompletionToken>
     auto async_reset_connection(CompletionToken&& token)
         -> decltype(op_impl(fn_type::reset, nullptr, std::forward<CompletionToken>(token)))
@@ -396,6 +414,30 @@ public:
         return op_impl(fn_type::reset, nullptr, std::forward<CompletionToken>(token));
     }
 
+    // Called by the free function async_prepare_statements
+    template <class CompletionToken>
+    auto async_prepare_statements(
+        const std::vector<std::string>& stmts_sql,
+        boost::mysql::statement* output,
+        diagnostics& diag,
+        CompletionToken&& token
+    ) -> decltype(op_impl(fn_type::prepare_statements, &diag, std::forward<CompletionToken>(token)))
+    {
+        last_statements = stmts_sql;
+        for (std::size_t i = 0; i < stmts_sql.size(); ++i)
+            output[i] = statement_builder().id(static_cast<std::uint32_t>(i + 1)).build();
+        return op_impl(fn_type::prepare_statements, &diag, std::forward<CompletionToken>(token));
+    }
+
+    // Called by the free function async_sample_replication_lag
+    template <class CompletionToken>
+    auto async_sample_replication_lag(std::int64_t& lag, CompletionToken&& token)
+        -> decltype(op_impl(fn_type::sample_replication_lag, nullptr, std::forward<CompletionToken>(token)))
+    {
+        lag = next_replication_lag;
+        return op_impl(fn_type::sample_replication_lag, nullptr, std::forward<CompletionToken>(token));
+    }
+
     void step(
         fn_type expected_op_type,
         asio::any_completion_handler<void()> handler,
@@ -411,11 +453,37 @@ public:
     }
 };
 
+// The connection node invokes this function unqualified
+template <class CompletionToken>
+auto async_prepare_statements(
+    mock_connection& conn,
+    const std::vector<std::string>& stmts_sql,
+    boost::mysql::statement* output,
+    diagnostics& diag,
+    CompletionToken&& token
+) -> decltype(conn.async_prepare_statements(stmts_sql, output, diag, std::forward<CompletionToken>(token)))
+{
+    return conn.async_prepare_statements(stmts_sql, output, diag, std::forward<CompletionToken>(token));
+}
+
+template <class CompletionToken>
+auto async_sample_replication_lag(
+    mock_connection& conn,
+    boost::mysql::results&,
+    std::int64_t& lag,
+    CompletionToken&& token
+) -> decltype(conn.async_sample_replication_lag(lag, std::forward<CompletionToken>(token)))
+{
+    return conn.async_sample_replication_lag(lag, std::forward<CompletionToken>(token));
+}
+
 // Mock for io_traits
 struct mock_io_traits
 {
     using connection_type = mock_connection;
     using timer_type = mock_timer;
+
+    static steady_clock::time_point now(const mock_timer& t) noexcept { return t.current_time(); }
 };
 
 struct mock_pooled_connection;
@@ -487,13 +555,19 @@ class get_connection_task
 public:
     get_connection_task() = default;
 
-    get_connection_task(mock_pool& pool, diagnostics* diag, std::chrono::steady_clock::duration timeout)
+    get_connection_task(
+        mock_pool& pool,
+        diagnostics* diag,
+        std::chrono::steady_clock::duration timeout,
+        request_priority priority
+    )
         : impl_(std::make_shared<impl_t>(pool))
     {
         auto ex = create_tracker_executor(pool.get_executor(), &impl_->exec_info);
         auto impl = impl_;
         pool.async_get_connection(
             asio::use_service<mock_timer_service>(ex.context()).current_time() + timeout,
+            priority,
             diag,
             asio::bind_executor(
                 ex,
@@ -540,10 +614,11 @@ protected:
     std::size_t num_pending_requests() const noexcept { return pool_.shared_state().pending_requests.size(); }
     get_connection_task create_task(
         diagnostics* diag = nullptr,
-        steady_clock::duration timeout = std::chrono::seconds(5)
+        steady_clock::duration timeout = std::chrono::seconds(5),
+        request_priority priority = request_priority::normal
     )
     {
-        return get_connection_task(pool_, diag, timeout);
+        return get_connection_task(pool_, diag, timeout, priority);
     }
 
     void check_shared_st(
@@ -746,6 +821,170 @@ BOOST_AUTO_TEST_CASE(lifecycle_connect_timeout)
     pool_test<op>(std::move(params));
 }
 
+BOOST_AUTO_TEST_CASE(lifecycle_connect_backoff)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Connect fails. We sleep for retry_interval
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::connect,
+                    common_server_errc::er_aborting_connection
+                );
+                wait_for_status(node, connection_status::sleep_connect_failed_in_progress);
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                wait_for_status(node, connection_status::connect_in_progress);
+
+                // Connect fails again. The interval is doubled
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::connect,
+                    common_server_errc::er_aborting_connection
+                );
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                wait_for_status(node, connection_status::sleep_connect_failed_in_progress);
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                wait_for_status(node, connection_status::connect_in_progress);
+
+                // The interval doesn't exceed max_retry_interval
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::connect,
+                    common_server_errc::er_aborting_connection
+                );
+                get_timer_service().advance_time_by(std::chrono::seconds(4));
+                wait_for_status(node, connection_status::sleep_connect_failed_in_progress);
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                wait_for_status(node, connection_status::connect_in_progress);
+
+                // Connect succeeds. Metrics were updated
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                BOOST_TEST(pool_.shared_state().num_connect_attempts == 4u);
+                BOOST_TEST(pool_.shared_state().num_connect_failures == 3u);
+                BOOST_TEST(pool_.shared_state().num_throttled_connects == 0u);
+
+                // Once the connection becomes idle, the interval is reset.
+                // A failed reset triggers a reconnection
+                node.mark_as_in_use();
+                node.mark_as_collectable(true);
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::reset,
+                    common_server_errc::er_aborting_connection
+                );
+                wait_for_status(node, connection_status::connect_in_progress);
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::connect,
+                    common_server_errc::er_aborting_connection
+                );
+                wait_for_status(node, connection_status::sleep_connect_failed_in_progress);
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                wait_for_status(node, connection_status::connect_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+            }
+        }
+    };
+
+    pool_params params;
+    params.retry_interval = std::chrono::seconds(2);
+    params.max_retry_interval = std::chrono::seconds(5);
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(lifecycle_connect_max_concurrent)
+{
+    // 2 connection nodes are created from the beginning
+    struct op : pool_test_op<op, 2>
+    {
+        using pool_test_op<op, 2>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node1 = pool_.nodes().front();
+            auto& node2 = pool_.nodes().back();
+            const auto& st = pool_.shared_state();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Only one of the connections is allowed to connect
+                poll();
+                BOOST_TEST(st.limiter.num_in_progress() == 1u);
+                BOOST_TEST(st.num_connect_attempts == 1u);
+                BOOST_TEST(st.num_throttled_connects == 1u);
+
+                // Once it finishes, the other one can proceed
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect);
+                wait_for_status(node1, connection_status::idle);
+                BOOST_TEST(st.num_connect_attempts == 2u);
+                BOOST_ASIO_CORO_YIELD step(node2, fn_type::connect);
+                wait_for_status(node2, connection_status::idle);
+                BOOST_TEST(st.limiter.num_in_progress() == 0u);
+                BOOST_TEST(st.num_throttled_connects == 1u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.initial_size = 2;
+    params.max_concurrent_connects = 1;
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(lifecycle_connect_min_interval)
+{
+    // 2 connection nodes are created from the beginning
+    struct op : pool_test_op<op, 2>
+    {
+        using pool_test_op<op, 2>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node1 = pool_.nodes().front();
+            auto& node2 = pool_.nodes().back();
+            const auto& st = pool_.shared_state();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // The first connection connects, the second one needs to wait
+                poll();
+                BOOST_TEST(st.num_connect_attempts == 1u);
+                BOOST_TEST(st.num_throttled_connects == 1u);
+
+                // Finishing a connect doesn't make the interval ellapse
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect);
+                wait_for_status(node1, connection_status::idle);
+                BOOST_TEST(st.num_connect_attempts == 1u);
+
+                // After the interval ellapses, the second connection connects
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                poll();
+                BOOST_TEST(st.num_connect_attempts == 2u);
+                BOOST_ASIO_CORO_YIELD step(node2, fn_type::connect);
+                wait_for_status(node2, connection_status::idle);
+            }
+        }
+    };
+
+    pool_params params;
+    params.initial_size = 2;
+    params.min_connect_interval = std::chrono::seconds(1);
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(lifecycle_return_without_reset)
 {
     struct op : pool_test_op<op>
@@ -815,6 +1054,49 @@ BOOST_AUTO_TEST_CASE(lifecycle_reset_success)
     pool_test<op>(pool_params{});
 }
 
+BOOST_AUTO_TEST_CASE(lifecycle_reset_skipped)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Wait until a connection is successfully connected, then pick it up
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                node.mark_as_in_use();
+
+                // Simulate a user returning the connection (with reset) without modifying the session
+                node.connection().session_changed = false;
+                node.mark_as_collectable(true);
+
+                // The reset is skipped and the connection goes back to idle
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+
+                // If the session was modified, a reset is issued
+                node.mark_as_in_use();
+                node.connection().session_changed = true;
+                node.mark_as_collectable(true);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::reset);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+            }
+        }
+    };
+
+    pool_params params;
+    params.skip_unneeded_resets = true;
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(lifecycle_reset_error)
 {
     struct op : pool_test_op<op>
@@ -928,6 +1210,64 @@ BOOST_AUTO_TEST_CASE(lifecycle_reset_timeout_disabled)
     pool_test<op>(std::move(params));
 }
 
+BOOST_AUTO_TEST_CASE(lifecycle_statements)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        static diagnostics expected_diag() { return create_server_diag("Bad statement"); }
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // After connecting, statements are prepared
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::prepare_statements_in_progress);
+                check_shared_st(error_code(), diagnostics(), 1, 0);
+                BOOST_TEST(node.connection().last_statements.size() == 2u);
+                BOOST_TEST(node.connection().last_statements.at(1) == "SELECT 2");
+
+                // Preparing fails. This is handled like a connection error
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::prepare_statements,
+                    common_server_errc::er_no_such_table,
+                    expected_diag()
+                );
+                wait_for_status(node, connection_status::sleep_connect_failed_in_progress);
+                check_shared_st(common_server_errc::er_no_such_table, expected_diag(), 1, 0);
+
+                // Retry
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::prepare_statements);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+                BOOST_TEST(node.get_statement(0).id() == 1u);
+                BOOST_TEST(node.get_statement(1).id() == 2u);
+
+                // Resetting the connection deallocates statements, so they're prepared again
+                node.mark_as_in_use();
+                node.mark_as_collectable(true);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::reset);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::prepare_statements);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+            }
+        }
+    };
+
+    pool_params params;
+    params.retry_interval = std::chrono::seconds(2);
+    params.statements = {"SELECT 1", "SELECT 2"};
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(lifecycle_ping_success)
 {
     struct op : pool_test_op<op>
@@ -963,6 +1303,104 @@ BOOST_AUTO_TEST_CASE(lifecycle_ping_success)
     pool_test<op>(std::move(params));
 }
 
+BOOST_AUTO_TEST_CASE(lifecycle_ping_replication_lag)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Replication lag is not known until the first health check
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                BOOST_TEST(!pool_.stats().replication_lag.has_value());
+
+                // Health checks measure replication lag instead of pinging
+                node.connection().next_replication_lag = 5;
+                get_timer_service().advance_time_by(std::chrono::seconds(100));
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::sample_replication_lag);
+                wait_for_status(node, connection_status::idle);
+                BOOST_TEST((pool_.stats().replication_lag == std::chrono::seconds(5)));
+
+                // Replication stopped
+                node.connection().next_replication_lag = detail::replication_lag_stopped;
+                get_timer_service().advance_time_by(std::chrono::seconds(100));
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::sample_replication_lag);
+                wait_for_status(node, connection_status::idle);
+                BOOST_TEST((pool_.stats().replication_lag == (std::chrono::seconds::max)()));
+
+                // Ping errors trigger a reconnection. The last measurement is kept
+                node.connection().next_replication_lag = 10;
+                get_timer_service().advance_time_by(std::chrono::seconds(100));
+                BOOST_ASIO_CORO_YIELD step(
+                    node,
+                    fn_type::sample_replication_lag,
+                    common_server_errc::er_aborting_connection
+                );
+                wait_for_status(node, connection_status::connect_in_progress);
+                BOOST_TEST((pool_.stats().replication_lag == (std::chrono::seconds::max)()));
+            }
+        }
+    };
+
+    pool_params params;
+    params.ping_interval = std::chrono::seconds(100);
+    params.measure_replication_lag = true;
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(lifecycle_ping_replication_lag_busy)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // The first sample is taken as soon as a connection is idle
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                node.connection().next_replication_lag = 5;
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::sample_replication_lag);
+                wait_for_status(node, connection_status::idle);
+                BOOST_TEST((pool_.stats().replication_lag == std::chrono::seconds(5)));
+
+                // The connection is used for longer than the ping interval
+                node.mark_as_in_use();
+                get_timer_service().advance_time_by(std::chrono::seconds(150));
+                wait_for_status(node, connection_status::in_use);
+
+                // When it's returned, the overdue sample is taken without waiting
+                // for the connection to be idle for a whole ping interval
+                node.mark_as_collectable(false);
+                wait_for_status(node, connection_status::idle);
+                node.connection().next_replication_lag = 7;
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::sample_replication_lag);
+                wait_for_status(node, connection_status::idle);
+                BOOST_TEST((pool_.stats().replication_lag == std::chrono::seconds(7)));
+            }
+        }
+    };
+
+    pool_params params;
+    params.ping_interval = std::chrono::seconds(100);
+    params.measure_replication_lag = true;
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(lifecycle_ping_error)
 {
     struct op : pool_test_op<op>
@@ -1267,6 +1705,183 @@ BOOST_AUTO_TEST_CASE(get_connection_wait_timeout_with_diag_nullptr)
     pool_test<op>(pool_params{});
 }
 
+BOOST_AUTO_TEST_CASE(get_connection_circuit_breaker)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+        get_connection_task task;
+        std::unique_ptr<diagnostics> diag{new diagnostics()};
+
+        static diagnostics expected_diag() { return create_server_diag("Bad db"); }
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // A request for a connection is issued, and it needs to wait
+                task = create_task(diag.get());
+                wait_for_num_requests(1);
+
+                // A single connect failure doesn't trip the circuit breaker
+                BOOST_ASIO_CORO_YIELD
+                step(node, fn_type::connect, common_server_errc::er_bad_db_error, expected_diag());
+                wait_for_num_requests(1);
+
+                // After the second failure, waiting requests fail immediately
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                BOOST_ASIO_CORO_YIELD
+                step(node, fn_type::connect, common_server_errc::er_bad_db_error, expected_diag());
+                BOOST_ASIO_CORO_YIELD wait_for_task(task, common_server_errc::er_bad_db_error);
+                BOOST_TEST(*diag == expected_diag());
+                BOOST_TEST(num_pending_requests() == 0u);
+
+                // So do new ones, without waiting for their timeout
+                task = create_task(diag.get());
+                BOOST_ASIO_CORO_YIELD wait_for_task(task, common_server_errc::er_bad_db_error);
+                BOOST_TEST(*diag == expected_diag());
+                BOOST_TEST(pool_.stats().fast_failed_requests == 2u);
+
+                // Once a connect succeeds, requests are served normally
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node);
+                BOOST_TEST(pool_.stats().fast_failed_requests == 2u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.retry_interval = std::chrono::seconds(2);
+    params.circuit_breaker_threshold = 2;
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(get_connection_circuit_breaker_probe)
+{
+    // 2 connection nodes are created from the beginning
+    struct op : pool_test_op<op, 2>
+    {
+        using pool_test_op<op, 2>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node1 = pool_.nodes().front();
+            auto& node2 = pool_.nodes().back();
+            const auto& st = pool_.shared_state();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Both connections fail, at different times. The circuit breaker trips
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect, common_server_errc::er_bad_db_error);
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD step(node2, fn_type::connect, common_server_errc::er_bad_db_error);
+                BOOST_TEST(st.circuit_open());
+
+                // The first connection wakes up and performs a probe
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                wait_for_status(node1, connection_status::connect_in_progress);
+                BOOST_TEST(st.num_connect_attempts == 3u);
+
+                // The second one can't connect while the probe is in progress
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                wait_for_status(node2, connection_status::connect_in_progress);
+                BOOST_TEST(st.num_connect_attempts == 3u);
+                BOOST_TEST(st.num_throttled_connects == 1u);
+
+                // The probe fails. The second connection still waits
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect, common_server_errc::er_bad_db_error);
+                wait_for_status(node1, connection_status::sleep_connect_failed_in_progress);
+                BOOST_TEST(st.num_connect_attempts == 3u);
+
+                // Another probe is performed after the retry interval. It succeeds,
+                // so the second connection is allowed to connect
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect);
+                wait_for_status(node1, connection_status::idle);
+                BOOST_TEST(!st.circuit_open());
+                BOOST_ASIO_CORO_YIELD step(node2, fn_type::connect);
+                wait_for_status(node2, connection_status::idle);
+                BOOST_TEST(st.num_connect_attempts == 5u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.initial_size = 2;
+    params.retry_interval = std::chrono::seconds(2);
+    params.circuit_breaker_threshold = 1;
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(get_connection_outstanding_requests)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+        get_connection_task task;
+
+        void check_stats(std::size_t expected_in_use, std::size_t expected_pending)
+        {
+            auto stats = pool_.stats();
+            BOOST_TEST(stats.in_use_connections == expected_in_use);
+            BOOST_TEST(stats.pending_requests == expected_pending);
+        }
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // A request waits until the connection is ready
+                task = create_task();
+                wait_for_num_requests(1);
+                check_stats(0, 1);
+
+                // The connection is handed to the user
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task, node);
+                check_stats(1, 0);
+
+                // Once returned, the connection is no longer in use
+                node.mark_as_collectable(false);
+                wait_for_status(node, connection_status::idle);
+                check_stats(0, 0);
+
+                // Requests that fail are no longer outstanding
+                task = create_task(nullptr, std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD wait_for_task(task, node);
+                task = create_task(nullptr, std::chrono::seconds(1));
+                wait_for_num_requests(1);
+                check_stats(1, 1);
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD wait_for_task(task, client_errc::timeout);
+                check_stats(1, 0);
+
+                // Deferred requests that are never started are not outstanding
+                pool_.async_get_connection(
+                    get_timer_service().current_time() + std::chrono::seconds(1),
+                    request_priority::normal,
+                    nullptr,
+                    asio::deferred
+                );
+                check_stats(1, 0);
+            }
+        }
+    };
+
+    pool_params params;
+    params.max_size = 1;
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(get_connection_immediate_completion)
 {
     struct op : pool_test_op<op>
@@ -1365,9 +1980,6 @@ BOOST_AUTO_TEST_CASE(get_connection_multiple_requests)
                 // Issue some parallel requests
                 task1 = create_task();
                 task2 = create_task();
-                task3 = create_task();
-                task4 = create_task(nullptr, std::chrono::seconds(2));
-                task5 = create_task();
 
                 // Two connections can be created. These fulfill two requests
                 node1 = &pool_.nodes().front();
@@ -1377,6 +1989,12 @@ BOOST_AUTO_TEST_CASE(get_connection_multiple_requests)
                 BOOST_ASIO_CORO_YIELD wait_for_task(task1, *node1);
                 BOOST_ASIO_CORO_YIELD wait_for_task(task2, *node2);
 
+                // More requests are issued while all connections are in use
+                task3 = create_task();
+                task4 = create_task(nullptr, std::chrono::seconds(2));
+                task5 = create_task();
+                wait_for_num_requests(3);
+
                 // Time ellapses and task4 times out
                 get_timer_service().advance_time_by(std::chrono::seconds(2));
                 BOOST_ASIO_CORO_YIELD wait_for_task(task4, client_errc::timeout);
@@ -1404,6 +2022,101 @@ BOOST_AUTO_TEST_CASE(get_connection_multiple_requests)
     pool_test<op>(std::move(params));
 }
 
+BOOST_AUTO_TEST_CASE(get_connection_priority)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+        get_connection_task task_low, task_normal_late, task_normal_early, task_high;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Get the only connection
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node);
+
+                // Requests with different priorities and deadlines wait
+                task_low = create_task(nullptr, std::chrono::seconds(5), request_priority::low);
+                task_normal_late = create_task(nullptr, std::chrono::seconds(10));
+                task_normal_early = create_task(nullptr, std::chrono::seconds(5));
+                task_high = create_task(nullptr, std::chrono::seconds(10), request_priority::high);
+                wait_for_num_requests(4);
+
+                // Requests are served by priority, then by deadline
+                node.mark_as_collectable(false);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task_high, node);
+                node.mark_as_collectable(false);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task_normal_early, node);
+                node.mark_as_collectable(false);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task_normal_late, node);
+                node.mark_as_collectable(false);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task_low, node);
+                BOOST_TEST(num_pending_requests() == 0u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.max_size = 1;
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(get_connection_queue_full)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+        get_connection_task task1, task2, task3;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Get the only connection
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node);
+
+                // Fill the queue
+                task1 = create_task();
+                task2 = create_task();
+                wait_for_num_requests(2);
+
+                // Requests that would be served last are rejected immediately
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), client_errc::pool_queue_full);
+                BOOST_TEST(num_pending_requests() == 2u);
+
+                // A higher priority request makes the last queued request be rejected instead
+                task3 = create_task(nullptr, std::chrono::seconds(5), request_priority::high);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task2, client_errc::pool_queue_full);
+                BOOST_TEST(num_pending_requests() == 2u);
+                BOOST_TEST(pool_.stats().rejected_requests == 2u);
+
+                // Queued requests are served normally
+                node.mark_as_collectable(false);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task3, node);
+                node.mark_as_collectable(false);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task1, node);
+                BOOST_TEST(num_pending_requests() == 0u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.max_size = 1;
+    params.max_pending_requests = 2;
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(get_connection_cancel)
 {
     struct op : pool_test_op<op>
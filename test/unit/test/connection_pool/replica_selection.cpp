@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/pool_stats.hpp>
+
+#include <boost/mysql/impl/internal/connection_pool/replica_selection.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using namespace boost::mysql;
+using detail::is_replica_eligible;
+using std::chrono::seconds;
+
+BOOST_AUTO_TEST_SUITE(test_replica_selection)
+
+static pool_stats create_stats(
+    std::size_t in_use,
+    std::size_t pending,
+    boost::optional<seconds> lag = boost::optional<seconds>()
+)
+{
+    pool_stats res;
+    res.in_use_connections = in_use;
+    res.pending_requests = pending;
+    res.replication_lag = lag;
+    return res;
+}
+
+static std::size_t select_replica(const std::vector<pool_stats>& replicas, seconds max_lag = seconds(0))
+{
+    return detail::select_replica(replicas.size(), max_lag, [&replicas](std::size_t i) {
+        return replicas.at(i);
+    });
+}
+
+BOOST_AUTO_TEST_CASE(eligible)
+{
+    // No lag limit
+    BOOST_TEST(is_replica_eligible(create_stats(0, 0, seconds(1000)), seconds(0)));
+
+    // Not measured yet
+    BOOST_TEST(is_replica_eligible(create_stats(0, 0), seconds(10)));
+
+    // Within the limit
+    BOOST_TEST(is_replica_eligible(create_stats(0, 0, seconds(0)), seconds(10)));
+    BOOST_TEST(is_replica_eligible(create_stats(0, 0, seconds(10)), seconds(10)));
+
+    // Limit exceeded
+    BOOST_TEST(!is_replica_eligible(create_stats(0, 0, seconds(11)), seconds(10)));
+    BOOST_TEST(!is_replica_eligible(create_stats(0, 0, (seconds::max)()), seconds(10)));
+
+    // Limits are compared in seconds, without overflowing
+    auto max_lag = (std::chrono::steady_clock::duration::max)();
+    BOOST_TEST(is_replica_eligible(create_stats(0, 0, seconds(1000)), max_lag));
+    BOOST_TEST(!is_replica_eligible(create_stats(0, 0, (seconds::max)()), max_lag));
+}
+
+BOOST_AUTO_TEST_CASE(least_outstanding_requests)
+{
+    // In use connections and pending requests are added together
+    BOOST_TEST(select_replica({create_stats(3, 0), create_stats(1, 1), create_stats(0, 4)}) == 1u);
+    BOOST_TEST(select_replica({create_stats(3, 0), create_stats(1, 3), create_stats(0, 2)}) == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(ties)
+{
+    // The first replica wins
+    BOOST_TEST(select_replica({create_stats(0, 0), create_stats(0, 0)}) == 0u);
+    BOOST_TEST(select_replica({create_stats(2, 0), create_stats(1, 0), create_stats(0, 1)}) == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(lagging_replicas_excluded)
+{
+    // The least loaded replica is lagging
+    std::vector<pool_stats> replicas{
+        create_stats(0, 0, seconds(30)),
+        create_stats(5, 0, seconds(2)),
+        create_stats(8, 0),
+    };
+    BOOST_TEST(select_replica(replicas, seconds(10)) == 1u);
+
+    // Without a limit, lag is ignored
+    BOOST_TEST(select_replica(replicas) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(no_eligible_replica)
+{
+    std::vector<pool_stats> replicas{
+        create_stats(0, 0, seconds(30)),
+        create_stats(0, 0, (seconds::max)()),
+    };
+    BOOST_TEST(select_replica(replicas, seconds(10)) == 2u);
+    BOOST_TEST(select_replica({}) == 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
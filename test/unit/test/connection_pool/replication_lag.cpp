@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/impl/internal/connection_pool/replication_lag.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/replay_fixture.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using detail::parse_replication_lag;
+using detail::replication_lag_stopped;
+using detail::replication_lag_unknown;
+
+BOOST_AUTO_TEST_SUITE(test_replication_lag)
+
+// A subset of the columns returned by SHOW REPLICA STATUS
+static exec_access replica_status(results& r, string_view lag_column = "Seconds_Behind_Source")
+{
+    return exec_access(get_iface(r)).meta({
+        meta_builder().type(column_type::varchar).name("Replica_IO_State").build_coldef(),
+        meta_builder().type(column_type::bigint).name(lag_column).build_coldef(),
+    });
+}
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    results r;
+    replica_status(r).row("Waiting for source to send event", 10).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == 10);
+}
+
+BOOST_AUTO_TEST_CASE(zero)
+{
+    results r;
+    replica_status(r).row("Waiting for source to send event", 0).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(legacy_column_name)
+{
+    // Older servers use Seconds_Behind_Master
+    results r;
+    replica_status(r, "Seconds_Behind_Master").row("", 42).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == 42);
+}
+
+BOOST_AUTO_TEST_CASE(several_channels)
+{
+    // The most lagging channel is used
+    results r;
+    replica_status(r).row("", 4).row("", 20).row("", 7).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == 20);
+}
+
+BOOST_AUTO_TEST_CASE(replication_stopped)
+{
+    // NULL means that replication threads are not running
+    results r;
+    replica_status(r).row("", 4).row("", nullptr).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == replication_lag_stopped);
+}
+
+BOOST_AUTO_TEST_CASE(not_a_replica)
+{
+    // Servers without replication configured return no rows
+    results r;
+    replica_status(r).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == replication_lag_stopped);
+}
+
+BOOST_AUTO_TEST_CASE(column_not_found)
+{
+    results r;
+    replica_status(r, "Other_Column").row("", 4).ok(ok_builder().build());
+    BOOST_TEST(parse_replication_lag(r) == replication_lag_stopped);
+}
+
+// async_sample_replication_lag, against a replayed server
+struct sample_fixture : replay_fixture
+{
+    any_connection conn;
+    results r;
+    std::int64_t lag{0};
+    error_code ec{client_errc::wrong_num_params};
+
+    sample_fixture(const std::vector<std::uint8_t>& bytes) : replay_fixture(bytes), conn(ctx, make_params())
+    {
+    }
+
+    void run()
+    {
+        detail::async_sample_replication_lag(conn, r, lag, [this](error_code err) { ec = err; });
+        ctx.run();
+    }
+};
+
+static std::vector<std::uint8_t> create_server_error(common_server_errc code)
+{
+    return err_builder().seqnum(1).code(code).build_frame();
+}
+
+BOOST_AUTO_TEST_CASE(sample_slave_status_fallback)
+{
+    // Servers that don't understand SHOW REPLICA STATUS get SHOW SLAVE STATUS
+    auto bytes = buffer_builder()
+                     .add(create_ok_frame(1, ok_builder().build()))
+                     .add(create_server_error(common_server_errc::er_parse_error))
+                     .add(create_frame(1, {0x01}))  // 1 column
+                     .add(create_coldef_frame(
+                         2,
+                         meta_builder().type(column_type::bigint).name("Seconds_Behind_Master").build_coldef()
+                     ))
+                     .add(create_text_row_message(3, 12))
+                     .add(create_eof_frame(4, ok_builder().build()))
+                     .build();
+    sample_fixture fix(bytes);
+
+    fix.run();
+
+    BOOST_TEST(fix.ec == error_code());
+    BOOST_TEST(fix.lag == 12);
+}
+
+BOOST_AUTO_TEST_CASE(sample_lag_query_rejected)
+{
+    // The connection is healthy, but we don't know the lag
+    auto bytes = buffer_builder()
+                     .add(create_ok_frame(1, ok_builder().build()))
+                     .add(create_server_error(common_server_errc::er_specific_access_denied_error))
+                     .add(create_server_error(common_server_errc::er_specific_access_denied_error))
+                     .build();
+    sample_fixture fix(bytes);
+    fix.lag = 10;
+
+    fix.run();
+
+    BOOST_TEST(fix.ec == error_code());
+    BOOST_TEST(fix.lag == replication_lag_unknown);
+}
+
+BOOST_AUTO_TEST_CASE(sample_ping_error)
+{
+    // Ping failures make the connection unhealthy. No lag is measured
+    sample_fixture fix(create_server_error(common_server_errc::er_aborting_connection));
+    fix.lag = 10;
+
+    fix.run();
+
+    BOOST_TEST(fix.ec == common_server_errc::er_aborting_connection);
+    BOOST_TEST(fix.lag == 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 //
 
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/common_server_errc.hpp>
 #include <boost/mysql/error_code.hpp>
 
 #include <boost/mysql/impl/internal/connection_pool/sansio_connection_node.hpp>
@@ -18,6 +19,7 @@
 
 using namespace boost::mysql::detail;
 using boost::mysql::client_errc;
+using boost::mysql::common_server_errc;
 using boost::mysql::error_code;
 
 BOOST_AUTO_TEST_SUITE(test_sansio_connection_node)
@@ -210,6 +212,70 @@ BOOST_AUTO_TEST_CASE(reset_error)
     nod.check(connection_status::idle, exit_pending | enter_idle);
 }
 
+// Pools with statements prepare them after connecting and resetting
+BOOST_AUTO_TEST_CASE(statements_lifecycle)
+{
+    // Initial
+    mock_node nod(connection_status::initial, true);
+
+    // Connect
+    auto act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::connect);
+    nod.check(connection_status::connect_in_progress, enter_pending);
+
+    // Connect success. Statements should be prepared
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::prepare_statements);
+    nod.check(connection_status::prepare_statements_in_progress, 0);
+
+    // Prepare success, we're idle
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::idle_wait);
+    nod.check(connection_status::idle, exit_pending | enter_idle);
+
+    // Pings don't affect statements
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::ping);
+    nod.check(connection_status::ping_in_progress, exit_idle | enter_pending);
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::idle_wait);
+    nod.check(connection_status::idle, exit_pending | enter_idle);
+
+    // In use, then returned with reset
+    nod.mark_as_in_use();
+    nod.check(connection_status::in_use, exit_idle);
+    act = nod.resume(error_code(), collection_state::needs_collect_with_reset);
+    BOOST_TEST(act == next_connection_action::reset);
+    nod.check(connection_status::reset_in_progress, enter_pending);
+
+    // Reset deallocates statements, so these are prepared again
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::prepare_statements);
+    nod.check(connection_status::prepare_statements_in_progress, 0);
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::idle_wait);
+    nod.check(connection_status::idle, exit_pending | enter_idle);
+}
+
+BOOST_AUTO_TEST_CASE(statements_error)
+{
+    // Connection preparing statements
+    mock_node nod(connection_status::prepare_statements_in_progress, true);
+
+    // Prepare fails. We sleep and reconnect, as in connect errors
+    auto act = nod.resume(common_server_errc::er_no_such_table, collection_state::none);
+    BOOST_TEST(act == next_connection_action::sleep_connect_failed);
+    nod.check(connection_status::sleep_connect_failed_in_progress, 0);
+
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::connect);
+    nod.check(connection_status::connect_in_progress, 0);
+
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::prepare_statements);
+    nod.check(connection_status::prepare_statements_in_progress, 0);
+}
+
 BOOST_AUTO_TEST_CASE(sleep_between_retries_fail)
 {
     // Note: this is an edge case. This op should not fail unless
@@ -271,6 +337,7 @@ BOOST_AUTO_TEST_CASE(cancel)
         {connection_status::in_use,                           0           },
         {connection_status::ping_in_progress,                 exit_pending},
         {connection_status::reset_in_progress,                exit_pending},
+        {connection_status::prepare_statements_in_progress,   exit_pending},
     };
 
     for (const auto& tc : test_cases)
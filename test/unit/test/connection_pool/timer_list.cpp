@@ -229,4 +229,68 @@ BOOST_FIXTURE_TEST_CASE(auto_unlink, fixture)
     BOOST_TEST(l.size() == 0u);
 }
 
+BOOST_FIXTURE_TEST_CASE(insert_ordering, fixture)
+{
+    // Create timers with different priorities and deadlines
+    const auto now = std::chrono::steady_clock::now();
+    block_t t_low(ctx.get_executor());
+    block_t t_normal_late(ctx.get_executor());
+    block_t t_normal_early(ctx.get_executor());
+    block_t t_normal_early2(ctx.get_executor());
+    t_low.priority = 2u;
+    t_low.deadline = now;
+    t_normal_late.priority = 1u;
+    t_normal_late.deadline = now + std::chrono::seconds(10);
+    t_normal_early.priority = 1u;
+    t_normal_early.deadline = now + std::chrono::seconds(5);
+    t_normal_early2.priority = 1u;
+    t_normal_early2.deadline = now + std::chrono::seconds(5);
+
+    // Add waits on them
+    add_wait(t_low);
+    add_wait(t_normal_late);
+    add_wait(t_normal_early);
+    add_wait(t_normal_early2);
+
+    // Insert them in an order different to the one they should be notified
+    l.insert(t_low);
+    l.insert(t_normal_late);
+    l.insert(t_normal_early);
+    l.insert(t_normal_early2);
+    BOOST_TEST(l.size() == 4u);
+
+    // Timers are notified by priority, then by deadline. Timers with the same key
+    // are notified in insertion order
+    l.notify_one();
+    BOOST_TEST(t_normal_early.timer.cancel() == 0u);
+    l.notify_one();
+    BOOST_TEST(t_normal_early2.timer.cancel() == 0u);
+    l.notify_one();
+    BOOST_TEST(t_normal_late.timer.cancel() == 0u);
+    BOOST_TEST(t_low.timer.cancel() == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(reject_back, fixture)
+{
+    // Create timers
+    block_t t1(ctx.get_executor());
+    block_t t2(ctx.get_executor());
+
+    // Add waits on them
+    add_wait(t1);
+    add_wait(t2);
+
+    // Add them to the list
+    l.insert(t1);
+    l.insert(t2);
+
+    // The last timer is removed, marked as rejected and cancelled
+    l.reject_back();
+    BOOST_TEST(l.size() == 1u);
+    BOOST_TEST(!t1.rejected);
+    BOOST_TEST(t2.rejected);
+    BOOST_TEST(t1.timer.cancel() == 1u);
+    BOOST_TEST(t2.timer.cancel() == 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/decimal.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "test_common/stringize.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+
+BOOST_AUTO_TEST_SUITE(test_decimal)
+
+BOOST_AUTO_TEST_CASE(default_constructor)
+{
+    decimal d;
+    BOOST_TEST(d.to_string_view() == "0");
+    BOOST_TEST(d.scale() == 0u);
+    BOOST_TEST(d.precision() == 0u);
+    BOOST_TEST(!d.is_negative());
+    BOOST_TEST(d.get_unscaled_value() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(ctor_from_string_success)
+{
+    // An unscaled value of 99 means "doesn't fit in int64"
+    const std::int64_t nofit = 99;
+    struct
+    {
+        string_view input;
+        string_view canonical;
+        unsigned scale;
+        unsigned precision;
+        bool is_negative;
+        std::int64_t unscaled;
+    } test_cases[] = {
+        // clang-format off
+        {"0",                         "0",                        0u,  0u,  false, 0},
+        {"10",                        "10",                       0u,  2u,  false, 10},
+        {"-10",                       "-10",                      0u,  2u,  true,  -10},
+        {"+10",                       "10",                       0u,  2u,  false, 10},
+        {"10.50",                     "10.50",                    2u,  4u,  false, 1050},
+        {"-10.50",                    "-10.50",                   2u,  4u,  true,  -1050},
+        {"0.05",                      "0.05",                     2u,  2u,  false, 5},
+        {"-0.05",                     "-0.05",                    2u,  2u,  true,  -5},
+        {"007.10",                    "7.10",                     2u,  3u,  false, 710},
+        {"-0.00",                     "0.00",                     2u,  2u,  false, 0},
+        {"-0",                        "0",                        0u,  0u,  false, 0},
+        {"9223372036854775807",       "9223372036854775807",      0u,  19u, false, INT64_MAX},
+        {"-9223372036854775808",      "-9223372036854775808",     0u,  19u, true,  INT64_MIN},
+        {"922337203685477580.7",      "922337203685477580.7",     1u,  19u, false, INT64_MAX},
+        {"9223372036854775808",       "9223372036854775808",      0u,  19u, false, nofit},
+        {"-9223372036854775809",      "-9223372036854775809",     0u,  19u, true,  nofit},
+        {"99999999999999999999",      "99999999999999999999",     0u,  20u, false, nofit},
+        {"0.000000000000000000000001", "0.000000000000000000000001", 24u, 24u, false, 1},
+        // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.input)
+        {
+            decimal d(tc.input);
+            BOOST_TEST(d.to_string_view() == tc.canonical);
+            BOOST_TEST(d.scale() == tc.scale);
+            BOOST_TEST(d.precision() == tc.precision);
+            BOOST_TEST(d.is_negative() == tc.is_negative);
+            if (tc.unscaled == nofit)
+            {
+                BOOST_TEST(!d.fits_int64());
+                BOOST_CHECK_THROW(d.as_unscaled_value(), std::out_of_range);
+            }
+            else
+            {
+                BOOST_TEST(d.fits_int64());
+                BOOST_TEST(d.get_unscaled_value() == tc.unscaled);
+                BOOST_TEST(d.as_unscaled_value() == tc.unscaled);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ctor_from_string_limits)
+{
+    // 65 digits, 30 of which are decimals
+    std::string max_value = std::string(35, '9') + '.' + std::string(30, '9');
+    decimal d(max_value);
+    BOOST_TEST(d.precision() == 65u);
+    BOOST_TEST(d.scale() == 30u);
+    BOOST_TEST(d.to_string_view() == max_value);
+
+    d = decimal('-' + max_value);
+    BOOST_TEST(d.to_string_view() == '-' + max_value);
+
+    // 65 digits, no decimals
+    d = decimal(std::string(65, '9'));
+    BOOST_TEST(d.precision() == 65u);
+}
+
+BOOST_AUTO_TEST_CASE(ctor_from_string_error)
+{
+    struct
+    {
+        const char* name;
+        std::string input;
+    } test_cases[] = {
+        {"empty",             ""                                               },
+        {"only_sign",         "-"                                              },
+        {"two_signs",         "--1"                                            },
+        {"no_int_part",       ".5"                                             },
+        {"no_frac_part",      "5."                                             },
+        {"two_points",        "1.2.3"                                          },
+        {"letters",           "1a"                                             },
+        {"spaces",            " 1"                                             },
+        {"exponent",          "1e10"                                           },
+        {"scale_too_big",     "0." + std::string(31, '1')                      },
+        {"precision_too_big", std::string(66, '1')                             },
+        {"precision_frac",    std::string(36, '1') + '.' + std::string(30, '1')},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            BOOST_CHECK_THROW(decimal{string_view(tc.input)}, std::invalid_argument);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ctor_from_unscaled)
+{
+    struct
+    {
+        std::int64_t unscaled;
+        unsigned scale;
+        string_view expected;
+    } test_cases[] = {
+        {0,         0,  "0"                               },
+        {0,         2,  "0.00"                            },
+        {10,        0,  "10"                              },
+        {-1050,     2,  "-10.50"                          },
+        {5,         2,  "0.05"                            },
+        {-5,        3,  "-0.005"                          },
+        {123,       3,  "0.123"                           },
+        {INT64_MAX, 0,  "9223372036854775807"             },
+        {INT64_MIN, 0,  "-9223372036854775808"            },
+        {INT64_MIN, 19, "-0.9223372036854775808"          },
+        {1,         30, "0.000000000000000000000000000001"},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.expected)
+        {
+            decimal d(tc.unscaled, tc.scale);
+            BOOST_TEST(d.to_string_view() == tc.expected);
+            BOOST_TEST(d.scale() == tc.scale);
+            BOOST_TEST(d.get_unscaled_value() == tc.unscaled);
+
+            // Same as parsing the string
+            BOOST_TEST(d == decimal(tc.expected));
+            BOOST_TEST(d.precision() == decimal(tc.expected).precision());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ctor_from_unscaled_error)
+{
+    BOOST_CHECK_THROW(decimal(1, 31), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(operator_equals)
+{
+    BOOST_TEST(decimal("10.50") == decimal("10.50"));
+    BOOST_TEST(decimal("10.50") == decimal("010.50"));
+    BOOST_TEST(decimal("0") == decimal("-0"));
+    BOOST_TEST(decimal("10.50") != decimal("10.5"));
+    BOOST_TEST(decimal("10.50") != decimal("-10.50"));
+    BOOST_TEST(decimal("10.50") != decimal("10.51"));
+    BOOST_TEST(decimal("1") != decimal("10"));
+}
+
+BOOST_AUTO_TEST_CASE(operator_stream)
+{
+    BOOST_TEST(stringize(decimal("-0010.50")) == "-10.50");
+    BOOST_TEST(stringize(decimal()) == "0");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -163,6 +163,32 @@ BOOST_AUTO_TEST_CASE(make_stable_2)
     BOOST_TEST(!stable.hparams.multi_queries());
 }
 
+BOOST_AUTO_TEST_CASE(make_stable_host_list)
+{
+    boost::mysql::host_and_port h1, h2;
+    h1.host = "host1";
+    h1.port = 2000;
+    h2.host = "host2";
+    h2.port = 2001;
+    connect_params input;
+    input.server_address.emplace_host_list({h1, h2}, boost::mysql::host_selection_policy::random);
+
+    auto stable = make_stable(input);
+    input.server_address.emplace_host_and_port("other");  // lifetime check
+
+    BOOST_TEST(stable.address.type == address_type::host_and_port);
+    BOOST_TEST(stable.address.policy == boost::mysql::host_selection_policy::random);
+    BOOST_TEST_REQUIRE(stable.address.num_hosts() == 2u);
+    BOOST_TEST(stable.address.host_at(0) == "host1");
+    BOOST_TEST(stable.address.port_at(0) == std::uint16_t(2000));
+    BOOST_TEST(stable.address.host_at(1) == "host2");
+    BOOST_TEST(stable.address.port_at(1) == std::uint16_t(2001));
+
+    // Moving the storage doesn't invalidate the view
+    auto hosts = std::move(stable.fallback_hosts);
+    BOOST_TEST(stable.address.host_at(1) == "host2");
+}
+
 BOOST_AUTO_TEST_CASE(make_hparams_1)
 {
     connect_params input;
@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/lazy_row_view.hpp>
+#include <boost/mysql/metadata.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/lazy_row_impl.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/row_decoding_plan.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "test_common/create_basic.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_meta.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using detail::lazy_row_impl;
+using detail::resultset_encoding;
+using detail::row_decoding_plan;
+
+BOOST_AUTO_TEST_SUITE(test_lazy_row_impl)
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    struct
+    {
+        const char* name;
+        resultset_encoding encoding;
+        std::vector<std::uint8_t> serialized;
+        std::vector<field_view> expected;
+        std::vector<metadata> meta;
+    } test_cases[] = {
+        // clang-format off
+        {
+            "text_several_values_one_null",
+            resultset_encoding::text,
+            {0x03, 0x76, 0x61, 0x6c, 0xfb, 0x02, 0x32, 0x31},
+            make_fv_vector("val", nullptr, std::int64_t(21)),
+            create_metas({ column_type::varchar, column_type::int_, column_type::int_ })
+        },
+        {
+            "text_all_nulls",
+            resultset_encoding::text,
+            {0xfb, 0xfb},
+            make_fv_vector(nullptr, nullptr),
+            create_metas({ column_type::varchar, column_type::datetime })
+        },
+        {
+            "binary_several_values",
+            resultset_encoding::binary,
+            {
+                0x00, 0x90, 0x00, 0xfd, 0x03, 0x61, 0x62, 0x63,
+                0xc3, 0xf5, 0x48, 0x40, 0x02, 0x61, 0x62, 0x04,
+                0xe2, 0x07, 0x0a, 0x05, 0x71, 0x99, 0x6d, 0xe2,
+                0x93, 0x4d, 0xf5, 0x3d
+            },
+            make_fv_vector(
+                std::int64_t(-3),
+                "abc",
+                nullptr,
+                3.14f,
+                "ab",
+                nullptr,
+                date(2018u, 10u, 5u),
+                3.10e-10
+            ),
+            create_metas({
+                column_type::tinyint,
+                column_type::varchar,
+                column_type::int_,
+                column_type::float_,
+                column_type::char_,
+                column_type::int_,
+                column_type::date,
+                column_type::double_,
+            })
+        },
+        {
+            "binary_fixed_sizes",
+            resultset_encoding::binary,
+            {
+                0x00, 0x00, 0x14, 0x6d, 0x07, 0x01, 0x00, 0x00,
+                0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00
+            },
+            make_fv_vector(std::int64_t(20), std::int64_t(1901), std::int64_t(1), std::int64_t(2), date()),
+            create_metas({
+                column_type::tinyint,
+                column_type::smallint,
+                column_type::int_,
+                column_type::bigint,
+                column_type::date,
+            })
+        },
+        // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            row_decoding_plan plan;
+            plan.compile(tc.encoding, tc.meta);
+            lazy_row_impl impl;
+            auto err = impl.reset(plan, tc.meta, tc.serialized);
+            BOOST_TEST_REQUIRE(err == error_code());
+            BOOST_TEST_REQUIRE(impl.size() == tc.expected.size());
+
+            // Fields can be accessed in any order, and more than once
+            for (std::size_t i = impl.size(); i-- > 0u;)
+            {
+                BOOST_TEST(impl.is_null(i) == tc.expected[i].is_null());
+                BOOST_TEST(impl.get(i, err) == tc.expected[i]);
+                BOOST_TEST(err == error_code());
+                BOOST_TEST(impl.get(i, err) == tc.expected[i]);
+                BOOST_TEST(err == error_code());
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(reset_error)
+{
+    struct
+    {
+        const char* name;
+        resultset_encoding encoding;
+        std::vector<std::uint8_t> serialized;
+        error_code expected;
+        std::vector<metadata> meta;
+    } test_cases[] = {
+        // clang-format off
+        {"text_no_space_string",       resultset_encoding::text,   {0x01, 0x35, 0x02, 0x35},       client_errc::incomplete_message, create_metas({column_type::tinyint, column_type::smallint})},
+        {"text_no_space_null",         resultset_encoding::text,   {0xfb},                         client_errc::incomplete_message, create_metas({column_type::tinyint, column_type::tinyint})},
+        {"text_extra_bytes",           resultset_encoding::text,   {0x01, 0x35, 0xfb, 0x00},       client_errc::extra_bytes,        create_metas({column_type::tinyint, column_type::tinyint})},
+        {"binary_no_space_header",     resultset_encoding::binary, {},                             client_errc::incomplete_message, create_metas({column_type::tinyint})},
+        {"binary_no_space_bitmap",     resultset_encoding::binary, {0x00},                         client_errc::incomplete_message, create_metas({column_type::tinyint})},
+        {"binary_no_space_int",        resultset_encoding::binary, {0x00, 0x00, 0x01, 0x02},       client_errc::incomplete_message, create_metas({column_type::int_})},
+        {"binary_no_space_double",     resultset_encoding::binary, {0x00, 0x00, 0x01, 0x02, 0x03}, client_errc::incomplete_message, create_metas({column_type::double_})},
+        {"binary_no_space_date_len",   resultset_encoding::binary, {0x00, 0x00},                   client_errc::incomplete_message, create_metas({column_type::date})},
+        {"binary_no_space_date_value", resultset_encoding::binary, {0x00, 0x00, 0x04, 0xe2, 0x07}, client_errc::incomplete_message, create_metas({column_type::date})},
+        {"binary_no_space_string",     resultset_encoding::binary, {0x00, 0x00, 0x03, 0x61},       client_errc::incomplete_message, create_metas({column_type::varchar})},
+        {"binary_extra_bytes",         resultset_encoding::binary, {0x00, 0x00, 0x01, 0x02},       client_errc::extra_bytes,        create_metas({column_type::tinyint})},
+        // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            row_decoding_plan plan;
+            plan.compile(tc.encoding, tc.meta);
+            lazy_row_impl impl;
+            BOOST_TEST(impl.reset(plan, tc.meta, tc.serialized) == tc.expected);
+        }
+    }
+}
+
+// Invalid values are only detected when the field is accessed
+BOOST_AUTO_TEST_CASE(value_error)
+{
+    const std::vector<std::uint8_t> serialized{0x01, 0x00, 0x01, 0x35};
+    const auto meta = create_metas({column_type::date, column_type::tinyint});
+    row_decoding_plan plan;
+    plan.compile(resultset_encoding::text, meta);
+    lazy_row_impl impl;
+    BOOST_TEST_REQUIRE(impl.reset(plan, meta, serialized) == error_code());
+
+    error_code err;
+    BOOST_TEST(impl.get(1, err) == field_view(std::int64_t(5)));
+    BOOST_TEST(err == error_code());
+    impl.get(0, err);
+    BOOST_TEST(err == client_errc::protocol_value_error);
+
+    // Through the public interface
+    auto view = detail::access::construct<lazy_row_view>(impl);
+    BOOST_TEST(view.size() == 2u);
+    BOOST_TEST(view.at(1) == field_view(std::int64_t(5)));
+    BOOST_CHECK_THROW(view.at(0), boost::system::system_error);
+    BOOST_CHECK_THROW(view.at(2), std::out_of_range);
+}
+
+// Storage is re-used between rows
+BOOST_AUTO_TEST_CASE(several_rows)
+{
+    const auto meta = create_metas({column_type::varchar, column_type::tinyint});
+    row_decoding_plan plan;
+    plan.compile(resultset_encoding::text, meta);
+    lazy_row_impl impl;
+    error_code err;
+
+    const std::vector<std::uint8_t> row1{0x01, 0x61, 0x01, 0x35};
+    BOOST_TEST_REQUIRE(impl.reset(plan, meta, row1) == error_code());
+    BOOST_TEST(impl.get(1, err) == field_view(std::int64_t(5)));
+
+    const std::vector<std::uint8_t> row2{0xfb, 0x01, 0x36};
+    BOOST_TEST_REQUIRE(impl.reset(plan, meta, row2) == error_code());
+    BOOST_TEST(impl.is_null(0));
+    BOOST_TEST(impl.get(1, err) == field_view(std::int64_t(6)));
+    BOOST_TEST(impl.get(0, err) == field_view());
+}
+
+BOOST_AUTO_TEST_CASE(default_view)
+{
+    lazy_row_view view;
+    BOOST_TEST(view.size() == 0u);
+    BOOST_TEST(view.empty());
+    BOOST_CHECK_THROW(view.at(0), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
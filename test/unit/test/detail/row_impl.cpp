@@ -9,6 +9,7 @@
 #include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/date.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/row_view.hpp>
 
 #include <boost/mysql/detail/row_impl.hpp>
@@ -16,9 +17,12 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <memory>
+#include <type_traits>
 
 #include "test_common/assert_buffer_equals.hpp"
 #include "test_common/create_basic.hpp"
+#include "test_unit/counting_memory_resource.hpp"
 
 using namespace boost::mysql::test;
 using namespace boost::mysql;
@@ -55,6 +59,13 @@ std::vector<field_view> make_scalar_vector()
     );
 }
 
+// Copies the row's fields into a std::vector, so they can be compared
+// regardless of the allocator used by row_impl
+std::vector<field_view> fields_of(const row_impl& r)
+{
+    return std::vector<field_view>(r.fields().begin(), r.fields().end());
+}
+
 void hard_clear(std::vector<field_view>& res)
 {
     for (auto& f : res)
@@ -121,7 +132,7 @@ BOOST_AUTO_TEST_CASE(non_strings)
 
     // Fields still valid even when the original source of the view changed
     hard_clear(fields);
-    BOOST_TEST(r.fields() == make_scalar_vector());
+    BOOST_TEST(fields_of(r) == make_scalar_vector());
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs)
@@ -176,7 +187,7 @@ BOOST_AUTO_TEST_CASE(non_strings)
     row_impl r2(r1);
     r1 = makerowimpl(42, "test");  // r2 should be independent of r1
 
-    BOOST_TEST(r2.fields() == make_scalar_vector());
+    BOOST_TEST(fields_of(r2) == make_scalar_vector());
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs)
@@ -231,7 +242,7 @@ BOOST_AUTO_TEST_CASE(non_strings)
     row_impl r2(std::move(r1));
     r1 = makerowimpl(42, "test");  // r2 should be independent of r1
 
-    BOOST_TEST(r2.fields() == make_scalar_vector());
+    BOOST_TEST(fields_of(r2) == make_scalar_vector());
     refcheck.check(r2);
 }
 
@@ -264,7 +275,7 @@ BOOST_AUTO_TEST_CASE(empty_strings_blobs)
     row_impl r2(std::move(r1));
     r1 = makerowimpl("another_string", 4.2f, "", makebv("\1\5\xab"));  // r2 should be independent of r1
 
-    BOOST_TEST(r2.fields() == make_fv_vector("", 42, blob_view()));
+    BOOST_TEST(fields_of(r2) == make_fv_vector("", 42, blob_view()));
 }
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -286,7 +297,7 @@ BOOST_AUTO_TEST_CASE(non_strings)
     r1 = r2;
     r2 = makerowimpl("abc", 80, nullptr);  // r1 is independent of r2
 
-    BOOST_TEST(r1.fields() == make_scalar_vector());
+    BOOST_TEST(fields_of(r1) == make_scalar_vector());
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs)
@@ -296,7 +307,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs)
     r1 = r2;
     r2 = makerowimpl("another_string", 90, "yet_another");  // r1 is independent of r2
 
-    BOOST_TEST(r1.fields() == make_fv_vector("a_very_long_string", nullptr, "", makebv("\3\4\5")));
+    BOOST_TEST(fields_of(r1) == make_fv_vector("a_very_long_string", nullptr, "", makebv("\3\4\5")));
 }
 
 BOOST_AUTO_TEST_CASE(empty_strings_blobs)
@@ -306,7 +317,7 @@ BOOST_AUTO_TEST_CASE(empty_strings_blobs)
     r1 = r2;
     r2 = makerowimpl("another_string", 90, "yet_another");  // r1 is independent of r2
 
-    BOOST_TEST(r1.fields() == make_fv_vector(nullptr, "", blob_view()));
+    BOOST_TEST(fields_of(r1) == make_fv_vector(nullptr, "", blob_view()));
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs_empty_to)
@@ -315,7 +326,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs_empty_to)
     row_impl r2 = makerowimpl("abc", nullptr, "bcd", makebv("\1\2\3"));
     r1 = r2;
 
-    BOOST_TEST(r1.fields() == make_fv_vector("abc", nullptr, "bcd", makebv("\1\2\3")));
+    BOOST_TEST(fields_of(r1) == make_fv_vector("abc", nullptr, "bcd", makebv("\1\2\3")));
 }
 
 BOOST_AUTO_TEST_CASE(self_assignment_empty)
@@ -333,7 +344,7 @@ BOOST_AUTO_TEST_CASE(self_assignment_non_empty)
     const row_impl& ref = r;
     r = ref;
 
-    BOOST_TEST(r.fields() == make_fv_vector("abc", 50u, "fgh"));
+    BOOST_TEST(fields_of(r) == make_fv_vector("abc", 50u, "fgh"));
 }
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -363,7 +374,7 @@ BOOST_AUTO_TEST_CASE(non_strings)
     r1 = std::move(r2);
     r2 = makerowimpl("abc", 80, nullptr);  // r1 is independent of r2
 
-    BOOST_TEST(r1.fields() == make_scalar_vector());
+    BOOST_TEST(fields_of(r1) == make_scalar_vector());
     refcheck.check(r1);
 }
 
@@ -379,7 +390,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs)
     r1 = std::move(r2);
     r2 = makerowimpl("another_string", 90, "yet_another", makebv("\0\0"));  // r1 is independent of r2
 
-    BOOST_TEST(r1.fields() == make_fv_vector("a_very_long_string", nullptr, "", makebv("\7\1\2")));
+    BOOST_TEST(fields_of(r1) == make_fv_vector("a_very_long_string", nullptr, "", makebv("\7\1\2")));
     refcheck.check(r1);
 }
 
@@ -395,7 +406,7 @@ BOOST_AUTO_TEST_CASE(empty_strings_blobs)
     r1 = std::move(r2);
     r2 = makerowimpl("another_string", 90);  // r1 is independent of r2
 
-    BOOST_TEST(r1.fields() == make_fv_vector("", blob_view()));
+    BOOST_TEST(fields_of(r1) == make_fv_vector("", blob_view()));
     refcheck.check(r1);
 }
 
@@ -409,7 +420,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs_empty_to)
 
     r1 = std::move(r2);
 
-    BOOST_TEST(r1.fields() == make_fv_vector("abc", nullptr, "bcd", makebv("\0\2\5")));
+    BOOST_TEST(fields_of(r1) == make_fv_vector("abc", nullptr, "bcd", makebv("\0\2\5")));
     refcheck.check(r1);
 }
 
@@ -421,7 +432,7 @@ BOOST_AUTO_TEST_CASE(self_assignment_empty)
 
     // r is in a valid but unspecified state; can be assigned to
     r = makerowimpl("abcdef");
-    BOOST_TEST(r.fields() == make_fv_vector("abcdef"));
+    BOOST_TEST(fields_of(r) == make_fv_vector("abcdef"));
 }
 
 BOOST_AUTO_TEST_CASE(self_assignment_non_empty)
@@ -432,7 +443,7 @@ BOOST_AUTO_TEST_CASE(self_assignment_non_empty)
 
     // r is in a valid but unspecified state; can be assigned to
     r = makerowimpl("abcdef");
-    BOOST_TEST(r.fields() == make_fv_vector("abcdef"));
+    BOOST_TEST(fields_of(r) == make_fv_vector("abcdef"));
 }
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -459,7 +470,7 @@ BOOST_AUTO_TEST_CASE(non_strings)
     r.assign(fields.data(), fields.size());
     hard_clear(fields);  // r should be independent of the original fields
 
-    BOOST_TEST(r.fields() == make_scalar_vector());
+    BOOST_TEST(fields_of(r) == make_scalar_vector());
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs)
@@ -475,7 +486,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs)
     s2 = "yet_another";
     b = {0xac, 0x32, 0x21, 0x50};
 
-    BOOST_TEST(r.fields() == make_fv_vector("a_very_long_string", nullptr, "abc", makebv("\0\xfa")));
+    BOOST_TEST(fields_of(r) == make_fv_vector("a_very_long_string", nullptr, "abc", makebv("\0\xfa")));
 }
 
 BOOST_AUTO_TEST_CASE(empty_strings_blobs)
@@ -490,7 +501,7 @@ BOOST_AUTO_TEST_CASE(empty_strings_blobs)
     s = "another_string";        // r should be independent of the original strings
     b = {0xac, 0x32, 0x21, 0x50};
 
-    BOOST_TEST(r.fields() == make_fv_vector("", blob_view()));
+    BOOST_TEST(fields_of(r) == make_fv_vector("", blob_view()));
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs_empty_to)
@@ -499,7 +510,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs_empty_to)
     auto fields = make_fv_arr("abc", nullptr, "bcd", makebv("\0\3"));
     r.assign(fields.data(), fields.size());
 
-    BOOST_TEST(r.fields() == make_fv_vector("abc", nullptr, "bcd", makebv("\0\3")));
+    BOOST_TEST(fields_of(r) == make_fv_vector("abc", nullptr, "bcd", makebv("\0\3")));
 }
 
 BOOST_AUTO_TEST_CASE(self_assignment)
@@ -507,7 +518,7 @@ BOOST_AUTO_TEST_CASE(self_assignment)
     row_impl r = makerowimpl("abcdef", 42, "plk", makebv("\0\1"));
     r.assign(r.fields().data(), r.fields().size());
 
-    BOOST_TEST(r.fields() == make_fv_vector("abcdef", 42, "plk", makebv("\0\1")));
+    BOOST_TEST(fields_of(r) == make_fv_vector("abcdef", 42, "plk", makebv("\0\1")));
 }
 
 BOOST_AUTO_TEST_CASE(self_assignment_empty)
@@ -571,7 +582,7 @@ BOOST_AUTO_TEST_CASE(scalars)
     add_fields(r, nullptr, 42, 10.0f, date(2020, 10, 1));
     r.copy_strings_as_offsets(0, 4);
     r.offsets_to_string_views();
-    BOOST_TEST(r.fields() == make_fv_vector(nullptr, 42, 10.f, date(2020, 10, 1)));
+    BOOST_TEST(fields_of(r) == make_fv_vector(nullptr, 42, 10.f, date(2020, 10, 1)));
 }
 
 BOOST_AUTO_TEST_CASE(strings_blobs)
@@ -584,7 +595,7 @@ BOOST_AUTO_TEST_CASE(strings_blobs)
     s = "ghi";
     b = {0xff, 0xff, 0xff};
     r.offsets_to_string_views();
-    BOOST_TEST(r.fields() == make_fv_vector(nullptr, "abc", 10.f, makebv("\1\2\3")));
+    BOOST_TEST(fields_of(r) == make_fv_vector(nullptr, "abc", 10.f, makebv("\1\2\3")));
 }
 
 BOOST_AUTO_TEST_CASE(empty_strings_blobs)
@@ -597,7 +608,7 @@ BOOST_AUTO_TEST_CASE(empty_strings_blobs)
     s = "ghi";
     b = {0xff, 0xff, 0xff};
     r.offsets_to_string_views();
-    BOOST_TEST(r.fields() == make_fv_vector(nullptr, "", 10.f, makebv("")));
+    BOOST_TEST(fields_of(r) == make_fv_vector(nullptr, "", 10.f, makebv("")));
 }
 
 BOOST_AUTO_TEST_CASE(buffer_relocation)
@@ -625,7 +636,7 @@ BOOST_AUTO_TEST_CASE(buffer_relocation)
 
     r.offsets_to_string_views();
     BOOST_TEST(
-        r.fields() ==
+        fields_of(r) ==
         make_fv_vector(nullptr, "abc", 10.f, makebv("\1\2\3"), "", makebv(""), "this is a long string")
     );
 }
@@ -636,7 +647,7 @@ BOOST_AUTO_TEST_CASE(empty_range)
     row_impl r = makerowimpl(nullptr, 42);
     r.copy_strings_as_offsets(0, 0);
     r.offsets_to_string_views();
-    BOOST_TEST(r.fields() == make_fv_vector(nullptr, 42));
+    BOOST_TEST(fields_of(r) == make_fv_vector(nullptr, 42));
 }
 
 BOOST_AUTO_TEST_CASE(empty_collection)
@@ -648,4 +659,61 @@ BOOST_AUTO_TEST_CASE(empty_collection)
 }
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(memory_resource_)
+BOOST_AUTO_TEST_CASE(allocations)
+{
+    counting_memory_resource res;
+    {
+        row_impl r(&res);
+        BOOST_TEST((r.memory_resource() == &res));
+        BOOST_TEST(res.num_allocations() == 0u);
+
+        // Fields and strings are allocated using the resource
+        auto fields = make_fv_arr("abc", 42, makebv("\1\2"));
+        r.assign(fields.data(), fields.size());
+        BOOST_TEST(res.num_allocations() == 2u);
+        BOOST_TEST(fields_of(r) == make_fv_vector("abc", 42, makebv("\1\2")));
+
+        // add_fields also uses the resource
+        add_fields(r, 50, nullptr);
+        BOOST_TEST(res.num_allocations() >= 3u);
+    }
+    BOOST_TEST(res.num_outstanding() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(copy_uses_global_heap)
+{
+    counting_memory_resource res;
+    row_impl r1(&res);
+    auto fields = make_fv_arr("abc", 42);
+    r1.assign(fields.data(), fields.size());
+
+    row_impl r2(r1);
+    BOOST_TEST((r2.memory_resource() == memory_resource_ref()));
+    BOOST_TEST(fields_of(r2) == make_fv_vector("abc", 42));
+}
+
+// Moving never copies, even across resources, so it can't throw
+static_assert(std::is_nothrow_move_constructible<row_impl>::value, "");
+static_assert(std::is_nothrow_move_assignable<row_impl>::value, "");
+
+BOOST_AUTO_TEST_CASE(move_assignment_different_resource)
+{
+    counting_memory_resource res1, res2;
+    row_impl r1(&res1);
+    auto fields = make_fv_arr("abc", 42, makebv("\1\2"));
+    r1.assign(fields.data(), fields.size());
+    row_impl r2(&res2);
+    r2.assign(fields.data(), fields.size());
+    reference_checker_strs refcheck(r2, 0, 2);
+
+    // Memory and resource are transferred, and our old memory is released
+    r1 = std::move(r2);
+    BOOST_TEST((r1.memory_resource() == &res2));
+    BOOST_TEST(fields_of(r1) == make_fv_vector("abc", 42, makebv("\1\2")));
+    refcheck.check(r1);
+    BOOST_TEST(res1.num_outstanding() == 0u);
+}
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/typing/meta_check_cache.hpp>
+#include <boost/mysql/detail/typing/pos_map.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "test_unit/create_meta.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using boost::mysql::detail::coldef_view;
+using boost::mysql::detail::meta_check_cache;
+using boost::mysql::detail::name_table_t;
+using boost::mysql::detail::pos_absent;
+using boost::mysql::detail::pos_map_reset;
+
+BOOST_AUTO_TEST_SUITE(test_meta_check_cache)
+
+static const string_view name_table_storage[] = {"f1", "f2", "f3"};
+static const name_table_t name_table(name_table_storage);
+using pos_map_t = std::array<std::size_t, 3>;
+
+static coldef_view col(string_view name, column_type type = column_type::int_)
+{
+    return meta_builder().name(name).type(type).nullable(false).build_coldef();
+}
+
+struct run_result
+{
+    bool hit;
+    pos_map_t pos_map;
+};
+
+// Processes a resultset as static_execution_state does, assuming meta_check succeeds
+static run_result run(meta_check_cache& cache, const std::vector<coldef_view>& cols, bool commit = true)
+{
+    run_result res{false, {}};
+    pos_map_reset(res.pos_map);
+    cache.on_resultset_start();
+    for (const auto& c : cols)
+        cache.on_column(res.pos_map, name_table, c);
+    res.hit = cache.on_resultset_finish(res.pos_map, name_table);
+    if (!res.hit && commit)
+        cache.commit(res.pos_map);
+    return res;
+}
+
+BOOST_AUTO_TEST_CASE(hit)
+{
+    meta_check_cache cache;
+    std::vector<coldef_view> cols{col("f3"), col("f1"), col("f2")};
+
+    // First time: miss
+    auto res = run(cache, cols);
+    BOOST_TEST(!res.hit);
+    BOOST_TEST(res.pos_map == (pos_map_t{{1u, 2u, 0u}}));
+
+    // Identical metadata: hit, with the same pos_map
+    res = run(cache, cols);
+    BOOST_TEST(res.hit);
+    BOOST_TEST(res.pos_map == (pos_map_t{{1u, 2u, 0u}}));
+
+    res = run(cache, cols);
+    BOOST_TEST(res.hit);
+    BOOST_TEST(res.pos_map == (pos_map_t{{1u, 2u, 0u}}));
+}
+
+BOOST_AUTO_TEST_CASE(not_committed)
+{
+    // If meta_check fails, the metadata is not used next time
+    meta_check_cache cache;
+    std::vector<coldef_view> cols{col("f1"), col("f2"), col("f3")};
+
+    auto res = run(cache, cols, false);
+    BOOST_TEST(!res.hit);
+    res = run(cache, cols, false);
+    BOOST_TEST(!res.hit);
+    BOOST_TEST(res.pos_map == (pos_map_t{{0u, 1u, 2u}}));
+}
+
+BOOST_AUTO_TEST_CASE(mismatch)
+{
+    struct
+    {
+        const char* name;
+        std::vector<coldef_view> cols;
+        pos_map_t expected;
+    } test_cases[] = {
+        // clang-format off
+        {"first_name",    {col("f2"), col("f1"), col("f3")},                             {{1u, 0u, 2u}}     },
+        {"middle_name",   {col("f1"), col("f3"), col("f2")},                             {{0u, 2u, 1u}}     },
+        {"last_name",     {col("f1"), col("f2"), col("other")},                          {{0u, 1u, pos_absent}}},
+        {"type",          {col("f1"), col("f2", column_type::bigint), col("f3")},        {{0u, 1u, 2u}}     },
+        {"flags",         {col("f1"), meta_builder().name("f2").build_coldef(), col("f3")}, {{0u, 1u, 2u}}  },
+        {"more_columns",  {col("f1"), col("f2"), col("f3"), col("f4")},                  {{0u, 1u, 2u}}     },
+        {"fewer_columns", {col("f2"), col("f1")},                                        {{1u, 0u, pos_absent}}},
+        // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            meta_check_cache cache;
+            run(cache, {col("f1"), col("f2"), col("f3")});
+
+            // Mismatch: the pos_map is computed from scratch
+            auto res = run(cache, tc.cols);
+            BOOST_TEST(!res.hit);
+            BOOST_TEST(res.pos_map == tc.expected);
+
+            // The new metadata replaces the old one
+            res = run(cache, tc.cols);
+            BOOST_TEST(res.hit);
+            BOOST_TEST(res.pos_map == tc.expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fewer_columns_prefix)
+{
+    // The resultset is a prefix of the cached one
+    meta_check_cache cache;
+    run(cache, {col("f3"), col("f1"), col("f2")});
+
+    auto res = run(cache, {col("f3"), col("f1")});
+    BOOST_TEST(!res.hit);
+    BOOST_TEST(res.pos_map == (pos_map_t{{1u, pos_absent, 0u}}));
+
+    res = run(cache, {col("f3"), col("f1")});
+    BOOST_TEST(res.hit);
+    BOOST_TEST(res.pos_map == (pos_map_t{{1u, pos_absent, 0u}}));
+}
+
+BOOST_AUTO_TEST_CASE(unnamed)
+{
+    // Tuples don't have a name table
+    meta_check_cache cache;
+    pos_map_t pos_map;
+    for (int i = 0; i < 2; ++i)
+    {
+        pos_map_reset(pos_map);
+        cache.on_resultset_start();
+        cache.on_column(pos_map, name_table_t(), col("a"));
+        cache.on_column(pos_map, name_table_t(), col("b"));
+        bool hit = cache.on_resultset_finish(pos_map, name_table_t());
+        BOOST_TEST(hit == (i == 1));
+        BOOST_TEST(pos_map == (pos_map_t{{0u, 1u, pos_absent}}));
+        cache.commit(pos_map);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
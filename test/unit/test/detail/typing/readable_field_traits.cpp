@@ -11,6 +11,7 @@
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/date.hpp>
 #include <boost/mysql/datetime.hpp>
+#include <boost/mysql/decimal.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field.hpp>
@@ -121,12 +122,12 @@ static_assert(is_readable_field<std::string>::value, "");
 static_assert(is_readable_field<string_with_alloc>::value, "");
 static_assert(!is_readable_field<string_with_traits>::value, "");
 static_assert(!is_readable_field<std::wstring>::value, "");
-static_assert(!is_readable_field<string_view>::value, "");
+static_assert(is_readable_field<string_view>::value, "");
 
 // blob types
 static_assert(is_readable_field<blob>::value, "");
 static_assert(is_readable_field<blob_with_alloc>::value, "");
-static_assert(!is_readable_field<blob_view>::value, "");
+static_assert(is_readable_field<blob_view>::value, "");
 
 // references not accepted
 static_assert(!is_readable_field<int&>::value, "");
@@ -168,22 +169,25 @@ constexpr struct cpp_type_descriptor
     const char* name;
     single_field_check_fn check_fn;
 } cpp_type_descriptors[] = {
-    {"int8_t",   &meta_check_field<std::int8_t>       },
-    {"uint8_t",  &meta_check_field<std::uint8_t>      },
-    {"int16_t",  &meta_check_field<std::int16_t>      },
-    {"uint16_t", &meta_check_field<std::uint16_t>     },
-    {"int32_t",  &meta_check_field<std::int32_t>      },
-    {"uint32_t", &meta_check_field<std::uint32_t>     },
-    {"int64_t",  &meta_check_field<std::int64_t>      },
-    {"uint64_t", &meta_check_field<std::uint64_t>     },
-    {"bool",     &meta_check_field<bool>              },
-    {"float",    &meta_check_field<float>             },
-    {"double",   &meta_check_field<double>            },
-    {"date",     &meta_check_field<date>              },
-    {"datetime", &meta_check_field<datetime>          },
-    {"time",     &meta_check_field<boost::mysql::time>},
-    {"string",   &meta_check_field<std::string>       },
-    {"blob",     &meta_check_field<blob>              },
+    {"int8_t",      &meta_check_field<std::int8_t>       },
+    {"uint8_t",     &meta_check_field<std::uint8_t>      },
+    {"int16_t",     &meta_check_field<std::int16_t>      },
+    {"uint16_t",    &meta_check_field<std::uint16_t>     },
+    {"int32_t",     &meta_check_field<std::int32_t>      },
+    {"uint32_t",    &meta_check_field<std::uint32_t>     },
+    {"int64_t",     &meta_check_field<std::int64_t>      },
+    {"uint64_t",    &meta_check_field<std::uint64_t>     },
+    {"bool",        &meta_check_field<bool>              },
+    {"float",       &meta_check_field<float>             },
+    {"double",      &meta_check_field<double>            },
+    {"date",        &meta_check_field<date>              },
+    {"datetime",    &meta_check_field<datetime>          },
+    {"time",        &meta_check_field<boost::mysql::time>},
+    {"string",      &meta_check_field<std::string>       },
+    {"blob",        &meta_check_field<blob>              },
+    {"string_view", &meta_check_field<string_view>       },
+    {"blob_view",   &meta_check_field<blob_view>         },
+    {"decimal",     &meta_check_field<decimal>           },
 };
 constexpr auto cpp_type_descriptors_size = sizeof(cpp_type_descriptors) / sizeof(cpp_type_descriptor);
 
@@ -235,36 +239,36 @@ struct compat_matrix_row
 // Looks like clang-format crashes when it sees this
 // clang-format off
 constexpr std::array<compat_matrix_row, db_type_descriptors_size> compat_matrix{{
-    {{{1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0}}},  // TINYINT
-    {{{0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // TINYINT UNSIGNED
-    {{{0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // SMALLINT
-    {{{0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // SMALLINT UNSIGNED
-    {{{0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // MEDIUMINT
-    {{{0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // MEDIUMINT UNSIGNED
-    {{{0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // INT
-    {{{0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // INT UNSIGNED
-    {{{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // BIGINT
-    {{{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // BIGINT UNSIGNED
-    {{{0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // YEAR
-    {{{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // BIT
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0}}},  // FLOAT
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0}}},  // DOUBLE
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}}},  // DATE
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}}},  // DATETIME
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}}},  // TIMESTAMP
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}}},  // TIME
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // CHAR
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // VARCHAR
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // TEXT
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // ENUM
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // SET
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // JSON
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}}},  // DECIMAL
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}}},  // BINARY
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}}},  // VARBINARY
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}}},  // BLOB
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}}},  // GEOMETRY
-    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}}},  // UNKNOWN
+    {{{1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // TINYINT
+    {{{0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // TINYINT UNSIGNED
+    {{{0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // SMALLINT
+    {{{0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // SMALLINT UNSIGNED
+    {{{0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // MEDIUMINT
+    {{{0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // MEDIUMINT UNSIGNED
+    {{{0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // INT
+    {{{0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // INT UNSIGNED
+    {{{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // BIGINT
+    {{{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // BIGINT UNSIGNED
+    {{{0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // YEAR
+    {{{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},  // BIT
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // FLOAT
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}}},  // DOUBLE
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0}}},  // DATE
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}}},  // DATETIME
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}}},  // TIMESTAMP
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0}}},  // TIME
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0}}},  // CHAR
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0}}},  // VARCHAR
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0}}},  // TEXT
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0}}},  // ENUM
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0}}},  // SET
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0}}},  // JSON
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1}}},  // DECIMAL
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0}}},  // BINARY
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0}}},  // VARBINARY
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0}}},  // BLOB
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0}}},  // GEOMETRY
+    {{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0}}},  // UNKNOWN
 }};
 // clang-format on
 
@@ -478,6 +482,7 @@ BOOST_AUTO_TEST_CASE(success)
         {"time", field_view(maket(10, 1, 1)), parse_and_check<boost::mysql::time>(maket(10, 1, 1))},
         {"string", field_view("abc"), parse_and_check<std::string>("abc")},
         {"blob", field_view(makebv("\0\1")), parse_and_check<blob>({0, 1})},
+        {"decimal", field_view("-10.50"), parse_and_check<decimal>(decimal("-10.50"))},
 
         {"boost_optional_empty",
          field_view(),
@@ -493,6 +498,42 @@ BOOST_AUTO_TEST_CASE(success)
     }
 }
 
+// string_view and blob_view point to the original data, instead of copying it
+BOOST_AUTO_TEST_CASE(string_view_)
+{
+    const char data[] = "abc";
+    string_view actual;
+    auto err = readable_field_traits<string_view>::parse(field_view(string_view(data, 3)), actual);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(actual.data() == data);
+    BOOST_TEST(actual.size() == 3u);
+}
+
+BOOST_AUTO_TEST_CASE(blob_view_)
+{
+    const unsigned char data[] = {0, 1, 2};
+    blob_view actual;
+    auto err = readable_field_traits<blob_view>::parse(field_view(blob_view(data)), actual);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(actual.data() == data);
+    BOOST_TEST(actual.size() == 3u);
+}
+
+BOOST_AUTO_TEST_CASE(optional_string_view)
+{
+    const char data[] = "abc";
+    boost::optional<string_view> actual;
+    using traits_t = readable_field_traits<boost::optional<string_view>>;
+    auto err = traits_t::parse(field_view(string_view(data, 3)), actual);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST_REQUIRE(actual.has_value());
+    BOOST_TEST(actual->data() == data);
+
+    err = traits_t::parse(field_view(), actual);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(!actual.has_value());
+}
+
 // std::optional, which doesn't implement equality or stream operators
 #ifndef BOOST_NO_CXX17_HDR_OPTIONAL
 BOOST_AUTO_TEST_CASE(std_optional_null)
@@ -605,6 +646,13 @@ BOOST_AUTO_TEST_CASE(errors)
 
         {"blob_null",                       field_view(),                    parse_and_discard<blob>                        },
         {"blob_badtype",                    field_view("abc"),               parse_and_discard<blob>                        },
+        {"string_view_null",                field_view(),                    parse_and_discard<string_view>                 },
+        {"string_view_badtype",             field_view(makebv("abc")),       parse_and_discard<string_view>                 },
+        {"blob_view_null",                  field_view(),                    parse_and_discard<blob_view>                   },
+        {"blob_view_badtype",               field_view("abc"),               parse_and_discard<blob_view>                   },
+        {"decimal_null",                    field_view(),                    parse_and_discard<decimal>                     },
+        {"decimal_badtype",                 field_view(4.2),                 parse_and_discard<decimal>                     },
+        {"decimal_badvalue",                field_view("abc"),               parse_and_discard<decimal>                     },
 #ifndef BOOST_NO_CXX17_HDR_OPTIONAL
         {"std_optional_underlying_error",   field_view("a"),                 parse_and_discard<std::optional<std::int8_t>>  },
 #endif
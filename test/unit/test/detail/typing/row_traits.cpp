@@ -9,6 +9,7 @@
 
 #ifdef BOOST_MYSQL_CXX14
 
+#include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
@@ -21,6 +22,7 @@
 
 #include <boost/core/span.hpp>
 #include <boost/describe/class.hpp>
+#include <boost/optional/optional.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <cstddef>
@@ -34,6 +36,7 @@ using namespace boost::mysql::test;
 using boost::span;
 using boost::mysql::detail::get_row_name_table;
 using boost::mysql::detail::get_row_size;
+using boost::mysql::detail::is_borrowed_row;
 using boost::mysql::detail::is_static_row;
 using boost::mysql::detail::meta_check;
 using boost::mysql::detail::name_table_t;
@@ -66,6 +69,13 @@ struct sinherit : s2
 };
 BOOST_DESCRIBE_STRUCT(sinherit, (s2), (double_field))
 
+struct sborrowed
+{
+    std::int32_t i;
+    string_view s;
+};
+BOOST_DESCRIBE_STRUCT(sborrowed, (), (i, s))
+
 // a struct without any relationship with this lib and no describe data
 struct unrelated
 {
@@ -85,6 +95,7 @@ using t1 = std::tuple<double>;
 using t2 = std::tuple<std::int32_t, float>;
 using t3 = std::tuple<std::string, std::int32_t, double>;
 using tbad = std::tuple<int, unrelated, double>;
+using tborrowed = std::tuple<int, boost::optional<blob_view>>;
 
 // is_row_type concept: doesn't inspect individual fields
 static_assert(is_static_row<sempty>::value, "");
@@ -108,6 +119,16 @@ static_assert(!is_static_row<s1&&>::value, "");
 static_assert(!is_static_row<const s1&&>::value, "");
 static_assert(!is_static_row<s1*>::value, "");
 
+// is_borrowed_row: rows pointing into the connection's buffer
+static_assert(!is_borrowed_row<sempty>::value, "");
+static_assert(!is_borrowed_row<s2>::value, "");
+static_assert(!is_borrowed_row<sinherit>::value, "");
+static_assert(is_borrowed_row<sborrowed>::value, "");
+static_assert(!is_borrowed_row<tempty>::value, "");
+static_assert(!is_borrowed_row<t3>::value, "");
+static_assert(is_borrowed_row<tborrowed>::value, "");
+static_assert(is_borrowed_row<std::tuple<string_view>>::value, "");
+
 // Helpers
 void compare_name_tables(name_table_t lhs, name_table_t rhs)
 {
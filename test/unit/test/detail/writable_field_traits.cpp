@@ -6,6 +6,7 @@
 //
 
 #include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/decimal.hpp>
 #include <boost/mysql/field.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/row.hpp>
@@ -93,6 +94,10 @@ static_assert(is_writable_field<double>::value, "");
 static_assert(is_writable_field<boost::mysql::date>::value, "");
 static_assert(is_writable_field<boost::mysql::datetime>::value, "");
 static_assert(is_writable_field<boost::mysql::time>::value, "");
+static_assert(is_writable_field<decimal>::value, "");
+static_assert(is_writable_field<const decimal&>::value, "");
+static_assert(is_writable_field<decimal&&>::value, "");
+static_assert(is_writable_field<boost::optional<decimal>>::value, "");
 
 // bool accepted
 static_assert(is_writable_field<bool>::value, "");
@@ -272,6 +277,7 @@ BOOST_AUTO_TEST_CASE(to_field_)
     BOOST_TEST(writable_field_traits<date>::to_field(date(2020, 1, 2)) == field_view(date(2020, 1, 2)));
     BOOST_TEST(writable_field_traits<datetime>::to_field(dt) == field_view(dt));
     BOOST_TEST(writable_field_traits<boost::mysql::time>::to_field(t) == field_view(t));
+    BOOST_TEST(writable_field_traits<decimal>::to_field(decimal("-10.50")) == field_view("-10.50"));
 
     // Strings
     BOOST_TEST(writable_field_traits<std::string>::to_field(s) == field_view("ljk"));
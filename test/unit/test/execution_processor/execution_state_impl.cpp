@@ -11,12 +11,14 @@
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
+#include <boost/asio/thread_pool.hpp>
 #include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -339,6 +341,37 @@ BOOST_FIXTURE_TEST_CASE(info_string_ownserhip, fixture)
     BOOST_TEST(st.get_info() == "other info");
 }
 
+BOOST_FIXTURE_TEST_CASE(rows_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    add_meta(st, create_meta_r1());
+
+    // Rows are decoded as a batch, in order
+    auto r1 = create_text_row_body(10, "abc");
+    auto r2 = create_text_row_body(20, "cdef");
+    auto r3 = create_text_row_body(30, "gh");
+    boost::span<const std::uint8_t> msgs[] = {r1, r2, r3};
+    auto err = st.on_rows(msgs, output_ref(), fields, decoder);
+    throw_on_error(err, diag);
+    BOOST_TEST(fields == make_fv_vector(10, "abc", 20, "cdef", 30, "gh"));
+}
+
+BOOST_FIXTURE_TEST_CASE(error_deserializing_rows_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    add_meta(st, create_meta_r1());
+    auto r1 = create_text_row_body(42, "abc");
+    auto bad_row = create_text_row_body(42, "abc");
+    bad_row.push_back(0xff);
+
+    boost::span<const std::uint8_t> msgs[] = {r1, bad_row};
+    auto err = st.on_rows(msgs, output_ref(), fields, decoder);
+
+    BOOST_TEST(err == client_errc::extra_bytes);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
 {
     add_meta(st, create_meta_r1());
@@ -9,6 +9,7 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -18,6 +19,8 @@
 #include <boost/mysql/detail/execution_processor/results_impl.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
+#include <boost/asio/thread_pool.hpp>
+#include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "execution_processor_helpers.hpp"
@@ -553,6 +556,44 @@ BOOST_FIXTURE_TEST_CASE(empty_row_batch, fixture)
     BOOST_TEST(r.get_rows(0) == makerows(2));  // empty but with 2 cols
 }
 
+BOOST_FIXTURE_TEST_CASE(row_batches_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    add_meta(r, create_meta_r1());
+
+    // Buffers
+    auto r1 = create_text_row_body(42, "abc");
+    auto r2 = create_text_row_body(50, "bdef");
+    auto r3 = create_text_row_body(60, "pov");
+
+    // First batch
+    r.on_row_batch_start();
+    boost::span<const std::uint8_t> msgs1[] = {r1, r2};
+    auto err = r.on_rows(msgs1, output_ref(), fields, decoder);
+    throw_on_error(err);
+    r.on_row_batch_finish();
+
+    // Second batch, mixed with individual rows
+    r.on_row_batch_start();
+    boost::span<const std::uint8_t> msgs2[] = {r3};
+    err = r.on_rows(msgs2, output_ref(), fields, decoder);
+    throw_on_error(err);
+    err = r.on_row(r1, output_ref(), fields);
+    throw_on_error(err);
+
+    // End of resultset
+    err = r.on_row_ok_packet(create_ok_r1());
+    throw_on_error(err);
+    r.on_row_batch_finish();
+
+    // Verify
+    BOOST_TEST(r.is_complete());
+    BOOST_TEST(r.num_resultsets() == 1u);
+    BOOST_TEST(r.get_rows(0) == makerows(2, 42, "abc", 50, "bdef", 60, "pov", 42, "abc"));
+    BOOST_TEST(fields.empty());  // unused
+}
+
 BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
 {
     add_meta(r, create_meta_r1());
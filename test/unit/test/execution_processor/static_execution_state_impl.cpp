@@ -12,6 +12,7 @@
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 #include <boost/mysql/throw_on_error.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
@@ -19,6 +20,7 @@
 #include <boost/mysql/detail/resultset_encoding.hpp>
 #include <boost/mysql/detail/typing/get_type_index.hpp>
 
+#include <boost/asio/thread_pool.hpp>
 #include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -476,6 +478,63 @@ BOOST_FIXTURE_TEST_CASE(error_meta_mismatch_head, fixture)
     BOOST_TEST(diag.client_message() == expected_msg);
 }
 
+BOOST_FIXTURE_TEST_CASE(rows_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    static_execution_state_impl<row1> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+
+    // Rows are written starting at the ref's offset
+    auto r1 = create_text_row_body(42, "abc");
+    auto r2 = create_text_row_body(43, "def");
+    auto r3 = create_text_row_body(44, "ghi");
+    span<const std::uint8_t> msgs[] = {r1, r2, r3};
+    row1 storage[4]{};
+    auto err = st.on_rows(msgs, create_ref<row1>(span<row1>(storage), 1), fields, decoder);
+    throw_on_error(err, diag);
+
+    // Verify results
+    BOOST_TEST(storage[0] == row1{});
+    BOOST_TEST((storage[1] == row1{"abc", 42}));
+    BOOST_TEST((storage[2] == row1{"def", 43}));
+    BOOST_TEST((storage[3] == row1{"ghi", 44}));
+    BOOST_TEST(fields.size() == 6u);
+}
+
+BOOST_FIXTURE_TEST_CASE(error_parsing_rows_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    static_execution_state_impl<row1> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+    auto r1 = create_text_row_body(42, "abc");
+    auto bad_row = create_text_row_body(nullptr, "abc");  // should not be NULL
+
+    span<const std::uint8_t> msgs[] = {r1, bad_row};
+    row1 storage[2]{};
+    auto err = st.on_rows(msgs, create_ref<row1>(span<row1>(storage), 0), fields, decoder);
+    BOOST_TEST(err == client_errc::static_row_parsing_error);
+    BOOST_TEST((storage[0] == row1{"abc", 42}));
+}
+
+BOOST_FIXTURE_TEST_CASE(error_type_index_mismatch_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    static_execution_state_impl<row1, row2> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+    auto r1 = create_text_row_body(42, "abc");
+
+    span<const std::uint8_t> msgs[] = {r1};
+    row2 storage[1]{};
+    auto err = st.on_rows(msgs, create_ref<row1, row2>(span<row2>(storage), 0), fields, decoder);
+    BOOST_TEST(err == client_errc::row_type_mismatch);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
 {
     static_execution_state_impl<row1> stp;
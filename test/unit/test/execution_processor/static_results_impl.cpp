@@ -12,12 +12,15 @@
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 #include <boost/mysql/throw_on_error.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/static_results_impl.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
+#include <boost/asio/thread_pool.hpp>
+#include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "execution_processor_helpers.hpp"
@@ -540,6 +543,34 @@ BOOST_FIXTURE_TEST_CASE(error_meta_mismatch_head, fixture)
     BOOST_TEST(diag.client_message() == expected_msg);
 }
 
+BOOST_FIXTURE_TEST_CASE(rows_parallel, fixture)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    static_results_impl<row1> rt;
+    auto& r = rt.get_interface();
+    add_meta(r, create_meta_r1());
+
+    // Rows are appended in order
+    auto r1 = create_text_row_body(42, "abc");
+    auto r2 = create_text_row_body(43, "def");
+    auto r3 = create_text_row_body(44, "ghi");
+    boost::span<const std::uint8_t> msgs[] = {r1, r2, r3};
+    auto err = r.on_rows(msgs, output_ref(), fields, decoder);
+    throw_on_error(err, diag);
+
+    // End of resultset
+    add_ok(r, create_ok_r1());
+
+    // Verify results
+    std::vector<row1> expected_r1{
+        {"abc", 42},
+        {"def", 43},
+        {"ghi", 44},
+    };
+    check_rows(rt.get_rows<0>(), expected_r1);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
 {
     static_results_impl<row1> rt;
@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/connection_observer.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/multiplexed_connection.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <boost/asio/bind_cancellation_slot.hpp>
+#include <boost/asio/cancellation_signal.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/replay_fixture.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+namespace asio = boost::asio;
+
+BOOST_AUTO_TEST_SUITE(test_multiplexed_connection)
+
+// Counts the number of writes issued to the server.
+// Optionally emits a cancellation signal when the first write starts
+struct write_counter final : connection_observer
+{
+    std::size_t num_writes{};
+    asio::cancellation_signal* cancel_on_write{};
+
+    void on_io_start(wire_event type) override
+    {
+        if (type == wire_event::write)
+        {
+            if (num_writes++ == 0u && cancel_on_write)
+                cancel_on_write->emit(asio::cancellation_type::terminal);
+        }
+    }
+};
+
+// Adds a multiplexed connection on top of a replay
+struct fixture : replay_fixture
+{
+    write_counter obs;
+
+    fixture(const std::vector<std::uint8_t>& bytes = {}) : replay_fixture(bytes) {}
+
+    multiplexed_connection create_connection()
+    {
+        return multiplexed_connection(any_connection(ctx, make_params(&obs)));
+    }
+};
+
+// Requests issued concurrently are written together and their responses
+// dispatched to the right operation, even if some of them fail
+BOOST_AUTO_TEST_CASE(concurrent_requests)
+{
+    auto varchar_meta = meta_builder().type(column_type::varchar);
+    const auto bytes = buffer_builder()
+                           .add(create_ok_frame(1, ok_builder().affected_rows(42u).build()))
+                           .add(err_builder()
+                                    .seqnum(1)
+                                    .code(common_server_errc::er_bad_db_error)
+                                    .message("my_message")
+                                    .build_frame())
+                           .add(create_frame(1, {0x01}))  // 1 column
+                           .add(create_coldef_frame(2, varchar_meta.build_coldef()))
+                           .add(create_text_row_message(3, "abc"))
+                           .add(create_eof_frame(4, ok_builder().build()))
+                           .build();
+    fixture fix(bytes);
+    auto conn = fix.create_connection();
+
+    results r1, r2, r3;
+    diagnostics diag1, diag2, diag3;
+    error_code ec1, ec2, ec3, run_ec = client_errc::wrong_num_params;
+    conn.async_run([&](error_code ec) { run_ec = ec; });
+    conn.async_execute("SELECT 1", r1, diag1, [&](error_code ec) { ec1 = ec; });
+    conn.async_execute("SELECT 2", r2, diag2, [&](error_code ec) { ec2 = ec; });
+    conn.async_execute("SELECT 3", r3, diag3, [&](error_code ec) {
+        ec3 = ec;
+        conn.cancel();
+    });
+    fix.ctx.run();
+
+    // Responses were delivered in order
+    BOOST_TEST(ec1 == error_code());
+    BOOST_TEST(r1.affected_rows() == 42u);
+    BOOST_TEST(ec2 == error_code(common_server_errc::er_bad_db_error));
+    BOOST_TEST(diag2 == create_server_diag("my_message"));
+    BOOST_TEST(ec3 == error_code());
+    BOOST_TEST_REQUIRE(r3.rows().size() == 1u);
+    BOOST_TEST(r3.rows().at(0).at(0).as_string() == "abc");
+
+    // Cancelling makes run exit successfully
+    BOOST_TEST(run_ec == error_code());
+
+    // All requests were written at once
+    BOOST_TEST(fix.obs.num_writes == 1u);
+}
+
+// Fatal errors fail all the requests and make run exit
+BOOST_AUTO_TEST_CASE(fatal_error)
+{
+    const auto bytes = create_ok_frame(1, ok_builder().build());
+    fixture fix(bytes);
+    auto conn = fix.create_connection();
+
+    results r1, r2;
+    diagnostics diag1, diag2;
+    error_code ec1 = client_errc::wrong_num_params, ec2, run_ec;
+    conn.async_run([&](error_code ec) { run_ec = ec; });
+    conn.async_execute("SELECT 1", r1, diag1, [&](error_code ec) { ec1 = ec; });
+    conn.async_execute("SELECT 2", r2, diag2, [&](error_code ec) { ec2 = ec; });
+    fix.ctx.run();
+
+    BOOST_TEST(ec1 == error_code());
+    BOOST_TEST(ec2 == error_code(asio::error::eof));
+    BOOST_TEST(run_ec == error_code(asio::error::eof));
+}
+
+// Requests issued after cancel fail without being sent
+BOOST_AUTO_TEST_CASE(cancel_before_run)
+{
+    fixture fix;
+    auto conn = fix.create_connection();
+    conn.cancel();
+
+    results r;
+    diagnostics diag;
+    error_code ec, run_ec = client_errc::wrong_num_params;
+    conn.async_execute("SELECT 1", r, diag, [&](error_code err) { ec = err; });
+    conn.async_run([&](error_code err) { run_ec = err; });
+    fix.ctx.run();
+
+    BOOST_TEST(ec == error_code(client_errc::cancelled));
+    BOOST_TEST(run_ec == error_code());
+    BOOST_TEST(fix.obs.num_writes == 0u);
+}
+
+// Cancelling a request that hasn't been sent removes it from the queue
+BOOST_AUTO_TEST_CASE(cancel_pending)
+{
+    fixture fix;
+    auto conn = fix.create_connection();
+
+    results r;
+    diagnostics diag;
+    asio::cancellation_signal sig;
+    error_code ec;
+    conn.async_execute(
+        "SELECT 1",
+        r,
+        diag,
+        asio::bind_cancellation_slot(sig.slot(), [&](error_code err) { ec = err; })
+    );
+
+    // async_run is not outstanding, so the request stays queued
+    fix.ctx.poll();
+    sig.emit(asio::cancellation_type::terminal);
+    fix.ctx.run();
+
+    BOOST_TEST(ec == error_code(client_errc::cancelled));
+
+    // The request is not sent when async_run is called
+    fix.ctx.restart();
+    conn.cancel();
+    conn.async_run([](error_code) {});
+    fix.ctx.run();
+    BOOST_TEST(fix.obs.num_writes == 0u);
+}
+
+// Cancelling a request that was already sent waits for its response,
+// which is read into the results object, and reports the cancellation
+BOOST_AUTO_TEST_CASE(cancel_in_flight)
+{
+    fixture fix(create_ok_frame(1, ok_builder().affected_rows(42u).build()));
+    asio::cancellation_signal sig;
+    fix.obs.cancel_on_write = &sig;
+    auto conn = fix.create_connection();
+
+    results r;
+    diagnostics diag;
+    error_code ec, run_ec = client_errc::wrong_num_params;
+    conn.async_run([&](error_code err) { run_ec = err; });
+    conn.async_execute(
+        "SELECT 1",
+        r,
+        diag,
+        asio::bind_cancellation_slot(sig.slot(), [&](error_code err) {
+            ec = err;
+            conn.cancel();
+        })
+    );
+    fix.ctx.run();
+
+    BOOST_TEST(ec == error_code(client_errc::cancelled));
+    BOOST_TEST(run_ec == error_code());
+    BOOST_TEST(fix.obs.num_writes == 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 //
 
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 
 #include <boost/mysql/detail/any_stream.hpp>
 
@@ -21,11 +22,13 @@
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <thread>
 
 #include "test_common/netfun_maker.hpp"
 #include "test_common/tracker_executor.hpp"
@@ -181,6 +184,31 @@ struct mock_algo : sansio_algorithm, asio::coroutine
     }
 };
 
+// Requests decoding rows, recording the thread where decoding happens
+struct mock_decode_algo : sansio_algorithm, asio::coroutine
+{
+    std::thread::id decode_thread;
+
+    mock_decode_algo(connection_state_data& st) : sansio_algorithm(st) {}
+
+    static void decode_fn(void* self)
+    {
+        static_cast<mock_decode_algo*>(self)->decode_thread = std::this_thread::get_id();
+    }
+
+    next_action resume(error_code ec)
+    {
+        BOOST_ASIO_CORO_REENTER(*this)
+        {
+            BOOST_TEST(ec == error_code());
+            st_->pending_decode_fn = &decode_fn;
+            st_->pending_decode_ctx = this;
+            BOOST_ASIO_CORO_YIELD return next_action::decode_rows();
+        }
+        return next_action();
+    }
+};
+
 // Verify that we correctly post for immediate completions,
 // and we don't do extra posts if we've done I/O
 BOOST_AUTO_TEST_CASE(async_completions)
@@ -217,6 +245,41 @@ BOOST_AUTO_TEST_CASE(async_completions)
     }
 }
 
+// Async ops decode rows in the decoder's executor, then resume in the stream's one.
+// Sync ops decode in the calling thread. No I/O is performed in either case
+BOOST_AUTO_TEST_CASE(decode_rows)
+{
+    struct
+    {
+        const char* name;
+        netfun_maker::signature fn;
+        bool decodes_in_caller;
+    } test_cases[] = {
+        {"sync",  sync_fn,  true },
+        {"async", async_fn, false},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            // Setup
+            asio::thread_pool pool(1);
+            boost::mysql::parallel_row_decoder decoder(pool.get_executor());
+            connection_state_data st(512);
+            st.row_decoder = &decoder;
+            mock_decode_algo algo(st);
+            asio::io_context ctx;
+            mock_stream stream(ctx.get_executor());
+
+            // Run the algo. validate checks that the token's executor receives a dispatch
+            tc.fn(stream, algo).validate_no_error();
+            BOOST_TEST(stream.calls.size() == 0u);
+            BOOST_TEST((algo.decode_thread == std::this_thread::get_id()) == tc.decodes_in_caller);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(read_ssl)
 {
     struct
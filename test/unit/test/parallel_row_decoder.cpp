@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "test_common/printing.hpp"
+
+using namespace boost::mysql;
+
+BOOST_AUTO_TEST_SUITE(test_parallel_row_decoder)
+
+// Records the chunks processed by run()
+struct chunk_recorder
+{
+    std::mutex mtx;
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    std::vector<std::thread::id> threads;
+
+    error_code operator()(std::size_t first, std::size_t last)
+    {
+        std::lock_guard<std::mutex> guard(mtx);
+        chunks.emplace_back(first, last);
+        threads.push_back(std::this_thread::get_id());
+        return error_code();
+    }
+
+    // Checks that chunks cover [0, num_items) without overlapping
+    void validate(std::size_t num_items)
+    {
+        std::vector<int> seen(num_items, 0);
+        for (const auto& c : chunks)
+        {
+            BOOST_TEST(c.first < c.second);
+            for (std::size_t i = c.first; i < c.second; ++i)
+                ++seen[i];
+        }
+        for (std::size_t i = 0; i < num_items; ++i)
+            BOOST_TEST(seen[i] == 1);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(ctor)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 4, 10);
+    BOOST_TEST((decoder.get_executor() == pool.get_executor()));
+    BOOST_TEST(decoder.max_tasks() == 4u);
+    BOOST_TEST(decoder.min_rows_per_task() == 10u);
+}
+
+BOOST_AUTO_TEST_CASE(ctor_defaults)
+{
+    // Zero values are replaced by sensible ones
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 0, 0);
+    BOOST_TEST(decoder.max_tasks() >= 1u);
+    BOOST_TEST(decoder.min_rows_per_task() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(splits)
+{
+    // Ranges are only split if there are at least 2 chunks of min_rows_per_task items
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 4, 10);
+    BOOST_TEST(!decoder.splits(0u));
+    BOOST_TEST(!decoder.splits(10u));
+    BOOST_TEST(!decoder.splits(19u));
+    BOOST_TEST(decoder.splits(20u));
+    BOOST_TEST(decoder.splits(1000u));
+
+    // Decoders with a single task never split
+    parallel_row_decoder single(pool.get_executor(), 1, 1);
+    BOOST_TEST(!single.splits(1000u));
+}
+
+BOOST_AUTO_TEST_CASE(run_chunks)
+{
+    // Setup
+    boost::asio::thread_pool pool(4);
+    parallel_row_decoder decoder(pool.get_executor(), 4, 10);
+    chunk_recorder rec;
+
+    // Run. The range is split in 4 chunks
+    auto err = decoder.run(1000, rec);
+
+    // Validate
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(rec.chunks.size() == 4u);
+    rec.validate(1000);
+}
+
+BOOST_AUTO_TEST_CASE(run_chunks_uneven)
+{
+    // Setup
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 3, 1);
+    chunk_recorder rec;
+
+    // Run. The last chunk is smaller
+    auto err = decoder.run(10, rec);
+
+    // Validate
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(rec.chunks.size() == 3u);
+    rec.validate(10);
+}
+
+BOOST_AUTO_TEST_CASE(run_min_rows_per_task)
+{
+    // Setup
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 8, 100);
+    chunk_recorder rec;
+
+    // Run. Chunks are not smaller than min_rows_per_task
+    auto err = decoder.run(350, rec);
+
+    // Validate
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(rec.chunks.size() == 3u);
+    for (const auto& c : rec.chunks)
+        BOOST_TEST(c.second - c.first >= 100u);
+    rec.validate(350);
+}
+
+BOOST_AUTO_TEST_CASE(run_small_batch_inline)
+{
+    // Setup
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 4, 100);
+    chunk_recorder rec;
+
+    // Run. Batches that fit in a single chunk are processed by the calling thread
+    auto err = decoder.run(150, rec);
+
+    // Validate
+    BOOST_TEST(err == error_code());
+    BOOST_TEST_REQUIRE(rec.chunks.size() == 1u);
+    BOOST_TEST(rec.chunks[0].first == 0u);
+    BOOST_TEST(rec.chunks[0].second == 150u);
+    BOOST_TEST((rec.threads[0] == std::this_thread::get_id()));
+}
+
+BOOST_AUTO_TEST_CASE(run_single_task)
+{
+    // Setup
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 1, 1);
+    chunk_recorder rec;
+
+    // Run
+    auto err = decoder.run(1000, rec);
+
+    // Validate
+    BOOST_TEST(err == error_code());
+    BOOST_TEST_REQUIRE(rec.chunks.size() == 1u);
+    BOOST_TEST((rec.threads[0] == std::this_thread::get_id()));
+}
+
+BOOST_AUTO_TEST_CASE(run_empty)
+{
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 4, 1);
+    bool called = false;
+
+    auto err = decoder.run(0, [&called](std::size_t, std::size_t) {
+        called = true;
+        return error_code();
+    });
+
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(!called);
+}
+
+BOOST_AUTO_TEST_CASE(run_executor_not_running)
+{
+    // Setup. Posted tasks never run
+    boost::asio::io_context ctx;
+    parallel_row_decoder decoder(ctx.get_executor(), 4, 1);
+    chunk_recorder rec;
+
+    // Run. The calling thread processes all the chunks
+    auto err = decoder.run(100, rec);
+
+    // Validate
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(rec.chunks.size() == 4u);
+    rec.validate(100);
+    for (auto id : rec.threads)
+        BOOST_TEST((id == std::this_thread::get_id()));
+
+    // Tasks posted by run() exit without processing anything
+    ctx.run();
+    BOOST_TEST(rec.chunks.size() == 4u);
+}
+
+BOOST_AUTO_TEST_CASE(run_error)
+{
+    // Setup
+    boost::asio::thread_pool pool(4);
+    parallel_row_decoder decoder(pool.get_executor(), 4, 1);
+    std::atomic<std::size_t> num_calls{0};
+
+    // Run. A chunk fails
+    auto err = decoder.run(100, [&num_calls](std::size_t first, std::size_t) -> error_code {
+        ++num_calls;
+        return first == 0u ? client_errc::extra_bytes : error_code();
+    });
+
+    // Validate. Some chunks may have been skipped
+    BOOST_TEST(err == client_errc::extra_bytes);
+    BOOST_TEST(num_calls.load() >= 1u);
+    BOOST_TEST(num_calls.load() <= 4u);
+}
+
+BOOST_AUTO_TEST_CASE(run_error_skips_chunks)
+{
+    // Setup. Tasks never run, so chunks are processed in order by the calling thread
+    boost::asio::io_context ctx;
+    parallel_row_decoder decoder(ctx.get_executor(), 4, 1);
+    chunk_recorder rec;
+
+    // Run. The second chunk fails
+    auto err = decoder.run(100, [&rec](std::size_t first, std::size_t last) -> error_code {
+        rec(first, last);
+        return first == 25u ? client_errc::incomplete_message : error_code();
+    });
+
+    // Validate
+    BOOST_TEST(err == client_errc::incomplete_message);
+    BOOST_TEST(rec.chunks.size() == 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -124,6 +124,26 @@ BOOST_AUTO_TEST_CASE(invalid_params)
             [](pool_params& p) { p.ping_timeout = (std::chrono::steady_clock::duration::min)(); },
             "pool_params::ping_timeout must not be negative"
         },
+        {
+            "dns_cache_ttl < 0",
+            [](pool_params& p) { p.dns_cache_ttl = std::chrono::seconds(-1); },
+            "pool_params::dns_cache_ttl must not be negative"
+        },
+        {
+            "connect_attempt_timeout < 0",
+            [](pool_params& p) { p.connect_attempt_timeout = std::chrono::seconds(-1); },
+            "pool_params::connect_attempt_timeout must not be negative"
+        },
+        {
+            "max_retry_interval < 0",
+            [](pool_params& p) { p.max_retry_interval = std::chrono::seconds(-1); },
+            "pool_params::max_retry_interval must not be negative"
+        },
+        {
+            "min_connect_interval < 0",
+            [](pool_params& p) { p.min_connect_interval = std::chrono::seconds(-1); },
+            "pool_params::min_connect_interval must not be negative"
+        },
   // clang-format on
     };
 
@@ -183,6 +203,22 @@ BOOST_AUTO_TEST_CASE(valid_params)
             "ping_timeout == max",
             [](pool_params& p) { p.ping_timeout = (std::chrono::steady_clock::duration::max)(); },
         },
+        {
+            "dns_cache_ttl == 0",
+            [](pool_params& p) { p.dns_cache_ttl = std::chrono::seconds(0); },
+        },
+        {
+            "connect_attempt_timeout == 0",
+            [](pool_params& p) { p.connect_attempt_timeout = std::chrono::seconds(0); },
+        },
+        {
+            "max_retry_interval == max",
+            [](pool_params& p) { p.max_retry_interval = (std::chrono::steady_clock::duration::max)(); },
+        },
+        {
+            "min_connect_interval == max",
+            [](pool_params& p) { p.min_connect_interval = (std::chrono::steady_clock::duration::max)(); },
+        },
   // clang-format on
     };
 
@@ -197,4 +233,65 @@ BOOST_AUTO_TEST_CASE(valid_params)
     }
 }
 
+BOOST_AUTO_TEST_CASE(dns_cache)
+{
+    // The cache is only created when a TTL is set, and is shared by all connections
+    pool_params params;
+    params.dns_cache_ttl = std::chrono::seconds(10);
+    params.connect_attempt_timeout = std::chrono::seconds(2);
+    auto internal = detail::make_internal_pool_params(std::move(params));
+    BOOST_TEST_REQUIRE(internal.dns_cache != nullptr);
+    BOOST_TEST((internal.dns_cache->ttl() == std::chrono::seconds(10)));
+    auto ctor_params = internal.make_ctor_params();
+    BOOST_TEST(ctor_params.dns_cache == internal.dns_cache.get());
+    BOOST_TEST((ctor_params.connect_attempt_timeout == std::chrono::seconds(2)));
+
+    // Disabled by default
+    auto internal2 = detail::make_internal_pool_params(pool_params());
+    BOOST_TEST(internal2.dns_cache == nullptr);
+    BOOST_TEST(internal2.make_ctor_params().dns_cache == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(tls_session_reuse)
+{
+    // The cache is only created when requested, and is shared by all connections
+    pool_params params;
+    params.reuse_tls_sessions = true;
+    auto internal = detail::make_internal_pool_params(std::move(params));
+    BOOST_TEST_REQUIRE(internal.tls_sessions != nullptr);
+    BOOST_TEST(internal.make_ctor_params().tls_sessions == internal.tls_sessions.get());
+
+    // Disabled by default
+    auto internal2 = detail::make_internal_pool_params(pool_params());
+    BOOST_TEST(internal2.tls_sessions == nullptr);
+    BOOST_TEST(internal2.make_ctor_params().tls_sessions == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(observer)
+{
+    // The observer is shared by all connections
+    connection_observer obs;
+    pool_params params;
+    params.observer = &obs;
+    auto internal = detail::make_internal_pool_params(std::move(params));
+    BOOST_TEST(internal.make_ctor_params().observer == &obs);
+
+    // Unset by default
+    auto internal2 = detail::make_internal_pool_params(pool_params());
+    BOOST_TEST(internal2.make_ctor_params().observer == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(statements)
+{
+    pool_params params;
+    params.statements = {"SELECT 1", "SELECT ?"};
+    auto internal = detail::make_internal_pool_params(std::move(params));
+    BOOST_TEST_REQUIRE(internal.statements.size() == 2u);
+    BOOST_TEST(internal.statements[0] == "SELECT 1");
+    BOOST_TEST(internal.statements[1] == "SELECT ?");
+
+    // Empty by default
+    BOOST_TEST(detail::make_internal_pool_params(pool_params()).statements.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,749 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/row_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/binlog.hpp>
+#include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "operators.hpp"
+#include "serialization_test.hpp"
+#include "test_common/create_basic.hpp"
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/printing.hpp"
+#include "test_unit/create_binlog_event.hpp"
+#include "test_unit/create_err.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using boost::span;
+using detail::binlog_column_type;
+using detail::binlog_state_impl;
+using detail::db_flavor;
+using detail::deserialize_errc;
+using std::chrono::hours;
+using std::chrono::microseconds;
+using std::chrono::minutes;
+using std::chrono::seconds;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_binlog)
+
+//
+// Commands
+//
+BOOST_AUTO_TEST_CASE(register_replica_command_serialization)
+{
+    detail::register_replica_command cmd{42};
+    const std::uint8_t serialized[] = {0x15, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    do_serialize_toplevel_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(binlog_dump_command_serialization)
+{
+    detail::binlog_dump_command cmd{42, "bin.01", 260, {}, false};
+    const std::uint8_t serialized[] = {
+        0x12, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x62, 0x69, 0x6e, 0x2e, 0x30, 0x31,
+    };
+    do_serialize_toplevel_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(binlog_dump_command_serialization_non_blocking)
+{
+    detail::binlog_dump_command cmd{42, "", 4, {}, true};
+    const std::uint8_t serialized[] = {0x12, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00};
+    do_serialize_toplevel_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(binlog_dump_command_serialization_gtid)
+{
+    const std::uint8_t gtid_set[] = {0x01, 0x02};
+    detail::binlog_dump_command cmd{42, "", 4, gtid_set, false};
+    const std::uint8_t serialized[] = {
+        0x1e, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02,
+    };
+    do_serialize_toplevel_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(binlog_dump_command_serialization_large_position)
+{
+    // Positions that don't fit in 4 bytes require COM_BINLOG_DUMP_GTID
+    detail::binlog_dump_command cmd{42, "f", 0x100000000, {}, false};
+    const std::uint8_t serialized[] = {
+        0x1e, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    };
+    do_serialize_toplevel_test(cmd, serialized);
+}
+
+//
+// Values
+//
+struct value_sample
+{
+    const char* name;
+    binlog_column_type type;
+    std::uint16_t meta;
+    bool is_unsigned;
+    std::vector<std::uint8_t> serialized;
+    field_view expected;
+};
+
+BOOST_AUTO_TEST_CASE(value_success)
+{
+    const std::uint8_t abc[] = {0x61, 0x62, 0x63};
+    const std::uint8_t packed_decimal[] = {0x80, 0x7b, 0x2d};
+    const value_sample test_cases[] = {
+        {"tiny_signed", binlog_column_type::tiny, 0, false, {0xff}, field_view(-1)},
+        {"tiny_unsigned", binlog_column_type::tiny, 0, true, {0xff}, field_view(255u)},
+        {"short", binlog_column_type::short_, 0, false, {0xfe, 0xff}, field_view(-2)},
+        {"int24_signed", binlog_column_type::int24, 0, false, {0xff, 0xff, 0xff}, field_view(-1)},
+        {"int24_unsigned", binlog_column_type::int24, 0, true, {0xff, 0xff, 0xff}, field_view(0xffffffu)},
+        {"int24_positive", binlog_column_type::int24, 0, false, {0x01, 0x02, 0x03}, field_view(0x030201)},
+        {"long", binlog_column_type::long_, 0, true, {0xff, 0xff, 0xff, 0xff}, field_view(0xffffffffu)},
+        {"longlong",
+         binlog_column_type::longlong,
+         0,
+         false,
+         std::vector<std::uint8_t>(8, 0xff),
+         field_view(-1)},
+        {"double",
+         binlog_column_type::double_,
+         8,
+         false,
+         {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40},
+         field_view(2.5)},
+        {"year", binlog_column_type::year, 0, false, {0x6e}, field_view(2010u)},
+        {"year_zero", binlog_column_type::year, 0, false, {0x00}, field_view(0u)},
+        {"date", binlog_column_type::date, 0, false, {0x4b, 0xb5, 0x0f}, field_view(date(2010, 10, 11))},
+        {"date_zero", binlog_column_type::date, 0, false, {0x00, 0x00, 0x00}, field_view(date())},
+        {"datetime2",
+         binlog_column_type::datetime2,
+         0,
+         false,
+         {0x99, 0x87, 0x16, 0xc3, 0x4e},
+         field_view(datetime(2010, 10, 11, 12, 13, 14))},
+        {"datetime2_decimals2",
+         binlog_column_type::datetime2,
+         2,
+         false,
+         {0x99, 0x87, 0x16, 0xc3, 0x4e, 0x0c},
+         field_view(datetime(2010, 10, 11, 12, 13, 14, 120000))},
+        {"datetime2_decimals6",
+         binlog_column_type::datetime2,
+         6,
+         false,
+         {0x99, 0x87, 0x16, 0xc3, 0x4e, 0x01, 0xe2, 0x40},
+         field_view(datetime(2010, 10, 11, 12, 13, 14, 123456))},
+        {"datetime2_zero",
+         binlog_column_type::datetime2,
+         0,
+         false,
+         {0x80, 0x00, 0x00, 0x00, 0x00},
+         field_view(datetime())},
+        {"timestamp2",
+         binlog_column_type::timestamp2,
+         0,
+         false,
+         {0x00, 0x00, 0x00, 0x01},
+         field_view(datetime(1970, 1, 1, 0, 0, 1))},
+        {"timestamp2_decimals4",
+         binlog_column_type::timestamp2,
+         4,
+         false,
+         {0x00, 0x00, 0x00, 0x01, 0x04, 0xd2},
+         field_view(datetime(1970, 1, 1, 0, 0, 1, 123400))},
+        {"timestamp2_zero",
+         binlog_column_type::timestamp2,
+         0,
+         false,
+         {0x00, 0x00, 0x00, 0x00},
+         field_view(datetime())},
+        {"time2",
+         binlog_column_type::time2,
+         0,
+         false,
+         {0x80, 0xc3, 0x4e},
+         field_view(hours(12) + minutes(13) + seconds(14))},
+        {"time2_negative",
+         binlog_column_type::time2,
+         0,
+         false,
+         {0x7f, 0x3c, 0xb2},
+         field_view(-(hours(12) + minutes(13) + seconds(14)))},
+        {"time2_decimals6",
+         binlog_column_type::time2,
+         6,
+         false,
+         {0x80, 0xc3, 0x4e, 0x01, 0xe2, 0x40},
+         field_view(hours(12) + minutes(13) + seconds(14) + microseconds(123456))},
+        {"time2_decimals6_negative",
+         binlog_column_type::time2,
+         6,
+         false,
+         {0x7f, 0x3c, 0xb1, 0xfe, 0x1d, 0xc0},
+         field_view(-(hours(12) + minutes(13) + seconds(14) + microseconds(123456)))},
+        {"time2_decimals1_negative",
+         binlog_column_type::time2,
+         1,
+         false,
+         {0x7f, 0xff, 0xfe, 0xce},
+         field_view(-(seconds(1) + microseconds(500000)))},
+        {"varchar", binlog_column_type::varchar, 10, false, {0x03, 0x61, 0x62, 0x63}, field_view("abc")},
+        {"varchar_long",
+         binlog_column_type::varchar,
+         300,
+         false,
+         {0x03, 0x00, 0x61, 0x62, 0x63},
+         field_view("abc")},
+        {"string", binlog_column_type::string, 0xfe0a, false, {0x03, 0x61, 0x62, 0x63}, field_view("abc")},
+        {"string_long",
+         binlog_column_type::string,
+         0xee2c,  // 300 characters, with the upper bits stored in the type
+         false,
+         {0x03, 0x00, 0x61, 0x62, 0x63},
+         field_view("abc")},
+        {"enum", binlog_column_type::string, 0xf701, false, {0x02}, field_view(2u)},
+        {"set", binlog_column_type::string, 0xf802, false, {0x05, 0x01}, field_view(0x105u)},
+        {"bit", binlog_column_type::bit, 0x0102, false, {0x01, 0x02}, field_view(0x0102u)},
+        {"blob",
+         binlog_column_type::blob,
+         2,
+         false,
+         {0x03, 0x00, 0x61, 0x62, 0x63},
+         field_view(blob_view(abc))},
+        {"json",
+         binlog_column_type::json,
+         4,
+         false,
+         {0x03, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63},
+         field_view(blob_view(abc))},
+        {"decimal",
+         binlog_column_type::newdecimal,
+         0x0502,
+         false,
+         {0x80, 0x7b, 0x2d},
+         field_view(blob_view(packed_decimal))},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            deserialization_buffer buffer(tc.serialized);
+            detail::deserialization_context ctx(buffer.data(), buffer.size());
+            field_view actual;
+            auto err = detail::deserialize_binlog_value(ctx, tc.type, tc.meta, tc.is_unsigned, actual);
+            BOOST_TEST(err == deserialize_errc::ok);
+            BOOST_TEST(actual == tc.expected);
+            BOOST_TEST(ctx.empty());  // all bytes consumed
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(value_error)
+{
+    struct
+    {
+        const char* name;
+        binlog_column_type type;
+        std::uint16_t meta;
+        std::vector<std::uint8_t> serialized;
+        deserialize_errc expected;
+    } test_cases[] = {
+        {"long_incomplete", binlog_column_type::long_, 0, {0x01, 0x02}, deserialize_errc::incomplete_message},
+        {"varchar_incomplete",
+         binlog_column_type::varchar,
+         10,
+         {0x03, 0x61},
+         deserialize_errc::incomplete_message},
+        {"datetime2_incomplete",
+         binlog_column_type::datetime2,
+         6,
+         {0x99, 0x87, 0x16, 0xc3, 0x4e, 0x01},
+         deserialize_errc::incomplete_message},
+        {"datetime2_negative",
+         binlog_column_type::datetime2,
+         0,
+         {0x7f, 0xff, 0xff, 0xff, 0xff},
+         deserialize_errc::protocol_value_error},
+        {"datetime2_bad_decimals",
+         binlog_column_type::datetime2,
+         7,
+         {0x99, 0x87, 0x16, 0xc3, 0x4e, 0x00, 0x00, 0x00, 0x00},
+         deserialize_errc::protocol_value_error},
+        {"time2_bad_minutes",
+         binlog_column_type::time2,
+         0,
+         {0x80, 0x0f, 0xc0},
+         deserialize_errc::protocol_value_error},
+        {"date_bad_month",
+         binlog_column_type::date,
+         0,
+         {0xe0, 0x01, 0x00},
+         deserialize_errc::protocol_value_error},
+        {"blob_bad_meta", binlog_column_type::blob, 5, {0x00}, deserialize_errc::protocol_value_error},
+        {"decimal_bad_meta",
+         binlog_column_type::newdecimal,
+         0x0506,
+         {0x80},
+         deserialize_errc::protocol_value_error},
+        {"unsupported", binlog_column_type::decimal, 0, {0x00}, deserialize_errc::server_unsupported},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            deserialization_buffer buffer(tc.serialized);
+            detail::deserialization_context ctx(buffer.data(), buffer.size());
+            field_view actual;
+            auto err = detail::deserialize_binlog_value(ctx, tc.type, tc.meta, false, actual);
+            BOOST_TEST(err == tc.expected);
+        }
+    }
+}
+
+//
+// DECIMAL to text
+//
+BOOST_AUTO_TEST_CASE(decimal_to_text_success)
+{
+    struct
+    {
+        const char* name;
+        std::uint8_t precision;
+        std::uint8_t scale;
+        std::vector<std::uint8_t> packed;
+        const char* expected;
+    } test_cases[] = {
+        {"positive", 5, 2, {0x80, 0x7b, 0x2d}, "123.45"},
+        {"negative", 5, 2, {0x7f, 0x84, 0xd2}, "-123.45"},
+        {"zero", 5, 2, {0x80, 0x00, 0x00}, "0.00"},
+        {"leading_zeros_fraction", 5, 2, {0x80, 0x00, 0x05}, "0.05"},
+        {"no_scale", 3, 0, {0x80, 0x7b}, "123"},
+        {"only_scale", 2, 2, {0x87}, "0.07"},
+        {"full_group", 10, 0, {0x81, 0x0d, 0xfb, 0x38, 0xd2}, "1234567890"},
+        {"full_group_leading_zeros", 10, 0, {0x80, 0x00, 0x00, 0x00, 0x01}, "1"},
+        {"full_group_fraction",
+         20,
+         10,
+         {0x80, 0x00, 0x00, 0x00, 0x01, 0x1d, 0xcd, 0x65, 0x00, 0x00},
+         "1.5000000000"},
+        {"inner_group_zero_padded", 10, 0, {0x81, 0x00, 0x00, 0x00, 0x05}, "1000000005"},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            std::string output(detail::max_decimal_text_size(tc.precision), '\0');
+            std::size_t size = 0;
+            auto err = detail::decimal_to_text(tc.packed, tc.precision, tc.scale, &output[0], size);
+            BOOST_TEST(err == deserialize_errc::ok);
+            BOOST_TEST(string_view(output.data(), size) == tc.expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(decimal_to_text_error)
+{
+    std::string output(detail::max_decimal_text_size(5), '\0');
+    std::size_t size = 0;
+
+    // Group values out of range
+    const std::vector<std::uint8_t> bad_group{0x80, 0x7b, 0x64};
+    BOOST_TEST(
+        detail::decimal_to_text(bad_group, 5, 2, &output[0], size) == deserialize_errc::protocol_value_error
+    );
+
+    // Size mismatch
+    const std::vector<std::uint8_t> bad_size{0x80, 0x7b};
+    BOOST_TEST(
+        detail::decimal_to_text(bad_size, 5, 2, &output[0], size) == deserialize_errc::protocol_value_error
+    );
+}
+
+//
+// Events
+//
+struct fixture
+{
+    binlog_state_impl st;
+    diagnostics diag;
+    std::vector<std::vector<std::uint8_t>> messages;  // keep messages alive, since events point into them
+
+    fixture() { st.dumping = true; }
+
+    error_code process(std::vector<std::uint8_t> msg, db_flavor flavor = db_flavor::mysql)
+    {
+        messages.push_back(std::move(msg));
+        return detail::process_binlog_message(messages.back(), flavor, st, diag);
+    }
+
+    binlog_event event() const { return detail::access::construct<binlog_event>(&st); }
+};
+
+// A table with columns (INT UNSIGNED NOT NULL, VARCHAR(100) NULL, DECIMAL(5, 2) NULL)
+std::vector<std::uint8_t> table_map_body()
+{
+    return {
+        0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,        // table ID
+        0x01, 0x00,                                // flags
+        0x04, 0x6d, 0x79, 0x64, 0x62, 0x00,        // schema
+        0x01, 0x74, 0x00,                          // table
+        0x03,                                      // number of columns
+        0x03, 0x0f, 0xf6,                          // types
+        0x04, 0x2c, 0x01, 0x05, 0x02,              // metadata
+        0x06,                                      // NULL bitmap
+        0x01, 0x01, 0x80,                          // signedness
+    };
+}
+
+BOOST_AUTO_TEST_CASE(format_description_checksum)
+{
+    fixture fix;
+
+    // A server with checksums enabled
+    auto body = create_format_description_body("8.0.30", 1);
+    auto ec = fix.process(create_binlog_event(binlog_event_type::format_description, body, 0, 0x20));
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(fix.st.has_checksum);
+    auto ev = fix.event();
+    BOOST_TEST_REQUIRE(!ev.empty());
+    BOOST_TEST(ev.type() == binlog_event_type::format_description);
+    BOOST_TEST(ev.data().size() == body.size() - 5u);  // checksum algorithm and checksum removed
+
+    // Subsequent events have their checksums removed
+    ec = fix.process(create_binlog_event(
+        binlog_event_type::xid,
+        {0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xbb, 0xcc, 0xdd},
+        1234
+    ));
+    BOOST_TEST(ec == error_code());
+    ev = fix.event();
+    BOOST_TEST(ev.type() == binlog_event_type::xid);
+    BOOST_TEST(ev.data().size() == 8u);
+    BOOST_TEST(ev.as_xid() == 5u);
+    BOOST_TEST(ev.log_position() == 1234u);
+    BOOST_TEST(fix.st.position == 1234u);
+}
+
+BOOST_AUTO_TEST_CASE(format_description_checksum_disabled)
+{
+    fixture fix;
+
+    // The trailer is there, but checksums are disabled
+    auto body = create_format_description_body("10.11.2-MariaDB-log", 0);
+    auto ec = fix.process(create_binlog_event(binlog_event_type::format_description, body));
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(!fix.st.has_checksum);
+    BOOST_TEST(fix.event().data().size() == body.size() - 5u);
+
+    // Subsequent events are not modified
+    ec = fix.process(
+        create_binlog_event(binlog_event_type::xid, {0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00})
+    );
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(fix.event().as_xid() == 5u);
+}
+
+BOOST_AUTO_TEST_CASE(format_description_old_server)
+{
+    fixture fix;
+
+    // Servers before 5.6.1 don't send a checksum algorithm
+    auto body = create_format_description_body("5.5.62-log", 1);
+    auto ec = fix.process(create_binlog_event(binlog_event_type::format_description, body));
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(!fix.st.has_checksum);
+    BOOST_TEST(fix.event().data().size() == body.size());
+}
+
+BOOST_AUTO_TEST_CASE(rotate)
+{
+    fixture fix;
+    fix.st.tables[42];
+
+    // Rotate events are artificial if they're sent when starting the dump
+    auto ec = fix.process(create_binlog_event(
+        binlog_event_type::rotate,
+        {0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x69, 0x6e, 0x2e, 0x30, 0x32},
+        0,
+        0x20
+    ));
+    BOOST_TEST(ec == error_code());
+    auto ev = fix.event();
+    BOOST_TEST(ev.type() == binlog_event_type::rotate);
+    BOOST_TEST(ev.as_rotate().position == 4u);
+    BOOST_TEST(ev.as_rotate().next_file == "bin.02");
+    BOOST_TEST(ev.flags() == 0x20u);
+    BOOST_TEST(ev.timestamp() == 100u);
+    BOOST_TEST(ev.server_id() == 1u);
+
+    // The position was updated, and table maps were discarded
+    BOOST_TEST(fix.st.file_name == "bin.02");
+    BOOST_TEST(fix.st.position == 4u);
+    BOOST_TEST(fix.st.tables.empty());
+}
+
+BOOST_AUTO_TEST_CASE(artificial_events_dont_update_position)
+{
+    fixture fix;
+    fix.st.position = 100;
+
+    auto ec = fix.process(create_binlog_event(binlog_event_type::heartbeat, {}, 200, 0x20));
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(fix.event().type() == binlog_event_type::heartbeat);
+    BOOST_TEST(fix.st.position == 100u);
+}
+
+BOOST_AUTO_TEST_CASE(query)
+{
+    fixture fix;
+
+    auto ec = fix.process(create_binlog_event(
+        binlog_event_type::query,
+        {
+            0x01, 0x00, 0x00, 0x00,                    // thread ID
+            0x00, 0x00, 0x00, 0x00,                    // execution time
+            0x04,                                      // schema length
+            0x00, 0x00,                                // error code
+            0x02, 0x00,                                // status variables length
+            0xaa, 0xbb,                                // status variables
+            0x6d, 0x79, 0x64, 0x62, 0x00,              // schema
+            0x42, 0x45, 0x47, 0x49, 0x4e,              // query
+        }
+    ));
+    BOOST_TEST(ec == error_code());
+    auto q = fix.event().as_query();
+    BOOST_TEST(q.schema == "mydb");
+    BOOST_TEST(q.query == "BEGIN");
+}
+
+BOOST_AUTO_TEST_CASE(gtid)
+{
+    fixture fix;
+
+    std::vector<std::uint8_t> body{0x01};  // flags
+    for (std::uint8_t i = 1; i <= 16; ++i)
+        body.push_back(i);  // source ID
+    append_le(body, 42, 8);
+    auto ec = fix.process(create_binlog_event(binlog_event_type::gtid, body));
+    BOOST_TEST(ec == error_code());
+    auto gtid = fix.event().as_gtid();
+    std::array<std::uint8_t, 16> expected_source_id{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    BOOST_TEST(gtid.source_id == expected_source_id);
+    BOOST_TEST(gtid.domain_id == 0u);
+    BOOST_TEST(gtid.sequence_number == 42u);
+}
+
+BOOST_AUTO_TEST_CASE(mariadb_gtid)
+{
+    fixture fix;
+
+    auto ec = fix.process(
+        create_binlog_event(
+            binlog_event_type::mariadb_gtid,
+            {0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00}
+        ),
+        db_flavor::mariadb
+    );
+    BOOST_TEST(ec == error_code());
+    auto gtid = fix.event().as_gtid();
+    BOOST_TEST(gtid.source_id == (std::array<std::uint8_t, 16>{}));
+    BOOST_TEST(gtid.domain_id == 3u);
+    BOOST_TEST(gtid.sequence_number == 42u);
+}
+
+BOOST_AUTO_TEST_CASE(table_map)
+{
+    fixture fix;
+
+    auto ec = fix.process(create_binlog_event(binlog_event_type::table_map, table_map_body()));
+    BOOST_TEST(ec == error_code());
+    auto table = fix.event().as_table_map();
+    BOOST_TEST(table.table_id() == 42u);
+    BOOST_TEST(table.schema() == "mydb");
+    BOOST_TEST(table.table() == "t");
+    BOOST_TEST_REQUIRE(table.size() == 3u);
+    BOOST_TEST(table.type(0) == column_type::int_);
+    BOOST_TEST(table.type(1) == column_type::varchar);
+    BOOST_TEST(table.type(2) == column_type::decimal);
+    BOOST_TEST(!table.is_nullable(0));
+    BOOST_TEST(table.is_nullable(1));
+    BOOST_TEST(table.is_nullable(2));
+    BOOST_TEST(table.is_unsigned(0));
+    BOOST_TEST(!table.is_unsigned(2));
+
+    // The table map is stored, and survives the message
+    BOOST_TEST(fix.st.tables.count(42u) == 1u);
+    BOOST_TEST(fix.st.tables[42].column_meta[1] == 300u);
+    BOOST_TEST(fix.st.tables[42].column_meta[2] == 0x0502u);
+}
+
+BOOST_AUTO_TEST_CASE(write_rows)
+{
+    fixture fix;
+    auto ec = fix.process(create_binlog_event(binlog_event_type::table_map, table_map_body()));
+    BOOST_TEST_REQUIRE(ec == error_code());
+
+    ec = fix.process(create_binlog_event(
+        binlog_event_type::write_rows,
+        {
+            0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,        // table ID
+            0x00, 0x00,                                // flags
+            0x02, 0x00,                                // extra data length
+            0x03,                                      // number of columns
+            0x07,                                      // present columns
+            0x00,                                      // row 1: NULL bitmap
+            0xff, 0xff, 0xff, 0xff,                    // row 1: INT
+            0x03, 0x00, 0x61, 0x62, 0x63,              // row 1: VARCHAR
+            0x80, 0x7b, 0x2d,                          // row 1: DECIMAL
+            0x06,                                      // row 2: NULL bitmap
+            0x01, 0x00, 0x00, 0x00,                    // row 2: INT
+        }
+    ));
+    BOOST_TEST(ec == error_code());
+    auto rows = fix.event().as_rows();
+    BOOST_TEST(rows.table().table() == "t");
+    BOOST_TEST(!rows.has_before_image());
+    BOOST_TEST(rows.has_after_image());
+    BOOST_TEST(rows.is_present_after(2));
+    BOOST_TEST_REQUIRE(rows.size() == 2u);
+    BOOST_TEST(rows.after(0) == makerow(0xffffffffu, "abc", "123.45"));
+    BOOST_TEST(rows.after(1) == makerow(1u, nullptr, nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(update_rows_partial_image)
+{
+    fixture fix;
+    auto ec = fix.process(create_binlog_event(binlog_event_type::table_map, table_map_body()));
+    BOOST_TEST_REQUIRE(ec == error_code());
+
+    ec = fix.process(create_binlog_event(
+        binlog_event_type::update_rows_v1,
+        {
+            0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,        // table ID
+            0x00, 0x00,                                // flags
+            0x03,                                      // number of columns
+            0x01,                                      // present columns (before)
+            0x07,                                      // present columns (after)
+            0x00,                                      // before: NULL bitmap
+            0x01, 0x00, 0x00, 0x00,                    // before: INT
+            0x04,                                      // after: NULL bitmap
+            0x02, 0x00, 0x00, 0x00,                    // after: INT
+            0x01, 0x00, 0x78,                          // after: VARCHAR
+        }
+    ));
+    BOOST_TEST(ec == error_code());
+    auto rows = fix.event().as_rows();
+    BOOST_TEST(rows.has_before_image());
+    BOOST_TEST(rows.has_after_image());
+    BOOST_TEST(rows.is_present_before(0));
+    BOOST_TEST(!rows.is_present_before(1));
+    BOOST_TEST(rows.is_present_after(1));
+    BOOST_TEST_REQUIRE(rows.size() == 1u);
+    BOOST_TEST(rows.before(0) == makerow(1u, nullptr, nullptr));
+    BOOST_TEST(rows.after(0) == makerow(2u, "x", nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(delete_rows_unknown_table)
+{
+    fixture fix;
+
+    auto ec = fix.process(create_binlog_event(
+        binlog_event_type::delete_rows,
+        {0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01}
+    ));
+    BOOST_TEST(ec == error_code(client_errc::protocol_value_error));
+    BOOST_TEST(fix.event().empty());
+}
+
+BOOST_AUTO_TEST_CASE(other_events)
+{
+    fixture fix;
+
+    // Events we don't decode are returned with their raw data
+    auto ec = fix.process(create_binlog_event(binlog_event_type::previous_gtids, {0x01, 0x02}, 500));
+    BOOST_TEST(ec == error_code());
+    auto ev = fix.event();
+    BOOST_TEST(ev.type() == binlog_event_type::previous_gtids);
+    BOOST_TEST(ev.data().size() == 2u);
+    BOOST_TEST(fix.st.position == 500u);
+}
+
+BOOST_AUTO_TEST_CASE(eof)
+{
+    fixture fix;
+
+    auto ec = fix.process({0xfe, 0x00, 0x00, 0x02, 0x00});
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(!fix.st.dumping);
+    BOOST_TEST(fix.event().empty());
+}
+
+BOOST_AUTO_TEST_CASE(error_packet)
+{
+    fixture fix;
+
+    auto msg = err_builder().code(common_server_errc::er_bad_db_error).message("abc").build_body();
+    auto ec = fix.process(msg);
+    BOOST_TEST(ec == common_server_errc::er_bad_db_error);
+    BOOST_TEST(fix.diag == create_server_diag("abc"));
+    BOOST_TEST(!fix.st.dumping);
+    BOOST_TEST(fix.event().empty());
+}
+
+BOOST_AUTO_TEST_CASE(error_size_mismatch)
+{
+    fixture fix;
+
+    auto msg = create_binlog_event(binlog_event_type::xid, {0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+    msg.push_back(0x00);
+    BOOST_TEST(fix.process(msg) == error_code(client_errc::protocol_value_error));
+    BOOST_TEST(fix.event().empty());
+}
+
+BOOST_AUTO_TEST_CASE(error_bad_header)
+{
+    fixture fix;
+    BOOST_TEST(fix.process({0x01, 0x02}) == error_code(client_errc::protocol_value_error));
+    BOOST_TEST(fix.process({}) == error_code(client_errc::incomplete_message));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
@@ -18,6 +18,8 @@
 #include <boost/mysql/mysql_collations.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/row_decoding_plan.hpp>
+
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/protocol/constants.hpp>
 #include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
@@ -26,6 +28,7 @@
 #include <boost/test/tools/context.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <array>
 
 #include "operators.hpp"
@@ -144,6 +147,29 @@ BOOST_AUTO_TEST_CASE(ok_view_success)
                 .info("")
                 .build(),
             {0x00, 0x00, 0x02, 0x00, 0x00, 0x00},
+        },
+        {
+            "session_state_changed",
+            ok_builder()
+                .affected_rows(0)
+                .last_insert_id(0)
+                .flags(0x4002)
+                .warnings(0)
+                .info("")
+                .session_state(string_view("\x01\x04\x03" "abc", 6))
+                .build(),
+            {0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x06, 0x01, 0x04, 0x03, 0x61, 0x62, 0x63},
+        },
+        {
+            "session_state_changed_no_capability",
+            ok_builder()
+                .affected_rows(0)
+                .last_insert_id(0)
+                .flags(0x4002)
+                .warnings(0)
+                .info("")
+                .build(),
+            {0x00, 0x00, 0x02, 0x40, 0x00, 0x00},
         }
   // clang-format on
     };
@@ -164,6 +190,7 @@ BOOST_AUTO_TEST_CASE(ok_view_success)
             BOOST_TEST(actual.status_flags == tc.expected.status_flags);
             BOOST_TEST(actual.warnings == tc.expected.warnings);
             BOOST_TEST(actual.info == tc.expected.info);
+            BOOST_TEST(actual.session_state == tc.expected.session_state);
         }
     }
 }
@@ -182,7 +209,8 @@ BOOST_AUTO_TEST_CASE(ok_view_error)
         {"error_last_insert_id", client_errc::incomplete_message, {0x01, 0x06, 0x02}                                    },
         {"error_warnings",       client_errc::incomplete_message, {0x01, 0x06, 0x02, 0x00, 0x00}                        },
         {"error_info",           client_errc::incomplete_message, {0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x28}            },
-        {"extra_bytes",          client_errc::extra_bytes,        {0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00}}
+        {"extra_bytes",          client_errc::extra_bytes,        {0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00}},
+        {"error_session_state",  client_errc::incomplete_message, {0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x05, 0x01}}
     };
 
     for (const auto& tc : test_cases)
@@ -650,23 +678,6 @@ BOOST_AUTO_TEST_CASE(coldef_view_error)
     }
 }
 
-// TODO: move this to common section
-template <class T>
-void do_serialize_toplevel_test(const T& value, span<const std::uint8_t> serialized)
-{
-    // Size
-    std::size_t expected_size = serialized.size();
-    std::size_t actual_size = value.get_size();
-    BOOST_TEST(actual_size == expected_size);
-
-    // Serialize
-    serialization_buffer buffer(actual_size);
-    value.serialize(buffer);
-
-    // Check buffer
-    buffer.check(serialized);
-}
-
 //
 // quit
 //
@@ -697,7 +708,7 @@ BOOST_AUTO_TEST_CASE(reset_connection_serialization)
     do_serialize_toplevel_test(cmd, serialized);
 }
 
-// OK response (ping & reset connection)
+// OK response (ping, reset connection & close statement)
 BOOST_AUTO_TEST_CASE(deserialize_ok_response_)
 {
     struct
@@ -728,12 +739,12 @@ BOOST_AUTO_TEST_CASE(deserialize_ok_response_)
         BOOST_TEST_CONTEXT(tc.name)
         {
             diagnostics diag;
-            bool backslash_escapes = true;
-            auto err = deserialize_ok_response(tc.message, db_flavor::mariadb, diag, backslash_escapes);
+            ok_view ok{};
+            auto err = deserialize_ok_response(tc.message, db_flavor::mariadb, diag, ok);
 
             BOOST_TEST(err == tc.expected_err);
             BOOST_TEST(diag.server_message() == tc.expected_msg);
-            BOOST_TEST(backslash_escapes == tc.expected_backslash_escapes);
+            BOOST_TEST(ok.backslash_escapes() == tc.expected_backslash_escapes);
         }
     }
 }
@@ -1342,6 +1353,17 @@ BOOST_AUTO_TEST_CASE(deserialize_row_success)
             BOOST_TEST_REQUIRE(err == error_code());
             std::vector<field_view> actual_vec{actual_span.begin(), actual_span.end()};
             BOOST_TEST(actual_vec == tc.expected);
+
+            // Using a precompiled plan yields the same results
+            row_decoding_plan plan;
+            plan.compile(tc.encoding, tc.meta);
+            BOOST_TEST(plan.encoding() == tc.encoding);
+            BOOST_TEST(plan.size() == tc.meta.size());
+            std::fill(actual_span.begin(), actual_span.end(), field_view());
+            err = deserialize_row(plan, tc.serialized, tc.meta, actual_span);
+            BOOST_TEST_REQUIRE(err == error_code());
+            actual_vec.assign(actual_span.begin(), actual_span.end());
+            BOOST_TEST(actual_vec == tc.expected);
         }
     }
 }
@@ -1477,7 +1499,12 @@ BOOST_AUTO_TEST_CASE(deserialize_row_error)
             span<field_view> actual_span{actual.get(), tc.meta.size()};
 
             auto err = deserialize_row(tc.encoding, tc.serialized, tc.meta, actual_span);
+            BOOST_TEST(err == tc.expected);
 
+            // Using a precompiled plan yields the same results
+            row_decoding_plan plan;
+            plan.compile(tc.encoding, tc.meta);
+            err = deserialize_row(plan, tc.serialized, tc.meta, actual_span);
             BOOST_TEST(err == tc.expected);
         }
     }
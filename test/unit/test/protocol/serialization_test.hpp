@@ -112,6 +112,23 @@ void do_serialize_test(T value, span<const std::uint8_t> serialized)
     BOOST_TEST(ctx.first() == buffer.data() + expected_size, "Iterator not updated correctly");
 }
 
+// Serialization test for top-level messages (commands), which expose get_size() and serialize()
+template <class T>
+void do_serialize_toplevel_test(const T& value, span<const std::uint8_t> serialized)
+{
+    // Size
+    std::size_t expected_size = serialized.size();
+    std::size_t actual_size = value.get_size();
+    BOOST_TEST(actual_size == expected_size);
+
+    // Serialize
+    serialization_buffer buffer(actual_size);
+    value.serialize(buffer);
+
+    // Check buffer
+    buffer.check(serialized);
+}
+
 template <class T>
 void do_deserialize_test(T value, span<const std::uint8_t> serialized)
 {
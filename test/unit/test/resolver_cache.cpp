@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/resolver_cache.hpp>
+
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace boost::mysql;
+namespace asio = boost::asio;
+using std::chrono::seconds;
+using endpoints_t = resolver_cache::endpoints_type;
+
+BOOST_AUTO_TEST_SUITE(test_resolver_cache)
+
+static endpoints_t make_endpoints(const char* ip, unsigned short port)
+{
+    asio::ip::tcp::endpoint ep(asio::ip::make_address_v4(ip), port);
+    return endpoints_t::create(ep, "host", std::to_string(port));
+}
+
+static std::chrono::steady_clock::time_point t0()
+{
+    return std::chrono::steady_clock::time_point(seconds(1000));
+}
+
+BOOST_AUTO_TEST_CASE(find_empty)
+{
+    resolver_cache cache(seconds(10));
+    endpoints_t res;
+    BOOST_TEST(!cache.find("host", 3306, t0(), res));
+    BOOST_TEST(res.empty());
+    BOOST_TEST(cache.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(insert_find)
+{
+    resolver_cache cache(seconds(10));
+    cache.insert("host", 3306, make_endpoints("10.0.0.1", 3306), t0());
+    BOOST_TEST(cache.size() == 1u);
+
+    // Found, before expiry
+    endpoints_t res;
+    BOOST_TEST(cache.find("host", 3306, t0() + seconds(9), res));
+    BOOST_TEST_REQUIRE(res.size() == 1u);
+    BOOST_TEST(res.begin()->endpoint().address().to_string() == "10.0.0.1");
+
+    // Host and port must match
+    endpoints_t res2;
+    BOOST_TEST(!cache.find("host", 3307, t0(), res2));
+    BOOST_TEST(!cache.find("other", 3306, t0(), res2));
+    BOOST_TEST(res2.empty());
+}
+
+BOOST_AUTO_TEST_CASE(expiry)
+{
+    resolver_cache cache(seconds(10));
+    cache.insert("host", 3306, make_endpoints("10.0.0.1", 3306), t0());
+
+    endpoints_t res;
+    BOOST_TEST(!cache.find("host", 3306, t0() + seconds(10), res));
+    BOOST_TEST(!cache.find("host", 3306, t0() + seconds(20), res));
+    BOOST_TEST(res.empty());
+}
+
+BOOST_AUTO_TEST_CASE(insert_replaces)
+{
+    resolver_cache cache(seconds(10));
+    cache.insert("host", 3306, make_endpoints("10.0.0.1", 3306), t0());
+    cache.insert("host", 3306, make_endpoints("10.0.0.2", 3306), t0() + seconds(5));
+    BOOST_TEST(cache.size() == 1u);
+
+    // The new entry is returned, and its expiry is refreshed
+    endpoints_t res;
+    BOOST_TEST(cache.find("host", 3306, t0() + seconds(12), res));
+    BOOST_TEST_REQUIRE(res.size() == 1u);
+    BOOST_TEST(res.begin()->endpoint().address().to_string() == "10.0.0.2");
+}
+
+BOOST_AUTO_TEST_CASE(invalidate)
+{
+    resolver_cache cache(seconds(10));
+    cache.insert("host1", 3306, make_endpoints("10.0.0.1", 3306), t0());
+    cache.insert("host2", 3306, make_endpoints("10.0.0.2", 3306), t0());
+
+    cache.invalidate("host1", 3306);
+    BOOST_TEST(cache.size() == 1u);
+    endpoints_t res;
+    BOOST_TEST(!cache.find("host1", 3306, t0(), res));
+    BOOST_TEST(cache.find("host2", 3306, t0(), res));
+
+    // Invalidating non-existing entries is a no-op
+    cache.invalidate("host1", 3306);
+    cache.invalidate("host2", 1234);
+    BOOST_TEST(cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(clear)
+{
+    resolver_cache cache(seconds(10));
+    cache.insert("host1", 3306, make_endpoints("10.0.0.1", 3306), t0());
+    cache.insert("host2", 3306, make_endpoints("10.0.0.2", 3306), t0());
+    cache.clear();
+    BOOST_TEST(cache.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(zero_ttl)
+{
+    // A zero TTL disables caching
+    resolver_cache cache(seconds(0));
+    cache.insert("host", 3306, make_endpoints("10.0.0.1", 3306), t0());
+    BOOST_TEST(cache.size() == 0u);
+    endpoints_t res;
+    BOOST_TEST(!cache.find("host", 3306, t0(), res));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
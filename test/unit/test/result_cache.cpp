@@ -0,0 +1,378 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/result_cache.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/impl/internal/result_cache_load_op.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_statement.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+namespace asio = boost::asio;
+using std::chrono::seconds;
+using results_ptr = result_cache::results_ptr;
+
+BOOST_AUTO_TEST_SUITE(test_result_cache)
+
+static std::chrono::steady_clock::time_point t0()
+{
+    return std::chrono::steady_clock::time_point(seconds(1000));
+}
+
+static results_ptr make_results() { return std::make_shared<const results>(); }
+
+BOOST_AUTO_TEST_CASE(find_empty)
+{
+    result_cache cache(seconds(10), 10);
+    BOOST_TEST((cache.find("key", t0()) == nullptr));
+    BOOST_TEST(cache.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(insert_find)
+{
+    result_cache cache(seconds(10), 10);
+    auto r = make_results();
+    cache.insert("key", r, {}, t0());
+    BOOST_TEST(cache.size() == 1u);
+
+    // Found, before expiry. No copies are made
+    BOOST_TEST(cache.find("key", t0() + seconds(9)) == r);
+
+    // Keys must match
+    BOOST_TEST((cache.find("other", t0()) == nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(expiry)
+{
+    result_cache cache(seconds(10), 10);
+    cache.insert("key", make_results(), {}, t0());
+
+    // Expired entries are not returned, and are removed
+    BOOST_TEST((cache.find("key", t0() + seconds(10)) == nullptr));
+    BOOST_TEST(cache.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(insert_replaces)
+{
+    result_cache cache(seconds(10), 10);
+    auto r1 = make_results();
+    auto r2 = make_results();
+    cache.insert("key", r1, {}, t0());
+
+    // Replacing updates the results and the expiry
+    cache.insert("key", r2, {}, t0() + seconds(5));
+    BOOST_TEST(cache.size() == 1u);
+    BOOST_TEST(cache.find("key", t0() + seconds(12)) == r2);
+}
+
+BOOST_AUTO_TEST_CASE(lru_eviction)
+{
+    result_cache cache(seconds(10), 2);
+    auto r1 = make_results();
+    auto r2 = make_results();
+    auto r3 = make_results();
+    cache.insert("k1", r1, {}, t0());
+    cache.insert("k2", r2, {}, t0());
+
+    // Looking up k1 makes k2 the least recently used entry
+    BOOST_TEST(cache.find("k1", t0()) == r1);
+
+    // Inserting another entry evicts k2
+    cache.insert("k3", r3, {}, t0());
+    BOOST_TEST(cache.size() == 2u);
+    BOOST_TEST(cache.find("k1", t0()) == r1);
+    BOOST_TEST((cache.find("k2", t0()) == nullptr));
+    BOOST_TEST(cache.find("k3", t0()) == r3);
+}
+
+BOOST_AUTO_TEST_CASE(invalidate)
+{
+    result_cache cache(seconds(10), 10);
+    cache.insert("k1", make_results(), {}, t0());
+    cache.insert("k2", make_results(), {}, t0());
+
+    cache.invalidate("k1");
+    BOOST_TEST(cache.size() == 1u);
+    BOOST_TEST((cache.find("k1", t0()) == nullptr));
+    BOOST_TEST((cache.find("k2", t0()) != nullptr));
+
+    // Invalidating a non-existent entry is a no-op
+    cache.invalidate("k1");
+    BOOST_TEST(cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(invalidate_tag)
+{
+    result_cache cache(seconds(10), 10);
+    const string_view tags_users[] = {"users"};
+    const string_view tags_both[] = {"users", "orders"};
+    const string_view tags_orders[] = {"orders"};
+    cache.insert("k1", make_results(), tags_users, t0());
+    cache.insert("k2", make_results(), tags_both, t0());
+    cache.insert("k3", make_results(), tags_orders, t0());
+    cache.insert("k4", make_results(), {}, t0());
+
+    // All entries with the tag are removed
+    cache.invalidate_tag("users");
+    BOOST_TEST(cache.size() == 2u);
+    BOOST_TEST((cache.find("k1", t0()) == nullptr));
+    BOOST_TEST((cache.find("k2", t0()) == nullptr));
+    BOOST_TEST((cache.find("k3", t0()) != nullptr));
+    BOOST_TEST((cache.find("k4", t0()) != nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(clear)
+{
+    result_cache cache(seconds(10), 10);
+    cache.insert("k1", make_results(), {}, t0());
+    cache.insert("k2", make_results(), {}, t0());
+    cache.clear();
+    BOOST_TEST(cache.size() == 0u);
+    BOOST_TEST((cache.find("k1", t0()) == nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(disabled)
+{
+    // Zero TTL
+    result_cache cache1(seconds(0), 10);
+    cache1.insert("key", make_results(), {}, t0());
+    BOOST_TEST(cache1.size() == 0u);
+    BOOST_TEST((cache1.find("key", t0()) == nullptr));
+
+    // Zero entries
+    result_cache cache2(seconds(10), 0);
+    cache2.insert("key", make_results(), {}, t0());
+    BOOST_TEST(cache2.size() == 0u);
+    BOOST_TEST((cache2.find("key", t0()) == nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(make_key)
+{
+    const field_view int_param[] = {field_view(1)};
+    const field_view string_param[] = {field_view("1")};
+    const field_view two_params[] = {field_view(1), field_view("abc")};
+    const field_view null_param[] = {field_view()};
+
+    const auto key_int = result_cache::make_key("SELECT ?", int_param);
+
+    // Same inputs yield the same key
+    BOOST_TEST(key_int == result_cache::make_key("SELECT ?", int_param));
+
+    // Keys depend on the SQL, the parameter values and their types
+    BOOST_TEST(result_cache::make_key("SELECT 1") != result_cache::make_key("SELECT 2"));
+    BOOST_TEST(key_int != result_cache::make_key("SELECT ?"));
+    BOOST_TEST(key_int != result_cache::make_key("SELECT ?", string_param));
+    BOOST_TEST(key_int != result_cache::make_key("SELECT ?", null_param));
+    BOOST_TEST(key_int != result_cache::make_key("SELECT ?", two_params));
+}
+
+// Load path (async_execute). The pool is mocked, so the real load operation runs without a server
+struct mock_pool;
+
+struct mock_pooled_connection
+{
+    mock_pool* pool{};
+    mock_pool* operator->() const noexcept { return pool; }
+};
+
+// Serves a connection immediately, and records the queries run using it
+struct mock_pool
+{
+    asio::any_io_executor ex;
+    std::size_t num_get_connection{0};
+    std::size_t num_prepares{0};
+    std::size_t num_queries{0};
+    error_code query_ec;              // returned by queries
+    diagnostics query_diag;           // returned by queries
+    std::function<void()> on_query;  // invoked when a query starts, if set
+
+    mock_pool(asio::any_io_executor ex) : ex(std::move(ex)) {}
+
+    asio::any_io_executor get_executor() const { return ex; }
+
+    template <class CompletionToken>
+    void async_get_connection(diagnostics&, CompletionToken&& token)
+    {
+        ++num_get_connection;
+        asio::post(
+            ex,
+            asio::append(std::forward<CompletionToken>(token), error_code(), mock_pooled_connection{this})
+        );
+    }
+
+    // Statements are prepared with as many parameters as passed to the cache
+    template <class CompletionToken>
+    void async_prepare_statement(string_view, diagnostics&, CompletionToken&& token)
+    {
+        ++num_prepares;
+        auto stmt = statement_builder().id(1).num_params(1).build();
+        asio::post(ex, asio::append(std::forward<CompletionToken>(token), error_code(), stmt));
+    }
+
+    template <class ExecutionRequest, class CompletionToken>
+    void async_execute(ExecutionRequest&&, results&, diagnostics& diag, CompletionToken&& token)
+    {
+        ++num_queries;
+        if (on_query)
+            on_query();
+        diag = query_diag;
+        asio::post(ex, asio::append(std::forward<CompletionToken>(token), query_ec));
+    }
+};
+
+struct mock_io_traits
+{
+    using pool_type = mock_pool;
+    using connection_type = mock_pooled_connection;
+};
+
+using mock_load_op = boost::mysql::detail::basic_result_cache_load_op<mock_io_traits>;
+
+// Stores the outcome of an async_execute operation
+struct execute_result
+{
+    bool called{false};
+    error_code ec;
+    results_ptr res;
+    diagnostics diag{create_server_diag("Diagnostics not cleared")};
+};
+
+struct load_fixture
+{
+    asio::io_context ctx;
+    mock_pool pool{ctx.get_executor()};
+    result_cache cache{seconds(10), 10};
+
+    void start_execute(execute_result& out, boost::span<const string_view> tags = {})
+    {
+        auto handler = [&out](error_code ec, results_ptr r) {
+            out.called = true;
+            out.ec = ec;
+            out.res = std::move(r);
+        };
+        mock_load_op::start(cache, pool, "SELECT 1", {}, tags, &out.diag, std::move(handler));
+    }
+
+    results_ptr find()
+    {
+        return cache.find(result_cache::make_key("SELECT 1"), std::chrono::steady_clock::now());
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(execute_coalesces_misses, load_fixture)
+{
+    // Two concurrent misses for the same key
+    execute_result r1, r2;
+    start_execute(r1);
+    start_execute(r2);
+    ctx.run();
+
+    // Only one query was run, and both operations got its results
+    BOOST_TEST(pool.num_get_connection == 1u);
+    BOOST_TEST(pool.num_queries == 1u);
+    BOOST_TEST_REQUIRE(r1.called);
+    BOOST_TEST_REQUIRE(r2.called);
+    BOOST_TEST(r1.ec == error_code());
+    BOOST_TEST(r2.ec == error_code());
+    BOOST_TEST((r1.res != nullptr));
+    BOOST_TEST(r1.res == r2.res);
+    BOOST_TEST(r1.diag == diagnostics());
+    BOOST_TEST(r2.diag == diagnostics());
+
+    // The results were cached, so the next operation doesn't run any query
+    BOOST_TEST(find() == r1.res);
+    execute_result r3;
+    start_execute(r3);
+    ctx.restart();
+    ctx.run();
+    BOOST_TEST(pool.num_queries == 1u);
+    BOOST_TEST_REQUIRE(r3.called);
+    BOOST_TEST(r3.ec == error_code());
+    BOOST_TEST(r3.res == r1.res);
+}
+
+BOOST_FIXTURE_TEST_CASE(execute_error, load_fixture)
+{
+    // The query fails
+    pool.query_ec = common_server_errc::er_bad_db_error;
+    pool.query_diag = create_server_diag("Unknown database");
+
+    // Two concurrent misses for the same key
+    execute_result r1, r2;
+    start_execute(r1);
+    start_execute(r2);
+    ctx.run();
+
+    // The error and diagnostics reach both operations
+    BOOST_TEST(pool.num_queries == 1u);
+    BOOST_TEST_REQUIRE(r1.called);
+    BOOST_TEST_REQUIRE(r2.called);
+    BOOST_TEST(r1.ec == error_code(common_server_errc::er_bad_db_error));
+    BOOST_TEST(r2.ec == error_code(common_server_errc::er_bad_db_error));
+    BOOST_TEST((r1.res == nullptr));
+    BOOST_TEST((r2.res == nullptr));
+    BOOST_TEST(r1.diag == create_server_diag("Unknown database"));
+    BOOST_TEST(r2.diag == create_server_diag("Unknown database"));
+
+    // Errors are not cached
+    BOOST_TEST(cache.size() == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(execute_invalidated_in_flight, load_fixture)
+{
+    // The data is modified while the query runs
+    const string_view tags[] = {"users"};
+    pool.on_query = [this] { cache.invalidate_tag("users"); };
+
+    // Run the query
+    execute_result r1, r2;
+    start_execute(r1, tags);
+    start_execute(r2, tags);
+    ctx.run();
+
+    // Waiters get the results, but they are not stored, since they may be stale
+    BOOST_TEST_REQUIRE(r1.called);
+    BOOST_TEST_REQUIRE(r2.called);
+    BOOST_TEST(r1.ec == error_code());
+    BOOST_TEST((r1.res != nullptr));
+    BOOST_TEST(r2.res == r1.res);
+    BOOST_TEST(cache.size() == 0u);
+
+    // The next operation runs the query again
+    pool.on_query = nullptr;
+    execute_result r3;
+    start_execute(r3, tags);
+    ctx.restart();
+    ctx.run();
+    BOOST_TEST(pool.num_queries == 2u);
+    BOOST_TEST_REQUIRE(r3.called);
+    BOOST_TEST(find() == r3.res);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,14 +6,22 @@
 //
 
 #include <boost/mysql/column_type.hpp>
+#include <boost/mysql/memory_resource_ref.hpp>
 #include <boost/mysql/results.hpp>
 
 #include <boost/test/unit_test.hpp>
 
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+
+#ifdef __cpp_lib_memory_resource
+#include <memory_resource>
+#endif
 
 #include "test_common/check_meta.hpp"
 #include "test_common/create_basic.hpp"
+#include "test_unit/counting_memory_resource.hpp"
 #include "test_unit/create_execution_processor.hpp"
 #include "test_unit/create_meta.hpp"
 #include "test_unit/create_ok.hpp"
@@ -25,9 +33,9 @@ BOOST_TEST_DONT_PRINT_LOG_VALUE(results::iterator)
 
 BOOST_AUTO_TEST_SUITE(test_results)
 
-results create_initial_results()
+results create_initial_results(memory_resource_ref resource = {})
 {
-    results res;
+    results res(resource);
     exec_access(get_iface(res))
         .meta({meta_builder().type(column_type::varchar).build_coldef()})
         .row("abc")
@@ -337,4 +345,74 @@ BOOST_AUTO_TEST_CASE(move_assignment)
     BOOST_TEST(result2.info() == "1st");
 }
 
+// Only types with allocate and deallocate can be referenced. References hold two pointers
+static_assert(std::is_constructible<memory_resource_ref, counting_memory_resource*>::value, "");
+static_assert(!std::is_constructible<memory_resource_ref, int*>::value, "");
+static_assert(!std::is_convertible<results*, memory_resource_ref>::value, "");
+static_assert(sizeof(memory_resource_ref) == 2 * sizeof(void*), "");
+
+BOOST_AUTO_TEST_CASE(memory_resource)
+{
+    counting_memory_resource res;
+    {
+        results result(&res);
+        BOOST_TEST(res.num_allocations() == 0u);
+
+        exec_access(get_iface(result))
+            .meta({meta_builder().type(column_type::varchar).build_coldef()})
+            .row("abc")
+            .ok(ok_builder().info("1st").build());
+
+        // Rows, metadata and info were allocated using the resource
+        BOOST_TEST(res.num_allocations() > 0u);
+        BOOST_TEST(result.rows() == makerows(1, "abc"));
+        check_meta(result.meta(), {column_type::varchar});
+        BOOST_TEST(result.info() == "1st");
+    }
+    BOOST_TEST(res.num_outstanding() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(move_assignment_different_resource)
+{
+    counting_memory_resource res1, res2;
+
+    // Having this in heap helps spot lifetime issues
+    std::unique_ptr<results> result{new results(create_initial_results(&res1))};
+    auto rows_before = result->rows();
+
+    // Memory and resource are transferred, so views remain valid
+    results result2(&res2);
+    result2 = std::move(*result);
+    result.reset();
+    BOOST_TEST(res1.num_outstanding() > 0u);
+    BOOST_TEST(res2.num_outstanding() == 0u);
+
+    // The new object holds the same data
+    BOOST_TEST_REQUIRE(result2.has_value());
+    BOOST_TEST(result2.rows() == makerows(1, "abc", nullptr));
+    BOOST_TEST(rows_before == makerows(1, "abc", nullptr));
+    check_meta(result2.meta(), {column_type::varchar});
+    BOOST_TEST(result2.info() == "1st");
+    BOOST_TEST(result2.at(1).rows() == makerows(1, 42));
+    BOOST_TEST(result2.at(2).info() == "3rd");
+}
+
+#ifdef __cpp_lib_memory_resource
+BOOST_AUTO_TEST_CASE(std_pmr)
+{
+    // Standard memory resources can be referenced
+    unsigned char buff[4096];
+    std::pmr::monotonic_buffer_resource res(buff, sizeof(buff), std::pmr::null_memory_resource());
+    results result(&res);
+
+    exec_access(get_iface(result))
+        .meta({meta_builder().type(column_type::varchar).build_coldef()})
+        .row("abc")
+        .ok(ok_builder().info("1st").build());
+
+    BOOST_TEST(result.rows() == makerows(1, "abc"));
+    BOOST_TEST(result.info() == "1st");
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/binlog.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/binlog_state_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
+#include <boost/mysql/impl/internal/sansio/read_binlog_event.hpp>
+#include <boost/mysql/impl/internal/sansio/start_binlog_dump.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/printing.hpp"
+#include "test_unit/algo_test.hpp"
+#include "test_unit/create_binlog_event.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+
+using namespace boost::mysql::test;
+using namespace boost::mysql;
+
+namespace {
+
+std::vector<std::uint8_t> create_query_frame(string_view query)
+{
+    std::vector<std::uint8_t> body{0x03};
+    body.insert(body.end(), query.begin(), query.end());
+    return create_frame(0, body);
+}
+
+const std::vector<std::uint8_t> setup_query_frame = create_query_frame(
+    "SET @master_binlog_checksum = 'NONE', @source_binlog_checksum = 'NONE'"
+);
+
+const std::vector<std::uint8_t> register_frame = create_frame(
+    0,
+    {0x15, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+);
+
+const std::vector<std::uint8_t> dump_frame = create_frame(
+    0,
+    {0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x62, 0x69, 0x6e, 0x2e, 0x30, 0x31}
+);
+
+BOOST_AUTO_TEST_SUITE(test_start_binlog_dump)
+
+struct fixture : algo_fixture_base
+{
+    binlog_dump_params params;
+    detail::binlog_state_impl binlog_st;
+    detail::start_binlog_dump_algo algo{st, {&diag, &params, &binlog_st}};
+
+    fixture()
+    {
+        params.server_id = 42;
+        params.file_name = "bin.01";
+    }
+};
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Setup. State from a previous dump is discarded
+    fixture fix;
+    fix.binlog_st.tables[10];
+    fix.binlog_st.has_checksum = true;
+
+    // Run the algo
+    algo_test()
+        .expect_write(setup_query_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(dump_frame)
+        .check(fix);
+
+    // The dump was started
+    BOOST_TEST(fix.binlog_st.dumping);
+    BOOST_TEST(fix.binlog_st.seqnum == 1u);
+    BOOST_TEST(fix.binlog_st.file_name == "bin.01");
+    BOOST_TEST(fix.binlog_st.position == 4u);
+    BOOST_TEST(fix.binlog_st.tables.empty());
+    BOOST_TEST(!fix.binlog_st.has_checksum);
+
+    // The connection can't be used for anything else until it's reset
+    BOOST_TEST(fix.st.execution_pending);
+    BOOST_TEST(fix.st.session_modified);
+}
+
+BOOST_AUTO_TEST_CASE(success_mariadb)
+{
+    // Setup
+    fixture fix;
+    fix.st.flavor = detail::db_flavor::mariadb;
+
+    // Run the algo. MariaDB requires an extra variable to send GTID events
+    algo_test()
+        .expect_write(create_query_frame(
+            "SET @master_binlog_checksum = 'NONE', @source_binlog_checksum = 'NONE', "
+            "@mariadb_slave_capability = 4"
+        ))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(dump_frame)
+        .check(fix);
+
+    BOOST_TEST(fix.binlog_st.dumping);
+}
+
+BOOST_AUTO_TEST_CASE(error_network)
+{
+    algo_test()
+        .expect_write(setup_query_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(dump_frame)
+        .check_network_errors<fixture>();
+}
+
+BOOST_AUTO_TEST_CASE(error_setup_query)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(setup_query_frame)
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_bad_db_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_bad_db_error, create_server_diag("my_message"));
+
+    // The dump wasn't started
+    BOOST_TEST(!fix.binlog_st.dumping);
+    BOOST_TEST(!fix.st.execution_pending);
+}
+
+BOOST_AUTO_TEST_CASE(error_register)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo. Registering fails if the user lacks the REPLICATION SLAVE privilege
+    algo_test()
+        .expect_write(setup_query_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_specific_access_denied_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_specific_access_denied_error, create_server_diag("my_message"));
+
+    // The dump wasn't started
+    BOOST_TEST(!fix.binlog_st.dumping);
+    BOOST_TEST(!fix.st.execution_pending);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_read_binlog_event)
+
+struct fixture : algo_fixture_base
+{
+    detail::binlog_state_impl binlog_st;
+    detail::read_binlog_event_algo algo{st, {&diag, &binlog_st}};
+
+    fixture()
+    {
+        // As left by start_binlog_dump
+        binlog_st.dumping = true;
+        binlog_st.seqnum = 1;
+        st.execution_pending = true;
+        st.session_modified = true;
+    }
+};
+
+const std::vector<std::uint8_t> xid_body{0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_binlog_event_frame(1, binlog_event_type::xid, xid_body, 1234))
+        .check(fix);
+
+    // The event was decoded
+    auto ev = fix.algo.result();
+    BOOST_TEST_REQUIRE(!ev.empty());
+    BOOST_TEST(ev.type() == binlog_event_type::xid);
+    BOOST_TEST(ev.as_xid() == 5u);
+    BOOST_TEST(fix.binlog_st.position == 1234u);
+    BOOST_TEST(fix.binlog_st.seqnum == 2u);
+    BOOST_TEST(fix.st.execution_pending);
+}
+
+BOOST_AUTO_TEST_CASE(success_seqnum_wraps)
+{
+    // Setup
+    fixture fix;
+    fix.binlog_st.seqnum = 255;
+
+    // Run the algo. Sequence numbers wrap, since the stream may be arbitrarily long
+    algo_test()
+        .expect_read(create_binlog_event_frame(255, binlog_event_type::xid, xid_body, 1234))
+        .check(fix);
+
+    BOOST_TEST(fix.algo.result().as_xid() == 5u);
+    BOOST_TEST(fix.binlog_st.seqnum == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(success_eof)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test().expect_read(create_frame(1, {0xfe, 0x00, 0x00, 0x02, 0x00})).check(fix);
+
+    // No event was returned, and the connection can be used again
+    BOOST_TEST(fix.algo.result().empty());
+    BOOST_TEST(!fix.binlog_st.dumping);
+    BOOST_TEST(!fix.st.execution_pending);
+    BOOST_TEST(fix.st.session_modified);
+}
+
+BOOST_AUTO_TEST_CASE(success_not_dumping)
+{
+    // Setup
+    fixture fix;
+    fix.binlog_st.dumping = false;
+    fix.binlog_st.has_event = true;
+
+    // Run the algo. Nothing is read
+    algo_test().check(fix);
+    BOOST_TEST(fix.algo.result().empty());
+}
+
+BOOST_AUTO_TEST_CASE(error_network)
+{
+    algo_test()
+        .expect_read(create_binlog_event_frame(1, binlog_event_type::xid, xid_body))
+        .check_network_errors<fixture>();
+}
+
+BOOST_AUTO_TEST_CASE(error_response)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo. The server sends an error if the requested position is not valid
+    algo_test()
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_bad_db_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_bad_db_error, create_server_diag("my_message"));
+
+    // The dump finished
+    BOOST_TEST(fix.algo.result().empty());
+    BOOST_TEST(!fix.binlog_st.dumping);
+    BOOST_TEST(!fix.st.execution_pending);
+}
+
+BOOST_AUTO_TEST_CASE(error_bad_event)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_frame(1, {0x00, 0x01, 0x02}))
+        .check(fix, client_errc::incomplete_message);
+
+    // The dump is still active. The caller should close the connection
+    BOOST_TEST(fix.algo.result().empty());
+    BOOST_TEST(fix.binlog_st.dumping);
+    BOOST_TEST(fix.st.execution_pending);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
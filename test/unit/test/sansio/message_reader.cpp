@@ -556,4 +556,92 @@ BOOST_AUTO_TEST_CASE(reset_keep_state_true)
     BOOST_TEST(fix.seqnum == 21u);
 }
 
+// Double buffering
+BOOST_AUTO_TEST_CASE(flip_buffers_disabled)
+{
+    // If double buffering is not enabled, flipping is a no-op
+    reader_fixture fix(
+        buffer_builder().add(create_frame(42, {0x01, 0x02, 0x03})).add(create_frame(43, {0x04, 0x05})).build()
+    );
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(13);
+    fix.check_message({0x01, 0x02, 0x03});
+
+    fix.reader.flip_buffers();
+    fix.check_buffer_stability();
+    fix.reader.prepare_read(fix.seqnum);
+    fix.check_message({0x04, 0x05});
+}
+
+BOOST_AUTO_TEST_CASE(flip_buffers_message_done)
+{
+    // Read a message and part of the next one
+    reader_fixture fix(
+        buffer_builder().add(create_frame(42, {0x01, 0x02, 0x03})).add(create_frame(43, {0x04, 0x05})).build()
+    );
+    fix.reader.enable_double_buffering(512);
+    fix.record_buffer_first();
+    const std::uint8_t* original_first = fix.reader.internal_buffer().first();
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(9);
+    auto msg = fix.check_message({0x01, 0x02, 0x03});
+
+    // Flip. Pending bytes are carried over to the other buffer
+    fix.reader.flip_buffers();
+    BOOST_TEST(fix.reader.internal_back_buffer().first() == original_first);
+    BOOST_TEST(fix.reader.internal_buffer().pending_size() == 2u);
+
+    // Read the rest of the message
+    fix.reader.prepare_read(fix.seqnum);
+    fix.reader.prepare_buffer();
+    fix.read_bytes(4);
+    fix.check_message({0x04, 0x05});
+    BOOST_TEST(fix.seqnum == 44u);
+
+    // The old message is still valid
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(msg, (u8vec{0x01, 0x02, 0x03}));
+
+    // Flipping again makes us use the original buffer
+    fix.reader.flip_buffers();
+    fix.check_buffer_stability();
+}
+
+BOOST_AUTO_TEST_CASE(flip_buffers_message_half_read)
+{
+    // Read part of a multi-frame message, so the first frame's body is in the current message area
+    u8vec expected_body(64, 0x04);
+    expected_body.push_back(0x05);
+    reader_fixture fix(
+        buffer_builder().add(create_frame(42, u8vec(64, 0x04))).add(create_frame(43, {0x05})).build()
+    );
+    fix.reader.enable_double_buffering(512);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(70);
+    BOOST_TEST(!fix.reader.done());
+
+    // Flip. The partial message is carried over
+    fix.reader.flip_buffers();
+    BOOST_TEST(fix.reader.internal_buffer().current_message_size() == 64u);
+    BOOST_TEST(fix.reader.internal_buffer().pending_size() == 2u);
+
+    // Continue parsing
+    fix.reader.prepare_read(fix.seqnum, true);
+    fix.read_until_completion();
+    fix.check_message(expected_body);
+    BOOST_TEST(fix.seqnum == 44u);
+}
+
+BOOST_AUTO_TEST_CASE(flip_buffers_reset)
+{
+    // Resetting clears both buffers
+    reader_fixture fix(create_frame(42, {0x01, 0x02, 0x03}));
+    fix.reader.enable_double_buffering(512);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(5);
+    fix.reader.flip_buffers();
+    fix.reader.reset();
+    BOOST_TEST(fix.reader.internal_buffer().pending_size() == 0u);
+    BOOST_TEST(fix.reader.internal_back_buffer().pending_size() == 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -416,8 +416,7 @@ BOOST_AUTO_TEST_CASE(pipelined_write)
     std::uint8_t seqnum_1 = 2;
     std::uint8_t seqnum_2 = 42;
 
-    // Prepare a pipelined write. This is currently limited
-    // to two messages which are shorter than the max frame size.
+    // Prepare a pipelined write. Messages must be shorter than the max frame size.
     writer.prepare_pipelined_write(mock_message{msg_1}, seqnum_1, mock_message{msg_2}, seqnum_2);
     BOOST_TEST(!writer.done());
 
@@ -447,6 +446,49 @@ BOOST_AUTO_TEST_CASE(pipelined_write)
     BOOST_TEST(seqnum_2 == 43u);
 }
 
+BOOST_AUTO_TEST_CASE(pipelined_write_many_messages)
+{
+    message_writer writer(8);
+    std::vector<std::uint8_t> msg_1{0x01, 0x02};
+    std::vector<std::uint8_t> msg_2{0x04, 0x05, 0x06};
+    std::vector<std::uint8_t> msg_3{0x07};
+    std::uint8_t seqnum_1 = 0;
+    std::uint8_t seqnum_2 = 0;
+    std::uint8_t seqnum_3 = 5;
+
+    // Size checks
+    BOOST_TEST(writer.fits_in_frame(7u));
+    BOOST_TEST(!writer.fits_in_frame(8u));
+
+    // Compose the pipeline
+    writer.start_pipeline();
+    writer.add_pipelined_message(mock_message{msg_1}, seqnum_1);
+    writer.add_pipelined_message(mock_message{msg_2}, seqnum_2);
+    writer.add_pipelined_message(mock_message{msg_3}, seqnum_3);
+    writer.finish_pipeline();
+    BOOST_TEST(!writer.done());
+
+    // All messages are written as a single chunk
+    auto chunk = writer.current_chunk();
+    auto expected = buffer_builder()
+                        .add(create_frame(0, msg_1))
+                        .add(create_frame(0, msg_2))
+                        .add(create_frame(5, msg_3))
+                        .build();
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(chunk, expected);
+    BOOST_TEST(seqnum_1 == 1u);
+    BOOST_TEST(seqnum_2 == 1u);
+    BOOST_TEST(seqnum_3 == 6u);
+
+    // Partial writes work
+    writer.resume(10);
+    chunk = writer.current_chunk();
+    auto expected_view = span<std::uint8_t>(expected).subspan(10);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(chunk, expected_view);
+    writer.resume(8);
+    BOOST_TEST(writer.done());
+}
+
 // Interleaving pipelined writes with regular writes works
 BOOST_AUTO_TEST_CASE(pipelined_write_interleaved)
 {
@@ -64,6 +64,25 @@ BOOST_AUTO_TEST_CASE(success_no_backslash_escapes)
     BOOST_TEST(!fix.st.backslash_escapes);
 }
 
+BOOST_AUTO_TEST_CASE(success_session_tracking)
+{
+    // A ping doesn't modify the session, even if session tracking wasn't negotiated
+    fixture fix;
+    algo_test()
+        .expect_write({0x01, 0x00, 0x00, 0x00, 0x0e})
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+    BOOST_TEST(!fix.st.session_modified);
+
+    // If the server reports an open transaction, the session is modified
+    fixture fix2;
+    algo_test()
+        .expect_write({0x01, 0x00, 0x00, 0x00, 0x0e})
+        .expect_read(create_ok_frame(1, ok_builder().in_transaction(true).build()))
+        .check(fix2);
+    BOOST_TEST(fix2.st.session_modified);
+}
+
 BOOST_AUTO_TEST_CASE(error_network)
 {
     // Check for net errors for each read/write
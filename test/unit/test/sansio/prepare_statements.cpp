@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/impl/internal/sansio/prepare_statements.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_common/create_diagnostics.hpp"
+#include "test_unit/algo_test.hpp"
+#include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_meta.hpp"
+
+using namespace boost::mysql::test;
+using namespace boost::mysql;
+
+BOOST_AUTO_TEST_SUITE(test_prepare_statements)
+
+struct fixture : algo_fixture_base
+{
+    std::vector<std::string> stmts_sql{"SELECT 1", "SELECT ?"};
+    std::array<statement, 2> stmts;
+    detail::prepare_statements_algo algo{st, {&diag, stmts_sql, stmts.data()}};
+};
+
+// A serialized COM_STMT_PREPARE request
+static std::vector<std::uint8_t> create_prepare_request(string_view sql)
+{
+    std::vector<std::uint8_t> body{0x16};
+    body.insert(body.end(), sql.begin(), sql.end());
+    return create_frame(0, body);
+}
+
+// A serialized COM_STMT_PREPARE response, with the given ID, 1 column and num_params params
+static std::vector<std::uint8_t> create_prepare_response(std::uint8_t id, std::uint8_t num_params)
+{
+    return create_frame(1, {0x00, id, 0x00, 0x00, 0x00, 0x01, 0x00, num_params, 0x00, 0x00, 0x00, 0x00});
+}
+
+static std::vector<std::uint8_t> create_meta_frame(std::uint8_t seqnum)
+{
+    return create_coldef_frame(seqnum, meta_builder().type(column_type::bigint).build_coldef());
+}
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo. All requests are written at once
+    algo_test()
+        .expect_write(concat_copy(create_prepare_request("SELECT 1"), create_prepare_request("SELECT ?")))
+        .expect_read(create_prepare_response(1, 0))
+        .expect_read(create_meta_frame(2))
+        .expect_read(create_prepare_response(2, 1))
+        .expect_read(create_meta_frame(2))
+        .expect_read(create_meta_frame(3))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.stmts[0].id() == 1u);
+    BOOST_TEST(fix.stmts[0].num_params() == 0u);
+    BOOST_TEST(fix.stmts[1].id() == 2u);
+    BOOST_TEST(fix.stmts[1].num_params() == 1u);
+
+    // Preparing statements this way doesn't count as a session change
+    BOOST_TEST(!fix.st.session_modified);
+}
+
+BOOST_AUTO_TEST_CASE(error_server)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(concat_copy(create_prepare_request("SELECT 1"), create_prepare_request("SELECT ?")))
+        .expect_read(create_prepare_response(1, 0))
+        .expect_read(create_meta_frame(2))
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_no_such_table)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_no_such_table, create_server_diag("my_message"));
+}
+
+BOOST_AUTO_TEST_CASE(error_network)
+{
+    algo_test()
+        .expect_write(concat_copy(create_prepare_request("SELECT 1"), create_prepare_request("SELECT ?")))
+        .expect_read(create_prepare_response(1, 0))
+        .expect_read(create_meta_frame(2))
+        .expect_read(create_prepare_response(2, 1))
+        .expect_read(create_meta_frame(2))
+        .expect_read(create_meta_frame(3))
+        .check_network_errors<fixture>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/read_resultset_head.hpp>
 
@@ -146,6 +147,78 @@ BOOST_AUTO_TEST_CASE(success_ok_packet_next_resultset)
     BOOST_TEST(fix.proc.info() == "1st");
 }
 
+// Session state tracking
+BOOST_AUTO_TEST_CASE(session_tracking_ok_packet)
+{
+    struct
+    {
+        const char* name;
+        std::uint32_t caps;
+        detail::ok_view ok;
+        bool expected;
+    } test_cases[] = {
+  // clang-format off
+        {"no_capability",   0u,                           ok_builder().build(),                             true },
+        {"unchanged",       detail::CLIENT_SESSION_TRACK, ok_builder().build(),                             false},
+        {"changed",         detail::CLIENT_SESSION_TRACK, ok_builder().session_state("abc").build(),        true },
+        {"changed_no_data", detail::CLIENT_SESSION_TRACK, ok_builder().session_state_changed(true).build(), true },
+        {"in_transaction",  detail::CLIENT_SESSION_TRACK, ok_builder().in_transaction(true).build(),        true },
+        {"more_results",    detail::CLIENT_SESSION_TRACK, ok_builder().more_results(true).build(),          true },
+  // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            // Setup
+            fixture fix;
+            fix.st.current_capabilities = detail::capabilities(tc.caps);
+
+            // Run the algo
+            algo_test().expect_read(create_ok_frame(1, tc.ok)).check(fix);
+
+            // Verify
+            BOOST_TEST(fix.st.session_state_changed() == tc.expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(session_tracking_reading_rows)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_frame(1, {0x01}))
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::varchar).build_coldef()))
+        .check(fix);
+
+    // Rows are pending, so the connection needs a reset
+    BOOST_TEST(!fix.st.session_modified);
+    BOOST_TEST(fix.st.execution_pending);
+    BOOST_TEST(fix.st.session_state_changed());
+}
+
+BOOST_AUTO_TEST_CASE(session_tracking_error_packet)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+
+    // Run the algo
+    algo_test()
+        .expect_read(
+            err_builder().seqnum(1).code(common_server_errc::er_bad_db_error).message("no_db").build_frame()
+        )
+        .check(fix, common_server_errc::er_bad_db_error, create_server_diag("no_db"));
+
+    // Errors complete the execution
+    BOOST_TEST(!fix.st.session_state_changed());
+}
+
 BOOST_AUTO_TEST_CASE(state_complete)
 {
     // Setup
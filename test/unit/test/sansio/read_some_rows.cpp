@@ -8,10 +8,13 @@
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/common_server_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
 
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/read_some_rows.hpp>
 
+#include <boost/asio/thread_pool.hpp>
 #include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -87,6 +90,38 @@ BOOST_AUTO_TEST_CASE(eof)
     BOOST_TEST(fix.st.backslash_escapes);
 }
 
+BOOST_AUTO_TEST_CASE(eof_session_tracking)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+    fix.st.execution_pending = true;
+
+    // Run the test
+    algo_test().expect_read(create_eof_frame(42, ok_builder().build())).check(fix);
+
+    // The execution is complete and the session wasn't modified
+    BOOST_TEST(!fix.st.execution_pending);
+    BOOST_TEST(!fix.st.session_modified);
+}
+
+BOOST_AUTO_TEST_CASE(eof_session_state_changed)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+    fix.st.execution_pending = true;
+
+    // Run the test
+    algo_test()
+        .expect_read(create_eof_frame(42, ok_builder().session_state_changed(true).build()))
+        .check(fix);
+
+    // The execution is complete and the session was modified
+    BOOST_TEST(!fix.st.execution_pending);
+    BOOST_TEST(fix.st.session_modified);
+}
+
 BOOST_AUTO_TEST_CASE(eof_no_backslash_escapes)
 {
     // Setup
@@ -376,4 +411,193 @@ BOOST_AUTO_TEST_CASE(error_deserialize_row_message)
     fix.proc.num_calls().on_num_meta(1).on_meta(1).on_row_batch_start(1).validate();
 }
 
+// With a row decoder, rows are framed first and then processed as a batch
+struct parallel_fixture : fixture
+{
+    boost::asio::thread_pool pool{2};
+    parallel_row_decoder decoder{pool.get_executor(), 2, 1};
+
+    parallel_fixture() { st.row_decoder = &decoder; }
+};
+
+BOOST_AUTO_TEST_CASE(parallel_batch_with_rows)
+{
+    // Setup
+    parallel_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_text_row_message(43, "von"))
+                         .build())
+        .expect_decode_rows()
+        .check(fix);
+
+    // Validate
+    BOOST_TEST(fix.algo.result() == 2u);  // num read rows
+    BOOST_TEST(fix.proc.is_reading_rows());
+    fix.validate_refs(2);
+    fix.proc.num_calls()
+        .on_num_meta(1)
+        .on_meta(1)
+        .on_row_batch_start(1)
+        .on_row(2)
+        .on_row_batch_finish(1)
+        .validate();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_batch_with_rows_eof)
+{
+    // Setup
+    parallel_fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+    fix.st.execution_pending = true;
+
+    // Run the algo. The OK packet is processed after the rows
+    algo_test()
+        .expect_read(
+            buffer_builder()
+                .add(create_text_row_message(42, "abc"))
+                .add(create_text_row_message(43, "von"))
+                .add(
+                    create_eof_frame(44, ok_builder().affected_rows(1).info("1st").more_results(true).build())
+                )
+                .add(create_ok_frame(45, ok_builder().info("2nd").build()))
+                .build()
+        )
+        .expect_decode_rows()
+        .check(fix);
+
+    // Validate
+    BOOST_TEST(fix.algo.result() == 2u);  // num read rows
+    BOOST_TEST_REQUIRE(fix.proc.is_reading_head());
+    BOOST_TEST(fix.proc.affected_rows() == 1u);
+    BOOST_TEST(fix.proc.info() == "1st");
+    BOOST_TEST(fix.st.backslash_escapes);
+    fix.validate_refs(2);
+    fix.proc.num_calls()
+        .on_num_meta(1)
+        .on_meta(1)
+        .on_row_batch_start(1)
+        .on_row(2)
+        .on_row_ok_packet(1)
+        .on_row_batch_finish(1)
+        .validate();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_batch_with_rows_out_of_span_space)
+{
+    // Setup
+    parallel_fixture fix;
+
+    // Run the algo. Single, long read that yields 4 rows.
+    // We have only space for 3
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "aaa"))
+                         .add(create_text_row_message(43, "bbb"))
+                         .add(create_text_row_message(44, "ccc"))
+                         .add(create_text_row_message(45, "ddd"))
+                         .build())
+        .expect_decode_rows()
+        .check(fix);
+
+    // Validate
+    BOOST_TEST(fix.algo.result() == 3u);  // num read rows
+    fix.validate_refs(3);
+    BOOST_TEST(fix.proc.is_reading_rows());
+    fix.proc.num_calls()
+        .on_num_meta(1)
+        .on_meta(1)
+        .on_row_batch_start(1)
+        .on_row(3)
+        .on_row_batch_finish(1)
+        .validate();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_error_seqnum_mismatch)
+{
+    // Setup
+    parallel_fixture fix;
+
+    // Run the algo. No row is processed
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_text_row_message(45, "von"))  // seqnum mismatch here
+                         .build())
+        .check(fix, client_errc::sequence_number_mismatch);
+
+    // Validate
+    fix.proc.num_calls().on_num_meta(1).on_meta(1).on_row_batch_start(1).validate();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_error_on_row)
+{
+    // Setup
+    parallel_fixture fix;
+
+    // Mock a failure
+    fix.proc.set_fail_count(fail_count(0, client_errc::static_row_parsing_error));
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_text_row_message(42, 10))
+        .check(fix, client_errc::static_row_parsing_error);
+
+    // Validate
+    fix.proc.num_calls().on_num_meta(1).on_meta(1).on_row(1).on_row_batch_start(1).validate();
+}
+
+// Errors in batches decoded by the decoder are reported once decoding finishes
+BOOST_AUTO_TEST_CASE(parallel_error_on_decoded_rows)
+{
+    // Setup
+    parallel_fixture fix;
+
+    // Mock a failure
+    fix.proc.set_fail_count(fail_count(0, client_errc::static_row_parsing_error));
+
+    // Run the algo
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_text_row_message(43, "von"))
+                         .build())
+        .expect_decode_rows()
+        .check(fix, client_errc::static_row_parsing_error);
+
+    // Validate
+    fix.proc.num_calls().on_num_meta(1).on_meta(1).on_row(1).on_row_batch_start(1).validate();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_error_packet_after_rows)
+{
+    // Setup
+    parallel_fixture fix;
+    fix.st.execution_pending = true;
+
+    // Run the algo. Rows before the error are processed
+    algo_test()
+        .expect_read(
+            buffer_builder()
+                .add(create_text_row_message(42, "abc"))
+                .add(create_text_row_message(43, "von"))
+                .add(err_builder()
+                         .seqnum(44)
+                         .code(common_server_errc::er_alter_info)
+                         .message("abc")
+                         .build_frame())
+                .build()
+        )
+        .expect_decode_rows()
+        .check(fix, common_server_errc::er_alter_info, create_server_diag("abc"));
+
+    // Validate
+    BOOST_TEST(!fix.st.execution_pending);
+    fix.validate_refs(2);
+    fix.proc.num_calls().on_num_meta(1).on_meta(1).on_row_batch_start(1).on_row(2).validate();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
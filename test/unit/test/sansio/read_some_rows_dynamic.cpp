@@ -7,12 +7,15 @@
 
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/parallel_row_decoder.hpp>
+#include <boost/mysql/rows_view.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
 
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/read_some_rows_dynamic.hpp>
 
+#include <boost/asio/thread_pool.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "test_common/buffer_concat.hpp"
@@ -104,6 +107,33 @@ BOOST_AUTO_TEST_CASE(batch_with_rows_eof)
     BOOST_TEST(fix.exec_st.get_info() == "1st");
 }
 
+BOOST_AUTO_TEST_CASE(batch_with_rows_eof_parallel)
+{
+    // Setup
+    fixture fix;
+    boost::asio::thread_pool pool(2);
+    parallel_row_decoder decoder(pool.get_executor(), 2, 1);
+    fix.st.row_decoder = &decoder;
+
+    // Run the algo
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_text_row_message(43, "von"))
+                         .add(create_text_row_message(44, "defg"))
+                         .add(create_text_row_message(45, "h"))
+                         .add(create_eof_frame(46, ok_builder().affected_rows(1).info("1st").build()))
+                         .build())
+        .expect_decode_rows()
+        .check(fix);
+
+    // Check. Rows are the same as when decoding sequentially
+    BOOST_TEST(fix.algo.result() == makerows(1, "abc", "von", "defg", "h"));
+    BOOST_TEST_REQUIRE(fix.exec_st.is_complete());
+    BOOST_TEST(fix.exec_st.get_affected_rows() == 1u);
+    BOOST_TEST(fix.exec_st.get_info() == "1st");
+}
+
 // All the other error cases are already tested in read_some_rows_impl. Spotcheck
 BOOST_AUTO_TEST_CASE(error)
 {
@@ -114,4 +144,41 @@ BOOST_AUTO_TEST_CASE(error)
     algo_test().expect_read(client_errc::incomplete_message).check(fix, client_errc::incomplete_message);
 }
 
+BOOST_AUTO_TEST_CASE(read_ahead)
+{
+    // Setup
+    fixture fix;
+    fix.st.reader.enable_double_buffering(512);
+
+    // Read a first batch
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_text_row_message(43, "von"))
+                         .build())
+        .check(fix);
+    rows_view batch1 = fix.algo.result();
+    BOOST_TEST(batch1 == makerows(1, "abc", "von"));
+
+    // Read a second batch
+    struct second_fixture
+    {
+        diagnostics diag;
+        detail::read_some_rows_dynamic_algo algo;
+
+        second_fixture(fixture& fix) : algo(fix.st, {&diag, &fix.exec_st}) {}
+    } fix2(fix);
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(44, "tu"))
+                         .add(create_eof_frame(45, ok_builder().build()))
+                         .build())
+        .check(fix2);
+    BOOST_TEST(fix2.algo.result() == makerows(1, "tu"));
+    BOOST_TEST(fix.exec_st.is_complete());
+
+    // The first batch is still valid
+    BOOST_TEST(batch1 == makerows(1, "abc", "von"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -62,6 +62,42 @@ BOOST_AUTO_TEST_CASE(success_no_backslash_escapes)
     BOOST_TEST(!fix.st.backslash_escapes);
 }
 
+BOOST_AUTO_TEST_CASE(success_clears_session_state)
+{
+    // Setup
+    fixture fix;
+    fix.st.session_modified = true;
+    fix.st.execution_pending = true;
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, {0x1f}))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+
+    // The session is considered pristine again
+    BOOST_TEST(!fix.st.session_state_changed());
+}
+
+BOOST_AUTO_TEST_CASE(error_keeps_session_state)
+{
+    // Setup
+    fixture fix;
+    fix.st.session_modified = true;
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, {0x1f}))
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_bad_db_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_bad_db_error, create_server_diag("my_message"));
+
+    BOOST_TEST(fix.st.session_state_changed());
+}
+
 BOOST_AUTO_TEST_CASE(error_network)
 {
     // This covers errors in read and write
@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/any_execution_request.hpp>
+
+#include <boost/mysql/impl/internal/sansio/run_pipeline.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_common/check_meta.hpp"
+#include "test_common/create_basic.hpp"
+#include "test_common/create_diagnostics.hpp"
+#include "test_unit/algo_test.hpp"
+#include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/create_statement.hpp"
+#include "test_unit/mock_execution_processor.hpp"
+#include "test_unit/printing.hpp"
+
+using namespace boost::mysql::test;
+using namespace boost::mysql;
+using boost::mysql::detail::any_execution_request;
+using boost::mysql::detail::pipeline_stage;
+namespace asio = boost::asio;
+
+BOOST_AUTO_TEST_SUITE(test_run_pipeline)
+
+struct fixture : algo_fixture_base
+{
+    mock_execution_processor proc1, proc2;
+    diagnostics diag1{create_server_diag("Diagnostics not cleared")};
+    diagnostics diag2{create_server_diag("Diagnostics not cleared")};
+    std::array<pipeline_stage, 2> stages;
+    detail::run_pipeline_algo algo;
+
+    fixture(any_execution_request req1 = {"SELECT 1"}, any_execution_request req2 = {"SELECT 2"})
+        : stages{{pipeline_stage{req1, &proc1, &diag1, {}}, pipeline_stage{req2, &proc2, &diag2, {}}}},
+          algo(st, {&diag, stages})
+    {
+    }
+};
+
+// The serialized form of SELECT 1 and SELECT 2 query requests
+static constexpr std::uint8_t serialized_select_1[] = {0x03, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x31};
+static constexpr std::uint8_t serialized_select_2[] = {0x03, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x32};
+
+// Both requests are written at once, with independent sequence numbers
+static std::vector<std::uint8_t> serialized_pipeline()
+{
+    return concat_copy(create_frame(0, serialized_select_1), create_frame(0, serialized_select_2));
+}
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(serialized_pipeline())
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(10u).info("1st").build()))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(20u).info("2nd").build()))
+        .check(fix);
+
+    // Verify
+    fix.proc1.num_calls().reset(1).on_head_ok_packet(1).validate();
+    fix.proc2.num_calls().reset(1).on_head_ok_packet(1).validate();
+    BOOST_TEST(fix.proc1.affected_rows() == 10u);
+    BOOST_TEST(fix.proc1.info() == "1st");
+    BOOST_TEST(fix.proc2.affected_rows() == 20u);
+    BOOST_TEST(fix.proc2.info() == "2nd");
+    BOOST_TEST(fix.stages[0].err == error_code());
+    BOOST_TEST(fix.stages[1].err == error_code());
+    BOOST_TEST(fix.diag1 == diagnostics());
+    BOOST_TEST(fix.diag2 == diagnostics());
+}
+
+BOOST_AUTO_TEST_CASE(rows)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo. The first request returns rows
+    algo_test()
+        .expect_write(serialized_pipeline())
+        .expect_read(create_frame(1, {0x01}))  // OK, 1 column
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::bigint).build_coldef()))
+        .expect_read(create_text_row_message(3, 42))
+        .expect_read(create_eof_frame(4, ok_builder().affected_rows(10u).build()))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(20u).build()))
+        .check(fix);
+
+    // Verify
+    fix.proc1.num_calls()
+        .reset(1)
+        .on_num_meta(1)
+        .on_meta(1)
+        .on_row_batch_start(2)
+        .on_row(1)
+        .on_row_batch_finish(2)
+        .on_row_ok_packet(1)
+        .validate();
+    check_meta(fix.proc1.meta(), {column_type::bigint});
+    BOOST_TEST(fix.proc1.affected_rows() == 10u);
+    fix.proc2.num_calls().reset(1).on_head_ok_packet(1).validate();
+    BOOST_TEST(fix.proc2.affected_rows() == 20u);
+}
+
+// A server error only affects the request that caused it
+BOOST_AUTO_TEST_CASE(error_server)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(serialized_pipeline())
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_bad_db_error)
+                         .message("my_message")
+                         .build_frame())
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(20u).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.stages[0].err == error_code(common_server_errc::er_bad_db_error));
+    BOOST_TEST(fix.diag1 == create_server_diag("my_message"));
+    BOOST_TEST(fix.stages[1].err == error_code());
+    BOOST_TEST(fix.diag2 == diagnostics());
+    fix.proc2.num_calls().reset(1).on_head_ok_packet(1).validate();
+    BOOST_TEST(fix.proc2.affected_rows() == 20u);
+}
+
+// Other errors abort the pipeline
+BOOST_AUTO_TEST_CASE(error_fatal)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(serialized_pipeline())
+        .expect_read(asio::error::eof)
+        .check(fix, asio::error::eof);
+
+    // Verify
+    BOOST_TEST(fix.stages[0].err == error_code(asio::error::eof));
+    BOOST_TEST(fix.stages[1].err == error_code(asio::error::eof));
+    fix.proc2.num_calls().reset(1).validate();
+}
+
+// Requests failing client-side checks are not sent
+BOOST_AUTO_TEST_CASE(error_client)
+{
+    // Setup
+    auto stmt = statement_builder().id(1).num_params(2).build();
+    const auto params = make_fv_arr("test", nullptr, 42);  // too many params
+    fixture fix(any_execution_request(stmt, params));
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, serialized_select_2))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(20u).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.stages[0].err == error_code(client_errc::wrong_num_params));
+    fix.proc1.num_calls().validate();
+    BOOST_TEST(fix.stages[1].err == error_code());
+    fix.proc2.num_calls().reset(1).on_head_ok_packet(1).validate();
+}
+
+BOOST_AUTO_TEST_CASE(error_network)
+{
+    algo_test()
+        .expect_write(serialized_pipeline())
+        .expect_read(create_frame(1, {0x01}))  // OK, 1 column
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::bigint).build_coldef()))
+        .expect_read(create_text_row_message(3, 42))
+        .expect_read(create_eof_frame(4, ok_builder().build()))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check_network_errors<fixture>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/tls_session_cache.hpp>
+
+#include <boost/asio/ssl/context.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+using namespace boost::mysql;
+
+BOOST_AUTO_TEST_SUITE(test_tls_session_cache)
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+
+struct session_deleter
+{
+    void operator()(SSL_SESSION* s) const noexcept { SSL_SESSION_free(s); }
+};
+using session_ptr = std::unique_ptr<SSL_SESSION, session_deleter>;
+
+static session_ptr make_session() { return session_ptr(SSL_SESSION_new()); }
+
+BOOST_AUTO_TEST_CASE(get_empty)
+{
+    tls_session_cache cache;
+    BOOST_TEST(cache.get("host", 3306) == nullptr);
+    BOOST_TEST(cache.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(store_get)
+{
+    tls_session_cache cache;
+    auto sess = make_session();
+    cache.store("host", 3306, sess.get());
+    BOOST_TEST(cache.size() == 1u);
+
+    // get returns a new reference to the same session
+    session_ptr res(cache.get("host", 3306));
+    BOOST_TEST(res.get() == sess.get());
+
+    // Host and port must match
+    BOOST_TEST(cache.get("host", 3307) == nullptr);
+    BOOST_TEST(cache.get("other", 3306) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(store_outlives_caller_reference)
+{
+    // The cache keeps its own reference
+    tls_session_cache cache;
+    SSL_SESSION* raw = nullptr;
+    {
+        auto sess = make_session();
+        raw = sess.get();
+        cache.store("host", 3306, raw);
+    }
+    session_ptr res(cache.get("host", 3306));
+    BOOST_TEST(res.get() == raw);
+}
+
+BOOST_AUTO_TEST_CASE(store_replaces)
+{
+    tls_session_cache cache;
+    auto sess1 = make_session();
+    auto sess2 = make_session();
+    cache.store("host", 3306, sess1.get());
+    cache.store("host", 3306, sess2.get());
+    BOOST_TEST(cache.size() == 1u);
+    session_ptr res(cache.get("host", 3306));
+    BOOST_TEST(res.get() == sess2.get());
+}
+
+BOOST_AUTO_TEST_CASE(invalidate)
+{
+    tls_session_cache cache;
+    auto sess1 = make_session();
+    auto sess2 = make_session();
+    cache.store("host1", 3306, sess1.get());
+    cache.store("host2", 3306, sess2.get());
+
+    cache.invalidate("host1", 3306);
+    BOOST_TEST(cache.size() == 1u);
+    BOOST_TEST(cache.get("host1", 3306) == nullptr);
+    session_ptr res(cache.get("host2", 3306));
+    BOOST_TEST(res.get() == sess2.get());
+
+    // Invalidating non-existing entries is a no-op
+    cache.invalidate("host1", 3306);
+    BOOST_TEST(cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(clear)
+{
+    tls_session_cache cache;
+    auto sess1 = make_session();
+    auto sess2 = make_session();
+    cache.store("host1", 3306, sess1.get());
+    cache.store("host2", 3306, sess2.get());
+    cache.clear();
+    BOOST_TEST(cache.size() == 0u);
+    BOOST_TEST(cache.get("host1", 3306) == nullptr);
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,312 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/execution_state.hpp>
+#include <boost/mysql/lazy_row_view.hpp>
+#include <boost/mysql/row_view.hpp>
+#include <boost/mysql/static_execution_state.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/replay_fixture.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+namespace asio = boost::asio;
+
+BOOST_AUTO_TEST_SUITE(test_visit_some_rows)
+
+// Adds a connection on top of a replay
+struct fixture : replay_fixture
+{
+    any_connection conn;
+
+    fixture(const std::vector<std::uint8_t>& bytes) : replay_fixture(bytes), conn(ctx, make_params()) {}
+};
+
+// Stores what it sees, as an aggregating consumer would
+struct dynamic_visitor
+{
+    std::int64_t sum{};
+    std::vector<std::string> names;
+
+    void operator()(row_view r)
+    {
+        BOOST_TEST_REQUIRE(r.size() == 2u);
+        sum += r.at(0).as_int64();
+        names.emplace_back(r.at(1).as_string());
+    }
+};
+
+static std::vector<std::uint8_t> three_rows()
+{
+    return buffer_builder()
+        .add(create_text_row_message(0, 10, "abc"))
+        .add(create_text_row_message(1, 20, "de"))
+        .add(create_text_row_message(2, 30, "f"))
+        .add(create_eof_frame(3, ok_builder().affected_rows(3).build()))
+        .build();
+}
+
+static void add_dynamic_meta(execution_state& st)
+{
+    add_meta(get_iface(st), {column_type::bigint, column_type::varchar});
+}
+
+BOOST_AUTO_TEST_CASE(dynamic_sync)
+{
+    fixture fix(three_rows());
+    execution_state st;
+    add_dynamic_meta(st);
+
+    // All rows are visited in a single batch
+    dynamic_visitor visitor;
+    std::size_t num_rows = fix.conn.visit_some_rows(st, visitor);
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(visitor.sum == 60);
+    BOOST_TEST(visitor.names == (std::vector<std::string>{"abc", "de", "f"}));
+    BOOST_TEST(st.complete());
+    BOOST_TEST(st.affected_rows() == 3u);
+
+    // Further calls are no-ops
+    num_rows = fix.conn.visit_some_rows(st, visitor);
+    BOOST_TEST(num_rows == 0u);
+    BOOST_TEST(visitor.names.size() == 3u);
+}
+
+BOOST_AUTO_TEST_CASE(dynamic_async)
+{
+    fixture fix(three_rows());
+    execution_state st;
+    add_dynamic_meta(st);
+
+    dynamic_visitor visitor;
+    error_code ec = client_errc::wrong_num_params;
+    std::size_t num_rows = 0u;
+    fix.conn.async_visit_some_rows(st, visitor, [&](error_code err, std::size_t n) {
+        ec = err;
+        num_rows = n;
+    });
+    fix.ctx.run();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(visitor.sum == 60);
+    BOOST_TEST(visitor.names == (std::vector<std::string>{"abc", "de", "f"}));
+    BOOST_TEST(st.complete());
+}
+
+BOOST_AUTO_TEST_CASE(dynamic_lambda)
+{
+    fixture fix(three_rows());
+    execution_state st;
+    add_dynamic_meta(st);
+
+    // Rvalue function objects are accepted by the sync functions
+    std::size_t count = 0u;
+    error_code ec;
+    diagnostics diag;
+    std::size_t num_rows = fix.conn.visit_some_rows(st, [&count](row_view) { ++count; }, ec, diag);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(count == 3u);
+}
+
+BOOST_AUTO_TEST_CASE(dynamic_error)
+{
+    // The second row has a wrong sequence number
+    auto bytes = buffer_builder()
+                     .add(create_text_row_message(0, 10, "abc"))
+                     .add(create_text_row_message(2, 20, "de"))
+                     .build();
+    fixture fix(bytes);
+    execution_state st;
+    add_dynamic_meta(st);
+
+    dynamic_visitor visitor;
+    error_code ec;
+    diagnostics diag;
+    fix.conn.visit_some_rows(st, visitor, ec, diag);
+    BOOST_TEST(ec == error_code(client_errc::sequence_number_mismatch));
+    BOOST_TEST(visitor.names == (std::vector<std::string>{"abc"}));
+}
+
+BOOST_AUTO_TEST_CASE(lazy)
+{
+    fixture fix(three_rows());
+    execution_state st;
+    add_dynamic_meta(st);
+
+    // Only the first column is accessed
+    std::int64_t sum = 0;
+    auto visitor = [&sum](lazy_row_view r) {
+        BOOST_TEST_REQUIRE(r.size() == 2u);
+        BOOST_TEST(!r.is_null(1));
+        sum += r.at(0).as_int64();
+    };
+    std::size_t num_rows = fix.conn.visit_some_rows_lazy(st, visitor);
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(sum == 60);
+    BOOST_TEST(st.complete());
+}
+
+BOOST_AUTO_TEST_CASE(lazy_async)
+{
+    fixture fix(three_rows());
+    execution_state st;
+    add_dynamic_meta(st);
+
+    std::vector<std::string> names;
+    auto visitor = [&names](lazy_row_view r) { names.emplace_back(r.at(1).as_string()); };
+    error_code ec = client_errc::wrong_num_params;
+    std::size_t num_rows = 0u;
+    fix.conn.async_visit_some_rows_lazy(st, visitor, [&](error_code err, std::size_t n) {
+        ec = err;
+        num_rows = n;
+    });
+    fix.ctx.run();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(names == (std::vector<std::string>{"abc", "de", "f"}));
+}
+
+BOOST_AUTO_TEST_CASE(lazy_framing_error)
+{
+    // The row contains a single field, but two are expected
+    auto bytes = create_text_row_message(0, 10);
+    fixture fix(bytes);
+    execution_state st;
+    add_dynamic_meta(st);
+
+    std::size_t count = 0u;
+    error_code ec;
+    diagnostics diag;
+    fix.conn.visit_some_rows_lazy(st, [&count](lazy_row_view) { ++count; }, ec, diag);
+    BOOST_TEST(ec == error_code(client_errc::incomplete_message));
+    BOOST_TEST(count == 0u);
+}
+
+#ifdef BOOST_MYSQL_CXX14
+
+using row1 = std::tuple<std::int64_t, std::string>;
+using row2 = std::tuple<double>;
+using state_t = static_execution_state<row1, row2>;
+
+struct static_visitor
+{
+    std::vector<row1> rows;
+
+    void operator()(row1& r) { rows.push_back(std::move(r)); }
+};
+
+static void add_static_meta(state_t& st)
+{
+    add_meta(
+        get_iface(st),
+        {
+            meta_builder().type(column_type::bigint).nullable(false).build_coldef(),
+            meta_builder().type(column_type::varchar).nullable(false).build_coldef(),
+        }
+    );
+}
+
+BOOST_AUTO_TEST_CASE(static_sync)
+{
+    fixture fix(three_rows());
+    state_t st;
+    add_static_meta(st);
+
+    static_visitor visitor;
+    std::size_t num_rows = fix.conn.visit_some_rows<row1>(st, visitor);
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST_REQUIRE(visitor.rows.size() == 3u);
+    BOOST_TEST((visitor.rows[0] == row1{10, "abc"}));
+    BOOST_TEST((visitor.rows[1] == row1{20, "de"}));
+    BOOST_TEST((visitor.rows[2] == row1{30, "f"}));
+    BOOST_TEST(st.complete());
+}
+
+BOOST_AUTO_TEST_CASE(static_async)
+{
+    fixture fix(three_rows());
+    state_t st;
+    add_static_meta(st);
+
+    static_visitor visitor;
+    error_code ec = client_errc::wrong_num_params;
+    std::size_t num_rows = 0u;
+    fix.conn.async_visit_some_rows<row1>(st, visitor, [&](error_code err, std::size_t n) {
+        ec = err;
+        num_rows = n;
+    });
+    fix.ctx.run();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(visitor.rows.size() == 3u);
+    BOOST_TEST(st.complete());
+}
+
+BOOST_AUTO_TEST_CASE(static_type_mismatch)
+{
+    fixture fix(three_rows());
+    state_t st;
+    add_static_meta(st);
+
+    // Visiting with the type of another resultset is an error, and the visitor isn't invoked
+    std::size_t count = 0u;
+    error_code ec;
+    diagnostics diag;
+    fix.conn.visit_some_rows<row2>(st, [&count](row2&) { ++count; }, ec, diag);
+    BOOST_TEST(ec == error_code(client_errc::row_type_mismatch));
+    BOOST_TEST(count == 0u);
+}
+
+// Borrowed fields point into the connection's buffer, and are valid until the next operation
+BOOST_AUTO_TEST_CASE(static_borrowed)
+{
+    using borrowed_row = std::tuple<std::int64_t, string_view>;
+    fixture fix(three_rows());
+    static_execution_state<borrowed_row> st;
+    add_meta(
+        get_iface(st),
+        {
+            meta_builder().type(column_type::bigint).nullable(false).build_coldef(),
+            meta_builder().type(column_type::varchar).nullable(false).build_coldef(),
+        }
+    );
+
+    std::vector<string_view> names;
+    auto visitor = [&names](borrowed_row& r) { names.push_back(std::get<1>(r)); };
+    std::size_t num_rows = fix.conn.visit_some_rows<borrowed_row>(st, visitor);
+    BOOST_TEST(num_rows == 3u);
+    BOOST_TEST(names == (std::vector<string_view>{"abc", "de", "f"}));
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,317 @@
+//
+// Copyright (c) 2019-2023 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/wire_capture.hpp>
+
+#include <boost/mysql/impl/internal/wire_capture_stream.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test_common/printing.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+namespace asio = boost::asio;
+
+BOOST_AUTO_TEST_SUITE(test_wire_capture)
+
+// Removes the file on destruction
+struct temp_file
+{
+    std::string path;
+
+    temp_file(std::string p) : path(std::move(p)) {}
+    temp_file(const temp_file&) = delete;
+    temp_file& operator=(const temp_file&) = delete;
+    ~temp_file() { std::remove(path.c_str()); }
+};
+
+static std::vector<std::uint8_t> ping_request() { return create_frame(0, {0x0e}); }
+static std::vector<std::uint8_t> ping_response() { return create_ok_frame(1, ok_builder().build()); }
+
+// Reads the capture file's contents
+static std::vector<std::uint8_t> read_file(const std::string& path)
+{
+    std::vector<std::uint8_t> res;
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    BOOST_TEST_REQUIRE(f != nullptr);
+    int c = 0;
+    while ((c = std::fgetc(f)) != EOF)
+        res.push_back(static_cast<std::uint8_t>(c));
+    std::fclose(f);
+    return res;
+}
+
+static std::string to_string(asio::const_buffer buff)
+{
+    return std::string(static_cast<const char*>(buff.data()), buff.size());
+}
+
+BOOST_AUTO_TEST_CASE(capture_replay)
+{
+    // Record some events
+    temp_file file("boost_mysql_test_capture_replay.bin");
+    wire_capture capture;
+    BOOST_TEST(!capture.is_open());
+    BOOST_TEST(capture.open(file.path.c_str()) == error_code());
+    BOOST_TEST(capture.is_open());
+    capture.record(wire_event::connect);
+    capture.record(wire_event::write, asio::buffer("abc", 3));
+    capture.record(wire_event::read, asio::buffer("hello", 5));
+    capture.record(wire_event::read, asio::buffer("world", 5));
+    capture.record(wire_event::close);
+    capture.close();
+    BOOST_TEST(!capture.is_open());
+    BOOST_TEST(capture.error() == error_code());
+
+    // Load them
+    wire_replay replay;
+    BOOST_TEST(replay.load(file.path.c_str()) == error_code());
+    BOOST_TEST(replay.num_events() == 5u);
+    BOOST_TEST(!replay.finished());
+    BOOST_TEST(replay.writes_match());
+
+    // Reads respect the boundaries of the recorded events
+    char buff[3]{};
+    BOOST_TEST(replay.read(asio::buffer(buff)) == 3u);
+    BOOST_TEST(to_string(asio::buffer(buff, 3)) == "hel");
+    BOOST_TEST(replay.read(asio::buffer(buff)) == 2u);
+    BOOST_TEST(to_string(asio::buffer(buff, 2)) == "lo");
+    BOOST_TEST(replay.read(asio::buffer(buff)) == 3u);
+    BOOST_TEST(to_string(asio::buffer(buff, 3)) == "wor");
+    BOOST_TEST(replay.read(asio::buffer(buff)) == 2u);
+    BOOST_TEST(to_string(asio::buffer(buff, 2)) == "ld");
+    BOOST_TEST(replay.finished());
+    BOOST_TEST(replay.read(asio::buffer(buff)) == 0u);
+
+    // Writes are compared against the recorded ones
+    replay.write(asio::buffer("ab", 2));
+    BOOST_TEST(replay.writes_match());
+    replay.write(asio::buffer("c", 1));
+    BOOST_TEST(replay.writes_match());
+    replay.write(asio::buffer("d", 1));
+    BOOST_TEST(!replay.writes_match());
+
+    // Rewinding resets the state
+    replay.rewind();
+    BOOST_TEST(!replay.finished());
+    BOOST_TEST(replay.writes_match());
+    replay.write(asio::buffer("abx", 3));
+    BOOST_TEST(!replay.writes_match());
+}
+
+BOOST_AUTO_TEST_CASE(record_not_open)
+{
+    // Doesn't crash
+    wire_capture capture;
+    capture.record(wire_event::write, asio::buffer("abc", 3));
+    capture.close();
+}
+
+BOOST_AUTO_TEST_CASE(write_error)
+{
+    // Writing to /dev/full always fails with ENOSPC
+    std::FILE* probe = std::fopen("/dev/full", "wb");
+    if (!probe)
+        return;
+    std::fclose(probe);
+
+    wire_capture capture;
+    BOOST_TEST_REQUIRE(capture.open("/dev/full") == error_code());
+    BOOST_TEST(capture.error() == error_code());
+
+    // Write more than the stdio buffer size, so the error surfaces
+    std::vector<std::uint8_t> payload(1024u * 1024u, 0x42);
+    capture.record(wire_event::write, asio::buffer(payload));
+    capture.record(wire_event::write, asio::buffer(payload));
+    capture.close();
+    BOOST_TEST(capture.error() != error_code());
+
+    // Opening again clears the error
+    temp_file file("boost_mysql_test_write_error.bin");
+    BOOST_TEST_REQUIRE(capture.open(file.path.c_str()) == error_code());
+    BOOST_TEST(capture.error() == error_code());
+}
+
+BOOST_AUTO_TEST_CASE(open_error)
+{
+    wire_capture capture;
+    BOOST_TEST(capture.open("this/directory/does/not/exist/capture.bin") != error_code());
+    BOOST_TEST(!capture.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(load_file_error)
+{
+    wire_replay replay;
+    BOOST_TEST(replay.load("this/directory/does/not/exist/capture.bin") != error_code());
+    BOOST_TEST(replay.num_events() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(load_invalid)
+{
+    // A valid capture with a single write event
+    temp_file file("boost_mysql_test_load_invalid.bin");
+    wire_capture capture;
+    BOOST_TEST_REQUIRE(capture.open(file.path.c_str()) == error_code());
+    capture.record(wire_event::write, asio::buffer("abc", 3));
+    capture.close();
+    const auto contents = read_file(file.path);
+    BOOST_TEST_REQUIRE(contents.size() == 28u);  // 12 byte header, 13 byte event header, 3 byte payload
+
+    auto bad_magic = contents;
+    bad_magic[0] = 'X';
+    auto bad_version = contents;
+    bad_version[8] = 2;
+    auto bad_event_type = contents;
+    bad_event_type[12] = 0xff;
+
+    struct
+    {
+        const char* name;
+        std::vector<std::uint8_t> contents;
+        error_code expected;
+    } test_cases[] = {
+    // clang-format off
+        {"empty",             {},                                        client_errc::protocol_value_error},
+        {"header_truncated",  {contents.begin(), contents.begin() + 8},  client_errc::protocol_value_error},
+        {"bad_magic",         bad_magic,                                 client_errc::protocol_value_error},
+        {"bad_version",       bad_version,                               client_errc::protocol_value_error},
+        {"bad_event_type",    bad_event_type,                            client_errc::protocol_value_error},
+        {"event_truncated",   {contents.begin(), contents.begin() + 20}, client_errc::incomplete_message  },
+        {"payload_truncated", {contents.begin(), contents.end() - 1},    client_errc::incomplete_message  },
+    // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            wire_replay replay;
+            BOOST_TEST(replay.load(asio::buffer(tc.contents)) == tc.expected);
+            BOOST_TEST(replay.num_events() == 0u);
+            BOOST_TEST(replay.finished());
+        }
+    }
+
+    // The unmodified contents are valid
+    wire_replay replay;
+    BOOST_TEST(replay.load(asio::buffer(contents)) == error_code());
+    BOOST_TEST(replay.num_events() == 1u);
+}
+
+// The capturing stream records what the underlying stream transfers
+BOOST_AUTO_TEST_CASE(capturing_stream)
+{
+    // Setup. Use a replay as the underlying stream, since it doesn't need a server
+    asio::io_context ctx;
+    temp_file input_file("boost_mysql_test_capturing_stream_input.bin");
+    temp_file output_file("boost_mysql_test_capturing_stream_output.bin");
+    {
+        wire_capture input;
+        BOOST_TEST_REQUIRE(input.open(input_file.path.c_str()) == error_code());
+        input.record(wire_event::read, asio::buffer("hello", 5));
+    }
+    wire_replay input_replay;
+    BOOST_TEST_REQUIRE(input_replay.load(input_file.path.c_str()) == error_code());
+
+    wire_capture output;
+    BOOST_TEST_REQUIRE(output.open(output_file.path.c_str()) == error_code());
+    detail::capturing_stream stream(
+        std::unique_ptr<detail::any_stream>(new detail::replay_stream(ctx.get_executor(), input_replay)),
+        output
+    );
+
+    // Run some operations
+    error_code ec;
+    stream.connect(ec);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(stream.write_some(asio::buffer("abc", 3), false, ec) == 3u);
+    BOOST_TEST(ec == error_code());
+
+    char buff[16]{};
+    std::size_t bytes_read = 0u;
+    stream.async_read_some(asio::buffer(buff), false, [&](error_code ec, std::size_t n) {
+        BOOST_TEST(ec == error_code());
+        bytes_read = n;
+    });
+    BOOST_TEST(bytes_read == 0u);  // not completed inline
+    ctx.run();
+    BOOST_TEST(bytes_read == 5u);
+
+    // EOF reads are not recorded
+    BOOST_TEST(stream.read_some(asio::buffer(buff), false, ec) == 0u);
+    BOOST_TEST(ec == error_code(asio::error::eof));
+    stream.close(ec);
+    output.close();
+
+    // Verify the capture
+    wire_replay res;
+    BOOST_TEST_REQUIRE(res.load(output_file.path.c_str()) == error_code());
+    BOOST_TEST(res.num_events() == 4u);
+    BOOST_TEST(res.read(asio::buffer(buff)) == 5u);
+    BOOST_TEST(to_string(asio::buffer(buff, 5)) == "hello");
+    BOOST_TEST(res.finished());
+    res.write(asio::buffer("abc", 3));
+    BOOST_TEST(res.writes_match());
+}
+
+// A connection configured with a replay runs its algorithms against the recorded bytes
+BOOST_AUTO_TEST_CASE(any_connection_replay)
+{
+    // Setup
+    temp_file file("boost_mysql_test_any_connection_replay.bin");
+    {
+        wire_capture capture;
+        BOOST_TEST_REQUIRE(capture.open(file.path.c_str()) == error_code());
+        capture.record(wire_event::write, asio::buffer(ping_request()));
+        capture.record(wire_event::read, asio::buffer(ping_response()));
+    }
+    wire_replay replay;
+    BOOST_TEST_REQUIRE(replay.load(file.path.c_str()) == error_code());
+
+    asio::io_context ctx;
+    any_connection_params params;
+    params.replay = &replay;
+    any_connection conn(ctx, params);
+
+    // Sync
+    conn.ping();
+    BOOST_TEST(replay.finished());
+    BOOST_TEST(replay.writes_match());
+
+    // Async
+    replay.rewind();
+    error_code ec = client_errc::wrong_num_params;
+    conn.async_ping([&](error_code err) { ec = err; });
+    ctx.run();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(replay.finished());
+    BOOST_TEST(replay.writes_match());
+
+    // Once all reads have been served, reads fail
+    diagnostics diag;
+    conn.ping(ec, diag);
+    BOOST_TEST(ec == error_code(asio::error::eof));
+    BOOST_TEST(!replay.writes_match());
+}
+
+BOOST_AUTO_TEST_SUITE_END()